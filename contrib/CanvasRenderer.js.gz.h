@@ -0,0 +1,471 @@
+#pragma once
+
+unsigned char CanvasRenderer_js_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3c,
+  0x6d, 0x73, 0xdb, 0x36, 0xd2, 0x9f, 0xe5, 0x5f, 0x81, 0xeb, 0x87, 0x5a,
+  0xb6, 0x69, 0xd9, 0xa2, 0x9a, 0x7e, 0xb0, 0xea, 0xeb, 0x93, 0x38, 0x69,
+  0x92, 0x9b, 0xa4, 0xc9, 0xc4, 0x69, 0xd2, 0x4c, 0x26, 0x93, 0xa1, 0x24,
+  0xc8, 0xe6, 0x85, 0x22, 0x75, 0x24, 0x25, 0x8b, 0x79, 0xf9, 0xef, 0xb7,
+  0x8b, 0xf7, 0x37, 0x52, 0x72, 0x9a, 0xeb, 0x5d, 0x67, 0x9e, 0x4c, 0x6c,
+  0x93, 0xd8, 0xc5, 0x62, 0xb1, 0x00, 0xf6, 0x0d, 0x20, 0x4e, 0x0e, 0x0f,
+  0xf7, 0xc8, 0x21, 0xf9, 0xbf, 0x64, 0x55, 0x5f, 0x17, 0x25, 0x59, 0x94,
+  0xb3, 0xa2, 0x98, 0x90, 0x13, 0x72, 0x5d, 0xd7, 0xcb, 0xb3, 0x93, 0x13,
+  0xfe, 0x3e, 0x98, 0x16, 0x8b, 0x13, 0x40, 0x3b, 0xd9, 0xdb, 0x7b, 0xf9,
+  0xe8, 0xc5, 0x83, 0x07, 0x83, 0xcb, 0x65, 0x99, 0xd6, 0xf4, 0x22, 0xc9,
+  0xd7, 0x49, 0xf5, 0x34, 0xa9, 0x69, 0x99, 0x26, 0x19, 0x39, 0x27, 0xf3,
+  0x55, 0x3e, 0xad, 0xd3, 0x22, 0x27, 0x7d, 0xb2, 0x4c, 0xca, 0x64, 0x41,
+  0x01, 0x52, 0x91, 0x03, 0xf2, 0x69, 0x6f, 0xaf, 0xc7, 0x2b, 0x4a, 0xe4,
+  0xc1, 0x34, 0xc9, 0xb2, 0x3e, 0xa9, 0xaf, 0x53, 0x80, 0x8f, 0x01, 0x8c,
+  0x4f, 0x83, 0xba, 0x59, 0x52, 0x20, 0xb3, 0x1f, 0x22, 0xbf, 0xaf, 0xb0,
+  0xa6, 0x45, 0x06, 0x9c, 0x9e, 0x93, 0x9c, 0xde, 0x10, 0x4e, 0xf5, 0x02,
+  0x4b, 0xfa, 0xe4, 0x74, 0x33, 0x67, 0xff, 0x90, 0x22, 0x47, 0x5d, 0x96,
+  0xc5, 0x15, 0xf0, 0x61, 0xb3, 0x36, 0x2d, 0xf2, 0x9a, 0x6e, 0xea, 0x88,
+  0x70, 0x42, 0xc0, 0xde, 0x17, 0x45, 0xbb, 0xa2, 0xf5, 0xab, 0x24, 0x5b,
+  0xd1, 0xca, 0xee, 0x01, 0xc0, 0x11, 0xa7, 0xbd, 0xf3, 0xd8, 0x52, 0x5d,
+  0x08, 0xfe, 0x9f, 0x4d, 0xfe, 0x49, 0xa7, 0xf5, 0x60, 0x5a, 0x52, 0x80,
+  0xf6, 0x89, 0xd3, 0x73, 0x8d, 0x09, 0x64, 0x77, 0xa1, 0x08, 0x1d, 0xce,
+  0xab, 0xba, 0x5c, 0x4d, 0x6b, 0xd6, 0xed, 0xf6, 0x2a, 0x3b, 0x72, 0x38,
+  0x98, 0x66, 0x45, 0x4e, 0x2d, 0x99, 0xf0, 0x21, 0x5a, 0x27, 0x30, 0x01,
+  0xf4, 0x68, 0x6a, 0xf9, 0x86, 0xe8, 0xf5, 0xd9, 0xb0, 0x2d, 0xd4, 0x78,
+  0x16, 0xcb, 0x46, 0x8f, 0xa7, 0x59, 0x0e, 0x32, 0x36, 0xa0, 0x62, 0xf4,
+  0x2c, 0x1c, 0x3d, 0x4a, 0xe6, 0xa0, 0x21, 0xf9, 0x92, 0xd6, 0xab, 0x32,
+  0x57, 0x4c, 0x89, 0x61, 0x38, 0x51, 0xf3, 0x90, 0xb3, 0xf4, 0x82, 0xe6,
+  0x33, 0x5a, 0xd2, 0x72, 0xcb, 0x0c, 0x44, 0x31, 0x16, 0x19, 0x1d, 0x64,
+  0xc5, 0x55, 0x9f, 0xec, 0x87, 0x08, 0xec, 0x47, 0xa2, 0xc3, 0x2f, 0x1e,
+  0xbc, 0x7a, 0x7c, 0xf9, 0xf8, 0xd9, 0xaf, 0x7c, 0x6e, 0x1a, 0x94, 0xce,
+  0x4d, 0xb2, 0x9f, 0x3f, 0x8b, 0xa9, 0x83, 0x82, 0x7b, 0xcf, 0xfa, 0xce,
+  0xbb, 0x10, 0xed, 0xf5, 0xde, 0x97, 0x8c, 0xe6, 0xfd, 0xa4, 0x4e, 0x22,
+  0xf2, 0x9e, 0x66, 0x74, 0x41, 0xf3, 0xba, 0x82, 0xc7, 0x2c, 0xbd, 0xba,
+  0xae, 0x19, 0x06, 0xf4, 0x13, 0xe7, 0x89, 0x33, 0x97, 0x9f, 0xcb, 0xd2,
+  0xfe, 0x41, 0x04, 0xa4, 0xdf, 0x4f, 0x19, 0x87, 0x56, 0xc3, 0x03, 0x51,
+  0xf6, 0xb7, 0xf3, 0x73, 0xb2, 0x82, 0x56, 0xe6, 0x69, 0x4e, 0x67, 0x7b,
+  0xbd, 0x5e, 0x8f, 0xfc, 0xec, 0x63, 0xb1, 0xf2, 0x33, 0x32, 0x2b, 0xa6,
+  0x2b, 0x64, 0x41, 0xcc, 0xca, 0x07, 0x9c, 0x21, 0x90, 0x03, 0xc7, 0xda,
+  0x27, 0x66, 0x6b, 0xaf, 0xd3, 0x59, 0x7d, 0x0d, 0x4d, 0x8a, 0xd7, 0xc1,
+  0x0d, 0xbe, 0x47, 0x0a, 0xfc, 0x88, 0x62, 0x1f, 0x0c, 0xf8, 0x35, 0x2b,
+  0x88, 0xec, 0xfa, 0x8f, 0x92, 0x6c, 0x0e, 0x38, 0x30, 0x5f, 0xae, 0x07,
+  0xf3, 0xac, 0xc0, 0x05, 0x6a, 0x91, 0x3f, 0x21, 0x31, 0x36, 0x6a, 0x13,
+  0x6d, 0xaf, 0x24, 0x1a, 0x15, 0xb5, 0xa0, 0xda, 0x3a, 0xa5, 0x37, 0xcb,
+  0xa2, 0xac, 0x7f, 0x07, 0xfc, 0xd3, 0xc8, 0x28, 0x78, 0xe3, 0x16, 0x38,
+  0xdd, 0x79, 0x2d, 0x7b, 0x23, 0xe1, 0x6e, 0x7f, 0x1e, 0x89, 0xee, 0xe0,
+  0x18, 0xa5, 0x1b, 0x9a, 0xbd, 0x48, 0x60, 0x4a, 0x01, 0x78, 0xc8, 0x45,
+  0xc4, 0xd5, 0x87, 0xd1, 0xfd, 0x2b, 0x5a, 0x5f, 0xf0, 0x42, 0x90, 0x67,
+  0x3c, 0x83, 0x59, 0xf4, 0x09, 0xa4, 0x9e, 0x64, 0xcb, 0xeb, 0xe4, 0xcc,
+  0x1c, 0x10, 0x56, 0x42, 0xce, 0x61, 0xd4, 0x60, 0x35, 0xd3, 0xbd, 0xde,
+  0x17, 0x29, 0xf4, 0x8c, 0x26, 0xe5, 0x45, 0xbb, 0x56, 0x3b, 0x65, 0xff,
+  0x84, 0xb0, 0x10, 0xf7, 0x2e, 0x27, 0xd4, 0x4e, 0x1b, 0x26, 0xc2, 0x29,
+  0x0c, 0xba, 0xc5, 0xf0, 0xc3, 0xac, 0x98, 0x24, 0x99, 0xac, 0x3a, 0x8c,
+  0x5c, 0xc8, 0x45, 0xb1, 0x58, 0x16, 0x15, 0xac, 0xf3, 0x67, 0x4b, 0x5a,
+  0x26, 0x6c, 0x11, 0x09, 0x39, 0x0a, 0xb4, 0xcb, 0xba, 0x2c, 0x3e, 0xd0,
+  0xcb, 0xba, 0xc9, 0x50, 0x79, 0xe4, 0xab, 0x2c, 0x33, 0x80, 0xbf, 0xa4,
+  0x59, 0xd6, 0x02, 0x7a, 0x02, 0xd3, 0x53, 0x0e, 0x41, 0x00, 0x74, 0x91,
+  0x2c, 0xc3, 0x80, 0x7f, 0x14, 0x69, 0x1e, 0x86, 0xdc, 0x4f, 0x2a, 0x24,
+  0xf6, 0xf6, 0x9d, 0x98, 0xb3, 0x0b, 0x60, 0x98, 0xcf, 0x89, 0x21, 0xac,
+  0xb0, 0x75, 0x8c, 0xbf, 0x46, 0xf8, 0xeb, 0x07, 0x36, 0xcc, 0x77, 0x2c,
+  0xb1, 0xf2, 0xc5, 0x9e, 0x4c, 0x32, 0xfa, 0x8a, 0x96, 0x40, 0xb1, 0xcf,
+  0xe4, 0xba, 0xfe, 0x71, 0x2b, 0x12, 0xa3, 0xbf, 0x41, 0xb2, 0xc3, 0x86,
+  0x35, 0xc3, 0x9e, 0x63, 0xf6, 0x3c, 0x62, 0xcf, 0xa3, 0x86, 0x91, 0xfa,
+  0x81, 0xbd, 0xfc, 0xc0, 0x00, 0x77, 0xd8, 0xf3, 0x1d, 0xf6, 0xfc, 0x23,
+  0x7b, 0xfe, 0xb1, 0x11, 0xa3, 0x12, 0x1e, 0x6f, 0x3e, 0xca, 0xf8, 0x38,
+  0xec, 0x84, 0xc6, 0x9d, 0xd0, 0x51, 0x27, 0xf4, 0x87, 0x30, 0x14, 0xc0,
+  0xb3, 0x74, 0x3e, 0x5f, 0x55, 0xf4, 0xa2, 0x8b, 0x39, 0xba, 0x48, 0xab,
+  0x2a, 0x5d, 0x77, 0x21, 0x01, 0x16, 0xd3, 0x73, 0xdd, 0x28, 0xcb, 0xa4,
+  0x86, 0xb9, 0x9b, 0xa3, 0x72, 0xfb, 0xf4, 0x85, 0x95, 0xa4, 0x8b, 0xe4,
+  0x8a, 0x82, 0x90, 0x56, 0x6b, 0xa6, 0x21, 0x57, 0x5c, 0xde, 0x2b, 0x2e,
+  0xf0, 0x15, 0x97, 0xf8, 0x8a, 0x8b, 0x7c, 0xc5, 0x65, 0xbe, 0x62, 0x42,
+  0x67, 0x0b, 0x23, 0x5d, 0xde, 0x2b, 0x36, 0x56, 0x63, 0xf0, 0x1e, 0xf7,
+  0xf5, 0xb2, 0x69, 0x07, 0xa3, 0x7e, 0x6e, 0x83, 0x02, 0x38, 0x59, 0x4c,
+  0x52, 0xd0, 0x96, 0x4f, 0x84, 0x9a, 0x08, 0x4a, 0x65, 0x96, 0x96, 0x94,
+  0x99, 0x9e, 0x24, 0x63, 0x78, 0x55, 0x1b, 0xe2, 0x12, 0xa6, 0x75, 0xdd,
+  0x85, 0x82, 0x53, 0x88, 0x59, 0x00, 0x7b, 0x10, 0x5f, 0xf1, 0x32, 0xc0,
+  0x20, 0x27, 0x27, 0xe4, 0x57, 0x4a, 0x67, 0x74, 0x46, 0xe6, 0x20, 0xde,
+  0xe7, 0x8a, 0x20, 0x76, 0x14, 0xf8, 0x2c, 0x8b, 0x74, 0xd6, 0x52, 0x15,
+  0x30, 0xf2, 0xa2, 0x5c, 0x38, 0xf6, 0x3d, 0x00, 0x7f, 0x05, 0xba, 0x11,
+  0xb4, 0x70, 0x99, 0xda, 0x42, 0xe1, 0x45, 0x23, 0x6e, 0xfc, 0x4f, 0x0e,
+  0xc9, 0xcb, 0x67, 0xf7, 0x9f, 0x29, 0x15, 0x3e, 0x58, 0x14, 0x1f, 0x1f,
+  0xe3, 0x08, 0x5e, 0x2e, 0x8a, 0x02, 0xec, 0x60, 0x7e, 0xf5, 0x20, 0xc7,
+  0x25, 0x84, 0xcc, 0xcc, 0x93, 0xac, 0xa2, 0x63, 0x8d, 0x7a, 0x43, 0x27,
+  0x1f, 0xd2, 0x7a, 0x57, 0xec, 0x45, 0xb5, 0x2b, 0x66, 0xba, 0x05, 0x0f,
+  0x7d, 0xd8, 0x1e, 0xc8, 0x6f, 0x06, 0x2a, 0xe4, 0xe8, 0x0a, 0x54, 0x0f,
+  0x00, 0xb2, 0x49, 0x32, 0xfd, 0x50, 0x31, 0x59, 0xfe, 0x02, 0xa3, 0x38,
+  0x87, 0x89, 0x90, 0xe4, 0x33, 0x42, 0xd7, 0xb4, 0x6c, 0x18, 0x19, 0x42,
+  0xa1, 0x32, 0xd4, 0x4b, 0xe7, 0x04, 0xed, 0x11, 0x57, 0x44, 0xe8, 0x2b,
+  0x6a, 0x65, 0x64, 0x9a, 0x62, 0xe1, 0x6f, 0xf4, 0xc2, 0x98, 0xb6, 0xdb,
+  0xc5, 0xfc, 0x87, 0x2f, 0xd2, 0xfd, 0x9c, 0x15, 0x0b, 0x61, 0x99, 0xb5,
+  0x79, 0x51, 0xbe, 0x29, 0xb8, 0xe8, 0xc5, 0x05, 0xce, 0x63, 0xc2, 0x95,
+  0xbc, 0x74, 0x72, 0x2b, 0x30, 0x61, 0xdc, 0xe5, 0xac, 0x02, 0x10, 0x41,
+  0x4f, 0x83, 0x04, 0x2c, 0xcd, 0xe7, 0x68, 0xd3, 0x18, 0xa3, 0xdc, 0x57,
+  0x39, 0xe3, 0x2f, 0x3d, 0xe8, 0x76, 0x9d, 0x4e, 0x69, 0x75, 0xc6, 0xb4,
+  0x7f, 0xaf, 0x37, 0x4f, 0xf8, 0x0b, 0x02, 0x91, 0x53, 0xc6, 0x32, 0x88,
+  0xf0, 0x35, 0x9d, 0x3c, 0x7c, 0xa2, 0x7c, 0x2f, 0x08, 0x11, 0x60, 0x3d,
+  0xa7, 0x93, 0x34, 0x4b, 0xeb, 0x46, 0xb9, 0xd3, 0xab, 0x25, 0x1a, 0xd8,
+  0x8a, 0x2b, 0xd1, 0x97, 0x20, 0x8b, 0x55, 0x49, 0xab, 0x80, 0x0c, 0x94,
+  0xf7, 0xfd, 0x0b, 0x34, 0x76, 0x01, 0x1a, 0x1f, 0xa5, 0x1e, 0x12, 0x15,
+  0xb4, 0x7b, 0xf7, 0xf9, 0x63, 0x49, 0x5f, 0x5b, 0xde, 0x80, 0x3b, 0x2b,
+  0xbd, 0x47, 0x39, 0x0c, 0x63, 0xc9, 0xbb, 0x53, 0xf5, 0x6e, 0x0d, 0x73,
+  0x7a, 0xb2, 0xaa, 0x7d, 0xc6, 0x02, 0x44, 0x82, 0xf5, 0xf8, 0x72, 0xb0,
+  0x68, 0x3f, 0x37, 0x1d, 0x87, 0x56, 0xa2, 0xda, 0xbd, 0xb0, 0x09, 0x54,
+  0xad, 0x04, 0xc8, 0x1a, 0xc3, 0x13, 0x39, 0xc3, 0xd8, 0x84, 0xe4, 0x25,
+  0x7f, 0x73, 0x66, 0xa0, 0xed, 0xba, 0x30, 0x1c, 0xaf, 0x8d, 0xcb, 0xf4,
+  0xa3, 0x1d, 0x07, 0x10, 0xee, 0xe9, 0x11, 0xe1, 0xd0, 0x91, 0xd5, 0x72,
+  0x06, 0xce, 0x22, 0xb7, 0xeb, 0x6a, 0x52, 0x5b, 0x2e, 0x22, 0xab, 0x00,
+  0x01, 0xa4, 0xd5, 0x95, 0x9e, 0xe7, 0x29, 0x72, 0x82, 0x2e, 0x9e, 0x46,
+  0xe4, 0x2e, 0xa6, 0xe3, 0xa3, 0x19, 0x84, 0x84, 0x8b, 0xe9, 0xfa, 0x68,
+  0x63, 0x97, 0xa3, 0x9d, 0x9c, 0x4e, 0x8f, 0xc1, 0xdd, 0xbc, 0xce, 0xb1,
+  0x92, 0xb8, 0x29, 0x16, 0x94, 0x3b, 0x53, 0x2e, 0x52, 0x40, 0x8a, 0xe5,
+  0x0a, 0xe1, 0xaa, 0x63, 0xfc, 0xef, 0x11, 0xd9, 0x5f, 0x6e, 0xf6, 0xc7,
+  0x3e, 0xda, 0xb5, 0x23, 0x29, 0x89, 0x28, 0xd6, 0x9c, 0xb2, 0x6f, 0x83,
+  0x45, 0x9a, 0xe3, 0xd0, 0xf5, 0xc9, 0x31, 0x71, 0x3b, 0x1e, 0xe9, 0x32,
+  0xa3, 0x5f, 0xa2, 0xbb, 0xb2, 0x7a, 0xb2, 0xe1, 0xd5, 0x49, 0xa0, 0x3a,
+  0x09, 0x57, 0xe7, 0xf5, 0xb9, 0x01, 0xfd, 0xfa, 0xf6, 0x65, 0xfd, 0xaf,
+  0x65, 0x20, 0xe8, 0xc5, 0x8e, 0x3d, 0x50, 0xd8, 0x8d, 0x35, 0xf1, 0x7c,
+  0x3f, 0xd6, 0x84, 0xba, 0x8e, 0xac, 0x09, 0x73, 0x3d, 0x59, 0x17, 0xa6,
+  0x5d, 0x59, 0x17, 0x62, 0xf8, 0xb2, 0xac, 0x3b, 0x2a, 0xd9, 0x20, 0x42,
+  0x10, 0x70, 0xf3, 0x23, 0xfc, 0x6f, 0xad, 0x3f, 0x72, 0xe0, 0xad, 0x58,
+  0x89, 0x6f, 0xaf, 0x5a, 0x70, 0x84, 0x1a, 0xaf, 0xae, 0x58, 0xae, 0x66,
+  0x98, 0xb4, 0x09, 0x2c, 0x54, 0x33, 0x6a, 0x6a, 0x42, 0x0b, 0xd4, 0x8d,
+  0xa2, 0xda, 0x56, 0xbc, 0x17, 0x4d, 0xb5, 0xad, 0x79, 0x5b, 0x05, 0x4d,
+  0xc1, 0x99, 0x2c, 0xca, 0x2e, 0x93, 0x20, 0x50, 0x5e, 0xd2, 0xaa, 0x0e,
+  0x9a, 0x04, 0x89, 0x77, 0x61, 0x86, 0x51, 0x56, 0xbe, 0x07, 0x8a, 0x22,
+  0xc2, 0x23, 0x24, 0xa5, 0xc5, 0x14, 0x32, 0x9f, 0x8d, 0x3a, 0x2d, 0xe1,
+  0xc4, 0x58, 0xbc, 0x9a, 0xad, 0x5d, 0x7f, 0x16, 0xa5, 0x67, 0x38, 0x01,
+  0xff, 0x07, 0x56, 0x47, 0x8b, 0x18, 0x1e, 0xd1, 0x8d, 0x2d, 0x89, 0x6b,
+  0xba, 0x71, 0xe4, 0x20, 0x73, 0x22, 0x37, 0x49, 0x99, 0xb7, 0x24, 0x45,
+  0xce, 0x88, 0x47, 0x15, 0x44, 0x9f, 0x56, 0x64, 0x42, 0xd1, 0x48, 0x97,
+  0x74, 0x51, 0xac, 0xe9, 0x6c, 0x40, 0x7e, 0x03, 0x15, 0x68, 0x63, 0x22,
+  0x5a, 0x5e, 0xd5, 0x34, 0x99, 0x0d, 0xf6, 0x79, 0x47, 0x7d, 0x1e, 0x6d,
+  0xa6, 0x7c, 0x13, 0x1d, 0x1e, 0x53, 0xd7, 0x36, 0x2b, 0xac, 0x30, 0x01,
+  0x39, 0x96, 0xdd, 0x04, 0x18, 0x96, 0x47, 0xe0, 0x69, 0xb2, 0xb9, 0x9b,
+  0xa7, 0x55, 0x01, 0x4a, 0x63, 0xd9, 0x74, 0xd0, 0x38, 0xb5, 0x6b, 0x4e,
+  0x85, 0xa3, 0xe6, 0xa1, 0x0b, 0x1f, 0x52, 0x0e, 0x78, 0x5a, 0x3d, 0x58,
+  0x2c, 0xeb, 0x06, 0xa0, 0xe7, 0x01, 0x43, 0xa2, 0xb0, 0x72, 0x0c, 0xf2,
+  0xc1, 0xc3, 0x63, 0x55, 0x79, 0xa0, 0x73, 0x30, 0xb6, 0x71, 0xe8, 0x66,
+  0x09, 0x5e, 0xeb, 0xbd, 0xe6, 0x72, 0x9a, 0x64, 0x09, 0xc8, 0x55, 0x5a,
+  0x2c, 0x67, 0x76, 0x6e, 0x98, 0x0d, 0xb5, 0x4b, 0x8e, 0xbc, 0xc9, 0x36,
+  0xf6, 0x2b, 0x62, 0xe7, 0xd9, 0x14, 0xb6, 0x0b, 0x8f, 0xfc, 0x49, 0x39,
+  0xee, 0xa1, 0x9b, 0x76, 0x0d, 0xaf, 0xe0, 0x17, 0x36, 0xd2, 0x3f, 0x71,
+  0x28, 0xc2, 0x44, 0x77, 0x58, 0x61, 0x25, 0xdb, 0x59, 0x01, 0x34, 0x9f,
+  0x15, 0x56, 0xd8, 0xca, 0x4a, 0x56, 0xdc, 0x58, 0x9c, 0x20, 0x45, 0x63,
+  0x1c, 0xf8, 0xf4, 0xf8, 0x89, 0x0c, 0x95, 0xe4, 0xb5, 0xeb, 0xce, 0x10,
+  0x5e, 0xa0, 0xe4, 0x59, 0xb9, 0x27, 0xcc, 0xcf, 0xc2, 0x49, 0xf6, 0x59,
+  0xd4, 0x90, 0xbe, 0xd7, 0xcb, 0x63, 0x6f, 0x08, 0x0e, 0xda, 0xf0, 0x99,
+  0x90, 0xfd, 0xbe, 0x32, 0x7c, 0x86, 0x2e, 0x46, 0xf9, 0x4b, 0xb8, 0x57,
+  0x7f, 0x27, 0xa7, 0xba, 0x57, 0xb0, 0xf2, 0xee, 0x65, 0xb0, 0xac, 0x61,
+  0xdd, 0xca, 0xb4, 0xf4, 0xaf, 0x2c, 0xda, 0x93, 0xa5, 0x62, 0x52, 0x21,
+  0xe2, 0xb3, 0x65, 0x32, 0x05, 0x4f, 0xbe, 0x8f, 0x52, 0x19, 0xab, 0xea,
+  0xca, 0x3a, 0x82, 0xb2, 0x28, 0xaf, 0x26, 0x49, 0x7f, 0x1f, 0xa4, 0x6e,
+  0xfb, 0x4d, 0x5a, 0xb1, 0x96, 0xa0, 0xfb, 0xe3, 0x3b, 0x77, 0xa0, 0x7d,
+  0xf0, 0x66, 0xa2, 0x2e, 0xcc, 0xab, 0x9d, 0x31, 0x27, 0x1e, 0xa6, 0xd9,
+  0x5b, 0x28, 0x3b, 0xd8, 0x57, 0xfc, 0xaa, 0x41, 0x9c, 0x03, 0xd7, 0x7f,
+  0x9d, 0x31, 0x34, 0xd1, 0x3e, 0x50, 0xa1, 0x1e, 0xc6, 0x6e, 0xf4, 0x15,
+  0x8c, 0xb7, 0xa6, 0xad, 0xea, 0x52, 0x19, 0x54, 0x86, 0x72, 0x9f, 0x2e,
+  0xeb, 0xeb, 0x6e, 0x94, 0xcb, 0x9a, 0xe6, 0xd3, 0x34, 0x6b, 0xb7, 0xb8,
+  0x3c, 0x68, 0xb4, 0x0d, 0x4c, 0x35, 0xa5, 0x39, 0x8d, 0x08, 0xcf, 0xc8,
+  0x59, 0x41, 0x8a, 0x28, 0x42, 0x7b, 0x90, 0xe4, 0x53, 0x5a, 0xcc, 0x65,
+  0xd6, 0x83, 0x97, 0xfb, 0xca, 0x4f, 0x5a, 0x26, 0x5a, 0x96, 0x38, 0x07,
+  0x82, 0xa6, 0x69, 0x20, 0x03, 0x57, 0x49, 0xbd, 0x22, 0x79, 0x51, 0x43,
+  0xf0, 0xae, 0xda, 0x21, 0x4e, 0x43, 0xd2, 0x10, 0x09, 0xad, 0xad, 0xfd,
+  0x6b, 0xc6, 0xa4, 0x1b, 0x66, 0xcb, 0x6c, 0xea, 0x01, 0xd1, 0x72, 0x11,
+  0x43, 0xf1, 0x5e, 0x05, 0xd1, 0x82, 0x89, 0x81, 0x0c, 0x9b, 0x95, 0xbb,
+  0xe9, 0x61, 0xb0, 0x40, 0x9a, 0x83, 0x9d, 0xec, 0xc0, 0xcb, 0x32, 0xc9,
+  0xab, 0x39, 0x2c, 0x45, 0x98, 0x36, 0xb6, 0xbf, 0x75, 0x62, 0x67, 0xad,
+  0x85, 0x9b, 0x78, 0x4c, 0x5c, 0x77, 0xeb, 0xc4, 0x49, 0x5e, 0x6b, 0x84,
+  0xdf, 0x23, 0x27, 0x98, 0x31, 0x2a, 0xbf, 0x91, 0xfe, 0x87, 0x60, 0xa5,
+  0x46, 0x3e, 0x32, 0xb6, 0x6b, 0xe5, 0xbb, 0x1f, 0xad, 0xae, 0xb9, 0xde,
+  0xea, 0x40, 0x85, 0xae, 0xb6, 0x35, 0x06, 0xe2, 0xe9, 0x12, 0x27, 0x85,
+  0x33, 0x37, 0x22, 0xe2, 0xa6, 0x2e, 0x8c, 0x12, 0x95, 0xb2, 0xe0, 0xcc,
+  0x51, 0x9d, 0xc1, 0x30, 0x9a, 0x1a, 0xc8, 0x62, 0x86, 0x93, 0xc9, 0x7c,
+  0x9a, 0x89, 0xc1, 0x0b, 0x45, 0xb4, 0xc7, 0xa7, 0x99, 0x68, 0x9e, 0xf3,
+  0xed, 0x66, 0xba, 0xd0, 0xdc, 0x73, 0x7d, 0xc8, 0xdf, 0xe5, 0xac, 0x85,
+  0x75, 0x88, 0xaf, 0xaf, 0x8b, 0x32, 0x9b, 0x3d, 0xce, 0xd7, 0x68, 0x89,
+  0x45, 0xd7, 0x4f, 0x0e, 0xc9, 0xfd, 0x07, 0xf7, 0x7e, 0x7b, 0xb8, 0x17,
+  0x56, 0x8e, 0x38, 0x54, 0xa0, 0xac, 0xc4, 0xaf, 0xd3, 0x01, 0xa8, 0xad,
+  0x7d, 0x47, 0xe2, 0x4a, 0x35, 0x11, 0x2b, 0xc2, 0xc3, 0xd4, 0xa6, 0xf9,
+  0xde, 0x98, 0xef, 0x5a, 0xfd, 0xb4, 0x54, 0x60, 0xda, 0xc5, 0x41, 0x68,
+  0x78, 0xc3, 0x2c, 0xff, 0xd5, 0x03, 0x17, 0x61, 0xba, 0xc2, 0x71, 0xe6,
+  0x79, 0x48, 0x31, 0xa7, 0x31, 0x01, 0x86, 0xe9, 0x84, 0x92, 0x50, 0x96,
+  0xfa, 0x27, 0x14, 0x97, 0xbf, 0x92, 0xff, 0x00, 0x8c, 0xc4, 0x15, 0x44,
+  0xe5, 0x00, 0xfd, 0x09, 0x40, 0xf8, 0xf7, 0xe8, 0x48, 0xad, 0x57, 0x56,
+  0x4d, 0xe7, 0xae, 0x64, 0xa5, 0xb7, 0x80, 0xf5, 0x6e, 0xac, 0x30, 0x8c,
+  0xed, 0x45, 0x81, 0x31, 0x30, 0x36, 0xf7, 0xa4, 0x01, 0xd3, 0x58, 0x96,
+  0xdb, 0xfd, 0xf9, 0xb3, 0x82, 0x0c, 0x0a, 0x6e, 0x9e, 0x18, 0x06, 0x5a,
+  0x38, 0x94, 0x67, 0x9a, 0xf3, 0x1c, 0x47, 0x4f, 0x25, 0x74, 0x3d, 0x0d,
+  0xca, 0xe9, 0x4b, 0x3e, 0x3d, 0x6d, 0xa4, 0xd3, 0xfe, 0x7c, 0xcb, 0xd3,
+  0x70, 0x08, 0xd6, 0x43, 0xcd, 0xf3, 0x58, 0x16, 0xc1, 0x38, 0x1c, 0x9e,
+  0xfb, 0x1e, 0x0b, 0x6e, 0x11, 0x80, 0xc0, 0x0f, 0xcf, 0x03, 0x0e, 0x09,
+  0x27, 0xc7, 0x67, 0x29, 0x6f, 0x04, 0xd7, 0xfc, 0x30, 0x92, 0xb4, 0x23,
+  0xdd, 0x7b, 0x69, 0x15, 0x58, 0xfa, 0x91, 0xec, 0xca, 0x39, 0x86, 0x9b,
+  0x2d, 0x7c, 0x0f, 0xd6, 0x43, 0xe4, 0x2d, 0x36, 0x4b, 0xe2, 0xb1, 0x42,
+  0x1c, 0xb0, 0xc0, 0x19, 0x34, 0xf9, 0xe5, 0xb4, 0xa4, 0x34, 0xef, 0xea,
+  0x9c, 0x83, 0xd9, 0xd6, 0x57, 0x4e, 0x38, 0xde, 0x99, 0x70, 0xbc, 0x2b,
+  0x61, 0x4e, 0x59, 0x8e, 0x32, 0xae, 0xbd, 0xb2, 0x58, 0xb0, 0x44, 0x78,
+  0xd5, 0x27, 0x6f, 0x85, 0x31, 0xf7, 0xf8, 0x94, 0x56, 0xde, 0x6b, 0x87,
+  0x95, 0xbf, 0x53, 0x8e, 0x83, 0xf4, 0xa2, 0xf8, 0xea, 0x51, 0xce, 0x77,
+  0x05, 0x6f, 0x7d, 0xa2, 0x36, 0x0b, 0x0e, 0x4c, 0x03, 0x21, 0xc4, 0x2d,
+  0x06, 0x16, 0xc7, 0x40, 0x0c, 0x2b, 0xdb, 0x8e, 0x6a, 0x1d, 0x5b, 0x61,
+  0xf2, 0x6f, 0x39, 0xc4, 0x98, 0x24, 0xbd, 0xd5, 0x10, 0xe3, 0xde, 0x94,
+  0x59, 0x32, 0xb2, 0x3a, 0xea, 0x8f, 0xe7, 0x47, 0x58, 0xe1, 0xc7, 0xe0,
+  0xf9, 0xc1, 0x8a, 0x0b, 0x42, 0xff, 0xce, 0x7c, 0x65, 0xbd, 0xe6, 0x0c,
+  0x5a, 0x71, 0x27, 0xad, 0xf8, 0x56, 0xb4, 0x46, 0x9d, 0xb4, 0x46, 0xdb,
+  0x69, 0xfd, 0x05, 0x67, 0x36, 0x27, 0x3c, 0xda, 0x99, 0xf0, 0xe8, 0x56,
+  0x4b, 0xc6, 0x52, 0xaf, 0x03, 0x08, 0xdc, 0xcb, 0x59, 0x99, 0xdc, 0xd8,
+  0x51, 0x42, 0x8f, 0x47, 0x92, 0xa1, 0x89, 0x11, 0x05, 0x7a, 0x12, 0x05,
+  0xe8, 0x89, 0x30, 0xc2, 0xa0, 0x14, 0x07, 0x28, 0x8d, 0xbe, 0x8a, 0xd2,
+  0x28, 0x40, 0x69, 0xb8, 0x1b, 0x25, 0x63, 0xc5, 0x7d, 0x43, 0xe5, 0xa1,
+  0x00, 0xa3, 0xff, 0xb0, 0x56, 0xc1, 0x65, 0x3f, 0x32, 0xd5, 0x0a, 0xdb,
+  0xe5, 0x06, 0x3b, 0x0d, 0xef, 0xbb, 0x28, 0x19, 0xf6, 0xdb, 0x70, 0x59,
+  0x7a, 0x62, 0x5f, 0x8a, 0xcd, 0x27, 0x11, 0xe8, 0xf1, 0x52, 0x23, 0x45,
+  0xea, 0xf9, 0x32, 0xa7, 0xb6, 0x27, 0x63, 0xf8, 0xb1, 0xac, 0x92, 0x70,
+  0x66, 0x94, 0x01, 0x16, 0xbe, 0x89, 0xf9, 0xde, 0x98, 0xef, 0xd2, 0x99,
+  0x69, 0xad, 0x20, 0x9d, 0x19, 0x8b, 0x82, 0x68, 0x9b, 0x7b, 0x33, 0x46,
+  0xc4, 0xb4, 0xca, 0x41, 0xfa, 0xa6, 0x34, 0xb5, 0x87, 0x6f, 0xfb, 0x6a,
+  0x7e, 0xbf, 0x5b, 0xba, 0xad, 0xfa, 0xdc, 0xe2, 0xc0, 0x59, 0xbd, 0xb6,
+  0x03, 0xc2, 0xc8, 0x8d, 0x01, 0xa3, 0xed, 0x41, 0x64, 0xe4, 0x45, 0x89,
+  0x7e, 0xca, 0xc5, 0x70, 0xe4, 0x5a, 0x82, 0x88, 0xa1, 0x64, 0x59, 0x3c,
+  0x18, 0x99, 0x35, 0x3c, 0x3c, 0xd5, 0x53, 0x21, 0x9b, 0xe7, 0x08, 0x8a,
+  0xf4, 0xa8, 0xb9, 0xe3, 0x8d, 0xb4, 0x5f, 0x3c, 0xbc, 0x27, 0x53, 0xd4,
+  0xa7, 0x42, 0x00, 0xde, 0x86, 0x77, 0x0b, 0x9e, 0xb1, 0xdf, 0x1d, 0xc2,
+  0xb0, 0xfc, 0xce, 0x8c, 0xfb, 0x9d, 0x19, 0xf3, 0x3b, 0xb9, 0xfb, 0xae,
+  0xbc, 0xce, 0x0c, 0x74, 0x7f, 0x96, 0xe1, 0x5f, 0xc7, 0xeb, 0xcc, 0xe4,
+  0xce, 0x10, 0xaf, 0xf0, 0x16, 0x30, 0xde, 0x8d, 0x2d, 0xa0, 0x8c, 0x88,
+  0xd9, 0x0b, 0x3f, 0x81, 0x66, 0x78, 0x83, 0xbc, 0xbe, 0x67, 0x6e, 0xef,
+  0x9a, 0x9b, 0xfe, 0xda, 0xd8, 0x5a, 0x92, 0x49, 0x66, 0xb3, 0xbe, 0xd9,
+  0x44, 0xc0, 0x63, 0x6b, 0xa1, 0x7e, 0xdf, 0x91, 0x9e, 0x6e, 0x01, 0x62,
+  0x7b, 0x14, 0x48, 0xc5, 0x7c, 0xc3, 0x4a, 0xb4, 0xea, 0x0b, 0xfb, 0xeb,
+  0x9b, 0xd6, 0xe7, 0x05, 0xb6, 0x34, 0x6a, 0x8e, 0x5c, 0x5b, 0x73, 0x2a,
+  0x2d, 0xd1, 0x3e, 0xab, 0xfa, 0x44, 0xaa, 0xc5, 0x88, 0xf0, 0x90, 0xcb,
+  0x38, 0x7a, 0xf9, 0x1f, 0x1b, 0x7f, 0xa6, 0x17, 0x34, 0xc3, 0xe2, 0x08,
+  0xa2, 0x31, 0x03, 0xc8, 0xc1, 0xf6, 0x39, 0xd0, 0x3e, 0x4a, 0xaa, 0xe1,
+  0xe7, 0xa2, 0x6f, 0xc8, 0x80, 0x38, 0xb6, 0x21, 0x4d, 0x0a, 0x8f, 0x22,
+  0x25, 0x82, 0x6c, 0xdc, 0x08, 0x26, 0xc9, 0xc1, 0x80, 0x0b, 0x24, 0xfd,
+  0x48, 0x65, 0x80, 0xc2, 0x28, 0x27, 0x8b, 0x62, 0xc5, 0xe2, 0x28, 0x0e,
+  0x1e, 0xcc, 0x8a, 0xba, 0xef, 0x34, 0x67, 0x59, 0x15, 0x81, 0xff, 0x53,
+  0x28, 0x16, 0xea, 0x09, 0xe0, 0xa1, 0x9c, 0xff, 0x68, 0x79, 0x72, 0xa0,
+  0xd2, 0x08, 0x38, 0x3f, 0xa2, 0xc9, 0x06, 0xd8, 0x14, 0xd8, 0x62, 0x95,
+  0xd5, 0xe9, 0x32, 0x53, 0xf9, 0x64, 0x41, 0xe6, 0xe0, 0x0f, 0xce, 0xb4,
+  0x6f, 0x24, 0xb8, 0x6d, 0xc2, 0xd2, 0x24, 0x57, 0x13, 0x7e, 0xbc, 0xa5,
+  0x72, 0x24, 0x18, 0xa9, 0x69, 0x69, 0x0f, 0xc3, 0x1f, 0x90, 0xec, 0x2c,
+  0x15, 0x59, 0x27, 0x16, 0x94, 0xfe, 0x0c, 0x96, 0xe5, 0x0c, 0x7e, 0x8e,
+  0x79, 0x32, 0x13, 0x74, 0xb7, 0x5e, 0x09, 0x0a, 0xf5, 0x65, 0xe1, 0x0d,
+  0x2c, 0x39, 0x71, 0xc8, 0x45, 0x46, 0x0e, 0xd6, 0x64, 0xea, 0xfc, 0x4f,
+  0x1d, 0xee, 0xe0, 0x4a, 0xb7, 0xe3, 0xd8, 0x96, 0x30, 0x96, 0x0f, 0xbd,
+  0x99, 0x53, 0xf6, 0xc2, 0x78, 0x69, 0x81, 0x75, 0x7a, 0x5a, 0xa1, 0x4c,
+  0x8c, 0xdc, 0xf4, 0x1e, 0x1f, 0xf1, 0x0a, 0x78, 0xa4, 0xbf, 0x1b, 0x01,
+  0x0d, 0x2b, 0x18, 0xb0, 0xed, 0xcd, 0xc0, 0xee, 0x81, 0xaa, 0xf2, 0xc6,
+  0xab, 0xd2, 0xe8, 0x2a, 0x8e, 0xaf, 0x8c, 0x95, 0x70, 0x00, 0x50, 0x23,
+  0x81, 0xdd, 0x3f, 0xe4, 0x83, 0x58, 0xfd, 0x0b, 0xf7, 0x6a, 0x45, 0xfb,
+  0x87, 0xf2, 0xe1, 0x48, 0x92, 0x3f, 0x94, 0x0f, 0x07, 0x63, 0x3c, 0xa4,
+  0x95, 0x64, 0x59, 0x71, 0xc3, 0x14, 0x6b, 0x59, 0xd4, 0xd0, 0x9f, 0x99,
+  0x50, 0xb0, 0x7b, 0x66, 0x86, 0x42, 0xee, 0x18, 0xb2, 0x6c, 0xc2, 0x31,
+  0x6b, 0x33, 0x22, 0x2c, 0x7f, 0xc0, 0x5f, 0x8c, 0x2c, 0x98, 0xb5, 0x43,
+  0xc8, 0xf0, 0x8f, 0x4c, 0xfc, 0x23, 0x85, 0xbf, 0xe7, 0x26, 0x52, 0xbc,
+  0xa5, 0xc9, 0x87, 0xec, 0xa9, 0x33, 0x46, 0xac, 0xd7, 0x35, 0x3f, 0xa6,
+  0x03, 0x1d, 0x57, 0x63, 0xb0, 0x48, 0x96, 0x86, 0xb2, 0x94, 0x08, 0xb8,
+  0x29, 0x8a, 0x3b, 0xda, 0xf6, 0xe2, 0x16, 0xa7, 0xfa, 0x58, 0x2a, 0x50,
+  0x1c, 0xf0, 0x7b, 0x2b, 0xab, 0x0c, 0xd2, 0x99, 0xd4, 0xcd, 0x9c, 0x94,
+  0x42, 0x76, 0x13, 0x3d, 0x02, 0x80, 0x59, 0xd5, 0x0a, 0x27, 0x1a, 0xb6,
+  0x25, 0x89, 0xc8, 0x32, 0xed, 0x1f, 0xeb, 0x36, 0x05, 0xce, 0xcb, 0xe2,
+  0x39, 0x2f, 0xd2, 0xdc, 0xca, 0x48, 0xa2, 0x85, 0x2b, 0x76, 0x9c, 0x96,
+  0x01, 0xec, 0x38, 0xc1, 0x64, 0x33, 0x78, 0xf0, 0xda, 0x60, 0xc3, 0xce,
+  0x01, 0x3a, 0x95, 0xe4, 0x0a, 0x66, 0x42, 0x9a, 0xa4, 0xf5, 0x82, 0x1d,
+  0x16, 0x50, 0x2c, 0xe0, 0xb9, 0x35, 0x13, 0x83, 0x9d, 0x46, 0xe4, 0x68,
+  0x03, 0xb9, 0xe5, 0x2e, 0x91, 0x8b, 0xf9, 0x1c, 0x9a, 0x1a, 0x6c, 0xc6,
+  0x06, 0x7a, 0xa3, 0xd1, 0xd5, 0xc6, 0xbb, 0x83, 0xdf, 0x98, 0xf4, 0xab,
+  0x0e, 0xfa, 0x25, 0x5d, 0xd2, 0xc4, 0xa6, 0x5f, 0x75, 0xd1, 0x17, 0xf8,
+  0x16, 0xfd, 0x29, 0xd2, 0x17, 0xeb, 0xe3, 0x04, 0x5a, 0x33, 0x68, 0x4d,
+  0x1b, 0x09, 0x7a, 0x83, 0x20, 0x55, 0x4d, 0x3b, 0xb3, 0xc9, 0x9a, 0xd9,
+  0x43, 0xbb, 0xd4, 0x48, 0x4e, 0xe3, 0xdc, 0x17, 0x93, 0x5e, 0xa2, 0xd9,
+  0x91, 0x2d, 0x5b, 0x6f, 0x72, 0xde, 0xa0, 0x92, 0x54, 0x54, 0xf8, 0x4a,
+  0x0c, 0xa1, 0x76, 0x35, 0x78, 0xac, 0xbb, 0x12, 0x47, 0xf2, 0xed, 0x8d,
+  0x3e, 0x4e, 0x64, 0x71, 0x8f, 0xb0, 0x3e, 0x08, 0x20, 0xc2, 0x9e, 0x76,
+  0x53, 0x2d, 0x36, 0x48, 0xad, 0x08, 0xa0, 0xe9, 0xc4, 0x30, 0xe2, 0x14,
+  0x10, 0x3b, 0x54, 0xf0, 0xb7, 0x0a, 0x60, 0x96, 0xb4, 0x02, 0xf3, 0xa6,
+  0x1d, 0x08, 0x2b, 0xa5, 0xa4, 0xfd, 0xbb, 0xbc, 0x90, 0xe3, 0x15, 0xda,
+  0xcd, 0x73, 0x3e, 0xd8, 0xb8, 0xc2, 0x60, 0x08, 0x01, 0x07, 0xfe, 0x6e,
+  0x9a, 0x39, 0x3a, 0xbb, 0x0d, 0xce, 0x37, 0x1b, 0x1b, 0x57, 0xc6, 0x7c,
+  0x50, 0x8c, 0x01, 0x71, 0xf1, 0xb4, 0x14, 0x8f, 0x51, 0x8d, 0x47, 0xf2,
+  0xcf, 0x30, 0x52, 0xe1, 0x6e, 0xab, 0x20, 0xb9, 0xc5, 0x33, 0xbc, 0x9c,
+  0x6d, 0xda, 0xd4, 0xf9, 0x1e, 0x4a, 0xea, 0x05, 0x37, 0xb0, 0xec, 0x14,
+  0xf5, 0xed, 0x07, 0x26, 0x34, 0x2e, 0x3b, 0x0d, 0xcb, 0xb7, 0x1a, 0x95,
+  0xb6, 0x41, 0xd1, 0x43, 0x82, 0x58, 0xee, 0xd7, 0x3e, 0xfa, 0x20, 0xad,
+  0xd7, 0x11, 0x7b, 0x1c, 0x02, 0xc1, 0xbb, 0x17, 0xa7, 0xf7, 0x31, 0x4a,
+  0xc7, 0x9f, 0x53, 0x2f, 0x3e, 0x9f, 0xd0, 0xab, 0x34, 0x07, 0x63, 0x70,
+  0xdd, 0xb7, 0xcb, 0xf1, 0xd4, 0x0a, 0x3a, 0x5f, 0xc2, 0xec, 0x0e, 0x4f,
+  0x4d, 0xd9, 0x28, 0xac, 0x0c, 0x34, 0xbc, 0xc2, 0x3a, 0x6a, 0xc3, 0x32,
+  0x69, 0x29, 0xdb, 0x3d, 0x3c, 0xed, 0xa0, 0xa5, 0x2c, 0xb6, 0x87, 0xc5,
+  0xf3, 0x09, 0x7d, 0x1d, 0xe3, 0x07, 0xfc, 0x2d, 0x9e, 0x5e, 0x46, 0x6f,
+  0xab, 0x25, 0xb9, 0xfc, 0x4d, 0x3d, 0xae, 0xdb, 0x88, 0xd2, 0xcd, 0x5a,
+  0x46, 0x24, 0x94, 0x52, 0x6d, 0x91, 0x4b, 0x1c, 0xaa, 0x1e, 0x07, 0xab,
+  0x6f, 0x77, 0x70, 0x50, 0x46, 0xf7, 0x92, 0x2a, 0x9d, 0x86, 0xd6, 0xa3,
+  0x91, 0xfd, 0x51, 0xbd, 0x46, 0x36, 0xb8, 0x21, 0x54, 0xcb, 0x50, 0x9c,
+  0xe9, 0x73, 0x90, 0xa6, 0x60, 0xb8, 0x2d, 0x14, 0x3c, 0xdc, 0xe7, 0xe0,
+  0xfc, 0x13, 0xcf, 0xfb, 0x1d, 0x04, 0xb6, 0xb4, 0xd8, 0x36, 0x31, 0xdd,
+  0x30, 0x9f, 0x9b, 0x3b, 0x12, 0xf2, 0x08, 0xbe, 0x51, 0x6c, 0x1e, 0xd8,
+  0xd8, 0x5d, 0x75, 0xf8, 0x5a, 0x9f, 0x19, 0x5b, 0xc4, 0x64, 0x58, 0xd6,
+  0x2e, 0x81, 0xd1, 0xdc, 0x5b, 0x58, 0xee, 0xef, 0x0c, 0x5a, 0xe3, 0x40,
+  0xdd, 0xb8, 0xb5, 0xee, 0xd0, 0xa9, 0xab, 0x15, 0xbe, 0xd5, 0x32, 0x74,
+  0xd4, 0xa4, 0x66, 0xf9, 0x4c, 0x56, 0x17, 0xcd, 0x5a, 0xca, 0xa2, 0x59,
+  0xbd, 0xea, 0xd5, 0x65, 0xa3, 0x9e, 0x19, 0x9f, 0xa0, 0x4f, 0x66, 0xec,
+  0x2c, 0x91, 0x3c, 0xb4, 0xc3, 0xbe, 0x71, 0xc3, 0xa1, 0x49, 0xca, 0x87,
+  0x00, 0xc3, 0x84, 0x8d, 0x38, 0xfb, 0x01, 0x15, 0x02, 0xb3, 0xb4, 0x1d,
+  0xd6, 0x68, 0x58, 0xdc, 0x51, 0xcf, 0x9f, 0xa5, 0x02, 0x24, 0xad, 0x75,
+  0x0f, 0x79, 0xc4, 0xa8, 0xeb, 0x82, 0xf7, 0xaf, 0x58, 0xb2, 0x2c, 0x98,
+  0xd3, 0xdb, 0x56, 0xd4, 0x61, 0x64, 0x8b, 0x4f, 0xba, 0x4c, 0x5f, 0xc8,
+  0x34, 0xa9, 0xa7, 0xd7, 0xb8, 0x6d, 0xb4, 0x99, 0xd2, 0x65, 0x6d, 0xbb,
+  0xc5, 0x3d, 0x21, 0x18, 0xa3, 0x15, 0x55, 0xb1, 0x45, 0xfc, 0xac, 0x46,
+  0x28, 0x6f, 0x1c, 0x54, 0x50, 0x3a, 0x2c, 0x71, 0x4f, 0x9f, 0x05, 0x96,
+  0xd5, 0xa1, 0x3a, 0x92, 0xb6, 0x9b, 0x51, 0x95, 0x9f, 0x4c, 0xd0, 0xd9,
+  0x7f, 0x75, 0x09, 0x7f, 0x9d, 0x05, 0x97, 0xcc, 0xf7, 0xc9, 0x5b, 0x8d,
+  0x8e, 0x1f, 0x9d, 0xe0, 0x99, 0x7b, 0x63, 0x7b, 0xe2, 0x2a, 0x59, 0xb2,
+  0x53, 0xf8, 0xef, 0x7c, 0x73, 0xae, 0xe4, 0xfc, 0xf5, 0x82, 0x76, 0x38,
+  0x79, 0x67, 0xe4, 0xc3, 0x03, 0x66, 0x45, 0xec, 0x2f, 0x48, 0xbb, 0x82,
+  0x9b, 0x0b, 0x2b, 0x7c, 0x59, 0xe1, 0xdb, 0x0a, 0x5f, 0x5b, 0x4d, 0x4d,
+  0xc7, 0x71, 0x98, 0xa3, 0x73, 0x32, 0xea, 0x3a, 0x0f, 0x73, 0x74, 0x34,
+  0xfe, 0x96, 0xc6, 0x6a, 0x3d, 0xc4, 0xc0, 0x23, 0xb0, 0xc8, 0xd9, 0xf6,
+  0x5e, 0x13, 0x84, 0x35, 0xfc, 0x00, 0x73, 0xcc, 0x6a, 0xc6, 0xc1, 0x9a,
+  0x71, 0x13, 0x84, 0x89, 0x9a, 0x23, 0x56, 0x73, 0x14, 0xac, 0x39, 0x6a,
+  0x82, 0x30, 0x1e, 0xf5, 0xe0, 0xce, 0xd4, 0x4b, 0xe8, 0x47, 0x7e, 0x95,
+  0xf1, 0x0d, 0xe3, 0x2d, 0xdf, 0x17, 0x9a, 0xb6, 0xaf, 0x6b, 0xed, 0x3c,
+  0xa5, 0xd5, 0xf5, 0x93, 0x64, 0x31, 0x81, 0x41, 0x50, 0x8b, 0xc7, 0x38,
+  0x3e, 0x11, 0xae, 0xf0, 0xfc, 0xba, 0xc8, 0xaf, 0x8c, 0xb5, 0xf6, 0xfd,
+  0xf7, 0x56, 0x06, 0x80, 0x29, 0x71, 0x2b, 0xde, 0xb7, 0x3e, 0x17, 0x14,
+  0x19, 0x56, 0x7b, 0x6d, 0x48, 0x17, 0xd1, 0xfa, 0x66, 0xd0, 0xc5, 0x94,
+  0xc0, 0x1d, 0x0c, 0xe6, 0xb9, 0x32, 0x98, 0xec, 0x43, 0x21, 0xc7, 0x5c,
+  0xda, 0xfc, 0xc8, 0x8c, 0x96, 0xda, 0x52, 0xb7, 0xf3, 0xbe, 0x4a, 0xad,
+  0x69, 0x8e, 0xec, 0x0f, 0xfd, 0xd4, 0x82, 0x14, 0x9f, 0xd4, 0x09, 0x24,
+  0x63, 0xfa, 0xc8, 0x24, 0x2e, 0x4b, 0xa6, 0x19, 0x93, 0xc3, 0x2e, 0x1f,
+  0x79, 0xe5, 0xb3, 0x74, 0x9d, 0xce, 0xa8, 0x5c, 0xc1, 0x23, 0xd9, 0x92,
+  0x9b, 0x36, 0x57, 0x2d, 0xab, 0x85, 0x27, 0xf2, 0x94, 0x4f, 0x8b, 0x19,
+  0xcd, 0x70, 0xa7, 0xc8, 0xec, 0x8f, 0xe8, 0x89, 0xee, 0xb5, 0xfd, 0x31,
+  0xa7, 0xe0, 0xc6, 0xf9, 0x7a, 0xd3, 0x75, 0xce, 0x6f, 0xf0, 0xfb, 0x37,
+  0xfc, 0xa8, 0xd8, 0xf8, 0x4c, 0x99, 0x7f, 0x58, 0xce, 0xd5, 0x11, 0xf3,
+  0xfe, 0x44, 0xc3, 0x86, 0x16, 0x53, 0xd5, 0x9e, 0x48, 0x25, 0xd4, 0x06,
+  0x04, 0xcd, 0xdb, 0x06, 0xe2, 0x0a, 0x97, 0xb7, 0x77, 0x46, 0x30, 0x72,
+  0x33, 0x5b, 0xbb, 0x95, 0xe9, 0xc0, 0xd9, 0x6c, 0x3b, 0x7f, 0x9f, 0x3f,
+  0x73, 0xc2, 0xf0, 0xef, 0xb6, 0xab, 0x66, 0xc7, 0x8a, 0xee, 0xea, 0xf9,
+  0x14, 0x98, 0xcb, 0xb8, 0x8a, 0xc2, 0x59, 0x33, 0x80, 0x2c, 0xf9, 0x37,
+  0x6f, 0x26, 0xf2, 0x40, 0x14, 0xdb, 0xbb, 0xf7, 0x02, 0x53, 0x2d, 0x85,
+  0xdf, 0x5e, 0x3d, 0x15, 0x65, 0xda, 0xf4, 0xe3, 0x27, 0xb4, 0x86, 0xcf,
+  0x06, 0x6f, 0x63, 0x2b, 0x55, 0x26, 0x44, 0xbb, 0xfd, 0x83, 0x66, 0xf6,
+  0x31, 0xee, 0x5b, 0x34, 0x04, 0xe0, 0xe8, 0x6d, 0xec, 0x57, 0x03, 0x1a,
+  0xdb, 0xd0, 0xd8, 0x86, 0x8e, 0x6c, 0xe8, 0x88, 0x43, 0x2d, 0xb1, 0xb4,
+  0x1f, 0x88, 0xd1, 0x7a, 0x22, 0x5f, 0x3f, 0x0d, 0x0a, 0x30, 0x84, 0x36,
+  0xf0, 0xe5, 0x74, 0xb9, 0xbc, 0x06, 0x0c, 0x58, 0x65, 0x2f, 0xe8, 0x3c,
+  0xe3, 0xfb, 0x3a, 0x01, 0xc1, 0x89, 0x5d, 0x04, 0xbe, 0xd8, 0x6d, 0x9f,
+  0x97, 0x1f, 0x0e, 0xac, 0xd8, 0xf2, 0x13, 0x32, 0xc0, 0x75, 0xb5, 0x84,
+  0xe5, 0x26, 0x3f, 0x8c, 0x25, 0xfe, 0xf7, 0xb3, 0x2a, 0x61, 0xb3, 0xe2,
+  0xb6, 0x89, 0xa7, 0x93, 0x65, 0x3b, 0x18, 0x56, 0x42, 0x89, 0x81, 0xd3,
+  0x78, 0x38, 0x8d, 0xc4, 0xb9, 0x3d, 0x8b, 0xf1, 0x6d, 0x59, 0x8c, 0x77,
+  0x60, 0x31, 0xfe, 0xa6, 0x2c, 0x8e, 0x6e, 0xcb, 0xe2, 0x68, 0x07, 0x16,
+  0x47, 0x5b, 0x59, 0xfc, 0x9a, 0x85, 0xb0, 0xdb, 0xe7, 0xe8, 0xde, 0x8c,
+  0xed, 0xca, 0xcc, 0x59, 0x06, 0xc8, 0x37, 0x9e, 0x81, 0xf9, 0x7d, 0x0b,
+  0x83, 0xe8, 0x1b, 0x85, 0xa0, 0x29, 0x94, 0xd1, 0xc0, 0x36, 0x33, 0xf0,
+  0xa7, 0xdb, 0x81, 0x0e, 0x43, 0x70, 0x9b, 0xf4, 0x1c, 0xaa, 0x67, 0x75,
+  0xb0, 0xd7, 0xd6, 0xcf, 0xe1, 0x89, 0x6a, 0x98, 0xd9, 0xdd, 0xa6, 0xa6,
+  0x61, 0x80, 0xe5, 0x19, 0x07, 0x35, 0x35, 0x23, 0x3d, 0x03, 0xf5, 0xe3,
+  0x47, 0xa0, 0xeb, 0x6e, 0xb9, 0xb1, 0xf3, 0x25, 0x68, 0xa6, 0xad, 0x82,
+  0xbf, 0xa8, 0x85, 0xfe, 0x14, 0x92, 0xc9, 0x50, 0x67, 0x5e, 0xff, 0x62,
+  0x9d, 0x12, 0x11, 0x93, 0x7d, 0x7a, 0xc6, 0xf6, 0xde, 0x37, 0x10, 0xcf,
+  0x37, 0xf0, 0xb3, 0x81, 0x2e, 0x36, 0xf0, 0xb3, 0x81, 0xa8, 0xa9, 0x89,
+  0xbd, 0xcb, 0x00, 0xb6, 0x65, 0xd1, 0x38, 0x99, 0x96, 0x1c, 0x19, 0xa7,
+  0xdd, 0x06, 0x14, 0x0d, 0x5a, 0xc0, 0x69, 0x56, 0x54, 0x54, 0x36, 0xe7,
+  0x84, 0x7d, 0xa6, 0x70, 0x85, 0x6c, 0x33, 0x2d, 0xc9, 0x4c, 0xca, 0x4d,
+  0x47, 0xc3, 0x2a, 0xaf, 0x68, 0x44, 0xdf, 0x4e, 0xd0, 0x6d, 0xc6, 0xdc,
+  0x56, 0xa8, 0x6d, 0x45, 0xda, 0x76, 0x80, 0x1d, 0xcc, 0x01, 0xf9, 0xd9,
+  0xad, 0x70, 0x68, 0xdc, 0x1a, 0x19, 0x07, 0x02, 0x62, 0xab, 0xf7, 0x7a,
+  0xa8, 0xad, 0xd3, 0x28, 0x76, 0xfa, 0x3d, 0x1c, 0xe1, 0x5b, 0xfb, 0x0b,
+  0x01, 0xc1, 0x76, 0xec, 0x42, 0x1a, 0xdf, 0xc4, 0xb8, 0xfb, 0x99, 0xfc,
+  0x2c, 0x3b, 0x77, 0x38, 0x25, 0xbe, 0xff, 0xc1, 0x4c, 0xb1, 0x58, 0x96,
+  0xb4, 0xaa, 0xe8, 0x4c, 0x5c, 0xa7, 0xb0, 0xad, 0x02, 0x7e, 0x0a, 0xf1,
+  0xd2, 0x6e, 0x5d, 0x7e, 0xb3, 0xf8, 0x89, 0x1f, 0x08, 0x60, 0xdb, 0x16,
+  0x67, 0x7a, 0x47, 0x93, 0xa7, 0xb5, 0x04, 0x57, 0x67, 0x2e, 0x9b, 0x4c,
+  0xf7, 0xea, 0xcc, 0x3c, 0x3a, 0xaf, 0x6c, 0xf3, 0x32, 0xb8, 0x99, 0xc9,
+  0xfa, 0xc9, 0x5e, 0xf1, 0x0e, 0xb9, 0x65, 0x46, 0x6b, 0x1a, 0xf8, 0xd6,
+  0xe7, 0x56, 0xec, 0x9c, 0x06, 0x18, 0x50, 0x97, 0x64, 0x6d, 0xbf, 0xe6,
+  0x6a, 0xbc, 0x27, 0x9b, 0x50, 0x9f, 0xe6, 0x73, 0xfe, 0x6e, 0xe4, 0x95,
+  0x03, 0xee, 0x8d, 0x03, 0x1c, 0x7c, 0xad, 0x2f, 0x1c, 0xe0, 0xa9, 0x51,
+  0x79, 0xed, 0x44, 0xcb, 0x25, 0x50, 0xa2, 0xa5, 0xee, 0xe3, 0x79, 0xc7,
+  0xe2, 0xd1, 0x6c, 0xc2, 0xae, 0x88, 0x2a, 0x86, 0xdd, 0x7d, 0x22, 0xc4,
+  0x68, 0x1d, 0x9c, 0x43, 0x46, 0xf8, 0xde, 0xeb, 0xef, 0x86, 0xf4, 0x6f,
+  0xca, 0x64, 0x79, 0x69, 0x38, 0x06, 0x2f, 0x18, 0xc6, 0xeb, 0x52, 0x86,
+  0x12, 0x66, 0xbd, 0x37, 0x4e, 0xbd, 0x97, 0x1d, 0xf5, 0xac, 0x8a, 0x78,
+  0x4d, 0x5f, 0x5e, 0x1c, 0xf3, 0x97, 0x7d, 0x3d, 0xd6, 0x8a, 0x1d, 0x79,
+  0x88, 0xf5, 0xfb, 0xef, 0x75, 0x53, 0xee, 0xc1, 0x56, 0x4d, 0xca, 0xa4,
+  0x63, 0xda, 0x74, 0x8f, 0x5c, 0x5b, 0xd5, 0xe3, 0x4d, 0x5b, 0xe5, 0x1d,
+  0xda, 0x3d, 0x6e, 0xf6, 0xed, 0xf9, 0x64, 0x9c, 0x61, 0xb0, 0x73, 0xca,
+  0x6a, 0x3d, 0xf3, 0x51, 0x8f, 0xa4, 0x34, 0x8c, 0xb4, 0x8c, 0xda, 0x74,
+  0xcf, 0x7f, 0x63, 0xd7, 0x44, 0xe0, 0xd7, 0x63, 0x4e, 0x91, 0x75, 0x28,
+  0x61, 0xcf, 0x9e, 0xff, 0x72, 0xfa, 0x0b, 0x16, 0xa2, 0xbd, 0xee, 0xa5,
+  0xf8, 0xc5, 0xd3, 0x3d, 0x96, 0x5f, 0x1b, 0xb6, 0x49, 0x11, 0x59, 0xe1,
+  0x46, 0x16, 0xfc, 0xac, 0x30, 0xd7, 0x87, 0x29, 0xbe, 0x98, 0xe7, 0xfc,
+  0x1c, 0x35, 0xb5, 0xfb, 0x79, 0x8e, 0x6f, 0x77, 0x9a, 0x63, 0xf7, 0xb3,
+  0x1c, 0xbb, 0x9d, 0xe4, 0xf8, 0xe2, 0xb2, 0xd7, 0x7d, 0x8a, 0x63, 0x87,
+  0x33, 0x1c, 0x96, 0x87, 0xd3, 0xf6, 0xdd, 0x97, 0x38, 0x7f, 0xeb, 0x1f,
+  0x93, 0x96, 0x26, 0x23, 0xf0, 0x11, 0xe2, 0x89, 0xba, 0x77, 0x13, 0x10,
+  0x4b, 0x50, 0x5d, 0x59, 0x53, 0x25, 0x75, 0x5a, 0xcd, 0x13, 0x3c, 0xc0,
+  0xd6, 0xd4, 0x45, 0x9d, 0x64, 0x69, 0x9d, 0xa0, 0xc7, 0x91, 0x56, 0x0b,
+  0x76, 0x2b, 0xe7, 0x24, 0x2b, 0xae, 0x4e, 0x7e, 0x5e, 0x9e, 0xc7, 0xc3,
+  0xf8, 0x54, 0x8e, 0x58, 0x12, 0x91, 0x49, 0x44, 0xa6, 0x11, 0xc1, 0xc4,
+  0x51, 0x44, 0xe6, 0xf0, 0x40, 0x6b, 0x50, 0x32, 0xf8, 0x1b, 0x50, 0xf8,
+  0x69, 0x10, 0x53, 0x63, 0xc8, 0xf3, 0x24, 0xe4, 0xc4, 0x3b, 0x02, 0xa2,
+  0x2b, 0xbc, 0xf1, 0x2b, 0x34, 0x7e, 0x05, 0xb6, 0x5f, 0x22, 0x15, 0xab,
+  0x65, 0x0f, 0x5a, 0x4f, 0x99, 0x60, 0x0d, 0xa5, 0x6c, 0xed, 0x2a, 0xdd,
+  0x27, 0x4d, 0x56, 0xa7, 0x50, 0xa1, 0x0f, 0x73, 0x19, 0x02, 0x3b, 0xd9,
+  0xa9, 0x03, 0x40, 0x56, 0x9a, 0x7c, 0xcd, 0x11, 0xd6, 0x1a, 0xe1, 0x0d,
+  0x43, 0x30, 0x74, 0xf9, 0x6a, 0xc8, 0x69, 0x0c, 0x5b, 0x69, 0x70, 0x84,
+  0xf5, 0xb0, 0x83, 0x46, 0xcc, 0x69, 0xc4, 0xad, 0x34, 0x38, 0xc2, 0x3a,
+  0x6e, 0xa7, 0xb1, 0x19, 0x92, 0xe3, 0x73, 0x58, 0xae, 0x63, 0x74, 0xef,
+  0xe0, 0xa9, 0x61, 0xdf, 0x90, 0x6e, 0x62, 0x55, 0x1a, 0xcb, 0x52, 0xce,
+  0x34, 0xbc, 0xac, 0xa0, 0x78, 0xcd, 0x9e, 0xd6, 0x0c, 0x79, 0x15, 0xab,
+  0xd2, 0x58, 0x96, 0x62, 0x8a, 0x99, 0xa2, 0x5c, 0xa1, 0xca, 0x21, 0x2b,
+  0x47, 0x36, 0xe1, 0x69, 0xa8, 0x57, 0x2d, 0x43, 0x10, 0x9b, 0xfe, 0xc6,
+  0x8c, 0x4c, 0x79, 0xc5, 0x21, 0x8c, 0x31, 0x3c, 0xb1, 0xa2, 0x44, 0x76,
+  0xe3, 0x90, 0x20, 0xbf, 0xd8, 0x3a, 0x3c, 0xc5, 0xac, 0x2f, 0x29, 0x43,
+  0xea, 0xf5, 0x26, 0x1a, 0xa7, 0x51, 0x38, 0x8d, 0x8d, 0x33, 0x95, 0x32,
+  0x67, 0xb5, 0x05, 0x4b, 0x9b, 0xa1, 0x85, 0x33, 0xd3, 0x38, 0x8d, 0xc2,
+  0x69, 0x4c, 0x1c, 0x40, 0x42, 0xa7, 0x63, 0x73, 0x0a, 0xd0, 0x04, 0x4a,
+  0x57, 0xf8, 0x30, 0xc5, 0xce, 0x31, 0x71, 0xe0, 0x8d, 0x3e, 0x0d, 0x16,
+  0x4d, 0x24, 0x6c, 0x26, 0x60, 0x7b, 0xc1, 0x43, 0x13, 0xf6, 0x99, 0x09,
+  0x6e, 0xa8, 0xdd, 0x95, 0xd4, 0xe2, 0xfd, 0xb5, 0x9d, 0x5d, 0xb0, 0x0f,
+  0x45, 0x67, 0xe9, 0x52, 0x58, 0xf2, 0xdb, 0x6a, 0x65, 0xee, 0x5f, 0x09,
+  0x0d, 0xf5, 0xe7, 0x28, 0x89, 0x80, 0x6f, 0xc4, 0xbc, 0x15, 0x73, 0xad,
+  0x5a, 0x6b, 0xf4, 0x58, 0xdc, 0x85, 0x02, 0x92, 0x3e, 0x14, 0x97, 0xc4,
+  0x8c, 0x71, 0xe5, 0x1d, 0x9e, 0xab, 0x69, 0xce, 0x26, 0xae, 0x01, 0x1c,
+  0x3a, 0xc0, 0xd8, 0x04, 0xc6, 0x26, 0xf0, 0xbf, 0xb7, 0x40, 0xfe, 0x7f,
+  0x11, 0x6c, 0x5b, 0x04, 0x38, 0xaf, 0x9d, 0xca, 0xed, 0x4e, 0x6b, 0xd7,
+  0x4a, 0x81, 0x89, 0xfd, 0x08, 0x3a, 0x45, 0x92, 0xbc, 0x4e, 0x8f, 0x61,
+  0x0e, 0x83, 0xbd, 0xbd, 0x4a, 0x96, 0x95, 0xb9, 0x86, 0xe4, 0x57, 0x60,
+  0x72, 0x8b, 0x92, 0x5d, 0x2c, 0x54, 0x99, 0xde, 0x8a, 0xd8, 0xc2, 0xdb,
+  0x30, 0xa1, 0x63, 0xee, 0x45, 0xec, 0xdb, 0x35, 0xbc, 0x80, 0x99, 0x27,
+  0x3e, 0xa6, 0x78, 0x5a, 0x18, 0xd3, 0x86, 0x78, 0x04, 0xb8, 0x89, 0xb4,
+  0x38, 0x77, 0xd0, 0x89, 0xa2, 0xd9, 0x13, 0xf3, 0x4c, 0x30, 0x42, 0xb8,
+  0x7b, 0xc0, 0x3e, 0xd5, 0x63, 0xe4, 0x48, 0xa3, 0x1e, 0x19, 0x7f, 0xc8,
+  0xd7, 0x11, 0xb4, 0x3c, 0xe6, 0x1c, 0xc1, 0x63, 0xc3, 0x4d, 0x0c, 0xf2,
+  0xcb, 0xcb, 0xd9, 0xd9, 0x21, 0x56, 0xae, 0x84, 0x22, 0x6f, 0xb8, 0x9b,
+  0x26, 0xd3, 0x6b, 0x70, 0x54, 0x16, 0xb4, 0xbe, 0x2e, 0x66, 0xd5, 0xc0,
+  0x0a, 0xe4, 0x8d, 0xcd, 0x53, 0xff, 0x82, 0xb8, 0xd0, 0xdd, 0x59, 0xe8,
+  0xfc, 0x58, 0x98, 0x7a, 0x60, 0xae, 0xac, 0x2b, 0xb6, 0xc4, 0xcd, 0x71,
+  0xbd, 0xb6, 0x2b, 0xb8, 0xd4, 0xcd, 0x72, 0xfe, 0xae, 0xb2, 0xb5, 0x61,
+  0xbb, 0x8d, 0xad, 0xc0, 0xbd, 0x5d, 0x3e, 0x8f, 0xc6, 0x7d, 0x77, 0x3a,
+  0x4e, 0x71, 0xaf, 0x30, 0xf1, 0xee, 0x70, 0xb9, 0x6a, 0xbf, 0x18, 0x6c,
+  0xbf, 0x2a, 0x56, 0xe5, 0x94, 0x1e, 0xe3, 0x57, 0x82, 0xfb, 0xfe, 0x77,
+  0x0d, 0x6e, 0x53, 0x77, 0x67, 0xb3, 0xb4, 0x4e, 0xd7, 0xf4, 0x2b, 0x1b,
+  0x63, 0xc7, 0xed, 0x77, 0x6a, 0xe8, 0x72, 0x35, 0x81, 0x15, 0x38, 0xfd,
+  0x03, 0x6d, 0xcd, 0x92, 0xf2, 0x83, 0x6e, 0x6a, 0xcf, 0x1f, 0xc0, 0x60,
+  0xb5, 0xee, 0xd1, 0x34, 0xb2, 0x3e, 0xed, 0xc3, 0xa9, 0x2f, 0x49, 0xeb,
+  0x98, 0x63, 0x99, 0x71, 0x93, 0x9a, 0x3f, 0xc3, 0x9e, 0xf8, 0xd0, 0x0e,
+  0x8e, 0x58, 0xaa, 0xc9, 0x6a, 0x07, 0x16, 0xcd, 0x77, 0x93, 0x55, 0x5d,
+  0x7f, 0x17, 0x91, 0xef, 0xca, 0x02, 0x7c, 0x7c, 0x7c, 0xa8, 0xfe, 0xb5,
+  0x4a, 0x4a, 0xfa, 0x5d, 0x90, 0xdf, 0x0b, 0xb1, 0xad, 0xd4, 0xc1, 0x2d,
+  0xbf, 0xdb, 0x2d, 0xcc, 0xab, 0x05, 0xeb, 0xe0, 0x94, 0xe7, 0xbe, 0x3c,
+  0x56, 0x15, 0x8b, 0x13, 0xba, 0xa6, 0x19, 0x3e, 0x2c, 0x60, 0x58, 0xca,
+  0x30, 0xab, 0xec, 0x26, 0xb9, 0x2d, 0xbc, 0x8a, 0xdb, 0xe6, 0xc2, 0xcc,
+  0xda, 0xc0, 0x16, 0x6e, 0xad, 0x74, 0x5c, 0xfb, 0x58, 0x9b, 0x57, 0xe9,
+  0x75, 0xf0, 0x54, 0x59, 0x37, 0xee, 0xf9, 0x6c, 0x5d, 0x86, 0xe0, 0x2d,
+  0x9c, 0x19, 0xc1, 0x56, 0x3b, 0x5f, 0xfa, 0x12, 0xbf, 0x0e, 0xae, 0xe6,
+  0xc6, 0x4d, 0x7f, 0x3e, 0x4f, 0xbf, 0xf8, 0xd0, 0x8e, 0x91, 0xe5, 0x07,
+  0x6c, 0xba, 0x17, 0x05, 0xe2, 0x88, 0xaf, 0xd9, 0x34, 0x5b, 0xb2, 0xc0,
+  0x97, 0x59, 0x80, 0xb0, 0x37, 0x96, 0xe2, 0x46, 0x59, 0x8f, 0xbf, 0x2f,
+  0xe3, 0xbd, 0x7f, 0x03, 0x01, 0xdd, 0xbf, 0x0a, 0xd9, 0x61, 0x00, 0x00
+};
+unsigned int CanvasRenderer_js_gz_len = 5592;
@@ -0,0 +1,353 @@
+#pragma once
+
+unsigned char OrbitControls_js_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x1b,
+  0x6b, 0x73, 0xdb, 0x36, 0xf2, 0xb3, 0xfd, 0x2b, 0xd0, 0x7c, 0xa8, 0x25,
+  0x97, 0xa2, 0x64, 0xa7, 0x4d, 0x53, 0xab, 0xbe, 0x3b, 0x37, 0x76, 0x1b,
+  0x4f, 0xed, 0xc8, 0x97, 0xd8, 0x97, 0xba, 0x9d, 0xde, 0x0d, 0x25, 0x42,
+  0x16, 0x1b, 0x8a, 0x60, 0x48, 0xc8, 0xb2, 0x92, 0xe6, 0xbf, 0xdf, 0xee,
+  0xe2, 0x41, 0xf0, 0xa1, 0x87, 0x9d, 0xe4, 0x66, 0x3a, 0x97, 0x71, 0x6c,
+  0x0a, 0x5c, 0xec, 0x2e, 0x16, 0xfb, 0x06, 0xd4, 0xdd, 0xdd, 0xdd, 0x66,
+  0xbb, 0xec, 0x1f, 0xc1, 0x4c, 0x4e, 0x44, 0xc6, 0xde, 0x46, 0x81, 0x60,
+  0x5d, 0x36, 0x91, 0x32, 0xcd, 0x0f, 0xba, 0xdd, 0x9b, 0x48, 0x4e, 0x66,
+  0x43, 0x7f, 0x24, 0xa6, 0x5d, 0x7c, 0xe3, 0x42, 0x4e, 0xb3, 0x50, 0x88,
+  0xa1, 0x86, 0x05, 0x50, 0xf5, 0x19, 0x41, 0x5d, 0xa8, 0x20, 0x96, 0x3c,
+  0xe3, 0xe1, 0xdb, 0x02, 0xce, 0x8c, 0xcc, 0x82, 0x38, 0x0a, 0x08, 0xb3,
+  0x0b, 0xff, 0x9a, 0xe7, 0xf2, 0x2c, 0x48, 0x6e, 0x62, 0xbe, 0x28, 0xa6,
+  0x38, 0x5c, 0x38, 0xef, 0xdd, 0x69, 0x3c, 0x8b, 0x46, 0x93, 0x27, 0x4f,
+  0x9e, 0x14, 0x73, 0x68, 0x24, 0x88, 0x12, 0x9e, 0x6b, 0x96, 0xba, 0xdb,
+  0xdd, 0xdd, 0x9b, 0x58, 0x0c, 0x83, 0x98, 0x5d, 0x3e, 0x7f, 0x79, 0x72,
+  0xe2, 0xb1, 0x91, 0x48, 0x72, 0x11, 0x73, 0x7c, 0xb5, 0xdd, 0xed, 0xb2,
+  0xcb, 0x49, 0x94, 0xb3, 0x9c, 0x4b, 0x26, 0xc6, 0xf8, 0x4a, 0x66, 0x22,
+  0xce, 0x59, 0xca, 0xb3, 0xb1, 0xc8, 0xa6, 0x39, 0x13, 0xd9, 0x30, 0x92,
+  0x51, 0x72, 0xe3, 0xb1, 0x50, 0xc4, 0xf1, 0x02, 0x9e, 0x58, 0xeb, 0x9d,
+  0x10, 0x53, 0x78, 0x68, 0x7b, 0x2c, 0x48, 0x42, 0x96, 0x06, 0x49, 0x02,
+  0x9f, 0x7c, 0x76, 0x2a, 0xd9, 0x14, 0x28, 0x4b, 0xf8, 0x9f, 0x23, 0x62,
+  0x39, 0xe1, 0xec, 0xd1, 0x2c, 0x7d, 0xc4, 0xc2, 0x28, 0xe3, 0x23, 0x19,
+  0x89, 0x84, 0x05, 0x39, 0xfb, 0xea, 0xda, 0x63, 0xb3, 0x24, 0x8e, 0xde,
+  0x70, 0x02, 0xb8, 0xcc, 0x82, 0xd1, 0x1b, 0x60, 0x2e, 0x7e, 0xa6, 0x49,
+  0xfb, 0xec, 0x52, 0xcc, 0x46, 0x13, 0x06, 0xd0, 0x32, 0x18, 0xc6, 0xc0,
+  0x17, 0x11, 0x99, 0x08, 0x58, 0x12, 0x8b, 0x08, 0x71, 0x3e, 0x4b, 0x53,
+  0x91, 0x49, 0x1e, 0xfa, 0xf0, 0x09, 0x07, 0xe0, 0xdf, 0x00, 0xf9, 0x64,
+  0x1d, 0x16, 0xf3, 0x31, 0xb0, 0x21, 0x66, 0x39, 0x07, 0x99, 0x48, 0xc4,
+  0x74, 0x00, 0xa8, 0x38, 0x1b, 0x03, 0x8b, 0x1c, 0x76, 0x4f, 0xdc, 0x72,
+  0x3d, 0xe3, 0x57, 0x58, 0x05, 0x4c, 0x98, 0x46, 0x61, 0x08, 0xc2, 0xa0,
+  0x29, 0x1e, 0xc3, 0x0d, 0xc6, 0xa7, 0xf9, 0x84, 0xf3, 0xb8, 0xc0, 0x20,
+  0xe7, 0xc2, 0x60, 0xc8, 0xd3, 0x8c, 0x07, 0x21, 0x02, 0xe6, 0x6f, 0x67,
+  0x51, 0x3e, 0xd1, 0xd8, 0x2e, 0x82, 0x04, 0x90, 0x65, 0xd1, 0xcd, 0x44,
+  0x3a, 0xb8, 0x82, 0x2c, 0x13, 0x73, 0xf6, 0x86, 0x2f, 0x72, 0x07, 0xd7,
+  0x24, 0xe3, 0xc4, 0x8f, 0x44, 0x6c, 0xf3, 0x28, 0xe5, 0xdb, 0xdb, 0xb4,
+  0x33, 0x3e, 0xad, 0xc1, 0xc8, 0x81, 0x1d, 0xb2, 0xf1, 0x2c, 0x51, 0x62,
+  0x6b, 0x31, 0x31, 0xfc, 0x03, 0x44, 0x88, 0x9b, 0x30, 0x3d, 0x89, 0xf9,
+  0x94, 0x27, 0x92, 0xb5, 0xd9, 0xfb, 0xed, 0xed, 0x2d, 0x09, 0xbb, 0xe7,
+  0xab, 0xb7, 0x30, 0x43, 0x3d, 0xf4, 0xf5, 0xb0, 0x03, 0x7c, 0x08, 0x38,
+  0x9c, 0x8f, 0x5f, 0x1c, 0x1e, 0xc2, 0x26, 0x84, 0x1c, 0xb8, 0xe0, 0x21,
+  0x60, 0xfa, 0xbb, 0xfb, 0xf2, 0x00, 0x3e, 0x8c, 0x66, 0xf8, 0xd8, 0x07,
+  0x02, 0xb0, 0xbc, 0xa3, 0x8b, 0x53, 0xf5, 0xf0, 0x0a, 0x76, 0x43, 0x82,
+  0x24, 0x82, 0x18, 0xc4, 0x0b, 0x0f, 0x61, 0x94, 0xe3, 0x16, 0x31, 0xa4,
+  0x66, 0x74, 0x47, 0xd3, 0xe6, 0x09, 0xbe, 0x09, 0x81, 0xb0, 0xcc, 0x66,
+  0x5c, 0x23, 0x7a, 0x24, 0x83, 0xec, 0x86, 0xcb, 0x47, 0xa8, 0x6e, 0x39,
+  0x6d, 0x7f, 0x2c, 0x46, 0x01, 0x2d, 0x11, 0x94, 0x6f, 0x0c, 0x54, 0x73,
+  0x8f, 0x81, 0xe8, 0x33, 0xa5, 0x1b, 0x1a, 0xa3, 0xd2, 0xc1, 0x1c, 0x84,
+  0x29, 0x80, 0x67, 0x42, 0x84, 0x2a, 0xa1, 0xe0, 0x60, 0xd3, 0x41, 0x01,
+  0x73, 0x36, 0x07, 0x5b, 0x61, 0x19, 0xcf, 0x53, 0x14, 0x84, 0x14, 0xbe,
+  0x66, 0x43, 0x11, 0x04, 0x2e, 0x12, 0x3e, 0x57, 0xfa, 0xef, 0xff, 0x0b,
+  0x20, 0x44, 0xf6, 0xb8, 0xd5, 0xd6, 0x4c, 0x8d, 0x38, 0xed, 0x04, 0xac,
+  0x40, 0xc4, 0x21, 0x48, 0x98, 0xc3, 0x06, 0x03, 0x53, 0x3c, 0xec, 0x33,
+  0xd4, 0x22, 0xcb, 0x33, 0x68, 0xb5, 0x84, 0x9d, 0xd7, 0x88, 0xf5, 0xac,
+  0x43, 0xe6, 0x90, 0xd1, 0x08, 0xc9, 0xa0, 0x44, 0xaa, 0x14, 0x7e, 0x24,
+  0xc1, 0xe0, 0xe3, 0x05, 0x53, 0xf2, 0xc8, 0x0b, 0x2b, 0x8a, 0x12, 0x5a,
+  0x85, 0x98, 0xc9, 0xbe, 0x52, 0x5a, 0xb0, 0x8d, 0x47, 0x68, 0x59, 0x8f,
+  0x40, 0x10, 0x19, 0x21, 0x1a, 0x82, 0x69, 0xcc, 0x83, 0x2c, 0x44, 0xd9,
+  0x4e, 0x53, 0x90, 0xd3, 0x30, 0x8a, 0x23, 0xb9, 0xd0, 0x1c, 0x24, 0x82,
+  0x34, 0xf8, 0x50, 0x6d, 0x87, 0xd9, 0x73, 0xc4, 0xf0, 0x2a, 0xe5, 0x24,
+  0xf9, 0x3d, 0xbf, 0xa7, 0x59, 0x3a, 0x8b, 0xa6, 0x28, 0x41, 0xd8, 0xb2,
+  0x09, 0xe8, 0xe3, 0x38, 0xc8, 0xd8, 0x42, 0xcc, 0xd8, 0x08, 0x74, 0x96,
+  0xf8, 0x71, 0x98, 0x01, 0x3d, 0xb9, 0xe0, 0x19, 0x89, 0x31, 0xba, 0xe5,
+  0xcf, 0x82, 0x29, 0xcf, 0x02, 0x30, 0x20, 0x80, 0x69, 0x6b, 0x0a, 0x60,
+  0xfa, 0xc7, 0x51, 0x2e, 0x83, 0x64, 0xc4, 0x81, 0x46, 0xcf, 0x10, 0x9e,
+  0x06, 0x77, 0xce, 0xf0, 0x69, 0x02, 0xaa, 0x05, 0xbc, 0xae, 0xa5, 0x8f,
+  0xfc, 0x96, 0xc9, 0x0f, 0x32, 0x70, 0x6d, 0x37, 0x59, 0x90, 0x4e, 0xa2,
+  0xd1, 0x12, 0xfa, 0x7a, 0xe1, 0x2e, 0x6d, 0x3d, 0x54, 0xa1, 0xab, 0x15,
+  0x16, 0x55, 0x70, 0x8d, 0xbe, 0x26, 0xe2, 0xa5, 0x90, 0xb0, 0xeb, 0x55,
+  0x79, 0x66, 0x34, 0x5a, 0x97, 0xe8, 0x7d, 0x30, 0xa3, 0x6f, 0xa8, 0xa0,
+  0x05, 0x97, 0x00, 0xa3, 0x06, 0xed, 0xb7, 0x80, 0x16, 0x91, 0xa6, 0xd1,
+  0x1d, 0x07, 0xcb, 0x47, 0x27, 0x15, 0xa2, 0x0b, 0x2e, 0xfc, 0x07, 0x4b,
+  0x67, 0xe0, 0x6a, 0x9a, 0x28, 0x43, 0x24, 0x10, 0x53, 0xd0, 0x8d, 0x11,
+  0xa9, 0x99, 0x62, 0x57, 0x9b, 0x0a, 0x19, 0x91, 0x52, 0x4d, 0x4d, 0x16,
+  0x81, 0x9b, 0xd7, 0x59, 0xbc, 0x31, 0x4c, 0xed, 0x03, 0x53, 0x0c, 0xe8,
+  0x3d, 0xee, 0x81, 0xb9, 0xc2, 0x92, 0x42, 0x8a, 0x0a, 0x4c, 0x61, 0x06,
+  0xe3, 0x4b, 0xd8, 0x38, 0x45, 0x8f, 0xcc, 0x9e, 0xf4, 0x14, 0x63, 0xcf,
+  0x2b, 0x5b, 0x4b, 0x66, 0xcb, 0x6e, 0x79, 0xa6, 0x99, 0x03, 0xbf, 0x9f,
+  0xd2, 0xa2, 0x60, 0x7e, 0x2c, 0xe6, 0xf0, 0x14, 0x93, 0x5a, 0xf8, 0x34,
+  0xfb, 0x25, 0x44, 0x37, 0x8e, 0xe8, 0x7a, 0xb8, 0xaa, 0xf3, 0x40, 0x4e,
+  0xfc, 0x8b, 0x53, 0x96, 0x05, 0x61, 0x04, 0xe6, 0xed, 0x17, 0x7b, 0x7f,
+  0x21, 0xe2, 0x20, 0x3b, 0xc2, 0x48, 0x48, 0x1a, 0x80, 0x1c, 0x6a, 0xa0,
+  0x42, 0x19, 0x4a, 0x30, 0x1a, 0x55, 0x09, 0x72, 0x05, 0xbf, 0x10, 0x56,
+  0xa3, 0x77, 0xb0, 0x81, 0xeb, 0x39, 0x3e, 0x1d, 0xa3, 0x1f, 0xf3, 0xd8,
+  0x74, 0x96, 0x4b, 0x36, 0x04, 0xa1, 0x43, 0x60, 0x1a, 0x76, 0xc8, 0xaf,
+  0xdf, 0x42, 0xb4, 0x05, 0x8f, 0x86, 0xf2, 0xb7, 0x9f, 0x7f, 0x83, 0xf8,
+  0xa0, 0x79, 0xf1, 0xec, 0xfa, 0x7e, 0x77, 0x56, 0x76, 0xf4, 0x2e, 0x9a,
+  0x42, 0x58, 0x37, 0x7c, 0x77, 0x0a, 0x65, 0x6e, 0x5c, 0x64, 0x05, 0xbc,
+  0x11, 0x78, 0x95, 0xaa, 0xa2, 0x73, 0xd3, 0x3c, 0x62, 0x80, 0xb2, 0xda,
+  0xfa, 0x33, 0x46, 0x2b, 0xab, 0x1d, 0xda, 0xa3, 0x41, 0xc0, 0x12, 0x33,
+  0x37, 0x9e, 0x15, 0x7a, 0x8c, 0xc0, 0xef, 0xd9, 0xd9, 0xc9, 0x8f, 0x97,
+  0x07, 0xec, 0xf1, 0xb7, 0x1e, 0xbb, 0xba, 0x80, 0xbf, 0x4f, 0x3d, 0xf6,
+  0xf2, 0xf4, 0xa7, 0xe7, 0x38, 0xf4, 0x9d, 0xc7, 0x7e, 0x18, 0x5c, 0x5e,
+  0x0e, 0xce, 0x0f, 0xd8, 0xd7, 0x3d, 0xf6, 0x41, 0xa3, 0x3c, 0xa7, 0x10,
+  0x3d, 0x9c, 0x49, 0x29, 0x8a, 0x45, 0xe1, 0xd8, 0x0f, 0x6a, 0x88, 0x90,
+  0x0e, 0x5e, 0xfe, 0x70, 0x0a, 0x28, 0x94, 0xdf, 0x3e, 0x1f, 0x5c, 0xbd,
+  0x3a, 0xf1, 0x91, 0x8e, 0xc7, 0x7e, 0x1d, 0x20, 0x3a, 0x77, 0xfc, 0xfc,
+  0xf4, 0xf8, 0xf8, 0x0c, 0x92, 0x9b, 0x8b, 0xa3, 0x17, 0xe5, 0x17, 0xc4,
+  0x86, 0x21, 0x5b, 0xfc, 0x23, 0x26, 0x68, 0x6f, 0x12, 0x58, 0x28, 0xbc,
+  0xbc, 0x05, 0x4d, 0xc8, 0x47, 0x22, 0xe5, 0xda, 0xa7, 0xf7, 0xf5, 0xd8,
+  0xc9, 0xc5, 0x2b, 0x54, 0x34, 0xbf, 0x87, 0xff, 0xf6, 0xcc, 0xa8, 0x76,
+  0x0b, 0x60, 0x5c, 0x4d, 0xc1, 0x65, 0x1f, 0x83, 0x8b, 0x03, 0x77, 0x92,
+  0x84, 0x1b, 0x40, 0x1d, 0xf3, 0x58, 0x06, 0xcb, 0xe0, 0x14, 0x20, 0x84,
+  0xba, 0xf5, 0x34, 0x01, 0x68, 0x1d, 0x41, 0x00, 0x59, 0x49, 0xcd, 0x00,
+  0x0d, 0xc6, 0xe3, 0x7c, 0x55, 0xf8, 0x44, 0x30, 0xb1, 0x01, 0x0c, 0x45,
+  0x99, 0xf5, 0x9c, 0x13, 0xd8, 0x3a, 0xde, 0x09, 0x68, 0x03, 0x59, 0x81,
+  0x62, 0xcb, 0xc0, 0x2c, 0x65, 0x12, 0x15, 0x4f, 0x66, 0x6e, 0xaf, 0xef,
+  0x00, 0x56, 0x07, 0x73, 0x70, 0x59, 0xa8, 0x0a, 0x7b, 0x85, 0x30, 0x56,
+  0x2f, 0x31, 0x0e, 0x72, 0x79, 0x21, 0xf2, 0x88, 0xc2, 0xfe, 0x12, 0x48,
+  0x0b, 0xf8, 0xcf, 0x59, 0x80, 0x9a, 0x57, 0x05, 0x2d, 0x86, 0x0b, 0xbc,
+  0xaf, 0x2e, 0x8f, 0x2e, 0x4f, 0xc8, 0x1a, 0x5e, 0x0c, 0x5e, 0x9c, 0x40,
+  0x72, 0xd6, 0xd9, 0x03, 0xdb, 0x1a, 0xd0, 0xe8, 0x01, 0xeb, 0x79, 0xec,
+  0x78, 0x70, 0x76, 0x76, 0x0d, 0x8f, 0x7b, 0xa4, 0xfc, 0xf0, 0xb0, 0xef,
+  0xb1, 0xcb, 0xc1, 0xd5, 0xb3, 0xe7, 0xff, 0xb1, 0x50, 0x8f, 0xcd, 0x88,
+  0x81, 0xfd, 0xda, 0x0c, 0xa8, 0x19, 0xdf, 0x28, 0xfb, 0xa0, 0x75, 0xeb,
+  0xe0, 0x40, 0x64, 0x7d, 0x24, 0xa9, 0x0d, 0x16, 0x92, 0x12, 0xcc, 0xaf,
+  0x20, 0x94, 0x94, 0x52, 0xab, 0x5e, 0x39, 0x05, 0xf2, 0x47, 0x31, 0x64,
+  0xdb, 0xb4, 0x56, 0x1a, 0x4d, 0xb5, 0x44, 0x2c, 0x98, 0xca, 0x50, 0xed,
+  0x78, 0x15, 0x1e, 0xd3, 0x81, 0x2a, 0x2c, 0x8e, 0x69, 0x26, 0x72, 0x01,
+  0x9e, 0x1a, 0x53, 0x02, 0x7f, 0x96, 0x62, 0xac, 0x40, 0xe7, 0xa5, 0xdc,
+  0x76, 0x70, 0x17, 0x19, 0x2b, 0x86, 0x12, 0x4b, 0x2e, 0x15, 0xab, 0x0f,
+  0x2b, 0xf8, 0x31, 0x13, 0xd3, 0x2b, 0xf0, 0x95, 0x6a, 0x67, 0x72, 0x93,
+  0x5d, 0x03, 0x4e, 0xaf, 0x61, 0xdf, 0x50, 0xc6, 0x20, 0xdb, 0x1e, 0xa4,
+  0xc9, 0x66, 0x0b, 0x91, 0xc2, 0x69, 0x02, 0x91, 0x2d, 0x47, 0x51, 0xe1,
+  0x27, 0xb3, 0x0e, 0x3f, 0x52, 0xc3, 0x36, 0xbb, 0xe4, 0xb7, 0x90, 0x28,
+  0x1a, 0xce, 0xa0, 0x32, 0x83, 0x20, 0x77, 0x72, 0xab, 0x32, 0xf2, 0xf7,
+  0x4c, 0x2e, 0x52, 0x7e, 0xc0, 0x76, 0xd4, 0xf0, 0x0e, 0x6e, 0x82, 0xd9,
+  0x83, 0x4c, 0xd6, 0xa0, 0x68, 0xb4, 0x00, 0xe2, 0x49, 0x58, 0x03, 0x81,
+  0xb1, 0x1d, 0xb5, 0x95, 0x4e, 0xee, 0x72, 0x86, 0xc9, 0x65, 0xa9, 0x98,
+  0xa0, 0x3a, 0x52, 0xd7, 0x0f, 0x5b, 0xd1, 0xd8, 0x8e, 0x1c, 0x56, 0xaa,
+  0x02, 0x7a, 0xbf, 0xa5, 0xdf, 0x31, 0xd8, 0xdd, 0x23, 0x93, 0x24, 0x00,
+  0x1e, 0x8a, 0x3b, 0x6a, 0x99, 0x5b, 0x1f, 0xf0, 0x97, 0x63, 0x46, 0x9d,
+  0x43, 0x85, 0x11, 0x5f, 0x56, 0xd9, 0xb9, 0x4a, 0xff, 0x17, 0xcc, 0x58,
+  0x33, 0xaf, 0xb1, 0x82, 0x69, 0x56, 0x90, 0xe7, 0x98, 0x73, 0x86, 0x26,
+  0x5f, 0x85, 0xe7, 0xb9, 0xc8, 0xe2, 0x10, 0x8a, 0xbb, 0x60, 0x44, 0x41,
+  0x12, 0x53, 0x30, 0x4a, 0xcb, 0x8d, 0x1e, 0x07, 0x49, 0x5d, 0x8e, 0x76,
+  0xbe, 0xe6, 0x8e, 0x9c, 0x09, 0xaf, 0x68, 0x2f, 0xe4, 0x66, 0x59, 0x74,
+  0xe7, 0x73, 0x55, 0x5c, 0x51, 0x58, 0x41, 0x1e, 0xb0, 0x2a, 0xf9, 0x05,
+  0x32, 0xc5, 0x78, 0x36, 0xa5, 0xe2, 0x47, 0x81, 0x21, 0xe7, 0xc6, 0xeb,
+  0xa2, 0xa6, 0xb6, 0x00, 0xdf, 0x6f, 0xa0, 0x7a, 0xbf, 0x7b, 0xf4, 0xb0,
+  0x67, 0x1e, 0xf6, 0xd9, 0xef, 0xa4, 0x8c, 0x0e, 0xf4, 0x74, 0x16, 0xcb,
+  0x28, 0x05, 0x2f, 0x0b, 0x8e, 0x2b, 0xc8, 0x5a, 0x90, 0x3e, 0x14, 0xec,
+  0x11, 0x51, 0x00, 0xf5, 0x83, 0x30, 0x6c, 0x39, 0x7e, 0xbd, 0xfd, 0x10,
+  0xa9, 0xcc, 0xd2, 0x42, 0x26, 0xd5, 0xcd, 0xfc, 0x58, 0x89, 0x5c, 0x6f,
+  0x28, 0x91, 0xaf, 0x8d, 0x20, 0xbe, 0x31, 0x0f, 0x4f, 0xd6, 0x4b, 0xe4,
+  0x81, 0xf2, 0xb8, 0xf3, 0x16, 0xd4, 0x1a, 0x21, 0x23, 0x85, 0xf2, 0x30,
+  0x8f, 0x32, 0x50, 0x48, 0x78, 0x41, 0xd9, 0xba, 0x12, 0x8e, 0x47, 0x33,
+  0x54, 0xf5, 0x8f, 0xc9, 0x62, 0x28, 0xe6, 0x50, 0xd2, 0x40, 0x79, 0xaa,
+  0xfc, 0xdc, 0x2d, 0x2f, 0x44, 0x56, 0x11, 0x18, 0x2a, 0xe9, 0x2f, 0x9e,
+  0xfa, 0x7b, 0xed, 0x8a, 0x8d, 0xdb, 0xca, 0x9d, 0xb2, 0x92, 0x52, 0x31,
+  0x0f, 0xa6, 0x61, 0x4a, 0x74, 0x28, 0xdd, 0xab, 0xef, 0xfd, 0xa1, 0x08,
+  0x17, 0xe0, 0xd5, 0xab, 0xe3, 0x7d, 0x6b, 0x61, 0xea, 0x8d, 0xee, 0x1a,
+  0x60, 0x5d, 0x8b, 0x62, 0x81, 0x35, 0x2a, 0xc7, 0x57, 0xaf, 0xff, 0x8c,
+  0xf5, 0xa1, 0x54, 0x8a, 0x97, 0x38, 0x42, 0xa1, 0xb1, 0x88, 0x7a, 0x2e,
+  0x62, 0xeb, 0xe3, 0xfb, 0x06, 0xd0, 0x66, 0x0a, 0x55, 0xef, 0xef, 0x43,
+  0xe2, 0x6c, 0xb8, 0xd2, 0x15, 0x7b, 0xdb, 0xce, 0x52, 0x03, 0x4e, 0x6d,
+  0xa9, 0xd0, 0xf8, 0x31, 0x4f, 0x6e, 0xe4, 0x44, 0x1b, 0x3d, 0xb2, 0x36,
+  0x09, 0xe2, 0xb1, 0xc9, 0x68, 0xc7, 0xe2, 0x16, 0xe3, 0x83, 0xae, 0xd2,
+  0x31, 0xfb, 0x15, 0x29, 0xbe, 0xcb, 0x47, 0x19, 0xe7, 0x09, 0x4e, 0xa8,
+  0xa0, 0xdd, 0xd5, 0x85, 0x02, 0x7c, 0x6a, 0x55, 0x24, 0xe4, 0x23, 0xb2,
+  0x2e, 0xd8, 0x5c, 0x9b, 0xed, 0xda, 0xc4, 0xbd, 0xcb, 0xf6, 0x9e, 0x42,
+  0x52, 0xc8, 0x0a, 0xf2, 0x73, 0x5e, 0x54, 0xfb, 0xa1, 0x48, 0x76, 0x24,
+  0x65, 0xd8, 0x8a, 0xe0, 0xeb, 0x28, 0x94, 0x13, 0x8f, 0xe5, 0x11, 0x92,
+  0x72, 0x44, 0xa8, 0xa3, 0x19, 0xb2, 0x3a, 0x06, 0x6d, 0x0a, 0x91, 0x53,
+  0x35, 0x83, 0x4d, 0x38, 0x6a, 0x13, 0xe2, 0x56, 0xbc, 0x68, 0x0f, 0xd4,
+  0x02, 0x3e, 0x76, 0xb5, 0xda, 0xc0, 0x43, 0x65, 0x15, 0x5d, 0xa3, 0x36,
+  0x20, 0xd9, 0x08, 0xfe, 0x3c, 0x27, 0x24, 0x5a, 0x98, 0x16, 0xcf, 0x55,
+  0xea, 0x60, 0xb9, 0xbe, 0x0f, 0x16, 0x74, 0xaf, 0xf0, 0x12, 0xd6, 0xb5,
+  0x81, 0x1e, 0x35, 0x14, 0xf2, 0x8e, 0x22, 0x09, 0xe7, 0x6d, 0xc3, 0x2a,
+  0xed, 0x0a, 0x5b, 0xa5, 0xad, 0x50, 0x26, 0xd6, 0x29, 0xef, 0x0f, 0xfa,
+  0xe9, 0x76, 0x8d, 0x6b, 0x92, 0x79, 0xd3, 0xd2, 0xed, 0xb2, 0xcb, 0xa8,
+  0x51, 0x43, 0x2a, 0x88, 0x87, 0x02, 0x6a, 0x91, 0x69, 0x7b, 0x23, 0x81,
+  0xd8, 0x85, 0xe9, 0x2d, 0x4d, 0x78, 0x04, 0x8a, 0x98, 0x95, 0xd6, 0x89,
+  0x2d, 0xc1, 0x8a, 0x01, 0xe9, 0x66, 0xac, 0x3f, 0x0f, 0x32, 0x50, 0xbc,
+  0x9d, 0xd7, 0x47, 0x2f, 0x5f, 0x9c, 0xbe, 0xf8, 0xe9, 0x80, 0x95, 0x7a,
+  0x81, 0xfe, 0x1f, 0x39, 0xc4, 0xfb, 0x11, 0x54, 0xde, 0xd4, 0x43, 0x06,
+  0x17, 0x03, 0xa1, 0xf1, 0x4d, 0x82, 0x4e, 0x46, 0x53, 0xc3, 0x04, 0x00,
+  0xb8, 0x47, 0xff, 0xa2, 0xeb, 0xbb, 0xd0, 0xdf, 0x61, 0x45, 0x40, 0x2c,
+  0xa2, 0x30, 0xa5, 0xcf, 0xa7, 0x55, 0x37, 0x44, 0xf9, 0x39, 0xa5, 0xbc,
+  0x6e, 0x24, 0x76, 0x86, 0x9b, 0xc3, 0xb1, 0x0b, 0x80, 0x0e, 0x1c, 0xbb,
+  0x30, 0xf4, 0xd1, 0x8d, 0xc5, 0x1f, 0xe5, 0x72, 0x54, 0x1e, 0xde, 0x3d,
+  0x74, 0x78, 0xf9, 0x74, 0x6a, 0x58, 0xda, 0xec, 0x77, 0xaa, 0x83, 0x44,
+  0x06, 0x0e, 0xe5, 0x75, 0x8b, 0xb9, 0xdd, 0x26, 0x5d, 0xb1, 0xc3, 0x27,
+  0x33, 0xae, 0x5a, 0x4e, 0x5e, 0x2d, 0x53, 0x45, 0xbb, 0x72, 0xa5, 0xe9,
+  0x2a, 0xa0, 0xcd, 0x33, 0x43, 0x48, 0x84, 0x2e, 0x32, 0xf1, 0x87, 0x6a,
+  0x8b, 0x9f, 0x53, 0xa4, 0x6b, 0xb9, 0x90, 0xb0, 0x89, 0x69, 0x20, 0x47,
+  0x13, 0x4a, 0xf1, 0x5a, 0xa5, 0xc4, 0xb1, 0x41, 0xeb, 0x3e, 0xad, 0x12,
+  0x11, 0xfb, 0x5d, 0x5a, 0xcb, 0x26, 0xba, 0x34, 0x98, 0xc9, 0xbf, 0x96,
+  0x32, 0xed, 0xfe, 0x85, 0x94, 0xa9, 0xfb, 0xff, 0xa3, 0x4c, 0x6a, 0x21,
+  0x25, 0x55, 0x72, 0xd2, 0x21, 0x27, 0xc9, 0x68, 0xaa, 0x23, 0x09, 0x9f,
+  0x4e, 0x0c, 0x60, 0xcd, 0x8b, 0x56, 0x31, 0x41, 0x67, 0x17, 0xee, 0x71,
+  0x40, 0xdb, 0xe4, 0x9c, 0xba, 0x5d, 0xaa, 0x13, 0x13, 0x08, 0xbe, 0x8f,
+  0x16, 0x1d, 0xac, 0x24, 0x3b, 0xf0, 0x83, 0x27, 0x57, 0x94, 0xdc, 0x15,
+  0x98, 0x83, 0x14, 0xd2, 0x49, 0xa7, 0x9a, 0x54, 0xa5, 0xa6, 0xc5, 0xa6,
+  0x8a, 0x93, 0x31, 0x54, 0x97, 0xec, 0x1d, 0xa1, 0x31, 0x7d, 0x58, 0x85,
+  0xd4, 0x16, 0x49, 0x46, 0x31, 0x02, 0xd0, 0xad, 0xfd, 0x96, 0xc9, 0x67,
+  0xee, 0x3c, 0xf3, 0xf4, 0xae, 0x11, 0x65, 0x81, 0x04, 0x94, 0xaf, 0x82,
+  0x82, 0x9e, 0xf3, 0xb7, 0x99, 0x2c, 0xb0, 0x81, 0x1f, 0xb2, 0x8f, 0x5f,
+  0x15, 0x98, 0x77, 0x1d, 0x22, 0x96, 0xe0, 0x42, 0x13, 0x24, 0x03, 0xa8,
+  0x36, 0x8a, 0xbf, 0xfc, 0xd2, 0x34, 0x05, 0x0e, 0xdd, 0xb6, 0x80, 0xd5,
+  0xfb, 0x4a, 0xa9, 0xd9, 0x5a, 0x52, 0x9b, 0xb1, 0x6a, 0xa9, 0xc8, 0xbe,
+  0x3a, 0x74, 0x5a, 0x2f, 0x7d, 0xbd, 0x2e, 0x18, 0x34, 0xb5, 0x9b, 0xdd,
+  0x24, 0x9e, 0x83, 0x4a, 0xe3, 0xb1, 0x0e, 0x4d, 0x83, 0x5d, 0x1a, 0x72,
+  0xf8, 0x91, 0x73, 0x4c, 0x93, 0x4c, 0x3e, 0xae, 0x1a, 0xb3, 0x55, 0x09,
+  0x97, 0x4c, 0xcf, 0x6d, 0x98, 0x36, 0x99, 0x60, 0xf9, 0xbd, 0xc2, 0xd3,
+  0x76, 0x74, 0xc5, 0xb0, 0x81, 0x6c, 0xae, 0x61, 0xc2, 0xd9, 0xa1, 0x12,
+  0x0b, 0x45, 0x63, 0xba, 0x89, 0x01, 0xf7, 0x2d, 0x62, 0xd8, 0x84, 0x38,
+  0xf5, 0x27, 0xb1, 0xe4, 0xb8, 0x38, 0xed, 0xc0, 0x63, 0x03, 0x6d, 0x18,
+  0x75, 0x89, 0x99, 0x04, 0xb6, 0xa3, 0x5e, 0xb8, 0x74, 0xa8, 0x15, 0x19,
+  0x84, 0xd1, 0x2c, 0xaf, 0x67, 0xd9, 0xa0, 0x38, 0xb9, 0xf5, 0x97, 0x2e,
+  0x43, 0x7a, 0xc2, 0x1a, 0x81, 0x58, 0xb4, 0x75, 0x99, 0x98, 0xb4, 0xb3,
+  0x49, 0x22, 0xc5, 0x3b, 0x8d, 0xc0, 0x11, 0x09, 0x15, 0xa3, 0xda, 0xa0,
+  0x81, 0x3a, 0x1e, 0x43, 0x23, 0x45, 0x7d, 0xa0, 0xb8, 0xbd, 0xe5, 0x76,
+  0xa9, 0x6c, 0xa1, 0xa7, 0xa7, 0x5b, 0xcb, 0x38, 0x34, 0x88, 0x75, 0x66,
+  0x9f, 0x23, 0x75, 0x25, 0x13, 0x77, 0x44, 0x2b, 0x43, 0xbf, 0x98, 0xba,
+  0xa8, 0x4d, 0x1d, 0x89, 0x5c, 0x4f, 0x75, 0xc0, 0xde, 0x6d, 0x40, 0x81,
+  0x26, 0x5a, 0x0a, 0x4d, 0x8e, 0x09, 0x0f, 0x02, 0xc9, 0x3b, 0x29, 0xdf,
+  0x0a, 0xae, 0xa9, 0x73, 0x4b, 0xdd, 0xa9, 0xfb, 0xf8, 0x29, 0xd3, 0xb0,
+  0xd2, 0xd5, 0xaf, 0x2d, 0xc1, 0xc8, 0x5b, 0x96, 0xbc, 0xa3, 0x92, 0x96,
+  0x70, 0x6a, 0x62, 0xf7, 0x98, 0xd9, 0x8f, 0x85, 0x78, 0x73, 0x24, 0x9b,
+  0x3c, 0x6a, 0xad, 0x93, 0xba, 0x55, 0x69, 0xb7, 0x6e, 0xb9, 0x6d, 0x55,
+  0xaa, 0xc0, 0xa9, 0xa4, 0xef, 0x79, 0xf4, 0x53, 0x2c, 0x5f, 0xc7, 0x02,
+  0x3c, 0x75, 0x52, 0x4e, 0x3c, 0xca, 0x0f, 0xf4, 0xae, 0x83, 0xf8, 0x74,
+  0x84, 0xc1, 0xb0, 0x16, 0xc3, 0xba, 0x31, 0x31, 0xf7, 0x4c, 0xd8, 0xc9,
+  0xb4, 0xd7, 0xc1, 0x02, 0x5d, 0x9f, 0x82, 0xb4, 0xff, 0xbd, 0xcf, 0xfe,
+  0xc6, 0x94, 0x71, 0x20, 0xee, 0x1c, 0x8f, 0x5f, 0xf3, 0x29, 0x14, 0x6a,
+  0x1d, 0xe5, 0x5e, 0x41, 0x5c, 0x99, 0xb8, 0x8b, 0xa6, 0x6a, 0x22, 0x6e,
+  0xc7, 0x5d, 0x77, 0xbf, 0x8d, 0x5c, 0x82, 0x95, 0xdc, 0xc1, 0xec, 0x2e,
+  0x7b, 0x6a, 0xdd, 0xa3, 0xdb, 0xe7, 0xf5, 0x4d, 0x4b, 0xe1, 0x52, 0xbc,
+  0x02, 0x11, 0x83, 0xc6, 0xb7, 0x1a, 0xa3, 0x13, 0xec, 0xb5, 0x61, 0x00,
+  0xef, 0x0a, 0xfc, 0xf9, 0x27, 0x7b, 0x8a, 0xe5, 0x07, 0xa2, 0x2f, 0x77,
+  0x83, 0x21, 0xa3, 0x92, 0x2d, 0x17, 0xc3, 0x5b, 0xfb, 0xaa, 0xad, 0x71,
+  0x94, 0xfd, 0xee, 0xda, 0xd0, 0xbe, 0x55, 0xe2, 0xd7, 0xd9, 0xec, 0x1a,
+  0x8b, 0x7d, 0x03, 0xed, 0xb0, 0x83, 0xf0, 0x6c, 0x09, 0x43, 0x95, 0x20,
+  0x6e, 0x9a, 0x7c, 0x5c, 0x95, 0xf8, 0xb5, 0x20, 0xde, 0xdc, 0x58, 0x2e,
+  0x19, 0x69, 0x4d, 0x15, 0x7b, 0x8a, 0xab, 0xe6, 0xc6, 0x71, 0x01, 0x5c,
+  0x34, 0x99, 0x6b, 0xe0, 0x3a, 0x0f, 0x2b, 0x7a, 0xcb, 0x35, 0x6d, 0x5e,
+  0x95, 0x3f, 0x6d, 0x26, 0x62, 0x27, 0x7b, 0x69, 0xb5, 0xcb, 0x2d, 0x4f,
+  0x58, 0x43, 0xe9, 0x2c, 0xb2, 0x26, 0x95, 0x8c, 0xcb, 0x59, 0x96, 0xa8,
+  0xf3, 0x89, 0xca, 0x44, 0x1d, 0x8e, 0x82, 0x78, 0xdd, 0x64, 0xb2, 0x3a,
+  0x33, 0xdb, 0x02, 0x2d, 0x89, 0xc2, 0xee, 0xc4, 0xfd, 0x52, 0x3f, 0xe3,
+  0x49, 0x4f, 0xfd, 0xda, 0xd5, 0x29, 0x70, 0xe5, 0x44, 0x98, 0xf8, 0xab,
+  0x10, 0x70, 0x32, 0xf4, 0x12, 0x62, 0x42, 0x9a, 0x8a, 0x39, 0x58, 0xb6,
+  0xff, 0xdd, 0x37, 0x9e, 0x46, 0x58, 0x5c, 0x4d, 0x68, 0xd7, 0x90, 0x81,
+  0xdc, 0xf1, 0xf0, 0xef, 0x18, 0x12, 0xc8, 0x96, 0xea, 0x99, 0x97, 0x6a,
+  0x07, 0x85, 0xc0, 0xde, 0x29, 0x39, 0xd4, 0xc7, 0x93, 0x00, 0xa3, 0x28,
+  0xe2, 0x66, 0xd1, 0x2c, 0x3f, 0xcd, 0xe8, 0xef, 0x31, 0x1f, 0x07, 0xb3,
+  0x58, 0xb6, 0x9c, 0xbc, 0x46, 0xbd, 0x57, 0x27, 0x8e, 0x84, 0x42, 0x21,
+  0x75, 0x0f, 0x1d, 0x7d, 0x3a, 0x70, 0x24, 0xca, 0x5b, 0x25, 0xca, 0xc5,
+  0xed, 0x80, 0x43, 0x75, 0xa1, 0xc5, 0xa1, 0x4c, 0x79, 0x76, 0x49, 0xb9,
+  0xd5, 0xb9, 0x8b, 0x7a, 0xe3, 0x1c, 0x14, 0x2a, 0x5f, 0xa7, 0xd8, 0x50,
+  0x7d, 0x84, 0x5f, 0xbc, 0xd2, 0xc7, 0xeb, 0x86, 0x16, 0xcb, 0x26, 0x5c,
+  0xe3, 0x69, 0x68, 0x23, 0xd3, 0xea, 0x52, 0xc4, 0x26, 0x2c, 0xd3, 0xc1,
+  0x50, 0xdf, 0x29, 0xc3, 0x3e, 0x2b, 0xc3, 0x78, 0xea, 0xd4, 0xc4, 0x2f,
+  0x5d, 0x94, 0xd8, 0x84, 0x5d, 0x40, 0xa0, 0x86, 0xcd, 0x81, 0xe8, 0xe6,
+  0xac, 0x16, 0x3a, 0x45, 0x18, 0xbf, 0xa8, 0x27, 0xb5, 0x24, 0x03, 0xd5,
+  0x5d, 0xc5, 0x48, 0x48, 0xa6, 0x7e, 0x06, 0x8e, 0x9e, 0x27, 0x3c, 0x83,
+  0x82, 0x88, 0x56, 0x82, 0xc9, 0xc7, 0x8e, 0x67, 0xd4, 0xf6, 0x1c, 0x3e,
+  0x79, 0x46, 0x25, 0xfb, 0x1b, 0x21, 0x98, 0xa5, 0xc5, 0xf4, 0xab, 0xb4,
+  0x3c, 0xb9, 0xb1, 0x6a, 0x73, 0x0e, 0x85, 0x08, 0xea, 0xc3, 0x12, 0x13,
+  0x42, 0x5e, 0x1e, 0x66, 0x42, 0xab, 0x6d, 0xe8, 0xb3, 0xf7, 0xa4, 0x2b,
+  0x35, 0x86, 0x3e, 0xbc, 0x34, 0xd1, 0xee, 0x1e, 0xc6, 0x68, 0xcf, 0xdc,
+  0x37, 0x53, 0x0a, 0x3b, 0x83, 0x12, 0x15, 0x2c, 0x16, 0xed, 0xb9, 0xa0,
+  0xc5, 0xe4, 0x95, 0x0e, 0xfc, 0x8b, 0x9e, 0xaf, 0xca, 0x36, 0x20, 0x9d,
+  0x08, 0x46, 0x99, 0xc8, 0x73, 0x36, 0x9f, 0xe0, 0xc5, 0x4a, 0xdd, 0xc1,
+  0xbd, 0x11, 0x3c, 0x67, 0x8f, 0xc1, 0xa3, 0x86, 0xfc, 0x06, 0x06, 0x8a,
+  0x0b, 0x6c, 0x66, 0x87, 0xdd, 0xa2, 0xc9, 0xf5, 0xc5, 0xbb, 0xee, 0x85,
+  0x00, 0x48, 0x52, 0x9b, 0x3b, 0x9b, 0xc6, 0x4f, 0xbb, 0x37, 0x94, 0x1a,
+  0x38, 0x9b, 0xa5, 0xce, 0x89, 0x44, 0x2c, 0x60, 0xa4, 0xc4, 0x64, 0x20,
+  0x25, 0x9f, 0xa6, 0xea, 0x6e, 0xd6, 0x8d, 0x40, 0x76, 0x3d, 0xbc, 0x95,
+  0xa1, 0x32, 0x77, 0xd5, 0x90, 0xde, 0x7b, 0xda, 0xab, 0xf2, 0x6c, 0x3a,
+  0xc8, 0xcd, 0x1c, 0x2f, 0x96, 0x35, 0x4c, 0x57, 0xb0, 0xec, 0xfa, 0x49,
+  0x15, 0xda, 0x8b, 0xab, 0x13, 0x0d, 0x8d, 0xe7, 0x8a, 0xb2, 0xa8, 0x73,
+  0xed, 0x46, 0x5d, 0x59, 0xe5, 0x03, 0xcd, 0x7d, 0x83, 0x8d, 0x15, 0xa5,
+  0xb8, 0x7b, 0x50, 0xd2, 0x13, 0x83, 0xc7, 0x73, 0x2f, 0x3a, 0xe8, 0x85,
+  0x15, 0xbd, 0x2f, 0x23, 0x9c, 0xbf, 0xd1, 0x59, 0xb2, 0x62, 0xd5, 0xd8,
+  0xba, 0x6a, 0xca, 0x9a, 0xc3, 0x0c, 0x77, 0xa9, 0xa5, 0xa9, 0xdf, 0x2f,
+  0x99, 0x3a, 0x98, 0x49, 0x3b, 0xb7, 0xea, 0xc4, 0x95, 0x34, 0xed, 0xd5,
+  0x8a, 0xf5, 0xc2, 0x34, 0xde, 0xf9, 0x3e, 0xee, 0x59, 0xdd, 0x39, 0xd9,
+  0x58, 0x8e, 0xe6, 0xfe, 0x49, 0x49, 0x8a, 0x0a, 0x87, 0x57, 0x5c, 0x72,
+  0xd1, 0x2b, 0xb2, 0xcd, 0xfb, 0x96, 0xbd, 0xb7, 0x82, 0xcd, 0x12, 0xfb,
+  0x6c, 0xba, 0x17, 0x45, 0x30, 0xd0, 0x1d, 0x20, 0x75, 0x0f, 0x66, 0x43,
+  0xbf, 0xaf, 0xa8, 0x94, 0xd2, 0xb8, 0x06, 0xef, 0x8a, 0x8a, 0xdf, 0xdd,
+  0xd5, 0xee, 0x75, 0xb7, 0x7b, 0x7f, 0x0f, 0x6b, 0x03, 0x43, 0x46, 0x31,
+  0xe4, 0x21, 0xc1, 0x65, 0x13, 0x14, 0x2b, 0xc2, 0x4b, 0x63, 0x74, 0xb1,
+  0xb7, 0x09, 0x14, 0x48, 0x63, 0xae, 0xde, 0x24, 0x8f, 0xd7, 0x78, 0x4f,
+  0xfa, 0x3e, 0xe1, 0x06, 0x6a, 0x9f, 0x66, 0xcb, 0xc4, 0x17, 0xcd, 0x3b,
+  0xb3, 0x41, 0x7c, 0x32, 0x6f, 0x72, 0x29, 0x52, 0x48, 0xe5, 0xd3, 0xe0,
+  0x86, 0x92, 0x5e, 0x27, 0x74, 0x85, 0x45, 0x15, 0x5a, 0x4e, 0x08, 0xe9,
+  0xa6, 0xb7, 0xaa, 0x51, 0xab, 0xb7, 0xa2, 0xdf, 0xe3, 0x55, 0xba, 0xd7,
+  0x7c, 0xf8, 0x73, 0x24, 0xc1, 0xa3, 0x0d, 0x52, 0xac, 0x2f, 0xbb, 0xec,
+  0xe4, 0x2e, 0x8d, 0x45, 0xc6, 0x33, 0xf6, 0x9d, 0xb2, 0x34, 0x8d, 0xb8,
+  0x8a, 0x6d, 0x49, 0x62, 0x14, 0x42, 0xae, 0x1e, 0xc5, 0xcd, 0xa4, 0x7e,
+  0x8c, 0x32, 0x3e, 0x16, 0x77, 0x25, 0xb4, 0x9d, 0xd2, 0xbc, 0x8a, 0x2a,
+  0x2b, 0x20, 0xd7, 0x9f, 0x34, 0xfa, 0x84, 0x92, 0x3b, 0xa1, 0x29, 0xdf,
+  0x37, 0x4f, 0xb1, 0x1e, 0x88, 0x48, 0x54, 0x2d, 0x62, 0xc3, 0xc4, 0x64,
+  0xad, 0x7e, 0xd5, 0x34, 0xe9, 0x67, 0xbe, 0xb8, 0x6f, 0xe2, 0xef, 0xa8,
+  0x91, 0xba, 0xaf, 0xe8, 0xaa, 0xd1, 0x5a, 0x77, 0x95, 0xcf, 0x23, 0x60,
+  0xcd, 0xee, 0xc9, 0x1b, 0xbe, 0x78, 0x26, 0x42, 0x7b, 0x5a, 0xb1, 0x35,
+  0x0a, 0xe8, 0xe0, 0x16, 0xb1, 0xe0, 0xfd, 0x46, 0xff, 0xea, 0xe2, 0xc0,
+  0x71, 0xb8, 0xe4, 0x88, 0x7a, 0x5e, 0x01, 0x60, 0x2f, 0xf2, 0x2a, 0xdf,
+  0xd6, 0x20, 0xb7, 0xad, 0xad, 0x61, 0xc6, 0x83, 0x37, 0xfd, 0x46, 0xec,
+  0xfa, 0x72, 0x64, 0x03, 0x85, 0xce, 0x27, 0xa3, 0x41, 0xb7, 0x33, 0xab,
+  0x14, 0x6a, 0xc8, 0x75, 0x0b, 0xe6, 0x01, 0xf8, 0xd5, 0x5d, 0xcf, 0x2a,
+  0x81, 0xce, 0x47, 0x90, 0xa8, 0xa5, 0xb7, 0xf4, 0xed, 0x09, 0xd2, 0xb5,
+  0x07, 0x67, 0xb7, 0x95, 0x6d, 0x27, 0x8c, 0x3c, 0xd7, 0x2d, 0xce, 0xf2,
+  0xee, 0xef, 0x1d, 0xd0, 0x19, 0x75, 0xc2, 0x3b, 0xea, 0x6b, 0x1f, 0x94,
+  0x09, 0xd1, 0xd7, 0x37, 0x54, 0x5a, 0xa2, 0x22, 0xf0, 0x3d, 0x92, 0xd2,
+  0x8a, 0x4f, 0x75, 0x2f, 0xe8, 0x69, 0x80, 0x25, 0x95, 0xa2, 0xe6, 0x92,
+  0x6e, 0x01, 0x81, 0x58, 0x6f, 0xb8, 0x0d, 0xa9, 0xb5, 0x37, 0x26, 0xba,
+  0xd6, 0x76, 0x6a, 0x9f, 0x56, 0x23, 0xe7, 0xa2, 0xb6, 0x1a, 0x32, 0xfb,
+  0x86, 0xc5, 0xac, 0xca, 0x9a, 0x1a, 0x97, 0xe2, 0x14, 0x90, 0xca, 0xdf,
+  0xde, 0x59, 0x9f, 0x58, 0x5f, 0x81, 0xf5, 0x6a, 0xf6, 0xd5, 0x9e, 0x79,
+  0xd5, 0x2f, 0x30, 0x2c, 0x96, 0x63, 0xb8, 0x5e, 0x8e, 0xe1, 0xda, 0xc1,
+  0x50, 0xdc, 0x19, 0x71, 0x0e, 0x48, 0x42, 0x3c, 0x1a, 0x09, 0xf1, 0x50,
+  0x04, 0x28, 0xec, 0xe2, 0x2f, 0x2d, 0xb5, 0x6a, 0xe1, 0x0b, 0x16, 0xe8,
+  0x5e, 0x19, 0x6a, 0x12, 0xec, 0xe3, 0x03, 0x46, 0x5f, 0x74, 0x82, 0x54,
+  0xba, 0x26, 0x5a, 0x30, 0x81, 0x06, 0xc1, 0xae, 0xc8, 0xa1, 0x1a, 0xe5,
+  0x6a, 0x2b, 0xdd, 0xc6, 0x52, 0xf7, 0x23, 0x95, 0x23, 0x54, 0x11, 0xf4,
+  0xa0, 0x89, 0xbc, 0xed, 0xd0, 0x6d, 0x98, 0x39, 0xad, 0x8c, 0x0a, 0x4d,
+  0xb6, 0x3c, 0xfd, 0x1c, 0x85, 0xea, 0xfa, 0x44, 0xe0, 0x33, 0xd5, 0xb0,
+  0xf7, 0xf2, 0x2d, 0xec, 0xd3, 0xf9, 0x96, 0x02, 0xb4, 0xb2, 0x39, 0xa5,
+  0x2b, 0xc0, 0x15, 0x45, 0x6b, 0xac, 0x90, 0x1f, 0xa2, 0x4b, 0x0f, 0x2b,
+  0x9c, 0x3f, 0xa6, 0x72, 0xfe, 0x9c, 0xa5, 0xf3, 0xd6, 0xe7, 0x2a, 0x9d,
+  0x3f, 0x73, 0xed, 0xbc, 0x41, 0xf1, 0xbc, 0x59, 0x44, 0xdf, 0x57, 0xee,
+  0xec, 0x13, 0xc4, 0x89, 0x35, 0x6a, 0x69, 0xea, 0xf5, 0x92, 0x56, 0xfe,
+  0x05, 0xc3, 0x46, 0x11, 0x37, 0xac, 0x31, 0x35, 0x44, 0x8d, 0x07, 0x74,
+  0x0d, 0xd6, 0xb5, 0x0d, 0x96, 0x14, 0xff, 0x1b, 0x76, 0x0e, 0x9a, 0xbb,
+  0x0e, 0xba, 0x75, 0xb0, 0xb6, 0x77, 0xb0, 0x99, 0x2e, 0x7d, 0xb2, 0xd0,
+  0xb8, 0x46, 0x95, 0x54, 0xb7, 0xa2, 0xa4, 0x48, 0xf5, 0x66, 0xc4, 0x43,
+  0x7c, 0xdb, 0xbd, 0x7a, 0x14, 0x9b, 0x37, 0x29, 0x56, 0x76, 0x29, 0xd6,
+  0x8a, 0x76, 0xe3, 0x88, 0x5d, 0x8f, 0xb7, 0x50, 0x82, 0x7d, 0x64, 0xef,
+  0xe2, 0xa3, 0x3a, 0x07, 0x95, 0x6f, 0x24, 0x37, 0x35, 0xc6, 0xf1, 0x7b,
+  0x93, 0xfc, 0x4e, 0xc2, 0xeb, 0xd9, 0x8e, 0xe7, 0xde, 0x28, 0xb3, 0x49,
+  0x02, 0x5b, 0x12, 0xf7, 0xd9, 0x07, 0xb7, 0xc5, 0xb1, 0x01, 0x29, 0x6a,
+  0x92, 0xa0, 0x63, 0x2f, 0xda, 0x24, 0x58, 0x82, 0x3e, 0x04, 0x0b, 0x95,
+  0xfc, 0x05, 0x1a, 0xea, 0x88, 0xdc, 0x13, 0xcf, 0xf1, 0xe0, 0x9c, 0xe6,
+  0xbe, 0x82, 0x58, 0x18, 0x2f, 0xc7, 0x85, 0x06, 0x35, 0xb6, 0x3d, 0x82,
+  0x0d, 0xf0, 0x16, 0x35, 0x13, 0xe0, 0x2c, 0x3e, 0xdc, 0x93, 0x3b, 0xa3,
+  0x3d, 0x06, 0x07, 0x47, 0x03, 0xb8, 0x3f, 0x06, 0xdd, 0xd5, 0xb2, 0xcf,
+  0x0e, 0x8e, 0xed, 0xad, 0x79, 0x94, 0xc0, 0x6e, 0x34, 0xcd, 0x85, 0xe2,
+  0xd1, 0xee, 0x93, 0x6e, 0x14, 0x94, 0x66, 0xaa, 0xaf, 0x26, 0x81, 0xb3,
+  0xc5, 0x2b, 0x68, 0xea, 0xda, 0x40, 0x20, 0x55, 0xfa, 0xb9, 0x5d, 0x3b,
+  0x9a, 0xc5, 0x23, 0xd2, 0x86, 0xef, 0xda, 0x83, 0x42, 0x09, 0x29, 0xe8,
+  0xc6, 0xda, 0x21, 0x1b, 0xa8, 0x73, 0x61, 0x88, 0xf1, 0x38, 0x4b, 0xdf,
+  0xfb, 0x23, 0xae, 0x8e, 0xb5, 0xe6, 0xf3, 0xcc, 0x99, 0x00, 0x68, 0x57,
+  0x62, 0xf4, 0xf1, 0x3e, 0x1d, 0xb8, 0x34, 0x74, 0x20, 0x80, 0xbd, 0x01,
+  0xb6, 0xbf, 0xfd, 0x5f, 0x95, 0x4a, 0xef, 0x35, 0x8d, 0x42, 0x00, 0x00
+};
+unsigned int OrbitControls_js_gz_len = 4176;
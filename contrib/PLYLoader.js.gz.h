@@ -0,0 +1,244 @@
+#pragma once
+
+unsigned char PLYLoader_js_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1a,
+  0xed, 0x6e, 0xdb, 0x38, 0xf2, 0xb7, 0xf3, 0x14, 0x5c, 0xe3, 0xb0, 0x96,
+  0x1b, 0x55, 0x6e, 0x92, 0x6e, 0x51, 0xd8, 0xcd, 0xdd, 0xb5, 0x69, 0xd3,
+  0x16, 0x48, 0x7b, 0x45, 0x9b, 0x76, 0xef, 0xe0, 0x04, 0x86, 0x2c, 0xd1,
+  0xb1, 0x5a, 0x59, 0xf2, 0x8a, 0x54, 0x12, 0xdf, 0xae, 0x81, 0x7d, 0x90,
+  0xbb, 0x97, 0xdb, 0x27, 0xd9, 0x19, 0x7e, 0x89, 0x94, 0x25, 0xc7, 0xdb,
+  0x1e, 0x16, 0x87, 0xa2, 0xb1, 0x49, 0x0e, 0xe7, 0x7b, 0x86, 0x33, 0xa4,
+  0x07, 0xf7, 0xee, 0xed, 0x91, 0x7b, 0xe4, 0xef, 0x61, 0xc9, 0xe7, 0x79,
+  0x41, 0x7e, 0xa4, 0x09, 0x79, 0x43, 0xb3, 0x2b, 0x32, 0x20, 0x73, 0xce,
+  0x97, 0xc3, 0xc1, 0x20, 0x9c, 0xe6, 0x25, 0x0f, 0x16, 0x74, 0xb0, 0xa0,
+  0xd9, 0x4d, 0xb8, 0x02, 0x60, 0x84, 0x7f, 0x4e, 0x59, 0x54, 0x24, 0x4b,
+  0x9e, 0xe4, 0xd9, 0x90, 0x3c, 0x25, 0xe7, 0xaf, 0xde, 0xbf, 0x78, 0x41,
+  0xd2, 0x3c, 0x8c, 0x69, 0x41, 0x66, 0x80, 0xe7, 0xdd, 0xd9, 0xbf, 0xc8,
+  0xd3, 0x0f, 0x27, 0xaf, 0x5f, 0x93, 0x59, 0x92, 0x52, 0x46, 0xbc, 0x2f,
+  0x59, 0x7e, 0x93, 0x91, 0x90, 0x11, 0x3e, 0xa7, 0xe4, 0x5d, 0x9e, 0xae,
+  0xae, 0xf2, 0x8c, 0x9c, 0xc2, 0x1a, 0x39, 0xcd, 0x8b, 0x45, 0xc8, 0x09,
+  0x6c, 0xc2, 0xa5, 0x0f, 0x3c, 0xcc, 0x00, 0x41, 0x4c, 0xce, 0x8b, 0x24,
+  0xcc, 0xae, 0xcc, 0x7a, 0x3f, 0x90, 0x94, 0x91, 0xf8, 0x59, 0xb2, 0x48,
+  0x78, 0x88, 0xb4, 0xd9, 0x50, 0x51, 0x89, 0x69, 0x94, 0xc7, 0x09, 0xf0,
+  0x1d, 0x32, 0x56, 0x2e, 0x80, 0x20, 0x92, 0x25, 0x09, 0x23, 0x1f, 0xcf,
+  0x4f, 0xef, 0x3f, 0x56, 0x7b, 0xc9, 0x47, 0x16, 0x5e, 0xd1, 0x21, 0x7c,
+  0xeb, 0x5c, 0x87, 0x85, 0x66, 0xf7, 0x98, 0x64, 0xf4, 0x46, 0x4a, 0x10,
+  0x00, 0xdb, 0x67, 0x62, 0xd6, 0xeb, 0x8f, 0x10, 0x4c, 0x82, 0x04, 0xf8,
+  0xe1, 0xf5, 0x82, 0xc1, 0x22, 0x8f, 0x69, 0xca, 0x06, 0xcb, 0x74, 0x35,
+  0x08, 0x59, 0x94, 0x24, 0x83, 0x38, 0x4f, 0x97, 0xf3, 0x24, 0x63, 0x01,
+  0x4c, 0xf5, 0x7c, 0x32, 0x2b, 0xb3, 0x08, 0xd9, 0x22, 0xde, 0x15, 0xcd,
+  0x17, 0x94, 0x17, 0xab, 0x3e, 0xf9, 0x59, 0xd2, 0xee, 0x74, 0x58, 0x44,
+  0x33, 0x1a, 0x84, 0x71, 0xec, 0x59, 0x04, 0xdf, 0x50, 0x36, 0xf7, 0x88,
+  0x86, 0x26, 0x7d, 0x22, 0xe8, 0x22, 0xfc, 0xda, 0x7c, 0x25, 0xaf, 0x67,
+  0x52, 0x6b, 0xa0, 0x53, 0x21, 0x56, 0xc9, 0x40, 0xc0, 0x0c, 0xc8, 0x30,
+  0x50, 0x56, 0x1c, 0x82, 0xb2, 0x96, 0x45, 0xbe, 0xa4, 0x05, 0x5f, 0x91,
+  0x2c, 0x04, 0xe1, 0x7d, 0x04, 0x5f, 0x91, 0x28, 0xcc, 0xc8, 0x94, 0x92,
+  0x45, 0xb8, 0x5c, 0xd2, 0x98, 0xdc, 0xcc, 0x61, 0x2b, 0x62, 0x43, 0x61,
+  0x40, 0x53, 0x01, 0x2a, 0x96, 0xd0, 0xdb, 0x70, 0xb1, 0x4c, 0xa9, 0xd8,
+  0x01, 0x86, 0x4b, 0xd3, 0xfc, 0x06, 0xb5, 0x08, 0x7b, 0xa4, 0xa5, 0x14,
+  0xe2, 0x84, 0x32, 0xdc, 0xfa, 0xdb, 0xaf, 0xff, 0x89, 0x93, 0xd9, 0x0c,
+  0xe8, 0x4f, 0xbc, 0x82, 0xc6, 0xbf, 0x5c, 0x15, 0x94, 0x66, 0xbf, 0x4c,
+  0xd3, 0x92, 0xf6, 0x7f, 0xfb, 0xf5, 0xbf, 0x24, 0xc9, 0x24, 0x1a, 0xe4,
+  0x91, 0xe7, 0x15, 0x77, 0x51, 0x9e, 0x02, 0x29, 0xc1, 0x9a, 0xb6, 0x84,
+  0x52, 0x2c, 0xa3, 0xfc, 0x9d, 0x62, 0xfd, 0x2d, 0x2c, 0xbf, 0x01, 0x56,
+  0x81, 0xbc, 0x27, 0x94, 0xd6, 0xd1, 0xa4, 0x80, 0xd2, 0x90, 0xf4, 0xe0,
+  0x6f, 0xcf, 0xb7, 0xa7, 0x05, 0x71, 0x58, 0x10, 0x9f, 0xee, 0x12, 0x72,
+  0x04, 0x2b, 0xf8, 0xd1, 0x43, 0x6a, 0x95, 0x2e, 0x07, 0x7b, 0x7b, 0x7b,
+  0x35, 0x53, 0x83, 0x03, 0x54, 0x76, 0x43, 0x7b, 0xed, 0x75, 0xf8, 0x3c,
+  0x01, 0x93, 0x6e, 0x32, 0x06, 0xa0, 0x3f, 0xaf, 0x47, 0x7b, 0x7b, 0xf8,
+  0xbf, 0x86, 0x05, 0xc1, 0x79, 0xce, 0x57, 0x4b, 0x8a, 0x40, 0x80, 0x23,
+  0x02, 0xef, 0xe4, 0x45, 0x19, 0xf1, 0xbc, 0x18, 0xd6, 0xbd, 0xcb, 0x87,
+  0xf5, 0x66, 0xd1, 0x87, 0x16, 0x2f, 0xc2, 0x72, 0x48, 0x55, 0x32, 0xb5,
+  0x8d, 0x2b, 0x05, 0x09, 0x6c, 0x75, 0xd6, 0x88, 0x1c, 0xd5, 0xeb, 0xa0,
+  0x2a, 0x8b, 0xd4, 0x07, 0x87, 0x48, 0xd3, 0x69, 0x18, 0x7d, 0xd1, 0x08,
+  0x31, 0x08, 0x58, 0x94, 0x0b, 0x96, 0x11, 0xf9, 0x48, 0xcd, 0x15, 0xf4,
+  0xa7, 0x92, 0x32, 0xae, 0x22, 0xe3, 0x9f, 0x6f, 0xce, 0x5e, 0x41, 0x2a,
+  0x78, 0x2f, 0x27, 0x31, 0x30, 0x00, 0x4c, 0x81, 0xa0, 0x3b, 0xbf, 0xb8,
+  0xa6, 0x19, 0x3f, 0x4b, 0x18, 0x07, 0xf7, 0x2e, 0x3c, 0xd2, 0x43, 0xda,
+  0x4e, 0x2c, 0x10, 0x8a, 0x10, 0x9a, 0xa8, 0xa0, 0x60, 0x1c, 0xfe, 0x58,
+  0x32, 0x10, 0x2c, 0xc3, 0x82, 0x51, 0x05, 0x19, 0xf0, 0xb0, 0xb8, 0xa2,
+  0x3c, 0x28, 0x28, 0x5b, 0x82, 0x12, 0x29, 0x91, 0x24, 0x3b, 0x12, 0x32,
+  0x4e, 0xd8, 0x32, 0xe4, 0xd1, 0x5c, 0x90, 0x05, 0x4f, 0x21, 0xa8, 0xf3,
+  0xa1, 0x21, 0x0b, 0x6a, 0x07, 0x46, 0xf8, 0xb0, 0x22, 0xb1, 0xd6, 0xfb,
+  0x93, 0x19, 0xf0, 0x62, 0xe9, 0x40, 0x7f, 0xb5, 0xe3, 0x4f, 0x40, 0xae,
+  0x81, 0xfb, 0x30, 0x35, 0x84, 0xb7, 0xc8, 0x0a, 0xd6, 0x00, 0xf7, 0x63,
+  0x6c, 0x9b, 0xbc, 0xdb, 0xd9, 0xb6, 0x30, 0x88, 0x98, 0x00, 0xb3, 0x49,
+  0x25, 0xc8, 0x11, 0x04, 0x66, 0xce, 0xc3, 0x54, 0x4f, 0x8a, 0x81, 0x91,
+  0x68, 0x77, 0x3e, 0x69, 0x51, 0xe4, 0x85, 0xc3, 0xe4, 0x6e, 0xdc, 0xe9,
+  0x7d, 0x10, 0xb9, 0x22, 0x75, 0x92, 0xde, 0x49, 0x5e, 0xa6, 0x71, 0x76,
+  0xd1, 0xe3, 0x82, 0x5d, 0xf2, 0xf1, 0xfd, 0x19, 0x19, 0xf7, 0xc8, 0x3e,
+  0x3a, 0x18, 0xfc, 0xed, 0x5d, 0xf6, 0xee, 0xe2, 0x0e, 0xc8, 0x65, 0xc0,
+  0xd1, 0xcb, 0x17, 0xe7, 0x80, 0x57, 0xb8, 0x25, 0x44, 0x89, 0x00, 0xaa,
+  0x60, 0xb4, 0xe5, 0xcf, 0x65, 0x38, 0x75, 0xc3, 0xa2, 0x08, 0x57, 0xd3,
+  0x72, 0x36, 0xa3, 0x45, 0xd7, 0x86, 0x63, 0x34, 0xc3, 0x6c, 0x5a, 0xa6,
+  0xa9, 0x24, 0x22, 0x7c, 0x7f, 0x9a, 0x64, 0x87, 0x10, 0x79, 0xb6, 0xfb,
+  0xc3, 0x56, 0xcb, 0xe5, 0x05, 0xb6, 0x89, 0x44, 0xa7, 0x7c, 0xfc, 0x63,
+  0x92, 0xf1, 0xc7, 0x4f, 0x71, 0x5e, 0xc0, 0xea, 0x40, 0x00, 0x34, 0x00,
+  0xd0, 0xeb, 0xe1, 0x18, 0x4f, 0x35, 0x0f, 0x27, 0x13, 0x98, 0x7a, 0x30,
+  0x82, 0x8f, 0x27, 0x04, 0x60, 0x83, 0xe9, 0x8a, 0xd3, 0x33, 0x38, 0x31,
+  0xf9, 0x1c, 0xe7, 0xf6, 0xf7, 0x91, 0x10, 0xea, 0x15, 0xb6, 0xee, 0x1f,
+  0xc3, 0x71, 0x56, 0x60, 0xae, 0x9d, 0x15, 0xf9, 0xe2, 0x64, 0x1e, 0x16,
+  0x27, 0x70, 0x80, 0x78, 0x36, 0xfd, 0x71, 0x72, 0xd9, 0x1f, 0x91, 0xc1,
+  0x80, 0x24, 0x90, 0x86, 0x93, 0x28, 0xe1, 0xe9, 0xca, 0x1c, 0x61, 0x69,
+  0xc2, 0x79, 0x4a, 0xef, 0x83, 0x8c, 0x70, 0x12, 0xa2, 0x42, 0xa5, 0x1a,
+  0x79, 0x59, 0x60, 0xe6, 0x2f, 0x8c, 0xc0, 0x09, 0x13, 0x67, 0x60, 0x25,
+  0xb0, 0x47, 0xe2, 0x90, 0x87, 0x76, 0x94, 0xcf, 0xa9, 0xca, 0x74, 0x32,
+  0x87, 0x60, 0xb0, 0xbd, 0x12, 0x53, 0x9e, 0x9c, 0x51, 0x3a, 0x33, 0x1b,
+  0xb5, 0xc9, 0x04, 0x2d, 0xb9, 0x39, 0x98, 0xc9, 0x73, 0xfa, 0xf8, 0x18,
+  0x0d, 0x82, 0xa7, 0x5f, 0xd7, 0x70, 0x20, 0x10, 0x3a, 0xf9, 0xc6, 0x66,
+  0x40, 0xc4, 0x9d, 0x98, 0x80, 0x93, 0x12, 0xce, 0x84, 0x88, 0xe6, 0x33,
+  0x22, 0x94, 0xfd, 0x4c, 0xda, 0x40, 0xfb, 0xa2, 0xa2, 0x27, 0x38, 0x52,
+  0x42, 0x69, 0x4c, 0xb8, 0xdc, 0xf9, 0x9b, 0xc5, 0xbe, 0x5a, 0x6d, 0xe6,
+  0x5e, 0x40, 0x0f, 0x2d, 0xe8, 0x67, 0x49, 0x16, 0x16, 0x2b, 0x0d, 0x20,
+  0xdd, 0x93, 0x50, 0x74, 0xce, 0x4d, 0xca, 0x36, 0x7a, 0x1b, 0xde, 0x11,
+  0x56, 0x6a, 0xaf, 0x55, 0x64, 0xd4, 0x39, 0x04, 0x14, 0xa7, 0x45, 0xf6,
+  0x4a, 0xab, 0x1e, 0xcb, 0x06, 0x6f, 0x7c, 0xc1, 0x2e, 0x3e, 0x5c, 0xde,
+  0xeb, 0x83, 0x51, 0x27, 0x52, 0xaf, 0x17, 0x6c, 0x30, 0x72, 0xac, 0x74,
+  0x4e, 0x6f, 0x31, 0xf5, 0x76, 0xbb, 0xee, 0xb4, 0xf4, 0x31, 0xe1, 0x7b,
+  0x26, 0x4d, 0xb3, 0x32, 0x45, 0x50, 0x87, 0x52, 0x40, 0x6f, 0x69, 0x54,
+  0x71, 0xae, 0xd4, 0xaf, 0x60, 0xbf, 0x03, 0xe3, 0xc9, 0x70, 0x91, 0x5e,
+  0xea, 0x50, 0x54, 0x30, 0x63, 0x72, 0x40, 0x2e, 0x47, 0xd5, 0xaa, 0x21,
+  0x2c, 0xd7, 0xc7, 0xe4, 0x01, 0xb9, 0x0c, 0x52, 0xe9, 0xf1, 0xda, 0x2b,
+  0x1d, 0x1f, 0x13, 0x98, 0xa3, 0x7c, 0x01, 0x05, 0x23, 0x87, 0x02, 0x6d,
+  0x7c, 0xe9, 0xe3, 0x04, 0x4d, 0xa9, 0x3b, 0x61, 0x63, 0x1f, 0x3a, 0x42,
+  0x22, 0xd6, 0x91, 0x46, 0x9b, 0x26, 0x19, 0xc4, 0xc2, 0xb1, 0xa5, 0x9c,
+  0x80, 0x41, 0xa8, 0x40, 0x96, 0xea, 0x5d, 0x64, 0x3d, 0x62, 0x62, 0x35,
+  0x2a, 0x8b, 0x02, 0xf0, 0xbf, 0x90, 0x64, 0x60, 0x43, 0x99, 0xc5, 0x74,
+  0x06, 0x9b, 0xe3, 0x91, 0x85, 0x09, 0x33, 0x8a, 0x2f, 0xbe, 0x7d, 0x0a,
+  0xa1, 0x3a, 0x60, 0x82, 0x8c, 0x31, 0xe2, 0x22, 0xfc, 0x42, 0x27, 0x60,
+  0xa6, 0x89, 0x62, 0x76, 0xa2, 0x4f, 0x5b, 0x4f, 0x17, 0x42, 0x72, 0x97,
+  0x4f, 0x9a, 0x8e, 0x61, 0xfb, 0x80, 0x33, 0x05, 0x99, 0x52, 0x47, 0x47,
+  0x26, 0x54, 0x07, 0x8b, 0xd0, 0x24, 0x2e, 0xae, 0xad, 0xf3, 0x49, 0x6f,
+  0x0c, 0x64, 0x29, 0x01, 0xf6, 0xea, 0xa5, 0x90, 0xc7, 0x7b, 0x06, 0x7b,
+  0xc7, 0x40, 0x60, 0x41, 0x85, 0xd6, 0x77, 0x71, 0x1e, 0x29, 0xe3, 0x55,
+  0x70, 0x51, 0x5e, 0x66, 0x5c, 0xa5, 0xd2, 0x1a, 0xf0, 0xc1, 0x06, 0x70,
+  0xc2, 0xe9, 0xa2, 0x19, 0xf6, 0x10, 0x61, 0x05, 0xbb, 0x76, 0xe4, 0xdc,
+  0xc5, 0xce, 0x81, 0xd9, 0xd5, 0x20, 0xa3, 0xd8, 0x02, 0x55, 0xe3, 0x36,
+  0x6d, 0xb6, 0x11, 0xb0, 0x81, 0xc7, 0x35, 0x94, 0x0e, 0x49, 0x15, 0xdb,
+  0x1a, 0xc2, 0x04, 0xb3, 0xcc, 0xe8, 0xa4, 0x96, 0xd2, 0x85, 0xbb, 0x69,
+  0xf7, 0x16, 0x09, 0xdd, 0xb1, 0x2b, 0x2e, 0x03, 0xb0, 0x80, 0x1a, 0xc3,
+  0xb2, 0x54, 0x9f, 0x35, 0x1b, 0x40, 0xc2, 0x5f, 0x78, 0x7d, 0x23, 0xab,
+  0x5c, 0xc2, 0x9c, 0xd9, 0x45, 0x44, 0xa2, 0x3e, 0x49, 0xb2, 0x92, 0x8e,
+  0xc8, 0x5a, 0xef, 0x94, 0xaa, 0xd2, 0xfb, 0x95, 0x73, 0x0f, 0x2e, 0xd8,
+  0xfe, 0x40, 0x7a, 0x77, 0x47, 0x3b, 0xae, 0x02, 0x91, 0xf0, 0x01, 0x9b,
+  0x27, 0x33, 0x2e, 0x29, 0x59, 0xf4, 0xd5, 0xe2, 0xe7, 0x3c, 0xc9, 0xbc,
+  0x2e, 0xe9, 0xf6, 0xe5, 0x21, 0x7f, 0x93, 0xc0, 0xe1, 0xae, 0xb8, 0x11,
+  0x98, 0xb4, 0x4c, 0x51, 0x08, 0x96, 0xec, 0xca, 0xd4, 0xde, 0x1d, 0x4a,
+  0x85, 0xd7, 0xf2, 0xbd, 0x85, 0x76, 0xfc, 0x40, 0xb9, 0x8b, 0x02, 0xb9,
+  0xa6, 0x05, 0xc3, 0xb8, 0x71, 0x60, 0x0e, 0x94, 0xf6, 0x3b, 0xd3, 0x82,
+  0x86, 0x5f, 0x46, 0x16, 0x19, 0x95, 0x13, 0x6a, 0x74, 0x74, 0xa6, 0x08,
+  0x96, 0x25, 0xf4, 0x42, 0x88, 0xa8, 0xdf, 0x86, 0x40, 0x85, 0xa5, 0x46,
+  0x20, 0x14, 0xfc, 0x9d, 0x57, 0x8f, 0xfc, 0x63, 0x2b, 0xf6, 0xfb, 0x95,
+  0x1f, 0x69, 0x7a, 0x3a, 0x11, 0x49, 0x7a, 0xee, 0x66, 0x4d, 0x59, 0x7a,
+  0x4e, 0x67, 0x23, 0xa7, 0xfc, 0x63, 0xfa, 0x99, 0x46, 0xa2, 0x06, 0xde,
+  0x5c, 0xd6, 0xfe, 0xd9, 0xa0, 0xae, 0x1a, 0xa0, 0x08, 0x48, 0x91, 0xb7,
+  0xe1, 0x24, 0x79, 0x8d, 0x05, 0x97, 0xa3, 0x3e, 0xd2, 0x8c, 0xbe, 0x6a,
+  0xc5, 0x60, 0xeb, 0xb8, 0x55, 0xc9, 0xda, 0xcf, 0xb5, 0x92, 0x5a, 0xb1,
+  0x48, 0xf9, 0xb7, 0xe5, 0xbc, 0x8a, 0x2b, 0x9f, 0xb4, 0x36, 0x1f, 0xba,
+  0x58, 0xa8, 0x58, 0xc1, 0x01, 0xa8, 0x3f, 0x84, 0xc3, 0x42, 0xf3, 0x00,
+  0xc5, 0x5c, 0x9e, 0x52, 0xa8, 0x69, 0xaf, 0xbc, 0x6e, 0x99, 0xcd, 0xa1,
+  0x2f, 0x4c, 0x69, 0xdc, 0xf5, 0x1b, 0x53, 0x72, 0xdf, 0x0a, 0xde, 0xb5,
+  0xa9, 0x1f, 0x76, 0x35, 0xf3, 0xce, 0x46, 0x5e, 0x6f, 0x54, 0x38, 0x6e,
+  0x39, 0x23, 0x2a, 0x80, 0xb7, 0xe5, 0x62, 0x5a, 0x3b, 0xe6, 0x33, 0x5f,
+  0x14, 0xc7, 0x9a, 0xa0, 0x09, 0x2d, 0x7b, 0x52, 0x58, 0xa2, 0x17, 0x41,
+  0xc1, 0xd7, 0x1b, 0x12, 0x39, 0x28, 0x9d, 0x11, 0x9b, 0xe7, 0x05, 0xaf,
+  0xd6, 0xdc, 0x21, 0xd4, 0xa2, 0xd5, 0x92, 0x18, 0x18, 0x94, 0x58, 0xa6,
+  0x3a, 0x6b, 0x8f, 0xed, 0x5d, 0x07, 0x8f, 0x9c, 0x35, 0x6b, 0x08, 0xa3,
+  0xa3, 0x43, 0x67, 0x11, 0x87, 0x4e, 0x7a, 0x34, 0xbe, 0x98, 0x29, 0x83,
+  0x4a, 0xd8, 0x19, 0x94, 0xf9, 0x15, 0x3b, 0x71, 0x5e, 0x4e, 0x53, 0x6a,
+  0x86, 0x62, 0xd1, 0x42, 0x2c, 0xc6, 0x8f, 0x1e, 0x36, 0x60, 0x3e, 0xc5,
+  0x95, 0x0a, 0xf7, 0x7a, 0x53, 0xd5, 0xca, 0x38, 0x8e, 0xae, 0x2b, 0x67,
+  0x95, 0x0e, 0x62, 0x97, 0x57, 0xd7, 0x5b, 0xb3, 0xa6, 0x02, 0xa2, 0x0d,
+  0x91, 0xdb, 0x96, 0xf9, 0xad, 0xc8, 0x68, 0x4c, 0xff, 0xf6, 0xd1, 0x05,
+  0x40, 0x50, 0xb9, 0x57, 0x67, 0x74, 0x17, 0xcf, 0xe8, 0x6e, 0x95, 0x6b,
+  0xe4, 0x51, 0x21, 0x5a, 0xe8, 0xb1, 0xca, 0x01, 0x38, 0x95, 0x39, 0x15,
+  0xb8, 0xe5, 0x61, 0x9e, 0x12, 0x47, 0x27, 0x75, 0xbf, 0x46, 0xa8, 0x3a,
+  0xc2, 0x75, 0xb0, 0x55, 0x22, 0x7c, 0x96, 0x22, 0x7c, 0x06, 0x11, 0x32,
+  0xfc, 0xb0, 0x58, 0xc6, 0x93, 0x01, 0xda, 0x24, 0x19, 0xe8, 0x5f, 0x45,
+  0xd8, 0x94, 0x03, 0x55, 0x98, 0xab, 0xdc, 0xa8, 0x54, 0x3b, 0xae, 0x6d,
+  0x90, 0xe7, 0xaf, 0x30, 0x0b, 0xe3, 0x4d, 0xf5, 0xc2, 0x5d, 0xfb, 0xbe,
+  0x8a, 0x4d, 0x6e, 0xa9, 0x66, 0x5d, 0x8f, 0x6e, 0x45, 0xb1, 0x21, 0xbc,
+  0x5b, 0xeb, 0x77, 0x68, 0xc8, 0xf0, 0xb6, 0x4d, 0xb4, 0x39, 0x44, 0x1d,
+  0x84, 0x6c, 0x49, 0xa3, 0x64, 0x96, 0x44, 0xe2, 0xe2, 0xd1, 0xc7, 0xab,
+  0x4c, 0x60, 0x40, 0xdf, 0x92, 0xd2, 0x2c, 0xb8, 0x49, 0xbe, 0x24, 0x4b,
+  0x0a, 0xbd, 0x5a, 0x90, 0x17, 0x57, 0x03, 0x1c, 0x0d, 0x00, 0xc7, 0xc4,
+  0xc3, 0xeb, 0xb0, 0x89, 0xc4, 0xd1, 0xd7, 0x7e, 0x69, 0xdd, 0x7f, 0x54,
+  0x77, 0x81, 0x2f, 0xd5, 0xa4, 0x57, 0xf9, 0xaf, 0x2c, 0xb9, 0x47, 0x3b,
+  0xb4, 0x71, 0x56, 0xa7, 0x62, 0x35, 0x1f, 0xcf, 0xf2, 0x18, 0x69, 0x0c,
+  0xec, 0x76, 0xc3, 0xf4, 0x20, 0x7f, 0x31, 0x8d, 0xc7, 0x54, 0x82, 0xc9,
+  0x96, 0x43, 0xf8, 0xb9, 0xb7, 0xd1, 0x5d, 0x20, 0x2a, 0xa7, 0xb7, 0x80,
+  0x7f, 0xf5, 0x76, 0x42, 0xe1, 0xa9, 0x37, 0x12, 0xeb, 0x7a, 0x2d, 0x8f,
+  0x70, 0x3b, 0x56, 0xf1, 0x0f, 0x9a, 0x57, 0x4e, 0xd4, 0x11, 0x2a, 0x96,
+  0xb5, 0x36, 0x83, 0x92, 0xd1, 0x13, 0x71, 0xd7, 0x78, 0x2c, 0xaf, 0x1e,
+  0x46, 0xff, 0x17, 0x65, 0x5e, 0x75, 0xf7, 0xd4, 0x20, 0xc2, 0x5f, 0x75,
+  0x67, 0x63, 0x8e, 0xac, 0xb1, 0x0b, 0xa6, 0x82, 0xbf, 0x8a, 0xe9, 0x9a,
+  0x8a, 0xf6, 0xf7, 0x9b, 0xaa, 0x05, 0x4b, 0x3f, 0x55, 0x25, 0xec, 0x66,
+  0xc4, 0x5a, 0xa0, 0xa9, 0x8d, 0xde, 0x9d, 0xec, 0x6c, 0x26, 0x65, 0x49,
+  0x43, 0xe0, 0x93, 0x47, 0xbb, 0xc1, 0xa5, 0x2d, 0xe3, 0xdf, 0x89, 0x15,
+  0xe3, 0xdf, 0x37, 0xdc, 0x29, 0x94, 0x4d, 0x32, 0xa1, 0xbc, 0xb5, 0x00,
+  0x97, 0x92, 0xe4, 0x0c, 0x2f, 0x54, 0x23, 0xca, 0x58, 0xfd, 0x42, 0x4f,
+  0x46, 0x7d, 0xb5, 0xee, 0x84, 0xbd, 0x75, 0xf7, 0x5e, 0xdd, 0x56, 0x6c,
+  0x7a, 0x94, 0x56, 0x7f, 0xa3, 0x37, 0x19, 0xf0, 0x59, 0x18, 0xb5, 0xb9,
+  0x55, 0xc7, 0x05, 0xc2, 0xac, 0x05, 0xe5, 0x33, 0xa7, 0xb7, 0x02, 0xbf,
+  0xa8, 0xe9, 0x64, 0xca, 0x36, 0x70, 0xe2, 0xda, 0x9c, 0x8d, 0x37, 0xf7,
+  0x85, 0xb2, 0x81, 0xde, 0x05, 0x74, 0xba, 0x3b, 0x68, 0x24, 0x7a, 0xd1,
+  0x8e, 0xd3, 0x3b, 0x19, 0x28, 0x6d, 0xb7, 0xb7, 0x94, 0xc6, 0x1f, 0x97,
+  0x90, 0x00, 0xc4, 0x9d, 0x71, 0x51, 0xd2, 0xca, 0x18, 0x16, 0x85, 0xc5,
+  0xb2, 0xe4, 0xf4, 0x19, 0x98, 0x0b, 0x1f, 0x1a, 0x3e, 0x2c, 0xe7, 0xb4,
+  0xa0, 0x9e, 0x73, 0xa5, 0xa4, 0x61, 0x8d, 0x75, 0x1c, 0xbf, 0x69, 0xb4,
+  0x8f, 0x71, 0x8e, 0xb7, 0xae, 0xa7, 0x58, 0x56, 0xb3, 0x00, 0x64, 0x2c,
+  0x4a, 0x05, 0x57, 0xe7, 0xb2, 0x61, 0x11, 0x17, 0x92, 0x48, 0xd7, 0xc0,
+  0x42, 0xee, 0x2a, 0x0f, 0x7f, 0xa2, 0x78, 0x69, 0x7f, 0x64, 0xf0, 0x05,
+  0xb7, 0x86, 0x5c, 0x50, 0xb1, 0x11, 0xfc, 0x5b, 0xde, 0x33, 0xd9, 0x97,
+  0xcb, 0xe2, 0x91, 0x02, 0x1b, 0x5a, 0xcd, 0xdd, 0xf7, 0xdf, 0xeb, 0xf7,
+  0x89, 0xfa, 0xac, 0x78, 0x9b, 0xb0, 0x27, 0x37, 0xfd, 0xc4, 0xca, 0x66,
+  0x46, 0xd3, 0x2a, 0x17, 0xaa, 0xe9, 0x8a, 0x67, 0x01, 0x68, 0xfa, 0x12,
+  0x1c, 0xe0, 0xdb, 0xca, 0xfb, 0x97, 0xcf, 0x2a, 0x29, 0x80, 0x37, 0x32,
+  0x20, 0x87, 0x3f, 0xfc, 0x10, 0x3c, 0xa8, 0x84, 0x10, 0xcc, 0x6d, 0x4e,
+  0x23, 0x77, 0x7a, 0x56, 0xb7, 0x23, 0x35, 0x0f, 0x52, 0x55, 0x85, 0x64,
+  0xc5, 0x39, 0x7a, 0xe5, 0x71, 0xdf, 0x6c, 0x11, 0xf4, 0xb6, 0xae, 0x93,
+  0x6a, 0xa5, 0x8d, 0x26, 0x09, 0xf8, 0x4a, 0x24, 0x0e, 0x07, 0xcd, 0x83,
+  0xbb, 0x60, 0x69, 0xd9, 0x5d, 0x50, 0xd1, 0x26, 0xd0, 0x1f, 0xb5, 0x45,
+  0x9b, 0x65, 0x67, 0xcb, 0xd0, 0xa7, 0xb0, 0x74, 0x54, 0xc7, 0x27, 0x6e,
+  0x65, 0xfc, 0x8d, 0xc9, 0x83, 0xa6, 0xc9, 0x43, 0xa8, 0x58, 0xe4, 0x65,
+  0x63, 0xdf, 0x29, 0x75, 0xee, 0x60, 0xf3, 0xe1, 0x9f, 0xcc, 0xe6, 0x11,
+  0xb2, 0xe9, 0xef, 0x88, 0xb6, 0x4d, 0xd0, 0x16, 0xb4, 0x8e, 0xf4, 0x4e,
+  0x69, 0x3f, 0x15, 0x77, 0xae, 0xef, 0x69, 0xed, 0x25, 0x0a, 0x8b, 0x87,
+  0xeb, 0x84, 0xde, 0x40, 0x05, 0xc5, 0x65, 0x2b, 0xe5, 0xab, 0x9b, 0xee,
+  0x89, 0xbc, 0xe9, 0xde, 0xda, 0x59, 0x61, 0x65, 0x16, 0xe5, 0xf2, 0x7d,
+  0x20, 0xa6, 0x19, 0x7a, 0x0c, 0x66, 0xe4, 0x2c, 0xcf, 0xee, 0xeb, 0xfa,
+  0x8c, 0x28, 0x4d, 0xe3, 0x36, 0x46, 0x30, 0xf7, 0x40, 0x8f, 0x8b, 0x98,
+  0x0a, 0xe8, 0x72, 0xeb, 0xad, 0x94, 0xdb, 0xab, 0x75, 0x88, 0xca, 0x4f,
+  0x63, 0xc3, 0x66, 0x70, 0x45, 0x39, 0xb4, 0x45, 0x8f, 0x3d, 0x60, 0x17,
+  0x94, 0x68, 0xee, 0xb3, 0x9c, 0x16, 0xcc, 0x0c, 0xb7, 0xa2, 0x11, 0x8f,
+  0x0c, 0xcd, 0x78, 0x54, 0xb7, 0xa6, 0x87, 0xaa, 0x1f, 0x6c, 0x67, 0xe7,
+  0xe0, 0x91, 0x27, 0xd4, 0x57, 0x53, 0x9c, 0x6f, 0x2e, 0xe9, 0xdc, 0x2e,
+  0xb0, 0x53, 0xeb, 0x33, 0x5b, 0xd9, 0xdb, 0x11, 0xaf, 0xea, 0x1f, 0xad,
+  0x21, 0x0e, 0x5a, 0xb9, 0x3d, 0x3a, 0x6c, 0xc1, 0xfa, 0x70, 0x83, 0x5b,
+  0x81, 0xd6, 0x6e, 0x7d, 0xb7, 0xe8, 0x72, 0x47, 0xb4, 0x8d, 0x4d, 0x6a,
+  0x2b, 0xe2, 0x53, 0x09, 0xbd, 0x3b, 0x66, 0x6c, 0x77, 0xeb, 0xdd, 0x71,
+  0x3b, 0xe6, 0x47, 0x0f, 0x5b, 0x30, 0x3f, 0x56, 0x98, 0x1b, 0xc2, 0xa7,
+  0xe9, 0x54, 0x74, 0xa3, 0xc8, 0x2d, 0xc9, 0x1a, 0x62, 0xa9, 0xad, 0x17,
+  0xb6, 0xbb, 0x0c, 0x1f, 0x3e, 0xc3, 0xd8, 0xd4, 0x8c, 0x7f, 0x76, 0x8f,
+  0x2c, 0xe6, 0x4c, 0xd3, 0xa1, 0xdf, 0x75, 0x94, 0x0a, 0x5c, 0x81, 0xc9,
+  0xbe, 0x60, 0xb5, 0xb5, 0x49, 0xde, 0x50, 0x82, 0xdb, 0x81, 0xab, 0x77,
+  0x0c, 0x7d, 0x39, 0x27, 0xa4, 0xde, 0x37, 0xd3, 0xe6, 0xfa, 0x72, 0xc7,
+  0x0e, 0xfb, 0x9b, 0x58, 0xd6, 0xed, 0x75, 0x0b, 0xc7, 0x76, 0xfb, 0x6e,
+  0xb8, 0x36, 0x8b, 0x6d, 0x8c, 0x7f, 0x63, 0x83, 0xfe, 0x4d, 0x02, 0xf1,
+  0x76, 0x61, 0xee, 0xe2, 0x67, 0x37, 0xb3, 0x6c, 0x74, 0xf7, 0x63, 0xed,
+  0xd8, 0xca, 0x7f, 0x2f, 0xdd, 0x3e, 0x5f, 0xbe, 0xfc, 0x6d, 0x7d, 0xa8,
+  0xdb, 0xb5, 0x19, 0xff, 0x8a, 0x47, 0x54, 0xed, 0xe5, 0xb6, 0x3a, 0x8e,
+  0x89, 0xd7, 0xf0, 0xa2, 0x2a, 0xf5, 0x3c, 0x71, 0x40, 0xbb, 0xfd, 0x5a,
+  0x83, 0x8e, 0xec, 0x3d, 0x07, 0xe4, 0x9f, 0xc0, 0x08, 0x92, 0x8c, 0x69,
+  0xac, 0x9c, 0xb7, 0xba, 0x8d, 0xc8, 0x4e, 0xf3, 0xa8, 0x21, 0xb0, 0x1b,
+  0x9a, 0xed, 0xfa, 0xdc, 0x93, 0x7a, 0xe3, 0x66, 0xe2, 0x7e, 0xa3, 0x0d,
+  0x6d, 0x68, 0x91, 0xda, 0x7a, 0xd2, 0xc6, 0x85, 0x27, 0xbb, 0x35, 0xc2,
+  0xcd, 0x9b, 0xed, 0x90, 0x6c, 0x73, 0x60, 0xd3, 0x95, 0xa2, 0x36, 0x85,
+  0x4e, 0xfc, 0x3f, 0xd8, 0xec, 0x36, 0x78, 0x35, 0x6a, 0xd6, 0xf5, 0xd2,
+  0xce, 0x46, 0xa7, 0x6d, 0x79, 0xb6, 0x7c, 0x0b, 0xfc, 0xdf, 0x77, 0xca,
+  0xeb, 0x3f, 0xdc, 0x13, 0xdb, 0xbf, 0x62, 0x12, 0x3f, 0xfb, 0x78, 0xae,
+  0x7e, 0x03, 0x62, 0xff, 0x96, 0x29, 0x08, 0x97, 0xf8, 0x6a, 0x4d, 0xda,
+  0x7f, 0xec, 0x04, 0xc8, 0x7e, 0x07, 0xb2, 0x3e, 0x93, 0x60, 0x43, 0x28,
+  0x00, 0x00
+};
+unsigned int PLYLoader_js_gz_len = 2858;
@@ -0,0 +1,389 @@
+#pragma once
+
+unsigned char Projector_js_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x1c,
+  0x6b, 0x73, 0xdb, 0x38, 0xee, 0xb3, 0xf3, 0x2b, 0xb8, 0x1f, 0xae, 0xb5,
+  0x13, 0x47, 0xa9, 0xed, 0xde, 0x97, 0x3c, 0xba, 0x77, 0xdd, 0xc7, 0x5d,
+  0x67, 0xda, 0xdd, 0xce, 0xf6, 0xb1, 0x33, 0x97, 0xe9, 0x74, 0x14, 0x9b,
+  0xb6, 0xd5, 0xca, 0x92, 0x47, 0x0f, 0x27, 0xf6, 0x36, 0xff, 0xfd, 0x40,
+  0x82, 0x0f, 0x90, 0xa2, 0x64, 0xa7, 0xdd, 0xbd, 0xbb, 0xb9, 0xad, 0x25,
+  0x12, 0x00, 0x01, 0x10, 0x04, 0x01, 0x90, 0xca, 0xd9, 0xf1, 0xf1, 0x11,
+  0x3b, 0x66, 0xff, 0x88, 0xeb, 0x6a, 0x99, 0x17, 0x6c, 0x55, 0xcc, 0xf2,
+  0xfc, 0x86, 0x9d, 0xb1, 0x65, 0x55, 0xad, 0xcf, 0xcf, 0xce, 0xf0, 0x3d,
+  0x9a, 0xe6, 0xab, 0x33, 0x0a, 0x56, 0xd6, 0x6b, 0x5e, 0xf0, 0xc5, 0xe2,
+  0x86, 0x17, 0x95, 0x05, 0xbe, 0xbd, 0xbd, 0x8d, 0xd6, 0x71, 0x9d, 0xde,
+  0x14, 0x75, 0x56, 0x01, 0x4e, 0x54, 0x7f, 0x76, 0xb0, 0x3e, 0xd5, 0x69,
+  0x12, 0x67, 0xb7, 0xb1, 0xc2, 0x28, 0x01, 0x65, 0x91, 0x54, 0xcb, 0x1a,
+  0xe9, 0xeb, 0x5e, 0xc0, 0x38, 0x3b, 0x3a, 0x7a, 0xfb, 0xef, 0xdf, 0x7e,
+  0xfa, 0x29, 0xfa, 0x8d, 0x67, 0x33, 0x5e, 0xc4, 0x37, 0x29, 0xff, 0xf5,
+  0xe6, 0x13, 0x9f, 0x56, 0xec, 0x8a, 0xcd, 0xeb, 0x6c, 0x5a, 0x25, 0x79,
+  0xc6, 0xfa, 0x03, 0xf6, 0xc7, 0xd1, 0x51, 0xaf, 0x5a, 0x26, 0x65, 0x94,
+  0xcc, 0xa0, 0xe7, 0xc9, 0x85, 0x7e, 0xcd, 0x35, 0x70, 0x56, 0xa7, 0xe9,
+  0x85, 0x6a, 0xdc, 0x21, 0x08, 0xbe, 0x14, 0x92, 0xf0, 0xaf, 0x05, 0xfc,
+  0xa3, 0x30, 0xef, 0xe1, 0xbf, 0xb3, 0xc0, 0xc0, 0x3f, 0xc7, 0x53, 0x7e,
+  0xe0, 0xb0, 0x9b, 0x91, 0x18, 0x92, 0xdf, 0x32, 0x9f, 0xc6, 0x7b, 0x50,
+  0x13, 0xbf, 0xeb, 0x0f, 0xf4, 0xe8, 0x9b, 0xf1, 0xa1, 0x80, 0x93, 0xbd,
+  0x80, 0x0a, 0x32, 0xcb, 0x8b, 0x55, 0x9c, 0xbe, 0xca, 0x67, 0x3c, 0x75,
+  0x50, 0xde, 0x83, 0x22, 0xf2, 0x62, 0x42, 0x20, 0x37, 0x12, 0xf5, 0x17,
+  0x09, 0x5f, 0x6a, 0x84, 0xeb, 0x10, 0xca, 0xf0, 0xe0, 0x46, 0xf6, 0xe1,
+  0x22, 0x44, 0xfd, 0x25, 0xcf, 0x16, 0xd5, 0xd2, 0xd1, 0xd1, 0x34, 0x4f,
+  0xf3, 0xc2, 0xe1, 0xf0, 0x07, 0xd1, 0x62, 0x45, 0x5e, 0xc5, 0x15, 0x2f,
+  0x92, 0x38, 0xf5, 0x66, 0xaf, 0xde, 0x94, 0x41, 0x36, 0xc7, 0x21, 0x8e,
+  0xda, 0x1a, 0x05, 0x9b, 0xdf, 0x66, 0x0d, 0xa8, 0xf7, 0x36, 0x7b, 0x58,
+  0xe7, 0x65, 0x22, 0x1b, 0x5b, 0x66, 0xc0, 0x85, 0xfa, 0x3d, 0x2f, 0xd2,
+  0xd9, 0x61, 0xa0, 0x6f, 0xa6, 0x05, 0xe7, 0x21, 0xb2, 0x4f, 0xe9, 0xc4,
+  0x26, 0x65, 0x02, 0x2c, 0x02, 0x54, 0x55, 0xd4, 0x5c, 0x09, 0x11, 0x16,
+  0x20, 0x5a, 0x17, 0x79, 0x95, 0x57, 0xdb, 0x35, 0x87, 0x09, 0x59, 0x6f,
+  0x1d, 0x79, 0x18, 0x4e, 0x21, 0x0b, 0xc8, 0x25, 0x39, 0x96, 0x18, 0x1a,
+  0xca, 0x13, 0xa6, 0x85, 0xf1, 0x30, 0x8a, 0x12, 0x6a, 0xd0, 0xa1, 0xee,
+  0x97, 0x49, 0xf6, 0xff, 0x58, 0x7c, 0x8e, 0x2d, 0x4b, 0xfb, 0xf4, 0x8d,
+  0x4f, 0x19, 0xed, 0xb0, 0xd9, 0x64, 0x97, 0x42, 0xc3, 0x92, 0xbf, 0xcd,
+  0xf4, 0xde, 0xac, 0x8b, 0xa4, 0xe2, 0x5f, 0xe7, 0x01, 0x55, 0xeb, 0x1d,
+  0x1d, 0x79, 0x4b, 0x5f, 0x76, 0x0e, 0x36, 0x18, 0x47, 0xac, 0xec, 0xd8,
+  0x40, 0x94, 0xd3, 0x58, 0xda, 0x56, 0x60, 0x59, 0x19, 0xbc, 0x96, 0xb5,
+  0xbb, 0x4f, 0xc6, 0xd7, 0x45, 0xfe, 0x49, 0xd2, 0x0a, 0x08, 0xb7, 0x89,
+  0x0b, 0xf6, 0x11, 0xa5, 0x19, 0xea, 0x87, 0x1f, 0x72, 0xd8, 0x5f, 0xcc,
+  0xdb, 0xeb, 0x3c, 0x97, 0x1e, 0xec, 0x83, 0xd3, 0x62, 0x5d, 0xcf, 0xf0,
+  0xa8, 0xf7, 0x11, 0x67, 0x12, 0x00, 0xf4, 0x94, 0x22, 0x01, 0x7c, 0xa3,
+  0x04, 0x6c, 0x8b, 0x4b, 0x60, 0x0e, 0xbb, 0x00, 0x74, 0x8b, 0x1f, 0x8d,
+  0x2c, 0x9e, 0x29, 0xaa, 0x7e, 0x77, 0x11, 0x53, 0xb0, 0x60, 0xe8, 0x14,
+  0x3f, 0x1a, 0x51, 0x3c, 0x53, 0x44, 0xfd, 0xee, 0x22, 0x96, 0x72, 0xba,
+  0xa1, 0x1b, 0x1f, 0x34, 0x32, 0xbe, 0x51, 0x74, 0xdb, 0x42, 0x09, 0x00,
+  0x05, 0x54, 0xfb, 0x8f, 0x71, 0x15, 0x43, 0xd3, 0x1f, 0x0c, 0x75, 0x53,
+  0x9e, 0x4b, 0xac, 0x34, 0x59, 0x2c, 0xf5, 0x33, 0x4f, 0xf9, 0x8a, 0x67,
+  0xf8, 0xc6, 0xee, 0x25, 0xea, 0x06, 0x1d, 0x51, 0xd8, 0x39, 0x0d, 0x0d,
+  0xc0, 0xd3, 0xb0, 0x47, 0x92, 0x24, 0xa6, 0x69, 0xb2, 0x7e, 0x9e, 0xdf,
+  0x39, 0x10, 0xf0, 0x3e, 0xe9, 0x07, 0x48, 0xb2, 0x53, 0x36, 0x1a, 0x9a,
+  0x7f, 0x58, 0x70, 0x8f, 0x11, 0x9d, 0xe2, 0xff, 0xe0, 0x97, 0x24, 0x07,
+  0x37, 0xa0, 0x90, 0x59, 0x92, 0x2d, 0x82, 0x63, 0x48, 0x88, 0x75, 0x9e,
+  0x80, 0x54, 0x5a, 0x88, 0x7f, 0x16, 0x45, 0x0c, 0x3e, 0x68, 0xc2, 0x48,
+  0xdf, 0x53, 0xb7, 0xef, 0x29, 0x43, 0xd6, 0x37, 0x09, 0xbf, 0x7d, 0x15,
+  0x57, 0x45, 0xe2, 0x52, 0xc6, 0xa6, 0xa7, 0x4a, 0x01, 0x00, 0xa3, 0xec,
+  0x16, 0xac, 0xb5, 0x1b, 0x1a, 0xc0, 0x57, 0x62, 0x9f, 0xc5, 0xa6, 0xa1,
+  0x7e, 0x7d, 0xff, 0x30, 0x12, 0x6a, 0x87, 0x6f, 0x03, 0x9b, 0x28, 0xb0,
+  0x79, 0x51, 0x97, 0x55, 0xbd, 0x72, 0x20, 0x7e, 0xc6, 0x36, 0x32, 0x33,
+  0x6b, 0x3e, 0x43, 0x77, 0x37, 0x7a, 0x7d, 0xc0, 0x16, 0x33, 0xf4, 0xb1,
+  0xc6, 0xaf, 0x0f, 0xdc, 0x98, 0xc4, 0x22, 0x57, 0x3b, 0x02, 0x4a, 0xfa,
+  0xbe, 0xb9, 0xd0, 0x19, 0x1a, 0xd3, 0x90, 0x4d, 0xe3, 0x15, 0xb8, 0x3a,
+  0xb5, 0xf1, 0xf4, 0xa6, 0x79, 0x56, 0xe6, 0x29, 0x8f, 0x6e, 0xe3, 0x22,
+  0xeb, 0xb3, 0xc7, 0x9e, 0xab, 0x38, 0x67, 0x2e, 0x45, 0x70, 0x17, 0x49,
+  0xc9, 0xb2, 0xfc, 0x56, 0x51, 0xd3, 0xbd, 0xfd, 0x41, 0xf4, 0x58, 0x6e,
+  0x4b, 0x3d, 0xaf, 0xdd, 0x8c, 0x26, 0xd8, 0xbc, 0x37, 0x2e, 0xac, 0xce,
+  0xfe, 0x7c, 0x46, 0x3d, 0x9a, 0x0d, 0x56, 0x4d, 0x7f, 0x83, 0x59, 0xdb,
+  0xd3, 0xc2, 0xee, 0x3a, 0x99, 0x7e, 0x86, 0x45, 0xf0, 0x5b, 0xbc, 0x7d,
+  0x08, 0xa7, 0xbc, 0x28, 0x80, 0x8d, 0xa0, 0x4e, 0x0d, 0x3d, 0xcb, 0x25,
+  0xac, 0x8d, 0x69, 0x5c, 0x82, 0x67, 0x8f, 0x4a, 0x5e, 0xfd, 0x5c, 0xe4,
+  0xab, 0x1f, 0x24, 0x51, 0xcd, 0xac, 0x62, 0x47, 0xce, 0xb4, 0xf0, 0xd6,
+  0xb8, 0x63, 0xbd, 0x4c, 0xca, 0x50, 0xb4, 0x2e, 0x21, 0xd0, 0x92, 0xe5,
+  0x96, 0xfa, 0xe1, 0x42, 0xb5, 0xa9, 0xf8, 0x4e, 0x06, 0x68, 0xb2, 0xc1,
+  0x8f, 0xe1, 0x65, 0x63, 0x60, 0x4b, 0x25, 0x14, 0xbb, 0xd6, 0x86, 0x04,
+  0x35, 0xdc, 0x80, 0x20, 0x98, 0x50, 0x80, 0xa6, 0xe2, 0xb4, 0xe6, 0x5a,
+  0x41, 0x3d, 0x33, 0xaa, 0x6c, 0x16, 0xc3, 0xf6, 0xc8, 0x98, 0xd8, 0x6b,
+  0xb6, 0x39, 0x49, 0xb3, 0x47, 0xc7, 0x8e, 0x16, 0xbc, 0xfa, 0x85, 0xbc,
+  0xf7, 0x09, 0x0a, 0xbc, 0x9a, 0x20, 0xc9, 0xe2, 0x95, 0x51, 0x4a, 0x82,
+  0x64, 0x68, 0x06, 0x45, 0x38, 0x4d, 0xd0, 0x76, 0xef, 0xf0, 0x6e, 0x6c,
+  0x49, 0x46, 0x2b, 0x6e, 0xb4, 0x86, 0xda, 0x20, 0x61, 0xa8, 0x17, 0x72,
+  0x5d, 0xf8, 0x20, 0x3a, 0x06, 0x0d, 0x45, 0x73, 0x0d, 0x60, 0xb3, 0xd8,
+  0x83, 0x81, 0x1c, 0x4a, 0x15, 0x0a, 0x15, 0x0d, 0x3f, 0x83, 0x28, 0x5e,
+  0xaf, 0xd3, 0xad, 0xf6, 0x6b, 0x8c, 0xba, 0x45, 0xb4, 0xfb, 0x5e, 0x30,
+  0x70, 0xf4, 0x82, 0x4c, 0x9f, 0x4a, 0xd0, 0x17, 0x2b, 0x2d, 0x0b, 0xfe,
+  0x93, 0x6c, 0xf3, 0x3b, 0x70, 0x3d, 0x82, 0xbc, 0xd3, 0x23, 0x7f, 0xeb,
+  0x32, 0xad, 0x5a, 0xef, 0xd8, 0xf1, 0x95, 0x44, 0x0a, 0x71, 0xb4, 0xed,
+  0xea, 0xdc, 0xd9, 0x4e, 0x39, 0x38, 0xea, 0xc9, 0x06, 0xe6, 0x8d, 0x81,
+  0x9e, 0x5d, 0xc9, 0x1d, 0xef, 0xd1, 0xa3, 0x66, 0xd7, 0xe5, 0x95, 0xec,
+  0x10, 0x74, 0x7a, 0x3d, 0xd6, 0xe0, 0xa2, 0x15, 0x73, 0xdb, 0x8d, 0xb9,
+  0x6b, 0xc7, 0xdc, 0x49, 0xcc, 0x90, 0xc9, 0xd5, 0xe5, 0x52, 0xdb, 0x1b,
+  0x44, 0x51, 0xdb, 0x21, 0xdb, 0x19, 0x83, 0x53, 0x21, 0x13, 0x08, 0x27,
+  0x6c, 0x9f, 0xdf, 0x29, 0xc3, 0x7c, 0x91, 0x89, 0x88, 0xa4, 0x8f, 0x93,
+  0xfa, 0xd1, 0x33, 0x18, 0xe1, 0x48, 0x08, 0x25, 0x35, 0x09, 0xae, 0x5d,
+  0x6b, 0xba, 0x83, 0x16, 0x7e, 0x70, 0x99, 0x35, 0xf9, 0xd1, 0xcb, 0x4a,
+  0xc0, 0xf8, 0x63, 0x34, 0xa9, 0xbc, 0xdb, 0x20, 0x8c, 0x41, 0x17, 0xcb,
+  0xcf, 0xa2, 0x06, 0xf1, 0xa6, 0x4b, 0x3e, 0xfd, 0xfc, 0x16, 0x1c, 0x40,
+  0xb6, 0x80, 0xa4, 0x41, 0xcc, 0x6d, 0x92, 0x26, 0x95, 0xc8, 0x6f, 0x20,
+  0x3e, 0xd9, 0x8c, 0xe1, 0xbf, 0x89, 0x21, 0x97, 0xcc, 0x85, 0x33, 0x1e,
+  0x59, 0x13, 0xb8, 0xc2, 0xec, 0x8c, 0x7d, 0xf9, 0x02, 0xa0, 0xe1, 0xe6,
+  0x49, 0xb3, 0x79, 0xc0, 0x0a, 0x5e, 0xd5, 0x45, 0xa6, 0x33, 0x3b, 0xa1,
+  0x53, 0x15, 0xde, 0x5c, 0xb3, 0x27, 0xec, 0x83, 0x58, 0x93, 0xa3, 0xc6,
+  0x7a, 0x74, 0xa0, 0x46, 0x08, 0x35, 0xee, 0x86, 0x1a, 0x23, 0xd4, 0x24,
+  0xb8, 0xb6, 0x15, 0x0f, 0x3a, 0xb4, 0x8b, 0x00, 0x87, 0x17, 0xa5, 0x08,
+  0x2a, 0xe1, 0x0d, 0x66, 0x8c, 0x84, 0x64, 0x7a, 0xab, 0x78, 0x2d, 0x09,
+  0x43, 0x9f, 0x0e, 0xc6, 0x06, 0xed, 0x2a, 0x7d, 0x1e, 0x4f, 0x3f, 0xcb,
+  0x00, 0x1b, 0x3c, 0x3b, 0x50, 0x09, 0xea, 0x53, 0xb1, 0xd0, 0x17, 0x5a,
+  0xf5, 0x99, 0x84, 0x35, 0x73, 0xda, 0x54, 0x43, 0x24, 0x7c, 0xe3, 0xb1,
+  0x5c, 0x0b, 0x0c, 0xfe, 0xd7, 0x6f, 0xaa, 0x00, 0x56, 0x4c, 0x08, 0x4f,
+  0xd8, 0xc4, 0x29, 0xc5, 0x9b, 0x1c, 0x8e, 0xd7, 0x3d, 0x5e, 0x3b, 0x9f,
+  0x03, 0x76, 0x19, 0xf6, 0xf9, 0x60, 0x91, 0x22, 0x17, 0xee, 0xb3, 0x78,
+  0xc8, 0x6e, 0x1c, 0x67, 0x2f, 0xf3, 0x5e, 0x92, 0xb7, 0x5c, 0xb3, 0x58,
+  0xa6, 0xa0, 0xaa, 0x77, 0xec, 0xf7, 0xde, 0x60, 0x11, 0xa4, 0x87, 0xa9,
+  0x89, 0x5d, 0xb6, 0x82, 0xbc, 0x5d, 0xb4, 0x06, 0x00, 0x13, 0x4b, 0xb5,
+  0x8b, 0x25, 0xb8, 0x27, 0x60, 0x07, 0x48, 0xa0, 0xd2, 0xfa, 0x91, 0xf2,
+  0xdd, 0xaa, 0x7d, 0xac, 0xdb, 0xc7, 0x4e, 0xbb, 0x48, 0x31, 0xfb, 0x01,
+  0xb9, 0x77, 0xec, 0x24, 0xa0, 0x23, 0xb1, 0xa0, 0xcf, 0xd8, 0x98, 0xe0,
+  0xbb, 0x59, 0xa4, 0xe2, 0x88, 0x34, 0x52, 0xa6, 0xf7, 0xed, 0xd9, 0x24,
+  0x37, 0x8a, 0x74, 0xfa, 0xa3, 0x96, 0x3d, 0xaa, 0xa5, 0xcd, 0x5f, 0xe8,
+  0x65, 0x8f, 0x13, 0x01, 0xf1, 0xd5, 0xb7, 0xcf, 0x85, 0xee, 0x9d, 0xf8,
+  0xbd, 0x53, 0x3d, 0x53, 0xd2, 0x89, 0x1c, 0xe6, 0x75, 0x84, 0xc7, 0x98,
+  0x83, 0xfb, 0xb3, 0x2e, 0x83, 0x90, 0xd0, 0x3a, 0x88, 0xca, 0x64, 0x86,
+  0xce, 0x05, 0x83, 0xa4, 0x1f, 0xf3, 0x5a, 0xd4, 0x17, 0x44, 0x23, 0xf8,
+  0x9f, 0x03, 0xd6, 0x22, 0xf1, 0x4b, 0x28, 0x3c, 0x26, 0xc8, 0xd6, 0x98,
+  0x44, 0xd1, 0xd4, 0x35, 0x26, 0x84, 0x08, 0x59, 0x93, 0xea, 0x69, 0x9a,
+  0x93, 0xee, 0x68, 0xd8, 0x93, 0xee, 0x98, 0xe8, 0x8e, 0x89, 0xdb, 0xf1,
+  0x50, 0x4b, 0x3b, 0x09, 0xac, 0x6d, 0xb4, 0xbf, 0x09, 0x25, 0x7b, 0x98,
+  0x01, 0x42, 0x20, 0xcc, 0x6a, 0xd0, 0xff, 0x3c, 0x29, 0x20, 0x02, 0x56,
+  0x9b, 0x18, 0x6e, 0x4a, 0x2c, 0x2e, 0x99, 0xd4, 0x13, 0xbe, 0x52, 0xbd,
+  0x90, 0xf2, 0x6d, 0x34, 0x07, 0xbf, 0xa9, 0x32, 0x52, 0xb5, 0x99, 0x0d,
+  0xc1, 0x8e, 0x8e, 0x99, 0x27, 0x25, 0x45, 0x21, 0x01, 0xd1, 0xa4, 0xef,
+  0x46, 0xc3, 0x03, 0x05, 0x98, 0xec, 0xb8, 0x99, 0x8b, 0x39, 0x24, 0x36,
+  0x22, 0xf2, 0x85, 0xd0, 0x48, 0x06, 0x99, 0xf0, 0x73, 0x09, 0xb2, 0xc2,
+  0xcf, 0xc9, 0x89, 0x9d, 0x53, 0x12, 0x59, 0x0b, 0xd3, 0x44, 0x9d, 0x37,
+  0x8a, 0xc7, 0xd7, 0x80, 0x85, 0x56, 0xac, 0xf7, 0xde, 0xb0, 0x00, 0xc5,
+  0xa2, 0x96, 0xcb, 0x4c, 0xc2, 0x53, 0x69, 0x34, 0xd6, 0x03, 0x65, 0x50,
+  0x59, 0x83, 0xe1, 0x0c, 0x36, 0x6e, 0xca, 0x4a, 0xbd, 0xa1, 0x6c, 0x40,
+  0x67, 0x80, 0x85, 0xb1, 0x0e, 0x3d, 0x70, 0xa1, 0x1b, 0xbb, 0x0a, 0x96,
+  0xb0, 0x27, 0x8e, 0x1d, 0xef, 0x73, 0x30, 0x9d, 0x1e, 0x46, 0xda, 0x80,
+  0x1a, 0xfa, 0xde, 0xf8, 0x19, 0xb5, 0xb5, 0xfd, 0x21, 0x5a, 0x4d, 0x7e,
+  0x72, 0x6e, 0x53, 0x95, 0x61, 0x23, 0x48, 0x3a, 0x77, 0x73, 0x01, 0x09,
+  0xd0, 0xe2, 0x26, 0xce, 0xdb, 0xfc, 0x87, 0x45, 0xf2, 0x96, 0xfc, 0x79,
+  0xd0, 0x11, 0x20, 0x13, 0x26, 0x1c, 0x3c, 0x27, 0xa1, 0xa1, 0xe9, 0x42,
+  0xcd, 0x9d, 0x93, 0x28, 0xcd, 0x74, 0xbd, 0xdb, 0x9c, 0xab, 0xb0, 0xcb,
+  0x34, 0x89, 0x7d, 0xe7, 0xdc, 0x6c, 0x70, 0xa6, 0x59, 0x73, 0x7a, 0xee,
+  0xb8, 0x5d, 0xa5, 0x2b, 0x99, 0x70, 0x8a, 0xf9, 0x2f, 0x68, 0xae, 0x29,
+  0xb2, 0x3e, 0x9b, 0x7c, 0x92, 0xb2, 0xa4, 0xd2, 0xd2, 0x9b, 0x29, 0xf7,
+  0xaa, 0xc9, 0xac, 0x14, 0x4d, 0x3a, 0x4b, 0x1e, 0xb2, 0x32, 0x2f, 0x94,
+  0xb2, 0x4b, 0x7c, 0xf9, 0x49, 0xcd, 0x9c, 0x5e, 0x14, 0xb6, 0x00, 0xa8,
+  0xf3, 0x35, 0x5b, 0xd9, 0x33, 0x2d, 0xa4, 0x60, 0x67, 0x52, 0xb8, 0xa0,
+  0x39, 0x78, 0x69, 0x9e, 0xf4, 0xd1, 0x92, 0xa3, 0x28, 0xae, 0xab, 0xfc,
+  0xdd, 0x7a, 0x16, 0x57, 0x4e, 0x0c, 0x88, 0x7d, 0xb5, 0x6c, 0x7f, 0x65,
+  0x13, 0x4a, 0x0c, 0xb2, 0x71, 0x93, 0x90, 0x82, 0x44, 0xeb, 0x18, 0x86,
+  0xab, 0x24, 0xaa, 0x48, 0x93, 0x01, 0x55, 0x75, 0x04, 0x71, 0x05, 0x7b,
+  0xb6, 0xe4, 0xa5, 0x7c, 0xaa, 0x42, 0x20, 0x79, 0xeb, 0x8b, 0x6c, 0x23,
+  0xa2, 0x3d, 0x91, 0xe2, 0xaa, 0xc7, 0x10, 0x14, 0x06, 0x78, 0xbd, 0x70,
+  0x81, 0x2c, 0x5a, 0xd5, 0x69, 0x95, 0xe8, 0x65, 0x3e, 0xe5, 0xa5, 0xe5,
+  0xd8, 0x83, 0x1c, 0x32, 0x5a, 0x85, 0x53, 0x4c, 0xaa, 0xd2, 0x96, 0x8e,
+  0x2d, 0x75, 0x8a, 0xdd, 0x95, 0xff, 0xc9, 0xaa, 0x44, 0x8f, 0xd6, 0x8d,
+  0x83, 0x53, 0xa2, 0x6a, 0xa3, 0x5e, 0x2e, 0x4e, 0x21, 0xb0, 0x60, 0xea,
+  0x4f, 0x19, 0xce, 0x48, 0x55, 0xc4, 0x52, 0x1f, 0xef, 0x31, 0x6c, 0xef,
+  0x53, 0x0b, 0x53, 0x05, 0x05, 0x27, 0x1f, 0x50, 0x6d, 0x49, 0x56, 0x56,
+  0x71, 0x36, 0xe5, 0xf9, 0x5c, 0xed, 0xc3, 0x2f, 0xc5, 0x18, 0x64, 0x4f,
+  0x6d, 0x0e, 0x8f, 0x0e, 0x44, 0xd3, 0x54, 0x1e, 0x84, 0x71, 0xb1, 0xdf,
+  0x77, 0x52, 0x7e, 0xc5, 0xcb, 0xa5, 0xd8, 0xdb, 0xdb, 0x47, 0xce, 0x78,
+  0x57, 0xbf, 0x3a, 0x7b, 0x30, 0xac, 0x79, 0xb5, 0x98, 0xb0, 0x0b, 0x74,
+  0x63, 0x0e, 0x9a, 0xd3, 0x84, 0x22, 0x14, 0xaa, 0x9a, 0x48, 0xcd, 0xb4,
+  0x70, 0x3a, 0x7c, 0x46, 0x50, 0x80, 0x45, 0x63, 0x05, 0x36, 0xfb, 0xd0,
+  0xa5, 0x1c, 0xa3, 0xeb, 0x66, 0x7c, 0xa2, 0x4d, 0xc0, 0x86, 0x28, 0x88,
+  0xe4, 0xa4, 0xa9, 0x06, 0x2a, 0x18, 0xa6, 0x98, 0x4e, 0x43, 0x09, 0x1f,
+  0xf4, 0x7e, 0xa4, 0x8b, 0xe6, 0xae, 0x79, 0xea, 0x42, 0x69, 0x5b, 0x25,
+  0xc8, 0x45, 0x95, 0x7b, 0xa0, 0x35, 0xe5, 0x0e, 0xdb, 0x76, 0x38, 0xda,
+  0x61, 0xe8, 0x88, 0x34, 0x76, 0x5e, 0xe7, 0x81, 0x61, 0x4b, 0x70, 0x3d,
+  0xa8, 0x0d, 0xcb, 0x35, 0x38, 0xb5, 0x5b, 0xe2, 0xce, 0xa5, 0x1a, 0xd1,
+  0x77, 0x59, 0xf7, 0xd9, 0x9c, 0x82, 0x10, 0x79, 0x81, 0xd0, 0x67, 0xeb,
+  0x58, 0x4e, 0xe5, 0x1b, 0x78, 0xa1, 0x71, 0x37, 0x2e, 0x5d, 0x1b, 0xaa,
+  0xe4, 0xf2, 0x60, 0x83, 0xc9, 0x83, 0x8f, 0xf6, 0xb5, 0x7b, 0x01, 0x70,
+  0x97, 0x00, 0x24, 0x7e, 0x49, 0x30, 0xe3, 0x54, 0x14, 0x03, 0xd8, 0xd7,
+  0x00, 0xfe, 0x21, 0xd2, 0x13, 0xaa, 0x10, 0x16, 0x3c, 0x5f, 0xf1, 0xaa,
+  0xd8, 0x5a, 0xb5, 0xe9, 0x16, 0x9d, 0x0f, 0xeb, 0xcd, 0x26, 0x22, 0x05,
+  0x45, 0x57, 0x59, 0x4e, 0x89, 0xeb, 0x2a, 0x60, 0x04, 0x17, 0xb4, 0x8a,
+  0xe2, 0x7a, 0xa8, 0xde, 0xfe, 0x35, 0x6d, 0x0c, 0x5c, 0x82, 0x1a, 0x86,
+  0x1b, 0xc0, 0xcf, 0xeb, 0xf9, 0x9c, 0x17, 0xff, 0xd2, 0xfd, 0x6e, 0x8c,
+  0x17, 0x57, 0xc0, 0xcd, 0x4d, 0x5d, 0xf1, 0x52, 0x2e, 0x0f, 0x84, 0x89,
+  0x6c, 0xeb, 0x85, 0x05, 0x5d, 0x14, 0x79, 0xbd, 0x76, 0xc0, 0xb0, 0x45,
+  0x1b, 0x91, 0x64, 0xc3, 0x62, 0x92, 0x13, 0x71, 0xb0, 0x87, 0x1a, 0xd4,
+  0x35, 0x07, 0x4f, 0x23, 0x36, 0x89, 0x69, 0x9e, 0x55, 0x49, 0xa6, 0x8b,
+  0x19, 0x6e, 0x9d, 0x51, 0xd0, 0x0f, 0xd0, 0x88, 0x62, 0x11, 0xcc, 0x69,
+  0x04, 0x2f, 0x86, 0x1d, 0xb2, 0x94, 0xd4, 0xd7, 0xac, 0x35, 0x88, 0xc8,
+  0x36, 0x95, 0x91, 0xed, 0x15, 0x9b, 0x10, 0xb9, 0xe9, 0xe4, 0xd1, 0xf2,
+  0x96, 0xa1, 0x20, 0x83, 0xc4, 0xa1, 0xfb, 0x7e, 0x22, 0xaa, 0x28, 0x8d,
+  0x36, 0x51, 0x33, 0x31, 0x51, 0xe9, 0x7d, 0x8b, 0x22, 0x54, 0x1c, 0xfd,
+  0x9d, 0xa7, 0x06, 0xc3, 0x8e, 0x5b, 0x17, 0x6f, 0x20, 0xba, 0xb2, 0x87,
+  0x85, 0x77, 0x0b, 0xca, 0x1d, 0xa2, 0xfb, 0xb2, 0xeb, 0x52, 0x9a, 0x22,
+  0xa0, 0x24, 0x27, 0x6f, 0x4a, 0x6e, 0xa7, 0xc5, 0x91, 0xda, 0x88, 0xdd,
+  0x26, 0x3e, 0x04, 0xea, 0x9d, 0xa2, 0x63, 0xf9, 0xdf, 0x41, 0x38, 0x44,
+  0x64, 0x5b, 0x2c, 0x77, 0xc5, 0x1d, 0x77, 0x89, 0x2b, 0x6a, 0x7e, 0x3a,
+  0x5b, 0x18, 0xea, 0x27, 0x29, 0xe2, 0x3e, 0x81, 0x8c, 0xd1, 0x27, 0x40,
+  0xf0, 0x4e, 0x4a, 0xa4, 0xe2, 0x2b, 0x47, 0x18, 0xe8, 0x15, 0xc1, 0x0d,
+  0x5d, 0x25, 0x12, 0xc1, 0x93, 0x08, 0x49, 0xca, 0xe5, 0xa3, 0xe3, 0x8a,
+  0x67, 0xec, 0x89, 0xc3, 0xb9, 0xe7, 0xfd, 0xd0, 0xb9, 0x39, 0x28, 0x9e,
+  0x9f, 0x73, 0x17, 0xaa, 0xe0, 0x40, 0x02, 0x4b, 0xf7, 0x76, 0x61, 0x21,
+  0x5c, 0x65, 0x4a, 0x98, 0x08, 0x3c, 0x46, 0x51, 0xa1, 0x5a, 0x49, 0x03,
+  0x28, 0x06, 0xdf, 0xa6, 0xc2, 0x35, 0x75, 0x19, 0x55, 0x43, 0xcf, 0xb6,
+  0x56, 0xa2, 0x14, 0xa2, 0x34, 0x4e, 0xde, 0x94, 0x61, 0x39, 0x2d, 0xae,
+  0x61, 0xd9, 0x19, 0x20, 0x4f, 0x2a, 0xe4, 0x09, 0xe9, 0x89, 0x18, 0x87,
+  0xa2, 0x7a, 0xc0, 0x7a, 0xf8, 0x6b, 0x38, 0xbf, 0x6f, 0xd8, 0x92, 0xc7,
+  0xf6, 0x41, 0x2e, 0x4c, 0x56, 0x21, 0x0e, 0x5f, 0xcb, 0x84, 0xf5, 0x21,
+  0xb2, 0x39, 0x54, 0xbc, 0xb5, 0xda, 0x36, 0x0d, 0x20, 0xdb, 0x77, 0x90,
+  0x96, 0xbd, 0x43, 0xec, 0x5b, 0xbe, 0xb1, 0xeb, 0x36, 0xb2, 0x6f, 0x88,
+  0xbc, 0xc9, 0x81, 0x91, 0x0d, 0x1e, 0x00, 0xfa, 0xe0, 0x77, 0x9b, 0x06,
+  0xa0, 0xe9, 0x90, 0xc5, 0x6e, 0x13, 0xb0, 0x74, 0x9f, 0xbc, 0xf9, 0x87,
+  0x4b, 0x76, 0xac, 0xbd, 0x91, 0x2b, 0xae, 0xe2, 0x52, 0x54, 0xb1, 0x5e,
+  0x59, 0x58, 0x83, 0xd6, 0xdc, 0x8a, 0x45, 0x5a, 0xf3, 0xca, 0xd0, 0x30,
+  0x24, 0x90, 0xba, 0xee, 0x10, 0x62, 0xf9, 0x44, 0x75, 0x94, 0xf4, 0xbd,
+  0xcf, 0x09, 0x3b, 0xb7, 0x27, 0x9c, 0x8e, 0xa9, 0x6c, 0xd0, 0x54, 0x36,
+  0xa9, 0x3a, 0x87, 0x73, 0x4c, 0x7c, 0x03, 0x66, 0xb2, 0x49, 0xc5, 0xaf,
+  0xeb, 0x13, 0xf4, 0x4c, 0xc9, 0x73, 0x1a, 0x8d, 0x75, 0x0d, 0x60, 0xd6,
+  0x29, 0x98, 0xf8, 0x91, 0xde, 0xd5, 0x22, 0x46, 0xe3, 0x46, 0xf3, 0xab,
+  0xbc, 0x58, 0x2f, 0xdf, 0xc6, 0x05, 0x68, 0xbd, 0x0c, 0x85, 0xdb, 0x4a,
+  0xd1, 0x0e, 0x94, 0x9d, 0x53, 0xda, 0x7e, 0xd1, 0x40, 0x78, 0x91, 0xcd,
+  0xd3, 0x9a, 0x67, 0x68, 0x30, 0x5a, 0x2d, 0x16, 0xc3, 0x76, 0x5f, 0x04,
+  0xd6, 0x7f, 0x85, 0xea, 0xa9, 0xe4, 0x84, 0x91, 0x61, 0x8c, 0x8a, 0x2a,
+  0x50, 0x51, 0x95, 0x8a, 0xdf, 0x90, 0xdb, 0x4c, 0x34, 0x71, 0x8d, 0x6e,
+  0x47, 0xbb, 0x06, 0x14, 0xea, 0x43, 0xa5, 0x42, 0x08, 0x3c, 0x28, 0xe1,
+  0x49, 0x20, 0xb0, 0x51, 0x84, 0x2b, 0xc9, 0x86, 0xc7, 0x94, 0x22, 0xd9,
+  0x84, 0x33, 0xd7, 0x0c, 0xf1, 0x35, 0x0a, 0x4f, 0x19, 0x99, 0xb4, 0x3b,
+  0xe1, 0x18, 0xfa, 0x0e, 0x36, 0x1e, 0x33, 0xe8, 0xc7, 0x01, 0x3b, 0xb6,
+  0xcc, 0x5e, 0x34, 0x09, 0x6c, 0x03, 0x04, 0xb6, 0x96, 0xc0, 0x76, 0x2f,
+  0x81, 0x5d, 0x80, 0xc0, 0xce, 0x12, 0xd8, 0xf9, 0x04, 0x5a, 0xbd, 0x64,
+  0x5b, 0x64, 0x66, 0x65, 0x1d, 0xda, 0xe7, 0x2d, 0x79, 0xde, 0x35, 0xa3,
+  0x30, 0x6b, 0x17, 0x73, 0xb4, 0x8b, 0xb9, 0xb0, 0x0b, 0xe9, 0x7b, 0x8c,
+  0x41, 0xcc, 0xc1, 0x20, 0xe6, 0xa9, 0xf8, 0x6d, 0xae, 0x19, 0x55, 0xd5,
+  0x96, 0x08, 0xd7, 0x00, 0x61, 0x75, 0x4f, 0x7c, 0x48, 0xcb, 0x9a, 0xd6,
+  0x02, 0x9a, 0xb5, 0x6d, 0xfc, 0x80, 0x59, 0xe4, 0x82, 0x26, 0xad, 0x26,
+  0xbe, 0x90, 0x61, 0xc5, 0x07, 0x83, 0x79, 0xde, 0xe6, 0x9f, 0xdc, 0xd5,
+  0xb8, 0x37, 0xb8, 0x96, 0xb2, 0x60, 0xd1, 0xdf, 0x3d, 0x04, 0x70, 0x00,
+  0x9a, 0xa7, 0x17, 0x92, 0xb9, 0xd8, 0x9a, 0x68, 0xf8, 0x14, 0x43, 0x42,
+  0xdd, 0x78, 0x50, 0x93, 0x20, 0xd4, 0x94, 0x68, 0x50, 0x8a, 0x40, 0xe6,
+  0xfa, 0xe1, 0x07, 0x1c, 0x41, 0x31, 0xed, 0x61, 0xbb, 0x4f, 0xbb, 0xf3,
+  0x4c, 0xc3, 0x65, 0x4b, 0xea, 0xea, 0xbb, 0xd0, 0x01, 0x09, 0xf5, 0x18,
+  0x16, 0xd4, 0x9e, 0xa5, 0x40, 0xe6, 0x9f, 0x55, 0x12, 0xf2, 0xd1, 0x23,
+  0x16, 0xaa, 0x79, 0x58, 0xa6, 0x3b, 0xa8, 0x08, 0x56, 0x43, 0x44, 0x94,
+  0x97, 0x6d, 0x08, 0x6e, 0xd6, 0xce, 0xfe, 0x73, 0x98, 0xae, 0x93, 0x98,
+  0x8e, 0xb3, 0x98, 0x8e, 0xd3, 0x98, 0x96, 0xf3, 0x18, 0xa7, 0x8f, 0x1e,
+  0x56, 0x20, 0x10, 0x69, 0xf6, 0xb5, 0xdf, 0x54, 0x1b, 0xa8, 0xa1, 0x5d,
+  0x47, 0x5f, 0xbe, 0xb0, 0xf6, 0x03, 0xad, 0x81, 0x33, 0x63, 0x4d, 0x66,
+  0x32, 0xbe, 0x80, 0x05, 0xd1, 0x1f, 0xb4, 0xa8, 0xb2, 0xe3, 0x94, 0xe5,
+  0xe3, 0xfe, 0x23, 0x0a, 0x2f, 0xb2, 0xf9, 0xc5, 0xe4, 0x77, 0xcd, 0x73,
+  0x86, 0x40, 0x9e, 0x93, 0xa1, 0xcb, 0xca, 0x84, 0x8f, 0x81, 0x51, 0x96,
+  0xd1, 0x2a, 0xc9, 0xfa, 0x4d, 0x72, 0xca, 0x91, 0x0d, 0xe5, 0x89, 0x0a,
+  0x20, 0x5d, 0x02, 0x86, 0xf8, 0xf5, 0xb6, 0x37, 0x72, 0x4d, 0x4a, 0xdd,
+  0xf9, 0x6f, 0x3f, 0xd1, 0xc9, 0xc8, 0xae, 0x14, 0x9e, 0x39, 0x87, 0x03,
+  0x89, 0x40, 0x23, 0xdf, 0xbf, 0x78, 0x16, 0x7b, 0x9d, 0x13, 0x48, 0x12,
+  0x86, 0x6f, 0x9b, 0x3c, 0xcf, 0x12, 0xc2, 0xc7, 0x42, 0x6d, 0xd3, 0x71,
+  0xd1, 0x0c, 0xbd, 0x30, 0xb0, 0xf5, 0xe2, 0xd9, 0xb9, 0xef, 0x11, 0x2d,
+  0x6c, 0x6b, 0xc2, 0x4c, 0x6c, 0xa4, 0xc6, 0xb4, 0xb0, 0xc6, 0xf3, 0xbb,
+  0xba, 0x11, 0xd3, 0x90, 0xb3, 0xb1, 0x9a, 0x7d, 0x70, 0x62, 0xbb, 0x77,
+  0xaa, 0xb1, 0x33, 0x65, 0x51, 0x04, 0xf4, 0x57, 0x1b, 0xf6, 0xc5, 0x5d,
+  0xfa, 0xab, 0x66, 0x94, 0xec, 0x39, 0x80, 0x3f, 0xfd, 0x4c, 0xf6, 0x81,
+  0xa7, 0xb2, 0x87, 0x9f, 0xc8, 0xd9, 0xbc, 0xe8, 0xe0, 0xf2, 0xba, 0x2c,
+  0x9f, 0xff, 0x8f, 0x4a, 0x71, 0x7b, 0xea, 0x6c, 0x9d, 0x55, 0x96, 0x07,
+  0x15, 0xd8, 0xbe, 0xb9, 0xc2, 0xf6, 0x57, 0x95, 0xd8, 0xac, 0x71, 0x1e,
+  0x5a, 0x94, 0x79, 0x48, 0x55, 0xe6, 0xe1, 0xb5, 0x84, 0x71, 0x67, 0x2d,
+  0x01, 0xaf, 0xed, 0x74, 0xd7, 0x11, 0xc2, 0x4b, 0xd0, 0x2f, 0x72, 0xc8,
+  0x20, 0xae, 0xe2, 0x6b, 0x63, 0xe6, 0x61, 0x43, 0x7c, 0xc3, 0x17, 0x78,
+  0x66, 0xf9, 0x3d, 0x70, 0x76, 0xae, 0xee, 0xf3, 0xb5, 0x4b, 0xd6, 0x0f,
+  0x56, 0x1c, 0xc4, 0xdd, 0x27, 0x40, 0x75, 0xe4, 0x94, 0x63, 0x1f, 0x20,
+  0xaa, 0xaa, 0x3b, 0x74, 0x97, 0x42, 0xbe, 0xb1, 0xf4, 0xd0, 0x7e, 0x83,
+  0x3e, 0x70, 0xc6, 0x18, 0x3c, 0x44, 0x19, 0x76, 0x14, 0x08, 0x48, 0x51,
+  0xc3, 0x2b, 0xfc, 0x93, 0xda, 0xc6, 0x91, 0xeb, 0xb3, 0x89, 0x79, 0xb4,
+  0xe6, 0x82, 0x32, 0xc2, 0x6e, 0xbf, 0x26, 0x29, 0x00, 0xda, 0xbf, 0x9c,
+  0x42, 0x8b, 0x11, 0x97, 0xfd, 0xc2, 0xd7, 0x68, 0xdf, 0x77, 0xdc, 0x82,
+  0xfd, 0x66, 0xe3, 0x71, 0xeb, 0x0f, 0xa3, 0x07, 0xd7, 0x1f, 0xf6, 0x09,
+  0x7e, 0x80, 0xe4, 0x9b, 0xaf, 0x94, 0x1c, 0xa7, 0xa8, 0x2f, 0x78, 0x92,
+  0x5f, 0x8f, 0xfc, 0x0d, 0xf5, 0xf0, 0x2c, 0x9c, 0xad, 0x37, 0xd3, 0x1b,
+  0xe7, 0x68, 0xe6, 0x54, 0xb8, 0x22, 0xbb, 0xa5, 0x74, 0x7d, 0x4a, 0x61,
+  0x42, 0xe8, 0xc0, 0x07, 0x6f, 0x21, 0xf4, 0x71, 0x18, 0x7d, 0x1c, 0xfa,
+  0x5e, 0x8e, 0x08, 0x26, 0x68, 0xe0, 0xc2, 0xeb, 0xe4, 0x66, 0xc8, 0xba,
+  0xbf, 0xe0, 0x18, 0x84, 0xab, 0x38, 0x67, 0x67, 0xec, 0x35, 0x2f, 0x60,
+  0xf6, 0x57, 0xac, 0x5a, 0x72, 0xb6, 0xe6, 0x45, 0xb9, 0x16, 0x6a, 0xde,
+  0x70, 0x36, 0x4b, 0x36, 0x10, 0x9a, 0x99, 0xc8, 0xba, 0x53, 0x15, 0x7a,
+  0x4d, 0xbe, 0x99, 0xc6, 0x69, 0x5c, 0xf4, 0xe5, 0x55, 0xec, 0x6e, 0x8c,
+  0x5b, 0xab, 0xa6, 0x3d, 0x7a, 0xda, 0x4f, 0x7b, 0x1c, 0xa2, 0x6d, 0x88,
+  0xef, 0xbb, 0x06, 0xd9, 0xeb, 0xba, 0x0a, 0xd9, 0xa3, 0xd7, 0x21, 0x83,
+  0x06, 0xdc, 0xfd, 0xb9, 0xcd, 0xc0, 0xa7, 0x32, 0x3e, 0x84, 0xca, 0xf8,
+  0x75, 0x9b, 0x49, 0x90, 0xbb, 0x96, 0x98, 0x32, 0xc4, 0x77, 0x7b, 0x58,
+  0x88, 0x76, 0x7b, 0x4c, 0x03, 0xeb, 0x2a, 0x0e, 0xf9, 0x83, 0x63, 0xae,
+  0x03, 0xaf, 0x63, 0xfa, 0xc7, 0xff, 0xf6, 0xd2, 0x80, 0xf3, 0x05, 0xa6,
+  0xc9, 0x0c, 0xde, 0xd3, 0x66, 0x37, 0xde, 0x45, 0x2d, 0x92, 0x7e, 0xe9,
+  0x32, 0x95, 0x16, 0x7d, 0x67, 0x3e, 0x55, 0x10, 0x1b, 0xdc, 0x82, 0xbb,
+  0x88, 0x8c, 0x0e, 0x20, 0x72, 0xda, 0xba, 0x97, 0x1f, 0x7a, 0xe1, 0x34,
+  0xb4, 0x45, 0x1e, 0x1c, 0x85, 0xfa, 0x97, 0x34, 0xf4, 0x47, 0x7a, 0x78,
+  0xdb, 0x9e, 0xee, 0x76, 0x86, 0x05, 0x90, 0x6b, 0x2c, 0x02, 0x92, 0xb6,
+  0xce, 0x49, 0x57, 0xe7, 0x53, 0xd1, 0x69, 0x2f, 0x6b, 0xea, 0xd1, 0x1e,
+  0xf0, 0x71, 0x86, 0xff, 0x75, 0x86, 0xa1, 0x71, 0x7b, 0xe1, 0x89, 0xe0,
+  0x7d, 0x58, 0x81, 0xd6, 0x42, 0x7a, 0xed, 0x37, 0x0d, 0xa4, 0x51, 0x7e,
+  0x07, 0x41, 0x62, 0x86, 0x52, 0x7f, 0x41, 0xab, 0xd6, 0x3a, 0x2a, 0xcc,
+  0xbf, 0x02, 0x82, 0x50, 0x2d, 0x57, 0x40, 0x54, 0xe7, 0x9d, 0xbd, 0x70,
+  0xf1, 0x54, 0x7c, 0x2e, 0x62, 0x3f, 0x08, 0xb1, 0x30, 0x5b, 0x0a, 0xb3,
+  0x0d, 0xc3, 0xec, 0x28, 0xcc, 0xce, 0xeb, 0xdc, 0xbf, 0xca, 0x1c, 0xf0,
+  0xb6, 0x6b, 0x29, 0x9a, 0x9a, 0xfd, 0xa6, 0x57, 0x93, 0x52, 0x2d, 0x3e,
+  0xa4, 0xfc, 0xd2, 0x37, 0x22, 0xb7, 0x15, 0x74, 0xc3, 0x31, 0xfa, 0x94,
+  0xf8, 0x46, 0xc4, 0x54, 0x46, 0x13, 0xa7, 0x74, 0x26, 0xee, 0x60, 0x93,
+  0x6d, 0xb9, 0xd2, 0x45, 0x4c, 0x47, 0x06, 0x31, 0x30, 0xdf, 0x04, 0xf1,
+  0xf6, 0x20, 0xc4, 0x91, 0x4c, 0x04, 0x98, 0x3f, 0x57, 0xc8, 0xe0, 0xd6,
+  0xe7, 0x78, 0x1b, 0xe4, 0x78, 0xeb, 0x72, 0xbc, 0x3d, 0x68, 0xe0, 0xbf,
+  0x7f, 0x35, 0xc7, 0x13, 0xcd, 0xb1, 0xcb, 0xf2, 0x7e, 0x97, 0xd8, 0xe5,
+  0x32, 0x94, 0x25, 0x87, 0x2e, 0xe4, 0x38, 0xb7, 0x71, 0xcc, 0xfd, 0xc5,
+  0xce, 0xeb, 0x38, 0x86, 0x7a, 0xe7, 0x7d, 0x1c, 0xfd, 0xf5, 0x87, 0x45,
+  0x24, 0xdf, 0xfe, 0x31, 0xb1, 0x86, 0x4a, 0x78, 0x34, 0x57, 0xdf, 0x82,
+  0xd7, 0xac, 0x70, 0x70, 0x5c, 0xbc, 0xce, 0x9d, 0x3c, 0x60, 0xaf, 0xf9,
+  0xf1, 0x76, 0xf0, 0xf2, 0x4e, 0xe8, 0xcb, 0x7d, 0x75, 0xf5, 0x46, 0x7d,
+  0x6d, 0x60, 0xe9, 0x34, 0xee, 0xcb, 0xb9, 0xdd, 0x6a, 0x98, 0x93, 0x13,
+  0xda, 0x81, 0x0c, 0xa9, 0x36, 0x25, 0x33, 0x59, 0x51, 0x8e, 0x2a, 0x2c,
+  0xa9, 0x6b, 0xe6, 0xa1, 0x63, 0x94, 0x78, 0x1f, 0xd0, 0x88, 0x1b, 0xff,
+  0x52, 0x8d, 0x38, 0x77, 0x80, 0xae, 0xae, 0x02, 0x5f, 0xa3, 0x3b, 0x1f,
+  0x1b, 0xe8, 0x33, 0xa2, 0x3d, 0x7f, 0xf4, 0xc0, 0x5c, 0x2e, 0x22, 0x1a,
+  0xb1, 0xa7, 0x7b, 0x6e, 0xb7, 0xa7, 0x11, 0xca, 0x90, 0xab, 0x11, 0xec,
+  0x69, 0x6a, 0xa4, 0x35, 0x70, 0xee, 0xd2, 0x08, 0xad, 0x52, 0x53, 0x7d,
+  0x90, 0xcb, 0xb6, 0x57, 0x57, 0x8d, 0x0f, 0xec, 0xa9, 0x2e, 0x54, 0xd5,
+  0x3b, 0xa4, 0x09, 0x41, 0x5c, 0xeb, 0x41, 0x53, 0x50, 0x5a, 0xd0, 0x55,
+  0x1f, 0xda, 0xe5, 0x69, 0xc0, 0xb2, 0xe0, 0xca, 0x2f, 0xda, 0x9b, 0xd2,
+  0x6b, 0x22, 0xd7, 0xcc, 0x41, 0x94, 0x92, 0x87, 0x45, 0xa7, 0xe1, 0x26,
+  0x15, 0x9d, 0xdc, 0x2a, 0x16, 0xa2, 0x7b, 0x7f, 0x22, 0x80, 0x8a, 0xae,
+  0xc2, 0xd7, 0x90, 0xe8, 0x32, 0x2d, 0x20, 0x9f, 0xe0, 0x10, 0xd1, 0x75,
+  0xcc, 0x41, 0xbb, 0x3c, 0xd1, 0x2d, 0x0b, 0xae, 0xe8, 0xa2, 0xbd, 0x29,
+  0xba, 0x26, 0x72, 0xcd, 0x1c, 0xc4, 0xf6, 0x49, 0x77, 0x37, 0x5f, 0x2a,
+  0xbb, 0x73, 0x7f, 0x5a, 0x48, 0xdf, 0xf8, 0x0b, 0x07, 0x54, 0x7e, 0xb3,
+  0xa9, 0x87, 0x34, 0x80, 0x83, 0x68, 0x1d, 0x58, 0x3a, 0x4a, 0x0b, 0xd6,
+  0x8d, 0xba, 0xdd, 0x9e, 0x26, 0x28, 0x43, 0xae, 0x2e, 0xb0, 0xa7, 0xa9,
+  0x0d, 0x4b, 0xea, 0x9a, 0x79, 0xe8, 0x56, 0x23, 0xf2, 0x82, 0xa3, 0xfd,
+  0xba, 0xc8, 0x7a, 0x5d, 0xf7, 0x2b, 0x2f, 0x2c, 0xf5, 0x39, 0xd1, 0x80,
+  0xa8, 0x71, 0xdd, 0x38, 0x2d, 0xde, 0xf7, 0x71, 0x2e, 0xf8, 0xa9, 0x0b,
+  0x8c, 0xec, 0x92, 0x80, 0x32, 0x86, 0x38, 0x04, 0x49, 0xee, 0x7c, 0x42,
+  0x37, 0xf2, 0x0c, 0x37, 0x16, 0xb1, 0x49, 0x03, 0x09, 0x22, 0x24, 0xc4,
+  0x4a, 0x66, 0xcd, 0xf1, 0xa1, 0xed, 0x54, 0x76, 0x51, 0x44, 0x07, 0xc6,
+  0x7e, 0xe7, 0xe6, 0x98, 0x87, 0xcd, 0x67, 0xcb, 0xd1, 0x90, 0x95, 0xa6,
+  0xb8, 0x26, 0xab, 0xa3, 0xe9, 0x7a, 0x19, 0x8f, 0xb0, 0x76, 0x25, 0x9f,
+  0xc7, 0xb2, 0x18, 0x81, 0xb7, 0x45, 0xd9, 0x0f, 0x71, 0x3a, 0xad, 0x53,
+  0x71, 0x67, 0x5e, 0xa4, 0xaa, 0xf2, 0x63, 0xc4, 0xb8, 0xd8, 0x42, 0x8a,
+  0x9f, 0x17, 0xb3, 0x24, 0x13, 0xed, 0x10, 0x2a, 0xf3, 0x78, 0xba, 0xd4,
+  0xee, 0x4f, 0x14, 0x35, 0x04, 0x68, 0xc6, 0x05, 0xed, 0x6c, 0x06, 0xab,
+  0xba, 0x90, 0xe3, 0xb3, 0x75, 0x1a, 0x67, 0xbc, 0x1c, 0x22, 0xdd, 0xff,
+  0xc0, 0x20, 0xa7, 0x23, 0x09, 0x20, 0x1e, 0x4f, 0x80, 0xad, 0x82, 0xeb,
+  0x34, 0x38, 0xdd, 0x46, 0x00, 0x75, 0x33, 0x1d, 0x49, 0x22, 0x57, 0x0c,
+  0xb8, 0x96, 0xd5, 0x6b, 0xf8, 0xb9, 0x1d, 0xca, 0x9e, 0xb1, 0xe9, 0x19,
+  0x63, 0xcf, 0x58, 0xf7, 0x8c, 0xe6, 0xd8, 0x71, 0x1a, 0x40, 0xb2, 0x5d,
+  0x16, 0xcb, 0xde, 0xb4, 0xd5, 0xe3, 0x3d, 0x13, 0x75, 0x26, 0x08, 0x7a,
+  0xf5, 0x28, 0xf6, 0x5d, 0xd2, 0x26, 0xdd, 0xe6, 0x55, 0xcf, 0x14, 0x08,
+  0xf6, 0x3c, 0xaf, 0x96, 0xb6, 0xd6, 0x95, 0x26, 0x9c, 0x41, 0x14, 0x90,
+  0x14, 0x20, 0x13, 0xbb, 0x4d, 0xaa, 0x65, 0x02, 0xf3, 0x98, 0xa6, 0x54,
+  0x21, 0x11, 0x99, 0x3e, 0xf3, 0x25, 0x2a, 0x35, 0x0a, 0xcb, 0xd9, 0xa5,
+  0xcb, 0xd8, 0xa5, 0x1c, 0xf9, 0xcb, 0x17, 0x84, 0x98, 0x3b, 0x00, 0x73,
+  0xd3, 0x7f, 0x18, 0x6f, 0x79, 0x5d, 0xc9, 0x93, 0xa2, 0x3c, 0x93, 0x33,
+  0x2a, 0x66, 0xb0, 0x85, 0x47, 0x79, 0xec, 0xd4, 0x34, 0x40, 0x20, 0xff,
+  0x16, 0x90, 0xa4, 0x0f, 0x2c, 0xb1, 0xe0, 0x05, 0x2b, 0x39, 0xce, 0x4a,
+  0x16, 0x57, 0x2c, 0xe5, 0x71, 0x59, 0x49, 0xda, 0x96, 0x68, 0x64, 0x6f,
+  0xe3, 0x52, 0xf9, 0x4c, 0x6a, 0x01, 0x04, 0x37, 0x23, 0xc1, 0x64, 0x69,
+  0x98, 0x33, 0x76, 0x25, 0x09, 0x88, 0x73, 0x66, 0x91, 0xb0, 0xe9, 0x82,
+  0x89, 0x31, 0x64, 0x9b, 0xa4, 0x63, 0xd3, 0xd0, 0x0c, 0x70, 0x46, 0x06,
+  0x3b, 0x35, 0x7a, 0x1c, 0x84, 0x6e, 0xfd, 0xbb, 0x4a, 0x26, 0x3c, 0x8d,
+  0xf7, 0xf0, 0x34, 0x6a, 0xf0, 0x34, 0x76, 0xce, 0x1a, 0xb1, 0xe9, 0x70,
+  0x9e, 0x1c, 0x35, 0xcd, 0x0f, 0xd4, 0xd2, 0xfc, 0xeb, 0x94, 0x34, 0xb7,
+  0xfc, 0xcc, 0x35, 0x3b, 0xf3, 0x0e, 0x0d, 0xcd, 0x0f, 0x54, 0x50, 0x37,
+  0x3b, 0xad, 0xfa, 0xd9, 0xcf, 0x8e, 0x55, 0x8e, 0xa2, 0x74, 0xa9, 0xfd,
+  0x19, 0x65, 0xa9, 0xc5, 0x30, 0xab, 0xdb, 0x5c, 0x7b, 0x34, 0x60, 0x18,
+  0x46, 0xac, 0x2b, 0xf1, 0xe7, 0x39, 0x34, 0xe3, 0x37, 0x62, 0xb5, 0xe0,
+  0x5a, 0x58, 0x45, 0x9a, 0x54, 0xff, 0xed, 0x12, 0x40, 0xa6, 0x71, 0xf6,
+  0xb8, 0x62, 0x4b, 0xc8, 0xca, 0x79, 0xc6, 0x6e, 0x97, 0xe2, 0x1f, 0xfe,
+  0xb8, 0x10, 0xab, 0x07, 0x96, 0x92, 0xac, 0xfb, 0x24, 0xd9, 0x82, 0xc5,
+  0x8b, 0x58, 0xd4, 0x13, 0xd8, 0xa7, 0x1a, 0xfe, 0x11, 0xb3, 0x7a, 0x26,
+  0x98, 0x17, 0xa3, 0x2c, 0xf2, 0x7c, 0xa6, 0x29, 0xb2, 0x2a, 0x17, 0xeb,
+  0x63, 0x83, 0x9a, 0x92, 0x97, 0x2a, 0xd8, 0x92, 0x03, 0x31, 0xe1, 0x49,
+  0xe7, 0x35, 0xac, 0x39, 0xce, 0xea, 0x32, 0x5e, 0x48, 0xad, 0x03, 0x4b,
+  0xdc, 0x71, 0xa7, 0x2c, 0x86, 0xee, 0x78, 0x36, 0xe3, 0xb3, 0x68, 0x70,
+  0xd4, 0x0b, 0xad, 0x52, 0xef, 0xcc, 0x03, 0x46, 0x54, 0x1f, 0x41, 0x89,
+  0xe1, 0x4a, 0x74, 0xc1, 0xb0, 0x23, 0x18, 0xb7, 0x00, 0xec, 0x40, 0xd6,
+  0x04, 0x0e, 0x5d, 0xfb, 0x80, 0x35, 0x9f, 0x39, 0xda, 0x43, 0x5d, 0x80,
+  0x5b, 0x4d, 0x79, 0xb1, 0x86, 0x1d, 0x65, 0x3c, 0x34, 0x3a, 0xc7, 0x14,
+  0x12, 0xdc, 0xaa, 0xea, 0x92, 0x7f, 0x5b, 0xe8, 0x54, 0xcf, 0x8d, 0xce,
+  0xac, 0x1a, 0x9f, 0xdd, 0xdf, 0x93, 0x4d, 0x0b, 0x72, 0x9f, 0xff, 0x02,
+  0x61, 0xf1, 0x4e, 0x01, 0x3f, 0x51, 0x00, 0x00
+};
+unsigned int Projector_js_gz_len = 4604;
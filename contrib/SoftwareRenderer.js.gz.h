@@ -0,0 +1,699 @@
+#pragma once
+
+unsigned char SoftwareRenderer_js_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0x3c,
+  0x6b, 0x77, 0xdb, 0x46, 0xae, 0x9f, 0xe5, 0x5f, 0x31, 0xfd, 0x52, 0x4b,
+  0xb6, 0x2c, 0x5b, 0x64, 0xd2, 0x9b, 0x13, 0xd5, 0xe9, 0x5d, 0x27, 0x69,
+  0x9a, 0x73, 0x53, 0xa5, 0x27, 0x6e, 0xb2, 0x4d, 0x52, 0x9f, 0x1e, 0x4a,
+  0x1a, 0x5b, 0x6c, 0x24, 0x52, 0xe1, 0xcb, 0xa2, 0x9a, 0xf4, 0xb7, 0x5f,
+  0x00, 0xf3, 0xa6, 0x48, 0x3d, 0xdc, 0xed, 0xf6, 0xde, 0x3d, 0xcd, 0x6e,
+  0x2d, 0x72, 0x06, 0xc0, 0x60, 0x30, 0x18, 0x00, 0x83, 0x99, 0xe1, 0xe9,
+  0xd1, 0xd1, 0x01, 0x3b, 0x62, 0xff, 0x1d, 0xe4, 0xd9, 0x34, 0x4e, 0xd8,
+  0x3c, 0x99, 0xc4, 0xf1, 0x88, 0x9d, 0xb2, 0x69, 0x96, 0x2d, 0x1e, 0x9e,
+  0x9e, 0x8a, 0xf7, 0xde, 0x38, 0x9e, 0x9f, 0xda, 0x60, 0x49, 0x79, 0x63,
+  0x60, 0xae, 0x83, 0x64, 0x94, 0x04, 0x79, 0x3a, 0x9e, 0xf6, 0x26, 0xfc,
+  0xf4, 0xf7, 0xeb, 0x1b, 0x97, 0x60, 0x30, 0xe3, 0x8b, 0xa9, 0x4d, 0x11,
+  0x0a, 0x7a, 0x8b, 0xa9, 0x43, 0x6f, 0x12, 0xc4, 0xe9, 0x94, 0x47, 0x37,
+  0xf3, 0xdc, 0x00, 0x4e, 0xd2, 0x79, 0xde, 0x9b, 0x73, 0x84, 0x3b, 0x3d,
+  0x38, 0xf8, 0xf1, 0xbb, 0x57, 0x4f, 0x9f, 0xf6, 0x2e, 0xe3, 0xeb, 0xec,
+  0x36, 0x48, 0xf8, 0x2b, 0x1e, 0x4d, 0x78, 0xc2, 0x13, 0x76, 0xce, 0xae,
+  0xf3, 0x68, 0x9c, 0x85, 0x71, 0xc4, 0xda, 0x6c, 0x11, 0x24, 0xc1, 0x9c,
+  0x67, 0x3c, 0x49, 0x59, 0x87, 0xfd, 0x76, 0x70, 0xd0, 0x1a, 0xc7, 0x51,
+  0x1a, 0x43, 0x6b, 0xb3, 0xf8, 0xa6, 0xcd, 0x0e, 0xeb, 0x49, 0x1c, 0x76,
+  0x99, 0xa8, 0x78, 0xf5, 0xf4, 0xcd, 0xf3, 0xcb, 0xe7, 0x2f, 0x87, 0xac,
+  0x33, 0x00, 0x54, 0x8b, 0xd6, 0xb9, 0x4d, 0xf8, 0xd3, 0x27, 0xf6, 0xdb,
+  0x67, 0x04, 0x28, 0x82, 0x84, 0x8d, 0x83, 0xa8, 0x08, 0x5c, 0x80, 0x9e,
+  0x2c, 0xfb, 0xe2, 0xfc, 0x9c, 0xe5, 0xd0, 0xc2, 0x75, 0x18, 0xf1, 0xc9,
+  0x41, 0xab, 0xd5, 0x62, 0xdf, 0xac, 0x43, 0x51, 0xf9, 0x43, 0x36, 0x89,
+  0xc7, 0xf9, 0x9c, 0x47, 0x59, 0x6f, 0x9c, 0xf0, 0x20, 0xe3, 0x4f, 0x67,
+  0x1c, 0xdf, 0x80, 0x63, 0x01, 0x75, 0x28, 0x38, 0xa2, 0x06, 0xe3, 0x28,
+  0xe3, 0xcb, 0x0c, 0x5a, 0x14, 0x55, 0xbd, 0x1b, 0x9e, 0x3d, 0x16, 0x65,
+  0x00, 0xee, 0x4d, 0xa0, 0x33, 0xbf, 0x01, 0xd1, 0x60, 0xb6, 0x98, 0x06,
+  0x0f, 0xed, 0xf6, 0xa8, 0x84, 0x9d, 0x03, 0x53, 0x59, 0x92, 0xf3, 0x83,
+  0xd6, 0x67, 0x43, 0x33, 0x9d, 0x06, 0x13, 0xd1, 0x4d, 0xec, 0x18, 0x15,
+  0x21, 0xbd, 0x3c, 0xe1, 0xaa, 0xcc, 0xee, 0xec, 0x3f, 0xc3, 0x49, 0x36,
+  0xed, 0xca, 0x97, 0xef, 0x78, 0x78, 0x33, 0xcd, 0x06, 0x4e, 0xfd, 0xc5,
+  0x2c, 0x1e, 0x7f, 0x48, 0x35, 0x84, 0x78, 0x95, 0x20, 0x45, 0xc8, 0x6f,
+  0x17, 0x71, 0x92, 0xfd, 0x74, 0x39, 0x06, 0x25, 0xe8, 0xea, 0xf7, 0xb7,
+  0x95, 0xf7, 0x77, 0xf4, 0x5e, 0x45, 0x7a, 0x79, 0x7d, 0x9d, 0x5a, 0x38,
+  0xee, 0xeb, 0x3b, 0x7c, 0xd5, 0xac, 0xce, 0x78, 0x90, 0x3c, 0x8e, 0x67,
+  0x31, 0x2a, 0x48, 0xc4, 0x6f, 0xe5, 0x08, 0x53, 0x49, 0x9b, 0x9d, 0x2d,
+  0xcf, 0xe8, 0x9f, 0x11, 0x41, 0x38, 0x0f, 0x6e, 0xf8, 0x24, 0xc8, 0x82,
+  0x2e, 0x13, 0x7f, 0x57, 0xa3, 0xfc, 0xfa, 0x9a, 0x27, 0x92, 0x83, 0x28,
+  0x9f, 0xab, 0x5e, 0x8d, 0xf0, 0xf7, 0xfb, 0x60, 0xf9, 0x4e, 0x3e, 0x7e,
+  0x3b, 0x0b, 0x6e, 0x74, 0xb3, 0x17, 0x2f, 0x5e, 0x3e, 0xfe, 0x9f, 0x5f,
+  0x9e, 0x5f, 0x3e, 0x7e, 0xf1, 0xf4, 0x1f, 0xaf, 0xa0, 0xe5, 0x36, 0xeb,
+  0xb3, 0xaf, 0xbf, 0x66, 0xd4, 0x90, 0x05, 0x30, 0x7c, 0xfa, 0xf4, 0x49,
+  0x05, 0xa4, 0x6f, 0x0d, 0x47, 0x3e, 0x5a, 0x84, 0x4b, 0x3e, 0xbb, 0x08,
+  0x33, 0x94, 0xff, 0xbd, 0x41, 0xb5, 0x98, 0x14, 0x4e, 0xe2, 0x39, 0xc0,
+  0x1d, 0x76, 0xc2, 0xfa, 0x12, 0x9c, 0x98, 0xbb, 0x9c, 0x86, 0xd7, 0xa8,
+  0x2b, 0xbe, 0x53, 0x18, 0xae, 0x38, 0x94, 0x11, 0xba, 0x81, 0x92, 0x10,
+  0x73, 0xe8, 0xd9, 0x9b, 0x60, 0x66, 0x1a, 0xf0, 0xee, 0x01, 0x67, 0xec,
+  0xf4, 0x94, 0x0d, 0xe3, 0x8c, 0x3f, 0x64, 0x6f, 0xe3, 0x9c, 0xdd, 0x06,
+  0x51, 0xc6, 0xb2, 0x98, 0xa5, 0x48, 0x28, 0x9b, 0x86, 0x29, 0x4b, 0x63,
+  0x56, 0x42, 0xc5, 0x24, 0x8e, 0x0e, 0x33, 0x06, 0x1a, 0xc9, 0xe2, 0x82,
+  0x27, 0xd7, 0xb3, 0xf8, 0x36, 0xed, 0x09, 0xb2, 0x33, 0x98, 0x04, 0xdf,
+  0xc7, 0x13, 0x6c, 0xf7, 0x3a, 0x98, 0xa5, 0x6a, 0x64, 0x67, 0x71, 0xfc,
+  0xe1, 0x0d, 0x1f, 0x67, 0x95, 0x61, 0x12, 0x45, 0x3e, 0x0c, 0x54, 0x17,
+  0xff, 0xdf, 0xd7, 0xe2, 0x1b, 0x27, 0x71, 0x9a, 0x6e, 0x40, 0xd0, 0x32,
+  0x4c, 0xa0, 0x60, 0xd9, 0x07, 0x98, 0xe7, 0x11, 0xcc, 0xbf, 0x30, 0x2b,
+  0xbb, 0x54, 0x54, 0xda, 0x45, 0x03, 0x0b, 0xd4, 0x83, 0xf2, 0x33, 0x09,
+  0x43, 0xcf, 0x8a, 0xd0, 0x22, 0xe1, 0x45, 0x0d, 0x31, 0x55, 0x5c, 0x47,
+  0x50, 0xa3, 0x48, 0xa2, 0x1a, 0xb6, 0x42, 0x38, 0xfe, 0x75, 0xbd, 0x23,
+  0x3f, 0xa8, 0x52, 0xd3, 0x95, 0x74, 0x91, 0x84, 0x19, 0x7f, 0xd3, 0xaf,
+  0xe9, 0xf0, 0xbd, 0xb6, 0x12, 0x8c, 0x04, 0xf2, 0x76, 0x01, 0xf2, 0x9b,
+  0x80, 0x6c, 0xa8, 0xd7, 0xb5, 0x0d, 0x7a, 0x15, 0x5a, 0xaf, 0x6b, 0x5b,
+  0x5c, 0x87, 0xf2, 0x9b, 0xa0, 0xa4, 0xd2, 0x2d, 0xde, 0xfc, 0x10, 0xc7,
+  0xa8, 0x74, 0xef, 0xaf, 0x06, 0x4e, 0xd1, 0xe3, 0x38, 0x8f, 0x32, 0x21,
+  0x36, 0x59, 0x3c, 0x5c, 0x87, 0x1c, 0xd6, 0x43, 0xbe, 0xae, 0x21, 0xfa,
+  0xba, 0x4a, 0xf5, 0xa0, 0x85, 0x0a, 0xdc, 0x9b, 0xc4, 0x73, 0x69, 0x74,
+  0xb5, 0x65, 0xd5, 0x75, 0xe0, 0xa1, 0xe2, 0xc7, 0x68, 0x4f, 0x98, 0xb0,
+  0x9d, 0x58, 0x01, 0xf3, 0xe1, 0x9f, 0x7c, 0xf4, 0xec, 0x85, 0x76, 0x43,
+  0xe0, 0x1f, 0x17, 0x41, 0x16, 0x8e, 0xc2, 0x19, 0x28, 0x82, 0xc2, 0x4c,
+  0xf3, 0x05, 0x5a, 0x26, 0xd0, 0xd8, 0x04, 0x0c, 0xea, 0x8f, 0xc6, 0xa6,
+  0x1a, 0x97, 0xd5, 0x11, 0x36, 0x57, 0x80, 0xf3, 0xec, 0xdb, 0x60, 0xcc,
+  0x1f, 0xe7, 0x33, 0x98, 0x2e, 0x37, 0x35, 0x60, 0x06, 0xee, 0xb1, 0x6d,
+  0xdf, 0x2c, 0x07, 0x38, 0xc6, 0xa2, 0x2e, 0x13, 0xc6, 0x5e, 0xb8, 0xc0,
+  0x96, 0xb1, 0x85, 0x88, 0x29, 0x61, 0x68, 0x4a, 0x51, 0x55, 0x44, 0x55,
+  0x17, 0x64, 0xee, 0xc4, 0x90, 0x38, 0x2d, 0xfd, 0x80, 0xd6, 0xe5, 0x15,
+  0x74, 0x2d, 0xde, 0xc8, 0x90, 0x34, 0x2a, 0x16, 0x2b, 0xb7, 0xc2, 0x4f,
+  0x4c, 0xc9, 0x43, 0x68, 0x5e, 0x6c, 0x17, 0x01, 0xf0, 0xdf, 0x07, 0xd9,
+  0xb4, 0x07, 0x86, 0x02, 0xad, 0x32, 0x21, 0x80, 0xf7, 0x37, 0x46, 0x4a,
+  0xf0, 0x68, 0xbb, 0x91, 0x0a, 0x8a, 0x24, 0xde, 0x80, 0x43, 0x9e, 0x8a,
+  0x31, 0x3d, 0xa2, 0xaa, 0xd9, 0x23, 0x03, 0x6e, 0x35, 0x20, 0x48, 0x69,
+  0xe0, 0xef, 0xea, 0x80, 0x01, 0x1a, 0xf5, 0xe8, 0x3a, 0x5c, 0x92, 0x7f,
+  0x52, 0x56, 0xd4, 0x36, 0xc2, 0x02, 0xc8, 0x71, 0x73, 0x00, 0x66, 0x50,
+  0x8e, 0x98, 0xc3, 0xdc, 0x29, 0xf3, 0x06, 0x16, 0xc2, 0x5b, 0x85, 0x70,
+  0xb2, 0x8e, 0xf1, 0x9d, 0xea, 0xac, 0x83, 0xf1, 0x4e, 0x37, 0x61, 0xfd,
+  0x53, 0x56, 0x9c, 0xfe, 0x11, 0x82, 0xcd, 0x14, 0x3a, 0x4a, 0xb6, 0x85,
+  0x29, 0x76, 0xcc, 0xce, 0x7a, 0xf7, 0x1d, 0xd6, 0x9a, 0xd1, 0x0c, 0x67,
+  0xeb, 0x68, 0xef, 0x34, 0xda, 0x06, 0xfe, 0x14, 0x9a, 0x1e, 0x8d, 0x9e,
+  0x50, 0x86, 0x73, 0x9b, 0x2f, 0x33, 0x56, 0x3d, 0x39, 0xee, 0xe7, 0x95,
+  0x28, 0x04, 0x01, 0x44, 0x2c, 0xd4, 0xbb, 0x0e, 0x67, 0xb3, 0xcb, 0xac,
+  0x24, 0xc9, 0x58, 0x13, 0x00, 0x7c, 0x13, 0x95, 0xb6, 0x85, 0x9a, 0x58,
+  0xc0, 0xaf, 0xc0, 0x28, 0x29, 0x87, 0xd3, 0x18, 0xe8, 0x08, 0x27, 0xdd,
+  0xd2, 0xd1, 0x02, 0x12, 0x97, 0x34, 0x80, 0xf2, 0x73, 0x2c, 0x7e, 0x02,
+  0xc5, 0x3b, 0xd1, 0x69, 0xb5, 0x24, 0x05, 0x4d, 0xad, 0x87, 0x7f, 0xa8,
+  0x01, 0x19, 0x7d, 0x48, 0xab, 0xf9, 0x3c, 0xca, 0x7c, 0xef, 0x1f, 0x49,
+  0x12, 0x94, 0x6d, 0x8a, 0x4e, 0x7a, 0x33, 0x08, 0x94, 0x69, 0xaa, 0xdc,
+  0x93, 0x0c, 0xe9, 0xf8, 0xa4, 0x46, 0xd7, 0xab, 0x61, 0x58, 0x4b, 0x47,
+  0x30, 0x35, 0xe4, 0x0d, 0xa1, 0x8e, 0x06, 0xa5, 0x08, 0x47, 0xc2, 0xbe,
+  0x0e, 0xa3, 0xec, 0x41, 0x1d, 0x2c, 0x00, 0x5f, 0x83, 0x55, 0x69, 0x33,
+  0x8a, 0xa6, 0x84, 0xe3, 0x43, 0xdb, 0x2b, 0x7b, 0x22, 0x59, 0x1e, 0x40,
+  0xd5, 0xd7, 0x6c, 0x86, 0x3f, 0xc7, 0xc7, 0xca, 0x26, 0xa8, 0xde, 0xbe,
+  0x87, 0xd2, 0x2b, 0x40, 0x91, 0xca, 0x41, 0x34, 0x3f, 0xd7, 0x10, 0x16,
+  0x44, 0x74, 0xeb, 0x15, 0x62, 0x86, 0x65, 0x45, 0xcf, 0x09, 0xca, 0x0c,
+  0xd5, 0x1d, 0x6c, 0x1f, 0x4e, 0xfa, 0x36, 0xb3, 0x35, 0x52, 0x0d, 0xa3,
+  0xd2, 0xc0, 0x8e, 0x06, 0x1f, 0x4b, 0x0f, 0xe1, 0x98, 0x48, 0x6c, 0x67,
+  0x2d, 0x7a, 0x18, 0xc8, 0xc2, 0xb2, 0xae, 0x70, 0x29, 0x83, 0x04, 0x09,
+  0xa2, 0xdf, 0x6a, 0xfc, 0x61, 0xab, 0xc6, 0xf3, 0xb5, 0x6a, 0x5d, 0xdc,
+  0x1d, 0x24, 0x88, 0xfa, 0xb1, 0x36, 0x20, 0xb5, 0xe2, 0x6d, 0xb3, 0x6a,
+  0xd9, 0x97, 0x95, 0x38, 0xb8, 0x03, 0x2b, 0x1f, 0xb7, 0xe4, 0x61, 0x35,
+  0x10, 0xd6, 0xc3, 0x82, 0xf2, 0x27, 0xa3, 0x70, 0xca, 0x7e, 0x7c, 0xf9,
+  0xe4, 0xe5, 0x43, 0xf6, 0x78, 0xca, 0xc7, 0x1f, 0xd8, 0xed, 0xb4, 0x64,
+  0xc6, 0x0f, 0xc3, 0x18, 0x40, 0x9c, 0x39, 0xe2, 0x22, 0x96, 0xec, 0xc9,
+  0x11, 0x48, 0xc8, 0x17, 0xbb, 0x4e, 0x28, 0x1d, 0xf3, 0x88, 0xe3, 0xa0,
+  0xcd, 0x79, 0xa2, 0x1d, 0x62, 0x78, 0x0d, 0x35, 0x55, 0xd7, 0x2e, 0x17,
+  0x46, 0x00, 0x63, 0x86, 0x53, 0xa8, 0x84, 0x8c, 0x12, 0x91, 0xf8, 0x13,
+  0x31, 0x63, 0x75, 0xec, 0xd6, 0x93, 0x4f, 0x97, 0xd8, 0x4c, 0xa5, 0xb5,
+  0xae, 0xe0, 0x4e, 0xfe, 0x88, 0xf9, 0x84, 0x94, 0xb8, 0x88, 0x33, 0x70,
+  0x46, 0x19, 0xa2, 0x3d, 0x55, 0x5a, 0x19, 0x2e, 0x2e, 0x66, 0x12, 0xc7,
+  0xa9, 0xa4, 0x40, 0xf4, 0x5c, 0xe2, 0x30, 0x88, 0x7c, 0x86, 0xbf, 0xd6,
+  0xe8, 0x59, 0x4d, 0x58, 0x38, 0xef, 0x01, 0xe8, 0x6a, 0xa0, 0xea, 0xe7,
+  0xb0, 0xc6, 0x4c, 0xc2, 0xc0, 0x22, 0xda, 0x53, 0x45, 0x1a, 0x46, 0x2c,
+  0x0a, 0x01, 0x02, 0x0c, 0xdb, 0xf7, 0xb2, 0xf2, 0x92, 0xca, 0xda, 0x06,
+  0x5f, 0xc8, 0x47, 0x08, 0xf4, 0x0b, 0x89, 0xd1, 0x21, 0x93, 0x18, 0x46,
+  0x22, 0x50, 0x92, 0x95, 0x8a, 0xa3, 0x30, 0x4a, 0xb3, 0x20, 0x1a, 0xf3,
+  0xf8, 0x5a, 0xad, 0xb9, 0x49, 0x04, 0xc1, 0x68, 0xc6, 0x31, 0xf4, 0xd1,
+  0xbd, 0x90, 0x24, 0x35, 0x7b, 0x79, 0x91, 0x9a, 0xba, 0xd6, 0x24, 0x09,
+  0x6e, 0x7f, 0x04, 0x06, 0xa2, 0x1b, 0xb0, 0xe4, 0xa2, 0xa8, 0xa5, 0x20,
+  0x8b, 0x7e, 0x6f, 0x11, 0xa7, 0x21, 0x8e, 0xff, 0x25, 0xac, 0xa6, 0x79,
+  0xd4, 0xad, 0x02, 0x78, 0xdb, 0x00, 0xfc, 0x06, 0x80, 0x08, 0x02, 0xb3,
+  0x2e, 0xb3, 0xfe, 0xca, 0x72, 0xd1, 0xf1, 0xae, 0x62, 0xb6, 0xab, 0xe5,
+  0x23, 0xea, 0xa5, 0x90, 0x60, 0xc5, 0xcd, 0x51, 0x11, 0xfe, 0xe2, 0x4e,
+  0x58, 0x12, 0x7d, 0x0f, 0x0b, 0xd3, 0xab, 0x2e, 0x73, 0x4a, 0xfa, 0x6b,
+  0x25, 0x1e, 0x94, 0xec, 0xd9, 0xd1, 0x03, 0xfa, 0x95, 0xfd, 0xdd, 0x75,
+  0xfc, 0x2f, 0x69, 0xad, 0x60, 0x46, 0x99, 0x94, 0x10, 0xc3, 0x8c, 0x9f,
+  0x2c, 0x35, 0xa5, 0x82, 0xde, 0x12, 0xdc, 0x9a, 0x0c, 0x33, 0x2c, 0xb8,
+  0xb7, 0x6b, 0x70, 0xa5, 0x82, 0x23, 0x40, 0xb5, 0x90, 0xea, 0x8d, 0xe3,
+  0x45, 0x69, 0x58, 0xea, 0x0c, 0xdc, 0xda, 0x25, 0x3b, 0x39, 0x97, 0x0d,
+  0x57, 0x6a, 0x4a, 0x76, 0x2c, 0x6b, 0xde, 0xba, 0x24, 0xbd, 0x8d, 0x24,
+  0xbd, 0x46, 0x92, 0x1e, 0x90, 0x3c, 0xa9, 0x27, 0xe9, 0x6f, 0x24, 0xe9,
+  0x03, 0xc9, 0xe3, 0x5a, 0x92, 0x7e, 0x0d, 0x97, 0x34, 0x02, 0x6a, 0xa8,
+  0x60, 0xa6, 0x2f, 0xac, 0xa9, 0xa4, 0x57, 0x7b, 0x62, 0x6d, 0xa0, 0x57,
+  0xdb, 0x76, 0x9d, 0xa7, 0xeb, 0xce, 0xd6, 0xea, 0x7c, 0x51, 0xd7, 0xef,
+  0xaa, 0x0c, 0x46, 0x93, 0x6a, 0x2b, 0x29, 0x76, 0xf5, 0x5a, 0x55, 0x3f,
+  0xf9, 0x5d, 0x07, 0xe6, 0xb5, 0x01, 0x7a, 0x6d, 0xa0, 0x5e, 0x5b, 0x60,
+  0xff, 0xb2, 0xf9, 0xb6, 0x0b, 0x53, 0x7f, 0x74, 0xd6, 0xef, 0xa9, 0x7c,
+  0xc7, 0xff, 0xcf, 0x95, 0xef, 0xe4, 0xee, 0xca, 0xd7, 0xbf, 0xbb, 0xf2,
+  0x9d, 0xfd, 0xad, 0x7c, 0xcd, 0xca, 0xb7, 0xa7, 0x21, 0x7e, 0x11, 0x46,
+  0x55, 0x33, 0xbc, 0x47, 0x2c, 0x40, 0x5d, 0x45, 0x12, 0xb2, 0x9b, 0xdb,
+  0x5c, 0xda, 0x36, 0x8f, 0xa6, 0xeb, 0x29, 0x87, 0x42, 0xf1, 0x7a, 0xfa,
+  0xfe, 0xec, 0x6a, 0x53, 0x6d, 0x5f, 0xd5, 0x4a, 0x29, 0x89, 0x17, 0x47,
+  0x42, 0x42, 0x93, 0x3e, 0x9b, 0x25, 0x06, 0x04, 0xe1, 0xe9, 0xf4, 0x71,
+  0x25, 0xe8, 0x5b, 0xaa, 0x74, 0xc3, 0x3c, 0x8c, 0xda, 0x32, 0xa7, 0xd8,
+  0xb5, 0x53, 0x82, 0x3a, 0xa8, 0x2b, 0xd7, 0x20, 0xcb, 0xbe, 0x93, 0x25,
+  0xd4, 0x90, 0x6a, 0x61, 0x2b, 0xa0, 0x83, 0xa5, 0xa4, 0xeb, 0x75, 0xed,
+  0xbc, 0x21, 0x26, 0x72, 0x97, 0x0a, 0x43, 0x2f, 0x76, 0x5d, 0x94, 0xd2,
+  0x73, 0x52, 0x8b, 0x88, 0x52, 0x12, 0xe7, 0xa7, 0x47, 0xf8, 0xe7, 0x94,
+  0x4d, 0xf8, 0x28, 0xbf, 0x19, 0x30, 0x1c, 0x0f, 0xb5, 0x0c, 0xdb, 0x7b,
+  0x99, 0x56, 0x09, 0x2c, 0x31, 0x07, 0x14, 0x82, 0x53, 0xbd, 0xa7, 0xc3,
+  0xc4, 0x02, 0x57, 0x00, 0x5f, 0xdd, 0xbf, 0xef, 0xdf, 0x87, 0xf6, 0xed,
+  0x85, 0x5c, 0x87, 0x3d, 0x7a, 0x44, 0x79, 0x67, 0xb1, 0xce, 0x7d, 0x0f,
+  0xb8, 0xc7, 0x18, 0x6f, 0x00, 0x7c, 0x51, 0x29, 0xed, 0xd7, 0x96, 0x7a,
+  0xb5, 0xa5, 0x3e, 0x95, 0x7a, 0xf7, 0xc9, 0xf9, 0x7f, 0x86, 0xff, 0x70,
+  0x6b, 0x48, 0x5a, 0x99, 0x25, 0xed, 0xb9, 0xa8, 0x15, 0x95, 0x66, 0x5c,
+  0xad, 0xd0, 0x17, 0xb9, 0xbd, 0x42, 0xb7, 0x32, 0xfe, 0x62, 0xb1, 0xbe,
+  0xec, 0xb2, 0xb2, 0x5b, 0xcd, 0x5a, 0x99, 0xe5, 0xa2, 0x93, 0x08, 0x16,
+  0x0f, 0x03, 0x37, 0x0d, 0x2c, 0x1e, 0x06, 0x36, 0xac, 0xa7, 0x60, 0xbd,
+  0x81, 0x9b, 0x06, 0x16, 0x0f, 0x7a, 0xc1, 0xa9, 0x57, 0x2c, 0x7a, 0xd1,
+  0xf9, 0x77, 0xf6, 0xec, 0x0f, 0x65, 0xcf, 0xfe, 0x4e, 0x9e, 0xfd, 0x9d,
+  0x3c, 0xfb, 0x3b, 0x79, 0xf6, 0xef, 0x4d, 0x9e, 0x51, 0x8d, 0xb6, 0x64,
+  0xeb, 0x10, 0xa2, 0x0d, 0x8a, 0x27, 0xc4, 0x66, 0x81, 0x3d, 0x6d, 0x2a,
+  0xb3, 0x81, 0x5c, 0x4c, 0x13, 0xf7, 0x88, 0x4e, 0x8c, 0x9f, 0xe3, 0x18,
+  0x4a, 0xd6, 0x85, 0x8b, 0x10, 0x4c, 0x5b, 0x3a, 0x9b, 0x00, 0x29, 0xf0,
+  0x16, 0xec, 0x93, 0x48, 0x8f, 0x69, 0x30, 0xe5, 0x75, 0x6c, 0xf5, 0x6e,
+  0x04, 0xf5, 0xaa, 0xa0, 0xa3, 0x46, 0x50, 0xcb, 0x3f, 0x69, 0x59, 0xfd,
+  0x1b, 0x66, 0x95, 0x23, 0x7a, 0xa0, 0xf8, 0x03, 0x58, 0x98, 0x2c, 0xe3,
+  0x26, 0x3c, 0xeb, 0xb2, 0xd1, 0x65, 0x38, 0xcf, 0x67, 0xf0, 0x7a, 0xb9,
+  0xe0, 0x63, 0x78, 0x48, 0x98, 0x35, 0x22, 0x52, 0xe9, 0x7e, 0x55, 0x69,
+  0x44, 0x2c, 0x9b, 0x84, 0xd7, 0xd7, 0x79, 0xca, 0x5f, 0x91, 0x56, 0xc9,
+  0xf8, 0x7d, 0x6c, 0x0b, 0xb5, 0x02, 0xf8, 0x6c, 0x1d, 0xf0, 0xa6, 0x16,
+  0xf0, 0x62, 0x1d, 0x70, 0xe4, 0x02, 0x2e, 0x04, 0xfb, 0x35, 0xf3, 0xc6,
+  0xbb, 0xff, 0x15, 0x80, 0xfa, 0xca, 0x96, 0xa0, 0xdb, 0x6f, 0xec, 0x58,
+  0xeb, 0x76, 0x1a, 0x82, 0xb4, 0xdb, 0xa4, 0x34, 0xde, 0x99, 0xd1, 0x95,
+  0x96, 0xa4, 0xff, 0x1e, 0x3a, 0x0c, 0xda, 0x7f, 0xe5, 0x04, 0x6f, 0x18,
+  0xdf, 0xe8, 0xae, 0x9f, 0x22, 0x5e, 0x97, 0xc6, 0x5a, 0x2e, 0x3e, 0x76,
+  0x44, 0x7d, 0x76, 0x77, 0xd4, 0x8b, 0x1a, 0x54, 0x80, 0x0f, 0x45, 0x7c,
+  0xfd, 0x79, 0xbd, 0x67, 0x20, 0x12, 0xdd, 0x33, 0x88, 0xfb, 0x16, 0xb3,
+  0x3c, 0x85, 0x85, 0x84, 0x94, 0xc5, 0x14, 0x94, 0x64, 0x86, 0x8a, 0xb2,
+  0x95, 0x05, 0xdd, 0xe9, 0x63, 0x22, 0x7c, 0x22, 0x45, 0x76, 0xc4, 0xda,
+  0xc4, 0xc9, 0x89, 0x01, 0xe8, 0x00, 0x87, 0x0f, 0xbc, 0x9d, 0xfb, 0xa6,
+  0x45, 0xb2, 0x85, 0xf0, 0xb3, 0x3b, 0x12, 0xbe, 0xd8, 0x46, 0xf8, 0xa2,
+  0x8e, 0x70, 0x45, 0xa4, 0xce, 0x82, 0xad, 0x51, 0xbc, 0xfb, 0x28, 0xce,
+  0xfd, 0xfb, 0x77, 0x56, 0x9c, 0xbb, 0xa1, 0x5e, 0xd4, 0xa0, 0x56, 0x7b,
+  0x29, 0x76, 0x24, 0xb2, 0x3c, 0x89, 0xd4, 0x24, 0x5b, 0x33, 0x1f, 0xa3,
+  0x20, 0x0d, 0xc7, 0xd5, 0x65, 0x9e, 0xf0, 0x32, 0x5d, 0x58, 0x54, 0x2c,
+  0xb2, 0x29, 0x58, 0xf4, 0x2e, 0x8b, 0x21, 0x34, 0xe1, 0x99, 0x2c, 0xe9,
+  0xb2, 0xbc, 0xcb, 0x0a, 0x58, 0xa3, 0x62, 0xba, 0x7b, 0xcc, 0xbb, 0xd6,
+  0xb2, 0xd0, 0x18, 0x19, 0x9a, 0xea, 0x2f, 0x09, 0x0d, 0xba, 0x20, 0xf0,
+  0xb5, 0xa5, 0xb7, 0x4e, 0x1d, 0xe1, 0x3e, 0xbb, 0xdc, 0x2b, 0x7f, 0xef,
+  0xa4, 0x0e, 0x7a, 0xe1, 0x04, 0xb3, 0xd8, 0x07, 0x3a, 0x3d, 0x2c, 0xc1,
+  0xc8, 0xf7, 0xb3, 0x0e, 0xf6, 0x52, 0xf4, 0xcd, 0x50, 0x9c, 0x84, 0x73,
+  0x43, 0x4e, 0x04, 0x46, 0xca, 0xc8, 0x84, 0xe9, 0x8f, 0x49, 0x10, 0xa5,
+  0x8b, 0x20, 0x11, 0xb9, 0x72, 0xdd, 0x52, 0x66, 0x8a, 0x15, 0x6c, 0x36,
+  0x8a, 0xf3, 0x68, 0x82, 0x94, 0x90, 0xa0, 0x38, 0x65, 0x23, 0x1b, 0x10,
+  0x71, 0x88, 0xcd, 0x89, 0xae, 0x7b, 0x0e, 0x4b, 0xea, 0x25, 0x6d, 0x91,
+  0xe0, 0xff, 0x0a, 0xe8, 0x2b, 0xa1, 0x77, 0xd8, 0x97, 0x8a, 0x60, 0x47,
+  0x95, 0x1d, 0x13, 0x48, 0x5e, 0x0b, 0xd2, 0xd1, 0x42, 0x92, 0xdd, 0x76,
+  0x39, 0xd7, 0xce, 0x5b, 0x06, 0x02, 0xb6, 0x98, 0xaf, 0x88, 0x65, 0xf2,
+  0x4e, 0x92, 0x1b, 0xb1, 0x0b, 0x50, 0x07, 0xab, 0x5c, 0xa2, 0x0b, 0x4f,
+  0xa5, 0x1b, 0x70, 0xbc, 0x5a, 0x1c, 0x6f, 0x23, 0x8e, 0x2f, 0x37, 0x8e,
+  0xb4, 0xc4, 0xe3, 0x45, 0x30, 0xc6, 0x25, 0x1b, 0xac, 0x06, 0x1e, 0xe8,
+  0x53, 0x4c, 0xe0, 0x56, 0xa5, 0xb2, 0xbd, 0x57, 0xca, 0x82, 0x68, 0x54,
+  0x38, 0x58, 0x9b, 0xb2, 0x14, 0x57, 0x24, 0xe3, 0x57, 0x0d, 0x1d, 0x96,
+  0xd5, 0xcf, 0x36, 0xf4, 0x4f, 0x82, 0x5c, 0x6c, 0xe8, 0x0e, 0xad, 0x81,
+  0x91, 0xd7, 0x1a, 0x18, 0xec, 0xd4, 0xd1, 0x7a, 0x97, 0x4e, 0x95, 0x5f,
+  0x13, 0x1e, 0x90, 0xa7, 0x19, 0xb2, 0x58, 0x3b, 0x56, 0x0e, 0xd4, 0xb3,
+  0x06, 0x28, 0x97, 0x5f, 0x84, 0xbc, 0x68, 0x84, 0x14, 0x6c, 0x6f, 0xd2,
+  0x8d, 0xb6, 0x90, 0xd9, 0x91, 0xec, 0xd5, 0xb1, 0x64, 0xf0, 0x88, 0x4e,
+  0x7f, 0x9d, 0xc8, 0xd2, 0x8e, 0x34, 0x26, 0x9b, 0x94, 0xa6, 0x2d, 0xa4,
+  0xeb, 0x12, 0x7a, 0xb6, 0x17, 0x21, 0xcf, 0x10, 0xba, 0xa8, 0x10, 0xba,
+  0xd8, 0x8b, 0xd0, 0x4e, 0xea, 0xa5, 0xb7, 0xa6, 0x36, 0xd0, 0x38, 0x17,
+  0x96, 0x14, 0x9d, 0xea, 0xcb, 0x68, 0x56, 0x62, 0xe3, 0x39, 0x67, 0xb0,
+  0x58, 0x9d, 0xa5, 0xec, 0x96, 0x76, 0x2b, 0xb2, 0x98, 0x65, 0x53, 0x2e,
+  0x74, 0x52, 0x52, 0x12, 0x49, 0xb0, 0x0d, 0x9a, 0x2b, 0x37, 0x3a, 0x6d,
+  0x93, 0x4b, 0x0e, 0x3a, 0x8c, 0x6e, 0xfe, 0xb6, 0xba, 0x8e, 0xd5, 0x1d,
+  0x1b, 0x03, 0x1a, 0xb1, 0x47, 0xec, 0x8c, 0x7d, 0x03, 0x4f, 0xbf, 0xff,
+  0x0e, 0x2f, 0x1d, 0xf6, 0x10, 0x73, 0xbe, 0x18, 0x0a, 0xfe, 0x27, 0x98,
+  0x68, 0x4b, 0x57, 0xb5, 0xaf, 0x97, 0x9d, 0xbf, 0xa2, 0xf6, 0x1c, 0x83,
+  0xc6, 0x28, 0xb7, 0xf6, 0x60, 0x87, 0x39, 0xd9, 0x48, 0x55, 0x80, 0x1c,
+  0xd5, 0xd9, 0xc2, 0xed, 0xd4, 0xbd, 0xed, 0xd4, 0xbd, 0x5a, 0xea, 0xde,
+  0x2e, 0xd4, 0xff, 0x2c, 0xe7, 0x00, 0x4b, 0x49, 0x4e, 0x2b, 0x2e, 0x67,
+  0x41, 0xb3, 0x83, 0xb8, 0x07, 0x6b, 0x14, 0x9e, 0x6d, 0xa2, 0xb0, 0x41,
+  0xb4, 0xeb, 0x94, 0x2e, 0x36, 0x53, 0x6a, 0x14, 0xe3, 0x1f, 0xf1, 0x46,
+  0x5f, 0xfd, 0x95, 0xde, 0x68, 0xd3, 0x2c, 0xb0, 0x46, 0x68, 0x8b, 0x43,
+  0xda, 0xaa, 0xfa, 0xd6, 0x50, 0x6d, 0x71, 0x49, 0x5b, 0xf5, 0xdc, 0x1a,
+  0xab, 0x2d, 0x4e, 0xe9, 0x3f, 0xca, 0x25, 0xc5, 0x91, 0x72, 0x46, 0xaf,
+  0x17, 0xa0, 0x5b, 0xb8, 0x1a, 0xe2, 0x85, 0x65, 0xcb, 0xaa, 0xe7, 0x48,
+  0xb0, 0xae, 0x97, 0x05, 0xc9, 0x0d, 0x17, 0xb9, 0x44, 0xdd, 0xd3, 0x84,
+  0xcf, 0xe3, 0x82, 0x3f, 0xc5, 0xfa, 0x17, 0x61, 0x9a, 0xf1, 0x08, 0x1d,
+  0xdb, 0x61, 0x4e, 0x44, 0x0f, 0xbb, 0xeb, 0xed, 0x88, 0x95, 0xfd, 0x84,
+  0xc3, 0x5c, 0xe0, 0xea, 0x6a, 0x82, 0xe5, 0x90, 0x94, 0x33, 0xaa, 0x66,
+  0x3c, 0x9a, 0xf7, 0xa5, 0xac, 0x2c, 0xc7, 0xc4, 0x9e, 0x6e, 0xe1, 0x44,
+  0x79, 0x01, 0xbd, 0xbf, 0xa5, 0x9b, 0x73, 0x5d, 0x9e, 0xac, 0xff, 0xf2,
+  0x4b, 0x77, 0x23, 0x13, 0xde, 0xbf, 0xd8, 0xe0, 0x32, 0xa1, 0xe5, 0x6a,
+  0x2f, 0xea, 0xc8, 0xca, 0x62, 0x3a, 0x81, 0xa4, 0xef, 0x8b, 0x68, 0x8f,
+  0xa1, 0xa9, 0x06, 0x93, 0xc9, 0xbe, 0x32, 0x74, 0xf7, 0x5e, 0xd7, 0xb7,
+  0xfc, 0xbe, 0xe7, 0xe9, 0xf4, 0xc2, 0x5e, 0xec, 0xb1, 0x4f, 0x9f, 0x0e,
+  0xec, 0xad, 0xb2, 0x7a, 0x94, 0x17, 0xc1, 0x7c, 0xc4, 0x93, 0x6c, 0x3f,
+  0xa4, 0x1f, 0xa6, 0xb1, 0x09, 0x6f, 0xb6, 0xa3, 0x88, 0xc3, 0x20, 0xdf,
+  0x57, 0xc6, 0x70, 0xa7, 0x1e, 0x55, 0xd9, 0x33, 0xdb, 0xcd, 0x30, 0x67,
+  0x9e, 0xa1, 0xe8, 0x50, 0x42, 0xe2, 0x10, 0xb4, 0xb4, 0xb8, 0xa2, 0x5a,
+  0x7a, 0xee, 0xaa, 0x39, 0xb6, 0x08, 0xb4, 0xd6, 0xea, 0xce, 0x1b, 0x92,
+  0x6d, 0xfa, 0xcc, 0x97, 0x40, 0xfc, 0xec, 0x6c, 0x0a, 0xef, 0xd0, 0x09,
+  0x57, 0x5c, 0x7f, 0x49, 0x17, 0xc4, 0x69, 0xb8, 0x6a, 0x0f, 0xac, 0x4d,
+  0xe1, 0x2c, 0x81, 0x88, 0x75, 0x87, 0x5d, 0x7e, 0x37, 0xc6, 0x34, 0xd7,
+  0x00, 0xaa, 0xf7, 0xb0, 0x7a, 0xf2, 0x80, 0x7c, 0x5b, 0x6d, 0xf3, 0xab,
+  0x80, 0xed, 0x3a, 0x89, 0xe7, 0xb4, 0x3d, 0xd0, 0xae, 0x4c, 0x32, 0x2c,
+  0x33, 0x2c, 0x8a, 0xce, 0xbb, 0xc1, 0x29, 0xb3, 0x22, 0x53, 0x43, 0xb1,
+  0x76, 0xb6, 0xea, 0x00, 0xd1, 0xa1, 0xb7, 0xc7, 0xec, 0x91, 0x02, 0xfe,
+  0xf4, 0x89, 0xed, 0xaf, 0xd7, 0x6a, 0xaf, 0x1a, 0x9d, 0xe7, 0x7a, 0xfa,
+  0x45, 0x0f, 0x82, 0x7b, 0xa8, 0xc0, 0xe0, 0xd4, 0xaf, 0x1f, 0xac, 0xb1,
+  0xab, 0x3b, 0x93, 0xe0, 0x8e, 0x99, 0xbd, 0x83, 0x4e, 0xb6, 0x48, 0x30,
+  0x4c, 0x17, 0x12, 0x44, 0xa1, 0xcd, 0x2c, 0x8d, 0x3d, 0x5e, 0xad, 0x90,
+  0x05, 0xad, 0xc3, 0x8d, 0x4b, 0x8d, 0xc3, 0xae, 0x86, 0x6b, 0x74, 0xfe,
+  0xd0, 0x50, 0x25, 0xbd, 0xbc, 0x05, 0x4b, 0xfb, 0x7a, 0x83, 0x79, 0xb3,
+  0x2b, 0xa6, 0x57, 0xc5, 0x1c, 0xed, 0x8a, 0xe9, 0xcb, 0x6d, 0x96, 0x8a,
+  0x1f, 0x5f, 0xc3, 0xde, 0xe0, 0x6e, 0x0f, 0x25, 0xd0, 0x55, 0xef, 0xd7,
+  0x18, 0x53, 0x78, 0x87, 0x3f, 0x47, 0x87, 0xd6, 0x4c, 0xab, 0x0e, 0xf2,
+  0xbf, 0x5e, 0xd6, 0x0d, 0xe9, 0xfc, 0x1d, 0xe5, 0xdd, 0x90, 0xe3, 0xdf,
+  0x51, 0xe6, 0x0d, 0x89, 0xff, 0xff, 0x03, 0x72, 0x3f, 0x38, 0x70, 0x27,
+  0x15, 0x5a, 0xaa, 0x6f, 0x65, 0x84, 0x01, 0xc0, 0x77, 0x5d, 0x8b, 0x83,
+  0x7f, 0x96, 0x43, 0xd8, 0x7c, 0x2a, 0xa7, 0xd9, 0x60, 0xe0, 0x49, 0x1a,
+  0xd7, 0x47, 0xbb, 0x27, 0x73, 0x2a, 0xca, 0xb1, 0x9b, 0x6a, 0xec, 0xa3,
+  0x18, 0x6d, 0x7a, 0xec, 0xf7, 0x92, 0x63, 0x7a, 0xf0, 0x7a, 0x49, 0x47,
+  0x9c, 0xaa, 0xac, 0x88, 0x7e, 0x5f, 0x95, 0x51, 0x74, 0x6f, 0x14, 0xdd,
+  0x9b, 0xbd, 0xe8, 0x36, 0x2a, 0x93, 0xa2, 0x3b, 0x52, 0x74, 0x47, 0x7b,
+  0xd1, 0x35, 0xfb, 0x77, 0x1a, 0x70, 0xab, 0x46, 0x49, 0x7d, 0x42, 0x75,
+  0x52, 0x43, 0x7c, 0x67, 0x25, 0x12, 0xdc, 0xcb, 0x5f, 0x6f, 0x83, 0x16,
+  0xb9, 0x66, 0xe2, 0x4f, 0xd0, 0x85, 0x7c, 0x9f, 0x01, 0x2e, 0xf6, 0x19,
+  0xb5, 0xb3, 0x3f, 0x71, 0x10, 0xdc, 0x49, 0xfd, 0xa7, 0xcf, 0x65, 0x31,
+  0x95, 0x2b, 0x81, 0xbc, 0x0c, 0xec, 0x07, 0xd5, 0x0d, 0x17, 0x53, 0xbc,
+  0xb6, 0x53, 0x9e, 0xe0, 0x5e, 0xaf, 0x38, 0x1d, 0xc8, 0xf0, 0x8c, 0x19,
+  0x9e, 0x1e, 0xc3, 0x33, 0x61, 0x74, 0xb0, 0x4b, 0xaf, 0x5f, 0x96, 0xf3,
+  0x30, 0x72, 0xce, 0x81, 0x99, 0x6d, 0xa0, 0x25, 0x21, 0xb0, 0x8e, 0x3e,
+  0x26, 0x29, 0xe0, 0x03, 0xf7, 0x08, 0x9b, 0xc1, 0x34, 0xf0, 0xf6, 0x2e,
+  0xbc, 0x39, 0xcf, 0xd6, 0xdc, 0x12, 0xb2, 0x56, 0x56, 0x5b, 0x2a, 0x9b,
+  0x5b, 0x32, 0xf0, 0x35, 0x87, 0x41, 0x28, 0x85, 0xa1, 0xb4, 0xb3, 0x2d,
+  0x3a, 0x78, 0x2c, 0x5a, 0x77, 0x8f, 0xd5, 0x50, 0x82, 0x0d, 0x55, 0x43,
+  0xb5, 0x88, 0x37, 0x8a, 0x61, 0x25, 0xb4, 0x20, 0x3c, 0x1b, 0xf2, 0x84,
+  0xe8, 0x00, 0x3b, 0x27, 0x82, 0x9c, 0x9d, 0x9c, 0x33, 0xc7, 0x09, 0xf0,
+  0xc0, 0x1e, 0x36, 0x33, 0x80, 0xa7, 0xaf, 0x89, 0x7d, 0x7c, 0xb2, 0x8e,
+  0x42, 0x18, 0x50, 0xec, 0xd8, 0x92, 0x40, 0x97, 0x00, 0xba, 0x24, 0xd0,
+  0xa5, 0x0d, 0xaa, 0x8e, 0xa7, 0x49, 0xf5, 0xc5, 0x53, 0x09, 0x57, 0xfa,
+  0xea, 0x8d, 0x54, 0x11, 0x53, 0xa9, 0x18, 0x37, 0x57, 0x5e, 0x6c, 0x65,
+  0x70, 0x0e, 0x8a, 0xb2, 0x02, 0x64, 0x57, 0x80, 0x1a, 0x14, 0x3e, 0xa8,
+  0x24, 0xbe, 0xe4, 0xf8, 0x96, 0xe3, 0xab, 0x3a, 0x01, 0x5a, 0x9f, 0xf8,
+  0xd5, 0xd7, 0x67, 0x9e, 0xcf, 0x17, 0xf2, 0xc4, 0xe7, 0x82, 0x27, 0x27,
+  0x74, 0xce, 0x8a, 0xad, 0x4e, 0xc6, 0xb3, 0x70, 0xb1, 0x00, 0x35, 0xd6,
+  0x4b, 0xd1, 0xa2, 0xdf, 0x5b, 0x41, 0xe7, 0x4e, 0x60, 0x3a, 0x43, 0xfc,
+  0x4a, 0x6f, 0x8f, 0xe4, 0xb3, 0xe7, 0xd4, 0x78, 0x56, 0x8d, 0xef, 0xd4,
+  0xf8, 0xb2, 0xc6, 0x89, 0xb9, 0x4f, 0xc5, 0xc7, 0x1c, 0xd2, 0x87, 0xa7,
+  0xa7, 0x37, 0xb0, 0x70, 0xed, 0xdd, 0x84, 0xd9, 0x34, 0x17, 0x5f, 0x93,
+  0xf0, 0xee, 0x3d, 0xf8, 0xaa, 0x7f, 0xd6, 0x17, 0x40, 0x7c, 0xb9, 0x98,
+  0x05, 0x11, 0xde, 0x32, 0x8d, 0x1e, 0xaa, 0xcf, 0x3f, 0x2c, 0xe2, 0x9c,
+  0x67, 0xbd, 0x88, 0x67, 0xa7, 0x59, 0xbc, 0x08, 0xc7, 0xbd, 0xc5, 0x74,
+  0xf1, 0xcd, 0xed, 0x34, 0x1c, 0x4f, 0xcf, 0x1f, 0xfc, 0xd7, 0x57, 0x67,
+  0x5f, 0x2e, 0x20, 0xf8, 0x3f, 0xef, 0x5b, 0x87, 0xca, 0x52, 0x79, 0x96,
+  0xab, 0xf6, 0x66, 0xbc, 0xe2, 0xc6, 0x7b, 0xd0, 0xbb, 0x87, 0xc0, 0x7c,
+  0x72, 0xb2, 0x00, 0x7b, 0x91, 0x81, 0xe5, 0x89, 0x93, 0x49, 0x08, 0x4d,
+  0xf3, 0x54, 0x4f, 0xb3, 0x3e, 0x51, 0x29, 0xfa, 0x74, 0xd1, 0xa0, 0x72,
+  0x1a, 0xed, 0xd8, 0xfd, 0x1c, 0x01, 0x74, 0xf7, 0x93, 0x39, 0x32, 0x41,
+  0x07, 0xfe, 0xda, 0x28, 0xa5, 0xbd, 0x31, 0x7d, 0x81, 0xe9, 0xef, 0x81,
+  0xa9, 0xe6, 0x9e, 0x66, 0xb7, 0xb4, 0x50, 0xdf, 0x56, 0x51, 0xdf, 0xae,
+  0x37, 0x5a, 0x6a, 0x76, 0xf7, 0xc6, 0xd4, 0xec, 0xee, 0x8e, 0x29, 0x51,
+  0x47, 0xdf, 0x05, 0xe9, 0x30, 0x4e, 0xe6, 0x94, 0x36, 0xa2, 0x08, 0x5c,
+  0x2c, 0x3d, 0x44, 0x59, 0x8a, 0x5f, 0x09, 0x98, 0x61, 0x6a, 0xa5, 0xa1,
+  0x4a, 0x1d, 0x86, 0xb2, 0xa8, 0xbd, 0x7e, 0x83, 0xee, 0xaa, 0xe8, 0x23,
+  0x16, 0x4c, 0x10, 0xf1, 0xe3, 0xeb, 0x06, 0x67, 0xb0, 0x94, 0x86, 0x19,
+  0x77, 0x19, 0xd2, 0xe7, 0x07, 0xb4, 0x61, 0xc2, 0x59, 0x49, 0x2f, 0xe9,
+  0xc7, 0x24, 0x6b, 0xb3, 0xf6, 0x12, 0x33, 0x79, 0x4b, 0xaf, 0x73, 0xa4,
+  0x9f, 0x30, 0xe3, 0x5f, 0xe2, 0x73, 0x89, 0xa5, 0xea, 0x09, 0x2c, 0xd9,
+  0x1a, 0xaa, 0x87, 0x08, 0x3e, 0xa2, 0xca, 0x27, 0x42, 0xc5, 0xe7, 0x12,
+  0x4b, 0xd5, 0x53, 0x1d, 0xaa, 0x8f, 0x08, 0x7d, 0x44, 0x95, 0x4f, 0x84,
+  0x8a, 0xcf, 0x25, 0x96, 0xaa, 0x27, 0xda, 0x67, 0x51, 0x87, 0x5e, 0x60,
+  0x99, 0xdb, 0x46, 0xf1, 0x6c, 0xbf, 0x4e, 0xd3, 0x61, 0xd8, 0x20, 0x08,
+  0xa4, 0x6d, 0x4b, 0x01, 0xa6, 0xe9, 0xd9, 0x19, 0x8c, 0x9b, 0x9a, 0x34,
+  0x1d, 0x6d, 0xca, 0x60, 0x86, 0xf4, 0xe5, 0xef, 0xa7, 0x9f, 0xd5, 0x43,
+  0xa0, 0x9f, 0x7e, 0xf9, 0x45, 0x3f, 0xfe, 0x3c, 0x36, 0x00, 0xa3, 0x9f,
+  0x3f, 0x4d, 0x6c, 0x18, 0x03, 0xe6, 0x89, 0x53, 0x8a, 0xfe, 0x81, 0xce,
+  0x03, 0xcc, 0x17, 0x74, 0xd1, 0xeb, 0x9c, 0xfd, 0xc6, 0x6a, 0xc6, 0xfd,
+  0x21, 0x7b, 0x7f, 0xd5, 0x65, 0x32, 0x4e, 0x17, 0x09, 0x8e, 0x87, 0xd6,
+  0x32, 0x8d, 0x7d, 0x36, 0x77, 0xd8, 0x16, 0xaf, 0xdf, 0xf4, 0x31, 0x40,
+  0x82, 0x5f, 0xcf, 0x17, 0xbf, 0xbe, 0xd8, 0x19, 0x10, 0x39, 0x54, 0xa1,
+  0x18, 0x1d, 0xfa, 0x1c, 0x8a, 0x5a, 0xec, 0xba, 0x97, 0x23, 0x61, 0x91,
+  0xab, 0x4a, 0xd4, 0xa9, 0x40, 0x05, 0xde, 0x12, 0xe4, 0x1b, 0x3f, 0x6e,
+  0xa0, 0x40, 0x08, 0x77, 0x91, 0xa7, 0xd3, 0xb6, 0x64, 0x48, 0xdf, 0x51,
+  0x38, 0x3e, 0x76, 0x5a, 0x53, 0xab, 0x0c, 0xc1, 0xee, 0xbe, 0x74, 0x3d,
+  0x7f, 0x17, 0xba, 0x7e, 0x7f, 0x5f, 0xba, 0x7e, 0xbf, 0x99, 0xae, 0xb3,
+  0x16, 0x75, 0x65, 0xa2, 0x20, 0xdf, 0x57, 0x24, 0x7a, 0xd5, 0x40, 0x0b,
+  0xcb, 0x2a, 0xdd, 0xdf, 0x97, 0x44, 0xa5, 0x97, 0x77, 0x42, 0xb7, 0x92,
+  0x57, 0xb7, 0xe6, 0xd0, 0x6b, 0xab, 0x75, 0xab, 0x0e, 0xc4, 0xb6, 0xfb,
+  0x68, 0xbb, 0xc0, 0xc5, 0xd1, 0x19, 0x22, 0x78, 0xb8, 0x65, 0xa7, 0x68,
+  0x57, 0x6f, 0xf1, 0xf8, 0x90, 0xa8, 0x04, 0xcf, 0x28, 0x25, 0x26, 0xa4,
+  0x21, 0x6f, 0xca, 0xa0, 0xf5, 0xe9, 0xf4, 0xe6, 0xf9, 0x2c, 0x0b, 0x17,
+  0xb3, 0x12, 0xcd, 0x60, 0x80, 0x67, 0xb2, 0x65, 0xa8, 0x83, 0xc9, 0xdb,
+  0x36, 0x99, 0xa6, 0x75, 0x98, 0x3e, 0x92, 0x96, 0x80, 0x10, 0x4d, 0xab,
+  0x9d, 0xed, 0x2a, 0x53, 0xbe, 0x62, 0xca, 0x17, 0x4c, 0x79, 0x36, 0x53,
+  0x9e, 0xc3, 0x94, 0xe7, 0x6b, 0xa6, 0xbc, 0x1d, 0x98, 0xf2, 0xef, 0xce,
+  0x54, 0x5f, 0x31, 0xd5, 0x17, 0x4c, 0xf9, 0x36, 0x53, 0xbe, 0xc3, 0x94,
+  0xdf, 0xd7, 0x4c, 0xf9, 0x3b, 0x30, 0xd5, 0xdf, 0x9d, 0x29, 0xbc, 0x04,
+  0xd0, 0x32, 0x56, 0x41, 0x1a, 0x05, 0x69, 0x13, 0x1c, 0x93, 0xe0, 0xde,
+  0xa1, 0xa6, 0xd9, 0x5f, 0x3b, 0xf9, 0x89, 0x48, 0xe3, 0x97, 0x54, 0x5a,
+  0xfa, 0x32, 0xb6, 0x9e, 0x48, 0xd6, 0xbc, 0x47, 0xc5, 0x5b, 0x9b, 0x9d,
+  0xc4, 0xce, 0x5e, 0x04, 0xcd, 0x84, 0x6f, 0x22, 0xe8, 0xf7, 0xf7, 0x22,
+  0x68, 0x66, 0x7a, 0x95, 0x60, 0x75, 0x9a, 0xab, 0xde, 0x4b, 0xa8, 0xf7,
+  0xae, 0xd8, 0xae, 0x6a, 0x89, 0xe8, 0x09, 0xae, 0x7a, 0xba, 0x0f, 0xb2,
+  0xd3, 0xa3, 0x7d, 0x11, 0xc5, 0x9c, 0x26, 0x9e, 0xa5, 0x82, 0x91, 0xee,
+  0x90, 0x1a, 0xd5, 0xaa, 0x3f, 0x66, 0x02, 0x84, 0x24, 0x88, 0x57, 0x85,
+  0xe4, 0x69, 0x24, 0x7f, 0x1b, 0x92, 0x56, 0x65, 0x02, 0x15, 0x48, 0xfd,
+  0x66, 0x24, 0xa3, 0x9a, 0x43, 0xa1, 0x9a, 0x43, 0xa1, 0x9a, 0x43, 0xad,
+  0x9a, 0x6d, 0x3b, 0x26, 0xaa, 0x38, 0xac, 0x61, 0x55, 0x63, 0x87, 0x0d,
+  0xee, 0x6a, 0x58, 0xab, 0xb2, 0xbe, 0x65, 0xfd, 0x87, 0x8e, 0x46, 0x0c,
+  0x2b, 0xbe, 0x6a, 0x58, 0xe3, 0x52, 0x86, 0xb5, 0x5a, 0xbb, 0x81, 0x66,
+  0xc5, 0x4f, 0xd5, 0xd2, 0xac, 0x55, 0xdc, 0x0d, 0x34, 0x2b, 0x3e, 0x6a,
+  0xb8, 0xc5, 0x45, 0x0d, 0xa5, 0xf2, 0x0e, 0x95, 0x1a, 0x0d, 0xeb, 0xbd,
+  0xc3, 0xb0, 0xde, 0x3d, 0x0d, 0xa5, 0xfa, 0xee, 0x81, 0xee, 0xf6, 0x6c,
+  0x7f, 0xd4, 0xcf, 0x6a, 0x4e, 0x0f, 0xb5, 0x0e, 0x37, 0xc4, 0xbe, 0x74,
+  0x61, 0x5b, 0xe9, 0x5c, 0x23, 0x0c, 0x9d, 0xe1, 0xe8, 0x45, 0x54, 0x86,
+  0x77, 0x89, 0xb4, 0x49, 0x18, 0x6a, 0x75, 0xdf, 0x82, 0xbb, 0x99, 0xbe,
+  0xd7, 0x48, 0x5f, 0xcf, 0x8c, 0x2d, 0xb8, 0x9b, 0xe9, 0x9f, 0xd5, 0xd2,
+  0xff, 0xac, 0xe2, 0xd3, 0x60, 0xc3, 0xa4, 0x51, 0xe1, 0x65, 0x23, 0xdd,
+  0xf3, 0x8d, 0xcd, 0x0e, 0xb6, 0x13, 0x91, 0xf9, 0x4c, 0x1c, 0xab, 0x1d,
+  0xa0, 0x3d, 0x05, 0x2d, 0xe7, 0x3a, 0xf9, 0xaa, 0xf5, 0x25, 0xbe, 0xf1,
+  0x5a, 0x7e, 0x5f, 0x2e, 0xf4, 0xed, 0xf0, 0x16, 0x0b, 0xd5, 0x72, 0x5f,
+  0x35, 0xd7, 0x5d, 0xbb, 0x78, 0x09, 0xa2, 0x19, 0xfd, 0x49, 0xa2, 0xe9,
+  0xef, 0x27, 0x1a, 0xcf, 0xdf, 0x47, 0x34, 0x52, 0x90, 0x75, 0xa2, 0x71,
+  0x3c, 0x79, 0xdf, 0x93, 0xe9, 0x0f, 0x3b, 0xe2, 0xc7, 0xc2, 0x9d, 0x44,
+  0x33, 0xfe, 0x63, 0xa2, 0xd9, 0x75, 0xc0, 0xef, 0x28, 0x83, 0x66, 0xf5,
+  0xa8, 0x09, 0x68, 0xba, 0x0d, 0x6b, 0x9f, 0x1d, 0x25, 0x31, 0xf9, 0x93,
+  0x94, 0xc4, 0xdb, 0x4f, 0x49, 0x64, 0x97, 0x77, 0x14, 0x90, 0x14, 0x67,
+  0x9d, 0x92, 0xd8, 0x62, 0x21, 0x69, 0xe4, 0x85, 0x25, 0x12, 0x25, 0xa2,
+  0xed, 0xa2, 0x51, 0x59, 0x2b, 0x69, 0x6a, 0x40, 0x52, 0xef, 0x58, 0x11,
+  0xcc, 0x72, 0x9e, 0xb2, 0x76, 0xcf, 0x7b, 0x60, 0x27, 0x8d, 0x3a, 0x2a,
+  0xb5, 0xb0, 0xd2, 0xa9, 0x97, 0x95, 0x95, 0x06, 0x79, 0x57, 0x4d, 0x83,
+  0xbc, 0x5b, 0x4f, 0xa0, 0xac, 0x74, 0xea, 0x65, 0x6f, 0x4c, 0x9d, 0x7a,
+  0xd9, 0x1d, 0x53, 0xf4, 0x07, 0x96, 0xc3, 0xa2, 0x43, 0xd5, 0xdc, 0x89,
+  0xfa, 0x24, 0xa3, 0x58, 0xa2, 0xe7, 0x20, 0xb6, 0x0c, 0x6d, 0x50, 0x96,
+  0x7b, 0xf8, 0x84, 0x7f, 0x72, 0x1f, 0x9f, 0x7c, 0x73, 0x76, 0x65, 0x2d,
+  0xdd, 0x62, 0xce, 0x38, 0x2a, 0xaa, 0xea, 0x5b, 0x79, 0x30, 0xc6, 0x79,
+  0x5f, 0x64, 0x68, 0x7a, 0x74, 0xa9, 0xb9, 0x05, 0xd4, 0xe9, 0xf2, 0xe7,
+  0x09, 0x95, 0x95, 0xa2, 0x2c, 0xf7, 0x08, 0xc6, 0xd3, 0x30, 0x9e, 0x86,
+  0xf1, 0x34, 0x8c, 0x4f, 0x30, 0xbe, 0x86, 0xf1, 0x35, 0x8c, 0xdf, 0x2b,
+  0x4d, 0xc2, 0x9d, 0x3e, 0x57, 0x49, 0x9a, 0xed, 0x74, 0x38, 0x82, 0x4e,
+  0x45, 0xd0, 0x9d, 0x08, 0x7a, 0x13, 0xad, 0xf0, 0x65, 0x85, 0x6f, 0x2b,
+  0xab, 0x5f, 0x95, 0x49, 0x81, 0xad, 0x44, 0xfd, 0x5d, 0xdc, 0x46, 0xe4,
+  0xed, 0x62, 0x41, 0x23, 0x7f, 0x97, 0x29, 0x14, 0x91, 0x5e, 0x45, 0x42,
+  0xab, 0xd4, 0xf1, 0xf1, 0x88, 0x54, 0x26, 0xf2, 0x2a, 0x85, 0x14, 0xa1,
+  0xf9, 0xa6, 0xd0, 0x12, 0xc1, 0x13, 0x3e, 0xcb, 0x02, 0x9d, 0xd5, 0x9c,
+  0x2c, 0x29, 0x32, 0x92, 0xc9, 0xad, 0x2e, 0x9b, 0x94, 0xf4, 0x2e, 0x72,
+  0x53, 0xfa, 0xb0, 0xec, 0x64, 0x49, 0x01, 0x90, 0xcc, 0x63, 0x21, 0x14,
+  0xbd, 0x8b, 0x34, 0x94, 0x67, 0xa0, 0x28, 0xd6, 0x91, 0x29, 0x2b, 0x84,
+  0xa2, 0x77, 0x91, 0x22, 0xf3, 0x95, 0xbe, 0x5d, 0xe0, 0xe1, 0x58, 0xdc,
+  0x2c, 0x49, 0xd4, 0xe6, 0x86, 0x3e, 0x38, 0x16, 0x46, 0x4b, 0x67, 0x7b,
+  0x61, 0x7d, 0x2b, 0xa3, 0x8b, 0xd4, 0x31, 0x19, 0xe6, 0x7c, 0xf7, 0x94,
+  0x4e, 0x8f, 0xda, 0x99, 0x5d, 0x67, 0x17, 0x02, 0x48, 0xb9, 0xbb, 0x10,
+  0xeb, 0x3b, 0x1e, 0x3b, 0x93, 0xad, 0xdd, 0x16, 0x01, 0xa2, 0x65, 0x23,
+  0xdf, 0x62, 0xa3, 0xa3, 0x8b, 0xb2, 0xda, 0x9f, 0xef, 0xb2, 0x91, 0xef,
+  0x3d, 0xc9, 0xd6, 0x6c, 0xb2, 0xe8, 0x6b, 0xeb, 0xa6, 0x01, 0x1c, 0x80,
+  0x2e, 0xb3, 0xbf, 0x62, 0xa0, 0xef, 0xab, 0x9b, 0x96, 0x51, 0x9c, 0x5d,
+  0xf5, 0x7d, 0xd4, 0x8e, 0xf3, 0xd9, 0x32, 0x87, 0x92, 0xf9, 0xb8, 0x6a,
+  0xc7, 0xf9, 0x70, 0x99, 0x43, 0xa9, 0xd4, 0x5f, 0x57, 0xd5, 0xb9, 0x78,
+  0xba, 0x82, 0x4a, 0xb7, 0x39, 0x71, 0x5b, 0x2d, 0x88, 0x26, 0x41, 0x32,
+  0x61, 0x0f, 0x96, 0x0f, 0x58, 0x7b, 0x9e, 0xa7, 0xf4, 0x7d, 0xaf, 0x45,
+  0x7c, 0xcb, 0x71, 0x83, 0x88, 0x65, 0xb7, 0xb1, 0x36, 0xba, 0x1f, 0xf1,
+  0x90, 0x8c, 0x73, 0xab, 0x1c, 0x68, 0x5d, 0x66, 0x41, 0x82, 0x5f, 0xb5,
+  0x60, 0xe3, 0x38, 0x89, 0x04, 0x0e, 0x52, 0x22, 0x38, 0x3a, 0x8e, 0x88,
+  0x1a, 0xf7, 0xe5, 0x39, 0xfb, 0x1d, 0x64, 0xfb, 0x91, 0xf6, 0x2c, 0x88,
+  0x57, 0x1a, 0xd0, 0x6a, 0xb1, 0xa0, 0xf8, 0x38, 0xa6, 0xe4, 0x6a, 0x86,
+  0x1f, 0x51, 0xce, 0x90, 0xde, 0x34, 0x98, 0x5d, 0x9f, 0xf0, 0xc9, 0x0d,
+  0xd7, 0x1f, 0x18, 0x4b, 0x2d, 0x7d, 0xfe, 0xc9, 0xd9, 0x81, 0xa0, 0xe6,
+  0x6a, 0x36, 0x21, 0x34, 0xf8, 0xdb, 0x2a, 0x78, 0xd9, 0xb0, 0x67, 0x41,
+  0x9b, 0xb8, 0x28, 0x72, 0x9a, 0xaf, 0x47, 0x74, 0x06, 0xdd, 0x69, 0x8e,
+  0xbe, 0x15, 0xd1, 0x27, 0xdd, 0xa0, 0x29, 0xae, 0x41, 0xde, 0x3a, 0x20,
+  0xf6, 0x37, 0x28, 0xc6, 0x1e, 0xd1, 0x83, 0x99, 0xdd, 0x44, 0xcf, 0x93,
+  0xf4, 0x6c, 0x90, 0x0a, 0x3d, 0xcf, 0xa2, 0xe7, 0x13, 0x3d, 0xb0, 0x01,
+  0x4d, 0xf4, 0x7c, 0x49, 0xcf, 0x06, 0xa9, 0xd0, 0xf3, 0x6d, 0xd1, 0x27,
+  0xa8, 0x2b, 0x78, 0xf4, 0x96, 0xe1, 0x45, 0x58, 0xbc, 0x27, 0x8e, 0x67,
+  0x1f, 0x41, 0xe4, 0xda, 0x50, 0x93, 0x38, 0xf0, 0x4e, 0xc0, 0xa7, 0x4f,
+  0xea, 0x0d, 0xd6, 0xc7, 0x67, 0xe8, 0x8d, 0x48, 0x0c, 0x8f, 0xe8, 0x7e,
+  0x40, 0x07, 0x65, 0x77, 0x7c, 0x3c, 0x30, 0x58, 0xd0, 0x23, 0x0b, 0x0b,
+  0x8d, 0x9b, 0xc6, 0x92, 0x55, 0x84, 0xe5, 0xb9, 0x58, 0xc0, 0xb7, 0x85,
+  0x85, 0xc6, 0x4e, 0x63, 0xc9, 0x2a, 0xc2, 0xf2, 0x09, 0x4b, 0x39, 0xa0,
+  0x4c, 0x7e, 0x1d, 0x79, 0x12, 0xf3, 0x14, 0x3f, 0x58, 0xf7, 0x01, 0xbb,
+  0xa2, 0x86, 0x18, 0xbf, 0x07, 0x31, 0x0e, 0x53, 0xe8, 0x52, 0x97, 0x8d,
+  0x72, 0x50, 0x30, 0x3c, 0xcd, 0x3b, 0xe2, 0xe3, 0x20, 0x87, 0xd5, 0xec,
+  0x2d, 0x60, 0xf2, 0x54, 0x08, 0xe0, 0xd1, 0xf9, 0x19, 0x6b, 0x47, 0x71,
+  0xc6, 0x1e, 0x9d, 0x75, 0x7a, 0x82, 0xf4, 0xf3, 0xec, 0x30, 0x65, 0x01,
+  0x1b, 0x85, 0x19, 0x92, 0xcb, 0x66, 0xbc, 0xc7, 0x1e, 0xe2, 0xfe, 0xc0,
+  0x58, 0x84, 0x23, 0xe3, 0xbe, 0xd0, 0xe4, 0xaa, 0x71, 0xa0, 0xfb, 0xc5,
+  0x22, 0xee, 0x18, 0x7b, 0x1b, 0x40, 0x44, 0x80, 0x31, 0xf6, 0x9b, 0x40,
+  0x54, 0x74, 0x04, 0x91, 0x10, 0x4f, 0x16, 0xf1, 0x2c, 0x50, 0x9f, 0xae,
+  0xc8, 0x17, 0xda, 0xd9, 0xac, 0xc8, 0xb9, 0xac, 0x90, 0x13, 0xf4, 0xb1,
+  0x93, 0x15, 0x39, 0x88, 0x15, 0xd2, 0x5c, 0x69, 0x67, 0x13, 0x46, 0xc5,
+  0x13, 0xda, 0xf9, 0xed, 0xf7, 0xce, 0x30, 0xb9, 0xa7, 0x14, 0x98, 0x24,
+  0x7c, 0xa2, 0xd4, 0x85, 0xc6, 0x56, 0xeb, 0xda, 0x64, 0x35, 0x11, 0xf7,
+  0x35, 0x24, 0x32, 0xaa, 0x13, 0xb5, 0x66, 0xd0, 0x56, 0x16, 0x9a, 0xfc,
+  0x78, 0xf5, 0x64, 0x85, 0xfb, 0x9f, 0x20, 0x64, 0x6e, 0x06, 0x80, 0x76,
+  0x8f, 0xc1, 0x62, 0x2c, 0x0d, 0xe5, 0xb2, 0x89, 0xf2, 0x52, 0x32, 0x24,
+  0xde, 0xb0, 0x81, 0x5d, 0x28, 0x97, 0x5a, 0x54, 0x01, 0x7e, 0x30, 0x7b,
+  0x71, 0x3a, 0xe3, 0xd7, 0x99, 0x65, 0xa1, 0x92, 0x00, 0xc6, 0x38, 0x48,
+  0x78, 0xa0, 0x27, 0xfa, 0x8a, 0x18, 0x58, 0xf5, 0xe5, 0x65, 0x93, 0xfa,
+  0x89, 0x7e, 0x24, 0x84, 0x70, 0xdc, 0x3c, 0xd1, 0x05, 0x48, 0xe9, 0x86,
+  0x7f, 0xef, 0x98, 0xe1, 0x8e, 0x2c, 0x97, 0x16, 0x25, 0x3d, 0x98, 0xed,
+  0x20, 0x13, 0x6f, 0x6a, 0x91, 0xd0, 0xc3, 0x3a, 0x84, 0x92, 0x5c, 0x56,
+  0x4c, 0xc0, 0x53, 0xe0, 0x0f, 0x98, 0xf9, 0xf1, 0x28, 0xcb, 0xe9, 0x6f,
+  0x31, 0x38, 0x58, 0xdf, 0x8c, 0x91, 0xab, 0x10, 0x78, 0xab, 0x53, 0x1f,
+  0x75, 0x91, 0x00, 0x22, 0x46, 0xd4, 0x1f, 0x0c, 0x1c, 0x4f, 0x44, 0x1c,
+  0x0a, 0x45, 0xa4, 0x42, 0x18, 0x03, 0x62, 0x51, 0x7f, 0x60, 0x01, 0xd7,
+  0xa8, 0x04, 0x51, 0x30, 0x3a, 0x41, 0xd8, 0x55, 0xa5, 0xc8, 0xf2, 0xcd,
+  0x5a, 0xa1, 0xc9, 0x97, 0x8d, 0xe4, 0x5d, 0xc5, 0xa0, 0x56, 0x76, 0x22,
+  0x5f, 0x1a, 0xf2, 0x85, 0xe8, 0x6a, 0x41, 0x5d, 0x2d, 0xa8, 0xab, 0x85,
+  0xe8, 0x6a, 0x41, 0x5d, 0x2d, 0xe4, 0x7d, 0x17, 0x14, 0xf2, 0x3a, 0x1f,
+  0x85, 0xdb, 0xcd, 0xa2, 0xae, 0x9b, 0xc5, 0x96, 0x6e, 0xd2, 0xc0, 0x35,
+  0x92, 0xae, 0x74, 0xb1, 0x70, 0xba, 0x58, 0x6c, 0xd1, 0x7e, 0x39, 0xd6,
+  0xdb, 0xf4, 0x1f, 0x77, 0xfb, 0x40, 0x6d, 0x88, 0x07, 0x1c, 0xf4, 0xe3,
+  0xaa, 0xf2, 0x1b, 0xd5, 0xa7, 0xd1, 0x3e, 0xae, 0x6a, 0xbe, 0xd1, 0x7b,
+  0x1a, 0x2e, 0x91, 0x33, 0x42, 0x1d, 0x14, 0x24, 0x8b, 0xcd, 0x24, 0x8b,
+  0x2d, 0x24, 0x0b, 0x41, 0xd2, 0xf4, 0xc7, 0x9e, 0x49, 0x24, 0x40, 0xa1,
+  0x82, 0xe2, 0xd7, 0xcc, 0x93, 0x81, 0xaa, 0x2c, 0x65, 0x65, 0xb9, 0x5e,
+  0x59, 0x48, 0xcc, 0xa2, 0x0e, 0xb3, 0x90, 0x98, 0x45, 0x05, 0x53, 0x45,
+  0xf9, 0xa4, 0x41, 0xd1, 0x92, 0x66, 0x5f, 0xb4, 0x12, 0xb3, 0x2f, 0x5a,
+  0x0d, 0x36, 0xac, 0x66, 0x98, 0x59, 0x1b, 0x6d, 0x9a, 0x80, 0x91, 0x30,
+  0xe0, 0x11, 0x59, 0x70, 0x5a, 0x26, 0x41, 0x91, 0x48, 0xdd, 0x92, 0x11,
+  0x8f, 0x56, 0xd6, 0x04, 0x8c, 0xea, 0x6c, 0x72, 0xe4, 0x1a, 0xe5, 0xa8,
+  0xce, 0x2a, 0x47, 0xab, 0x5d, 0x26, 0x60, 0x54, 0x67, 0x98, 0xa3, 0x5a,
+  0xcb, 0x1c, 0x39, 0xa6, 0x39, 0x5a, 0xed, 0xa0, 0x9d, 0x52, 0x18, 0x3b,
+  0x69, 0x68, 0x24, 0xec, 0x73, 0xb4, 0xda, 0xa8, 0x4e, 0xd1, 0x6a, 0xb3,
+  0x3a, 0x51, 0x7f, 0x8c, 0x3a, 0x49, 0x06, 0xaa, 0x2a, 0xa5, 0x85, 0x2a,
+  0x9e, 0x6c, 0xe3, 0x3b, 0x50, 0x00, 0xa5, 0x06, 0x28, 0x2b, 0x00, 0xd6,
+  0x32, 0xf0, 0x12, 0x44, 0x96, 0x2f, 0x90, 0x99, 0x53, 0x3c, 0x16, 0x25,
+  0x3a, 0xa7, 0x96, 0xc4, 0x1f, 0xe7, 0x38, 0xa6, 0x14, 0xfa, 0x92, 0xcc,
+  0x30, 0xe2, 0x10, 0xd1, 0x56, 0xc8, 0xa3, 0x31, 0x57, 0x0b, 0x67, 0x40,
+  0xee, 0x8b, 0x4f, 0x84, 0x44, 0x40, 0xa3, 0x6f, 0x7f, 0x26, 0x04, 0xeb,
+  0x3c, 0x53, 0xe7, 0x55, 0xeb, 0x7c, 0x53, 0xe7, 0x57, 0xeb, 0x56, 0xa6,
+  0x6e, 0xa5, 0xea, 0x44, 0xc4, 0x45, 0x21, 0xdc, 0x39, 0xc5, 0x55, 0xa2,
+  0xc5, 0x93, 0x73, 0xe2, 0xf5, 0x88, 0xaa, 0x06, 0x22, 0xe9, 0x2f, 0xd8,
+  0x72, 0x6b, 0xdc, 0xf8, 0xb0, 0x9e, 0x42, 0xd9, 0x48, 0xa1, 0xb4, 0x29,
+  0x50, 0x40, 0x68, 0x28, 0x78, 0x76, 0x4b, 0x9e, 0x6f, 0x51, 0xa8, 0xd6,
+  0xb8, 0xd1, 0x66, 0x3d, 0x85, 0xb2, 0x91, 0x42, 0x69, 0x53, 0xa0, 0xf0,
+  0xd2, 0x50, 0xf0, 0xed, 0x96, 0xfc, 0xbe, 0x45, 0xa1, 0x5a, 0xe3, 0xc6,
+  0xae, 0xf5, 0x14, 0xca, 0x46, 0x0a, 0xa5, 0x4d, 0x01, 0xd5, 0xcf, 0xa2,
+  0xb0, 0xc2, 0x53, 0x6c, 0x12, 0x0e, 0xaa, 0x2c, 0x0a, 0xd5, 0x1a, 0x8b,
+  0x42, 0xd9, 0x4c, 0xa1, 0x6c, 0xa4, 0x50, 0xaa, 0xd0, 0xe5, 0x45, 0x1c,
+  0x2f, 0x20, 0x96, 0x4e, 0xe2, 0xfc, 0x66, 0x2a, 0xd6, 0x74, 0xe9, 0xfa,
+  0x31, 0x40, 0xf7, 0x10, 0xe0, 0x47, 0xb3, 0x7a, 0x1a, 0xa1, 0xbe, 0x8e,
+  0x75, 0xd4, 0x39, 0x1e, 0xa1, 0x8e, 0x8e, 0x3d, 0xf3, 0x8e, 0x7a, 0x39,
+  0xf6, 0xcd, 0x3b, 0xea, 0xe2, 0x78, 0xa5, 0xde, 0x3f, 0x4a, 0xfa, 0x44,
+  0x53, 0x7e, 0x60, 0xb9, 0x8f, 0x53, 0x53, 0x54, 0x18, 0xad, 0xa1, 0x1a,
+  0xcf, 0xad, 0xf1, 0x34, 0x59, 0xee, 0xbb, 0x35, 0xbe, 0x66, 0x88, 0xaf,
+  0x9c, 0x1a, 0x92, 0x9c, 0xaa, 0xca, 0x72, 0x30, 0xed, 0x3c, 0x2b, 0x96,
+  0x4d, 0xb1, 0x14, 0x42, 0xd8, 0xd8, 0xe8, 0x81, 0x06, 0xa2, 0xa2, 0x70,
+  0x2b, 0x0a, 0x49, 0x57, 0x3b, 0x0e, 0x1e, 0xad, 0x96, 0x9b, 0x5c, 0x05,
+  0xd6, 0xdb, 0x14, 0xa2, 0x55, 0x95, 0xc2, 0xf2, 0x0c, 0xd3, 0xb3, 0xb0,
+  0xd6, 0xad, 0x9e, 0xae, 0x94, 0xe5, 0x30, 0xb4, 0xf0, 0xf8, 0x35, 0xad,
+  0xff, 0xe9, 0x11, 0x47, 0xd7, 0x0e, 0x03, 0x87, 0xfc, 0x56, 0x8c, 0x27,
+  0x0d, 0x24, 0x88, 0xf8, 0x03, 0x87, 0xb6, 0xa6, 0x39, 0x7e, 0x40, 0xfa,
+  0x86, 0x8c, 0x51, 0x96, 0x84, 0x2c, 0xce, 0xc1, 0x51, 0x31, 0x5a, 0x7a,
+  0x83, 0xe5, 0x8e, 0x67, 0x13, 0x1b, 0x67, 0x12, 0x26, 0xf6, 0x27, 0x5b,
+  0x80, 0xa5, 0x47, 0x82, 0x27, 0x5c, 0x9e, 0x2d, 0x65, 0xeb, 0xf4, 0x82,
+  0x8a, 0x00, 0x75, 0xc2, 0x1a, 0xd0, 0xbb, 0xa7, 0xde, 0x3d, 0xf1, 0xee,
+  0xab, 0x77, 0x93, 0xce, 0x6c, 0x2d, 0x05, 0xd7, 0xe2, 0xc8, 0x26, 0x1d,
+  0x4b, 0x02, 0x32, 0x50, 0x02, 0x3a, 0xa0, 0xde, 0x3d, 0x7a, 0xf7, 0xf4,
+  0xbb, 0x4f, 0xef, 0xbe, 0x7e, 0x27, 0xad, 0xe6, 0xab, 0xa5, 0x7d, 0x59,
+  0xaa, 0x32, 0x8c, 0x32, 0xfe, 0x41, 0x38, 0x18, 0xd0, 0x81, 0x2e, 0x2a,
+  0x44, 0x51, 0xb1, 0x74, 0x3f, 0x27, 0xdb, 0x34, 0x64, 0xd2, 0x49, 0x21,
+  0x4e, 0xb4, 0x72, 0x71, 0xf4, 0x06, 0xda, 0xcb, 0x0f, 0x01, 0x7e, 0xe8,
+  0x90, 0x1f, 0x26, 0x30, 0xe7, 0xe2, 0x5b, 0x14, 0x69, 0x20, 0x05, 0x0a,
+  0xeb, 0xce, 0x0f, 0x54, 0x94, 0xa2, 0xcc, 0xd3, 0x70, 0x02, 0x2b, 0xcb,
+  0x57, 0xbc, 0x00, 0x77, 0x41, 0x72, 0xfe, 0xdf, 0xf2, 0x8e, 0x65, 0xb9,
+  0x6d, 0x1b, 0x78, 0x96, 0xbf, 0x82, 0xbd, 0xd4, 0xb2, 0xf5, 0xa8, 0x23,
+  0xdd, 0x6a, 0x3b, 0x99, 0x4c, 0xfa, 0x98, 0x9c, 0x92, 0x99, 0x36, 0x53,
+  0xcb, 0x33, 0x3d, 0xc8, 0x12, 0x65, 0x6b, 0x2c, 0x8b, 0x7a, 0x5b, 0xe4,
+  0xd8, 0xff, 0xde, 0x7d, 0x01, 0xbb, 0x20, 0x29, 0x85, 0x71, 0xe3, 0x26,
+  0x69, 0x0e, 0x89, 0x6d, 0x10, 0x0b, 0x60, 0x17, 0xc0, 0x02, 0xd8, 0x67,
+  0xcc, 0x36, 0xaa, 0xfd, 0xe9, 0x30, 0xba, 0x4e, 0xf0, 0xfa, 0x90, 0x00,
+  0x6d, 0x01, 0x7c, 0x02, 0xdb, 0x13, 0x9f, 0xa6, 0x35, 0xb3, 0x55, 0x3c,
+  0xbd, 0x78, 0xaf, 0xb4, 0x3c, 0xbd, 0x78, 0x87, 0xb4, 0x3c, 0xbd, 0x78,
+  0x5f, 0xb4, 0x3c, 0xbd, 0x78, 0x37, 0xb4, 0x94, 0x5e, 0xa5, 0xe4, 0x92,
+  0x65, 0xdf, 0x32, 0xe4, 0x92, 0x05, 0xdf, 0x32, 0xe4, 0x7a, 0x0c, 0x1b,
+  0xc8, 0x13, 0x4b, 0x16, 0x78, 0xcb, 0x10, 0x2b, 0x0c, 0xaf, 0xf4, 0x22,
+  0x08, 0xac, 0xf4, 0x07, 0x22, 0x87, 0xd4, 0x48, 0xe1, 0x59, 0x3f, 0xbd,
+  0xfe, 0x5f, 0xad, 0x0e, 0xce, 0x68, 0x83, 0x4b, 0x62, 0x88, 0xd7, 0xa5,
+  0xfb, 0x31, 0x30, 0x51, 0x12, 0x5e, 0x98, 0x9d, 0x76, 0x7f, 0x13, 0x4f,
+  0xf1, 0x9e, 0x34, 0x89, 0xf1, 0x56, 0x84, 0xd5, 0x68, 0x4b, 0x62, 0xea,
+  0x1b, 0x74, 0x73, 0x45, 0x6f, 0xe4, 0xf5, 0xca, 0x35, 0xf6, 0x76, 0x04,
+  0xeb, 0x24, 0x0a, 0xc4, 0x65, 0xb8, 0xac, 0x56, 0x49, 0x12, 0x2d, 0x61,
+  0x4c, 0x13, 0x5a, 0x45, 0xc3, 0x18, 0x13, 0x9e, 0x2d, 0x71, 0xaf, 0xc3,
+  0x32, 0x42, 0xb7, 0xe5, 0xc1, 0x7a, 0x41, 0x11, 0x13, 0x56, 0x8b, 0x3e,
+  0x2e, 0x3b, 0xf1, 0xaa, 0xc3, 0xcb, 0xdc, 0x78, 0xe1, 0x16, 0x6d, 0x6e,
+  0x84, 0x38, 0xb6, 0xb6, 0xe2, 0xcd, 0x5b, 0x1e, 0xf7, 0xff, 0xc3, 0x83,
+  0xe3, 0x06, 0xc8, 0x00, 0x8e, 0xa2, 0x2b, 0xe8, 0xeb, 0xf6, 0x54, 0x6b,
+  0xe2, 0x54, 0x9d, 0x09, 0x3b, 0x38, 0x92, 0xf0, 0xb8, 0x2f, 0xd0, 0xc6,
+  0xfb, 0xc4, 0x57, 0xe6, 0x93, 0x49, 0x03, 0xda, 0x1b, 0xd8, 0x8e, 0xc0,
+  0x76, 0x3c, 0x6c, 0xa7, 0x32, 0x6c, 0x57, 0x60, 0xbb, 0x1e, 0xb6, 0xbb,
+  0x1f, 0x56, 0xa7, 0x08, 0x8f, 0xb9, 0x68, 0x79, 0x3b, 0x9e, 0xd9, 0xe9,
+  0x81, 0x36, 0xc6, 0x24, 0x13, 0x9a, 0x00, 0x34, 0x9c, 0xb5, 0xa3, 0xf5,
+  0x04, 0x66, 0x63, 0x80, 0x59, 0xb8, 0x38, 0xf7, 0x9c, 0x66, 0xff, 0xc2,
+  0x68, 0xea, 0x48, 0x95, 0x97, 0x61, 0xee, 0x2f, 0x5b, 0x05, 0x03, 0xa9,
+  0xa7, 0xfb, 0xab, 0xbc, 0x1d, 0x3a, 0x21, 0xec, 0x05, 0xdc, 0x74, 0x05,
+  0xea, 0x38, 0x0c, 0x9f, 0xa8, 0x20, 0x72, 0xd3, 0xa3, 0xa5, 0xce, 0xc7,
+  0xbc, 0x62, 0x34, 0xea, 0x2f, 0x60, 0xde, 0x61, 0x3d, 0xb1, 0x39, 0x36,
+  0x2c, 0x03, 0x46, 0x69, 0x30, 0x49, 0x96, 0xc0, 0xf4, 0x57, 0x37, 0xfd,
+  0x29, 0xff, 0x6e, 0xab, 0x24, 0x6b, 0x3a, 0x18, 0x5e, 0x99, 0xd5, 0xae,
+  0x49, 0x2b, 0xdc, 0x00, 0xff, 0xe6, 0x75, 0x90, 0x15, 0x32, 0x12, 0xf0,
+  0xc1, 0x13, 0x0f, 0xd1, 0x55, 0x7e, 0x98, 0x00, 0xf3, 0x1b, 0xc6, 0xa3,
+  0x18, 0x96, 0xdd, 0x90, 0x5d, 0x31, 0x5e, 0x29, 0xaa, 0x23, 0x89, 0xde,
+  0x68, 0xe3, 0x22, 0xfa, 0xe6, 0xcd, 0x8c, 0x4a, 0xc5, 0x1f, 0x0b, 0xf9,
+  0xdd, 0x8e, 0xb8, 0x49, 0x22, 0x88, 0x0c, 0xf2, 0xa2, 0xe9, 0xe8, 0x25,
+  0x86, 0x13, 0xa5, 0x8d, 0x63, 0xa7, 0xae, 0x51, 0x14, 0x4e, 0x87, 0xf9,
+  0x33, 0x1e, 0x8a, 0x1d, 0x29, 0x6a, 0xe2, 0x46, 0xc3, 0x0f, 0x9a, 0x96,
+  0x79, 0xd0, 0x78, 0xbc, 0xbc, 0xc7, 0x05, 0x72, 0x2f, 0x9c, 0xea, 0xe3,
+  0x30, 0x54, 0xa8, 0x6b, 0xe9, 0xf5, 0x60, 0x10, 0xcf, 0x56, 0xb0, 0xef,
+  0x13, 0xe0, 0x86, 0x72, 0x42, 0x20, 0x0f, 0x28, 0x2e, 0x2f, 0xbf, 0x9f,
+  0xe8, 0xfc, 0xc4, 0x3b, 0xb5, 0x3d, 0x5f, 0xf1, 0x7e, 0x6b, 0xcf, 0x57,
+  0xbc, 0x6b, 0x86, 0xfe, 0xc1, 0xf2, 0x00, 0x70, 0x2b, 0x04, 0xfe, 0x12,
+  0x26, 0x57, 0x3a, 0xaf, 0x56, 0xff, 0x50, 0x56, 0xa1, 0xc9, 0xed, 0x79,
+  0xd7, 0x3e, 0xba, 0xd5, 0x91, 0xde, 0x02, 0x86, 0x78, 0x6a, 0xcb, 0xe8,
+  0x26, 0x78, 0xd5, 0x09, 0xca, 0x64, 0x20, 0x21, 0x30, 0x89, 0xb4, 0x52,
+  0x16, 0x69, 0xed, 0x64, 0xd2, 0x35, 0xac, 0x47, 0xd0, 0xab, 0xf5, 0xa9,
+  0x16, 0x6d, 0xb8, 0x68, 0x93, 0xf7, 0x34, 0xe4, 0x96, 0xa7, 0x59, 0xbe,
+  0xcd, 0x02, 0xd7, 0xae, 0x61, 0x2d, 0x6a, 0xc4, 0xef, 0x1c, 0xef, 0xd4,
+  0x6b, 0x43, 0x64, 0xa6, 0x12, 0x23, 0x13, 0x5d, 0x5a, 0xe6, 0xf4, 0xd3,
+  0x7a, 0xa9, 0x48, 0x87, 0xf4, 0x7a, 0x1b, 0xa4, 0x8e, 0x0e, 0x52, 0x48,
+  0x84, 0x48, 0x3b, 0x61, 0x21, 0xf5, 0x99, 0xfa, 0x2e, 0xa5, 0x54, 0x71,
+  0x93, 0xbf, 0x1d, 0x51, 0x76, 0x51, 0xa5, 0x86, 0x30, 0xd4, 0x94, 0x82,
+  0x62, 0xd9, 0x86, 0xcb, 0x3c, 0x5d, 0x3c, 0x61, 0xa4, 0x61, 0x4f, 0x99,
+  0x7d, 0xa4, 0xa9, 0x61, 0x3d, 0x6a, 0x48, 0x69, 0xa3, 0x0d, 0x19, 0xe2,
+  0x6c, 0x85, 0x38, 0x5b, 0x21, 0xce, 0x36, 0x47, 0x1c, 0x56, 0xae, 0x63,
+  0x4b, 0x5b, 0x6d, 0x88, 0x7b, 0x46, 0x37, 0x17, 0x1f, 0x67, 0xd5, 0xfb,
+  0x9f, 0x59, 0x58, 0x71, 0x01, 0xab, 0x87, 0xd9, 0x23, 0xd5, 0xad, 0x2c,
+  0x6b, 0x12, 0xe1, 0xe8, 0xff, 0x4d, 0x93, 0x70, 0x2b, 0xba, 0xee, 0x68,
+  0xaf, 0x8f, 0x06, 0x3b, 0xba, 0x4e, 0xb8, 0x27, 0x86, 0x94, 0x75, 0xb8,
+  0xcc, 0x19, 0x99, 0x50, 0x19, 0x9d, 0xeb, 0xfe, 0xf1, 0xb0, 0x77, 0x3e,
+  0x78, 0x42, 0x1a, 0xe7, 0xe6, 0xb5, 0xa0, 0x73, 0xd2, 0x38, 0x37, 0x6f,
+  0x85, 0xdc, 0x68, 0xf6, 0xcd, 0x03, 0x4f, 0x04, 0x42, 0x4f, 0xb3, 0x72,
+  0x68, 0xe7, 0x03, 0xd5, 0x28, 0xce, 0x13, 0xee, 0x4e, 0x04, 0xdd, 0x2a,
+  0x9a, 0xb8, 0x39, 0xa9, 0x48, 0xb1, 0xc4, 0xbd, 0xc9, 0x48, 0xa6, 0xbe,
+  0x89, 0x9d, 0x6b, 0x2e, 0x55, 0x14, 0xd3, 0x53, 0x53, 0xea, 0x31, 0x4c,
+  0x8b, 0xc3, 0xd8, 0xbb, 0xce, 0x52, 0x45, 0xaf, 0x04, 0x74, 0x87, 0x83,
+  0x57, 0x21, 0xf8, 0x83, 0x89, 0xe4, 0xf0, 0x1e, 0x8e, 0x3e, 0x98, 0x78,
+  0x65, 0xa5, 0xaa, 0xae, 0xfc, 0x64, 0xa6, 0x45, 0x4f, 0xd8, 0xab, 0xee,
+  0xb7, 0xc9, 0xc8, 0x9e, 0x9b, 0x8f, 0x11, 0x71, 0xd2, 0xee, 0xf7, 0xcc,
+  0xdc, 0xa8, 0x93, 0x3a, 0x51, 0xed, 0x81, 0xc8, 0xf4, 0x40, 0x74, 0x39,
+  0x72, 0x62, 0x19, 0xb3, 0x8f, 0x4b, 0xf9, 0x60, 0x65, 0x46, 0xf8, 0x99,
+  0x39, 0xa1, 0x61, 0x1f, 0x4f, 0x61, 0x8a, 0x5d, 0x2e, 0xeb, 0xbe, 0xf8,
+  0xde, 0x18, 0x25, 0x23, 0xbe, 0x55, 0xc4, 0xbf, 0x6d, 0xde, 0x19, 0x4a,
+  0x30, 0x5e, 0x0f, 0x37, 0xe8, 0xf5, 0x86, 0xf7, 0xf7, 0x29, 0x26, 0xc3,
+  0x5e, 0x24, 0xf7, 0x28, 0xac, 0xf7, 0x82, 0x41, 0xf7, 0x08, 0x9f, 0x1b,
+  0xa1, 0xb0, 0x7b, 0x88, 0xcf, 0x8d, 0x90, 0xd6, 0x3d, 0xc6, 0xe7, 0x46,
+  0x68, 0xea, 0x1e, 0xe4, 0x73, 0x2b, 0x82, 0x2c, 0xa7, 0x94, 0x7b, 0x93,
+  0xcf, 0x9d, 0xda, 0xc9, 0xbd, 0xe8, 0x99, 0x4e, 0x73, 0xa7, 0x3a, 0xaa,
+  0x24, 0x8b, 0x70, 0x2f, 0xf3, 0xb9, 0xd3, 0x10, 0xe4, 0xa2, 0xf6, 0x3e,
+  0x4a, 0xd6, 0x59, 0xbc, 0x7f, 0xa3, 0x05, 0x24, 0xbe, 0x99, 0x91, 0x5a,
+  0x4d, 0x7a, 0x36, 0xeb, 0x43, 0x8d, 0x53, 0x3e, 0xdf, 0xf4, 0xf1, 0xa9,
+  0x8d, 0x26, 0x34, 0x59, 0xbc, 0x48, 0xda, 0xd1, 0x5b, 0x78, 0x33, 0x2d,
+  0xd0, 0x15, 0x1e, 0x0a, 0x29, 0x32, 0x3b, 0xab, 0x1b, 0xa8, 0xc9, 0x0f,
+  0xf4, 0xfe, 0xe6, 0xc0, 0x03, 0xf4, 0x2a, 0xe7, 0xd8, 0x03, 0x58, 0x35,
+  0xd4, 0x10, 0xb1, 0x86, 0x82, 0xbe, 0x12, 0x20, 0xc6, 0xa6, 0x60, 0x71,
+  0x2b, 0x3c, 0x44, 0xfb, 0x83, 0x01, 0x39, 0xd2, 0x5e, 0x47, 0x24, 0x15,
+  0x92, 0xb8, 0x0c, 0x38, 0x42, 0x0a, 0xff, 0x98, 0x73, 0x71, 0xa6, 0x04,
+  0x31, 0xde, 0xbd, 0x39, 0x1f, 0xf4, 0xc0, 0x19, 0x6b, 0x96, 0x78, 0x35,
+  0xff, 0x45, 0x92, 0x19, 0x44, 0x99, 0x44, 0x12, 0x77, 0x98, 0x53, 0x1a,
+  0x7a, 0x8f, 0xa7, 0xe8, 0xf3, 0xd8, 0x34, 0x99, 0x2c, 0x94, 0x02, 0x03,
+  0x78, 0x42, 0x5e, 0xf3, 0x6b, 0xef, 0xa4, 0xed, 0x23, 0x34, 0xfa, 0x8c,
+  0xd4, 0x62, 0xfb, 0x6a, 0x32, 0x54, 0xb3, 0xe1, 0xa2, 0x7b, 0x7c, 0xb8,
+  0x1c, 0xda, 0x27, 0xa6, 0x68, 0x47, 0x06, 0x6d, 0x8a, 0x05, 0x50, 0x31,
+  0x6d, 0xa4, 0xea, 0x67, 0x2a, 0x39, 0x6a, 0xe7, 0xfc, 0xb4, 0x77, 0xba,
+  0x69, 0x87, 0x5e, 0xda, 0x81, 0x2f, 0x36, 0xe5, 0x92, 0xe9, 0x4f, 0x46,
+  0x3a, 0x6d, 0x61, 0x3a, 0x90, 0x7a, 0xc9, 0xb4, 0x89, 0x09, 0xc8, 0xb1,
+  0x71, 0x66, 0xf9, 0x4f, 0x5c, 0xba, 0x3f, 0xe6, 0xa9, 0xfd, 0x25, 0x1c,
+  0xb5, 0xbf, 0x88, 0xbb, 0xf5, 0x17, 0x31, 0x34, 0x0e, 0xcc, 0x47, 0xf7,
+  0x5b, 0x8f, 0xb2, 0x53, 0x74, 0x33, 0x67, 0xf0, 0xb3, 0xc7, 0x02, 0xb4,
+  0xb2, 0x01, 0xe8, 0x33, 0x18, 0x7f, 0x3e, 0xab, 0xe1, 0xe7, 0x33, 0x18,
+  0x7d, 0x3e, 0xc9, 0xe0, 0x33, 0x10, 0xb9, 0x95, 0x0f, 0x18, 0x4d, 0x9f,
+  0xb3, 0xa7, 0x0c, 0x98, 0xd5, 0xdf, 0xda, 0x68, 0xe5, 0x86, 0xbe, 0x6a,
+  0x3b, 0xd4, 0xdf, 0xe1, 0xee, 0xe1, 0x4e, 0x94, 0xc3, 0x65, 0xb4, 0x9e,
+  0x8e, 0x57, 0xd1, 0x86, 0xdc, 0xd2, 0xf8, 0x38, 0x5c, 0x24, 0xcb, 0xa5,
+  0x14, 0x38, 0xad, 0x23, 0xbb, 0xdf, 0x49, 0xd3, 0xe2, 0xca, 0xef, 0x2c,
+  0x34, 0xc5, 0xc4, 0xa1, 0x61, 0xec, 0xd9, 0xb6, 0x62, 0xf4, 0x20, 0xe0,
+  0xd8, 0xc3, 0x05, 0xab, 0xee, 0xf1, 0xcb, 0x4f, 0xae, 0xbd, 0xa0, 0x42,
+  0x8f, 0x2b, 0xa4, 0x3b, 0x2b, 0x5c, 0x8a, 0x65, 0x56, 0x69, 0x05, 0xa2,
+  0xfc, 0x45, 0x93, 0x7f, 0xf6, 0xe4, 0xe7, 0xa5, 0xff, 0x8a, 0x5f, 0xb0,
+  0x94, 0x4a, 0x08, 0x41, 0xf6, 0xc3, 0xe3, 0x84, 0x7a, 0x34, 0xbe, 0x26,
+  0x8f, 0xa2, 0x29, 0x7d, 0x1d, 0xe5, 0x6b, 0xd2, 0xef, 0x75, 0xd4, 0xfd,
+  0xdc, 0x72, 0x49, 0xb1, 0x4a, 0xe0, 0xc3, 0x75, 0xe0, 0xd5, 0x2a, 0x32,
+  0xd6, 0x97, 0xd1, 0x89, 0xd1, 0x04, 0xf2, 0x24, 0xc0, 0x51, 0x4e, 0x23,
+  0x25, 0x79, 0x3e, 0xe3, 0xc0, 0xd6, 0xe8, 0x0d, 0x87, 0xe1, 0x31, 0x8f,
+  0xee, 0xd4, 0x57, 0xe8, 0xb1, 0x11, 0x7b, 0xae, 0x42, 0x4f, 0x2b, 0x20,
+  0x9d, 0xb2, 0x42, 0x85, 0x4b, 0x3e, 0xae, 0x7d, 0x1f, 0x75, 0x21, 0x59,
+  0x85, 0xa5, 0x6c, 0x7b, 0x16, 0xb0, 0x5e, 0x45, 0xb0, 0x4b, 0x05, 0xb9,
+  0xac, 0xb6, 0x69, 0x88, 0x13, 0x63, 0x0a, 0x37, 0x56, 0xc1, 0xa0, 0xd6,
+  0x43, 0x7e, 0xa3, 0x5b, 0x55, 0x3e, 0x45, 0x4e, 0x2b, 0x38, 0xe1, 0x29,
+  0x5f, 0xce, 0x79, 0x94, 0x2b, 0x6b, 0x34, 0xc6, 0x81, 0x5e, 0xeb, 0x4d,
+  0x72, 0x37, 0x5b, 0xaf, 0xcc, 0xad, 0x8a, 0x46, 0xb0, 0x6c, 0x1f, 0xd4,
+  0x6a, 0xc1, 0xfe, 0xe0, 0xe2, 0x28, 0x61, 0x4d, 0x8d, 0xec, 0x90, 0xd5,
+  0x4d, 0x7f, 0xc5, 0x5b, 0x24, 0x5e, 0xba, 0xd8, 0xb3, 0xd4, 0x88, 0xdf,
+  0x30, 0x80, 0xf6, 0x45, 0xe1, 0xaa, 0xe1, 0x89, 0x6d, 0xd7, 0x0b, 0x9e,
+  0xc5, 0x1a, 0xdc, 0xbd, 0x36, 0xeb, 0x95, 0x83, 0xf5, 0x72, 0x60, 0xa9,
+  0x82, 0xb9, 0x21, 0xc3, 0x65, 0x89, 0xaf, 0x50, 0xa8, 0xc9, 0xdc, 0x90,
+  0x1e, 0x21, 0xa6, 0x7d, 0xdf, 0x46, 0xbb, 0x6e, 0xd2, 0x05, 0xa8, 0xdc,
+  0x5a, 0xd8, 0x0f, 0xbc, 0x84, 0x61, 0xa0, 0x70, 0x7d, 0x12, 0x4e, 0x73,
+  0x66, 0xff, 0x4e, 0xf9, 0x7b, 0xef, 0xc0, 0xc5, 0x78, 0x14, 0x26, 0x82,
+  0x95, 0x7a, 0x1c, 0x04, 0xbd, 0x56, 0xd4, 0x32, 0xfc, 0x36, 0x06, 0xfe,
+  0xa1, 0xab, 0x1a, 0x65, 0xf2, 0x74, 0xdd, 0x11, 0x41, 0x4f, 0x41, 0x31,
+  0x03, 0xfd, 0x7d, 0x4c, 0x31, 0x03, 0xbd, 0xfd, 0x7b, 0xc5, 0x8c, 0x9d,
+  0xf9, 0xfe, 0x22, 0xd6, 0xd9, 0x95, 0xb0, 0xc1, 0x7c, 0xf7, 0xcb, 0x18,
+  0xbe, 0xfd, 0x44, 0x2d, 0xcb, 0xe7, 0x10, 0xdd, 0x7f, 0x4d, 0x5a, 0x98,
+  0x4f, 0x52, 0xc2, 0x50, 0xd6, 0x45, 0x79, 0x63, 0xe5, 0xb5, 0x2e, 0x33,
+  0x9c, 0x9a, 0x59, 0xaf, 0x54, 0xeb, 0x42, 0x88, 0x00, 0x9b, 0xd8, 0x25,
+  0x67, 0xa9, 0x22, 0x62, 0x99, 0x5d, 0xee, 0x8e, 0x23, 0xe7, 0xd0, 0x7d,
+  0xd4, 0x27, 0x69, 0xab, 0xa5, 0x21, 0x75, 0x1e, 0x4b, 0x83, 0x93, 0xed,
+  0x20, 0x9c, 0x06, 0x26, 0xcb, 0x3c, 0x6e, 0xb2, 0xf4, 0x4c, 0xde, 0x3f,
+  0xbb, 0x0c, 0xb5, 0xf0, 0x38, 0x9f, 0x9c, 0x8e, 0x8e, 0x25, 0xdf, 0x4c,
+  0x56, 0x92, 0xa7, 0x20, 0xdb, 0x69, 0xeb, 0x13, 0x24, 0x24, 0xa4, 0x86,
+  0x4c, 0x55, 0x05, 0x2b, 0x8f, 0x02, 0x76, 0xc2, 0x21, 0xc0, 0xb4, 0x8d,
+  0x7d, 0x71, 0xc0, 0x4e, 0x38, 0x08, 0x98, 0xa9, 0x1c, 0x4a, 0xda, 0xfc,
+  0xa4, 0x65, 0x5e, 0x86, 0x53, 0x48, 0xcb, 0xe6, 0xe2, 0x85, 0xcd, 0xc2,
+  0x2a, 0x7b, 0x92, 0x96, 0x7d, 0x14, 0xe0, 0xfa, 0x53, 0x01, 0xae, 0x2a,
+  0x01, 0x38, 0x87, 0x32, 0x59, 0x28, 0x99, 0xca, 0x69, 0x32, 0x15, 0xd4,
+  0x20, 0xa3, 0xd6, 0x0f, 0xb3, 0xfd, 0xe1, 0xcd, 0x6c, 0x9e, 0x55, 0xbb,
+  0x80, 0x58, 0xb9, 0xe8, 0x62, 0xa6, 0x95, 0x4e, 0x50, 0x98, 0x8a, 0xaf,
+  0xc2, 0x24, 0x85, 0x3c, 0x2f, 0x37, 0x51, 0xca, 0xce, 0xec, 0x9e, 0x07,
+  0xac, 0xcb, 0xb8, 0x87, 0xb7, 0x9e, 0x30, 0x9b, 0x01, 0xd3, 0x85, 0xfa,
+  0xc0, 0x04, 0x65, 0x0d, 0x95, 0xe5, 0xce, 0xf3, 0x02, 0x2d, 0xae, 0xe4,
+  0x04, 0x7c, 0x56, 0xc8, 0x83, 0xf9, 0x40, 0xf7, 0xc7, 0x47, 0x46, 0x0f,
+  0x42, 0x17, 0xca, 0x90, 0xc7, 0x46, 0x12, 0x65, 0xc2, 0x16, 0xdb, 0xc3,
+  0xf3, 0x46, 0x63, 0x26, 0xdb, 0xda, 0x91, 0x44, 0x4c, 0x66, 0x84, 0x5c,
+  0xa6, 0x0a, 0x2a, 0x83, 0x13, 0x8d, 0x7e, 0x91, 0xdc, 0x91, 0x67, 0xe7,
+  0xec, 0xed, 0xc2, 0x65, 0x22, 0xb5, 0xa0, 0xc2, 0x7c, 0xbe, 0x0f, 0xd6,
+  0xfc, 0x52, 0xe7, 0x3b, 0x42, 0x98, 0xbb, 0x8f, 0xd1, 0x30, 0x19, 0xac,
+  0x29, 0x5b, 0x2f, 0x1a, 0x7d, 0xac, 0xe2, 0x5f, 0x59, 0xde, 0x51, 0x8f,
+  0x0e, 0xb9, 0xc6, 0xa1, 0xb5, 0x5b, 0x35, 0x69, 0x02, 0xed, 0xb8, 0x5e,
+  0x86, 0x23, 0x7a, 0x15, 0x7c, 0xfc, 0x39, 0xf8, 0x88, 0x53, 0x23, 0x2d,
+  0x48, 0xc0, 0x66, 0x3c, 0x78, 0x50, 0x5e, 0xf8, 0x1e, 0xbd, 0xca, 0xde,
+  0x8d, 0xfe, 0xbc, 0x4f, 0xea, 0xdc, 0xc7, 0x51, 0x1e, 0x13, 0x69, 0xf0,
+  0x87, 0x73, 0xfe, 0x0e, 0x84, 0x08, 0xe5, 0x37, 0xee, 0x43, 0x88, 0xa2,
+  0xcf, 0xbb, 0xb9, 0x14, 0x56, 0x54, 0xc8, 0xb8, 0xb9, 0x74, 0x1e, 0x6b,
+  0x1e, 0x47, 0xb8, 0x69, 0x78, 0x76, 0x86, 0xa9, 0x00, 0xdf, 0x70, 0xfe,
+  0x3f, 0x20, 0x4a, 0x67, 0x78, 0x28, 0x37, 0xea, 0xd5, 0xb6, 0xed, 0x63,
+  0x44, 0xba, 0x7c, 0x80, 0xe2, 0x35, 0xa7, 0x39, 0x5b, 0xa1, 0x12, 0x9e,
+  0x39, 0x12, 0x27, 0x9b, 0x08, 0xd1, 0x2c, 0xad, 0xeb, 0x7c, 0x6f, 0xee,
+  0xae, 0x7f, 0x91, 0x24, 0x9c, 0x00, 0x5a, 0x96, 0x80, 0xb3, 0x00, 0x46,
+  0x0b, 0xcb, 0xe7, 0xdd, 0x24, 0x70, 0x9f, 0x4c, 0x85, 0xbe, 0xe5, 0xf1,
+  0xa7, 0xc2, 0x1c, 0xf2, 0x52, 0xba, 0x5c, 0x0c, 0x3e, 0x2c, 0x26, 0x7e,
+  0x76, 0xe1, 0x4f, 0x97, 0x0c, 0x17, 0xfe, 0xfd, 0x03, 0xb5, 0xfa, 0x38,
+  0xba, 0x93, 0x92, 0x00, 0x00
+};
+unsigned int SoftwareRenderer_js_gz_len = 8321;
@@ -0,0 +1,495 @@
+#pragma once
+
+unsigned char licenses_txt_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5b,
+  0xdb, 0x92, 0xdb, 0x48, 0x72, 0x7d, 0x1e, 0x7c, 0x45, 0x45, 0x3f, 0x78,
+  0xd4, 0x11, 0x68, 0x4a, 0x6a, 0xcd, 0x65, 0x57, 0x63, 0x39, 0x82, 0xea,
+  0xa6, 0x24, 0xce, 0xb0, 0x2f, 0x26, 0x5b, 0xab, 0x9d, 0x70, 0xf8, 0x01,
+  0x04, 0x8a, 0x64, 0x49, 0x20, 0xc0, 0x41, 0x01, 0x4d, 0xf5, 0x3c, 0xf9,
+  0x37, 0xfc, 0x09, 0xfe, 0x0d, 0x7f, 0x8a, 0xbf, 0xc4, 0x27, 0x33, 0xab,
+  0x80, 0x02, 0xc8, 0xd6, 0xcc, 0x78, 0x23, 0xf6, 0xc1, 0xb1, 0x13, 0xbb,
+  0x92, 0x9a, 0xac, 0xca, 0xca, 0xca, 0xcb, 0xc9, 0x5b, 0xf5, 0xab, 0x57,
+  0xaf, 0xd4, 0x9b, 0x4a, 0xeb, 0xd9, 0x62, 0xa1, 0x5e, 0xbd, 0x7a, 0x15,
+  0xa9, 0x63, 0xff, 0xf9, 0x05, 0x17, 0xe5, 0x76, 0xab, 0xab, 0xd4, 0x24,
+  0xb9, 0x9a, 0x99, 0x54, 0x17, 0x56, 0xab, 0x33, 0x75, 0xa7, 0xab, 0xad,
+  0x55, 0x49, 0x91, 0xa9, 0xb4, 0x2c, 0x32, 0x53, 0x9b, 0xb2, 0xb0, 0xd1,
+  0xf3, 0x91, 0xba, 0xad, 0x74, 0xb2, 0x5d, 0xe6, 0xfa, 0xa5, 0xba, 0xdb,
+  0x18, 0xab, 0xc6, 0x6b, 0x10, 0xd9, 0xea, 0xa2, 0x8e, 0x95, 0x35, 0xeb,
+  0x42, 0x67, 0xaa, 0x2c, 0xd4, 0x55, 0x52, 0xa9, 0xf3, 0x3f, 0xc5, 0xea,
+  0xfc, 0xd9, 0xf3, 0xef, 0xd4, 0x93, 0x8d, 0xae, 0xb4, 0x29, 0x92, 0x55,
+  0xad, 0xab, 0x97, 0x6a, 0xb2, 0x5a, 0xe9, 0xb4, 0x36, 0xf7, 0x5a, 0x5d,
+  0x26, 0xb5, 0x3e, 0x55, 0xd1, 0x57, 0xeb, 0xf2, 0x5e, 0x57, 0x85, 0x55,
+  0xf5, 0x46, 0xab, 0x4a, 0xe7, 0x09, 0x9f, 0xb4, 0x31, 0x3b, 0xb5, 0xd4,
+  0xf5, 0x5e, 0xeb, 0x82, 0xbf, 0x78, 0xbf, 0x98, 0xcc, 0x63, 0x95, 0x0c,
+  0x88, 0x39, 0x6e, 0x41, 0x86, 0xf8, 0xbc, 0x6a, 0xaa, 0x72, 0x59, 0xaa,
+  0xd9, 0xec, 0x22, 0x06, 0xd9, 0x44, 0x65, 0x4d, 0xfe, 0x00, 0x8a, 0x6b,
+  0x63, 0xb1, 0x58, 0xd3, 0x3d, 0xb6, 0xbb, 0xa4, 0x78, 0x50, 0xa6, 0x50,
+  0xfb, 0x4d, 0x89, 0x4b, 0xee, 0x2a, 0x53, 0xa4, 0x66, 0x87, 0x6b, 0xef,
+  0xf2, 0x24, 0xd5, 0xaa, 0x5c, 0xa9, 0x65, 0x63, 0x4d, 0xa1, 0xad, 0x55,
+  0xb8, 0x1a, 0xd6, 0x4d, 0x8b, 0x4c, 0xef, 0x34, 0xfe, 0x28, 0x52, 0x1d,
+  0xab, 0x9f, 0x70, 0xcd, 0x26, 0xfd, 0xf4, 0x70, 0x94, 0x8b, 0xb2, 0x3a,
+  0x1d, 0xe1, 0xd8, 0xbe, 0x50, 0x94, 0xd5, 0xb5, 0xdc, 0xac, 0x26, 0x71,
+  0xc6, 0xaa, 0x32, 0xeb, 0x4d, 0x4d, 0x7f, 0x6b, 0x5b, 0x57, 0x26, 0xe5,
+  0xbb, 0x32, 0xf3, 0xe5, 0x32, 0x37, 0x6b, 0xb9, 0x3b, 0x49, 0x90, 0xd8,
+  0x58, 0x83, 0xdc, 0x11, 0x15, 0xf5, 0x0f, 0xbf, 0x03, 0xed, 0x45, 0xb9,
+  0xaa, 0xf7, 0x49, 0x05, 0x31, 0xa4, 0x50, 0x4e, 0x8d, 0xab, 0x32, 0xc5,
+  0x3d, 0x69, 0x63, 0xf9, 0xd0, 0xf2, 0x07, 0xf9, 0x59, 0x95, 0xe9, 0x3a,
+  0x31, 0x39, 0xbe, 0x10, 0x2a, 0x51, 0x74, 0x3e, 0x6a, 0x95, 0xfe, 0xb6,
+  0x4a, 0x8a, 0xba, 0xbb, 0x0f, 0x2f, 0xc1, 0xfe, 0x35, 0x7d, 0x6c, 0x5b,
+  0x61, 0x43, 0x0b, 0xb7, 0xba, 0xb2, 0x65, 0x91, 0xe4, 0xb1, 0xba, 0x2e,
+  0x8b, 0xb3, 0xc4, 0x92, 0xe6, 0x13, 0xd8, 0x84, 0xfa, 0x27, 0x55, 0xe0,
+  0x83, 0x1a, 0x1b, 0xec, 0x4a, 0x57, 0xf4, 0x11, 0xa9, 0x02, 0xcb, 0x77,
+  0xba, 0x6e, 0x68, 0x7d, 0x77, 0x8f, 0x58, 0xcd, 0xcb, 0x87, 0x24, 0xaf,
+  0x1f, 0xd4, 0x0a, 0x77, 0x8c, 0xd5, 0x07, 0x53, 0x6f, 0xca, 0xa6, 0x16,
+  0x33, 0x60, 0x29, 0xa9, 0xba, 0x74, 0x17, 0x02, 0xd7, 0x95, 0xb9, 0x4f,
+  0xd8, 0x6c, 0xf6, 0x65, 0xf5, 0xc9, 0xca, 0xc1, 0xfa, 0x73, 0x9a, 0x43,
+  0x50, 0xf8, 0x30, 0xfa, 0x2a, 0x17, 0xee, 0x70, 0xc7, 0x3c, 0x57, 0x7b,
+  0xd0, 0x52, 0x49, 0x9a, 0x96, 0x55, 0x96, 0x40, 0x73, 0xf2, 0x73, 0xab,
+  0x05, 0x52, 0x8a, 0x5a, 0x95, 0x15, 0xad, 0x21, 0x39, 0xe1, 0x8b, 0x4a,
+  0xe5, 0x7a, 0x0d, 0xd9, 0xf6, 0xd4, 0xd2, 0x2d, 0x83, 0x25, 0x44, 0x5f,
+  0xbd, 0xa8, 0x32, 0xb5, 0x4b, 0x2a, 0x30, 0x6c, 0x9d, 0xbc, 0xa1, 0x25,
+  0x08, 0x72, 0xbf, 0x81, 0x3c, 0x55, 0xd5, 0x14, 0x05, 0xa9, 0xcc, 0xeb,
+  0x62, 0x14, 0x7d, 0x75, 0x3e, 0x7a, 0x0e, 0xa1, 0x6d, 0x0d, 0x14, 0xd2,
+  0x99, 0xaa, 0xda, 0x26, 0x0f, 0xb4, 0xaf, 0x5d, 0x48, 0x47, 0x30, 0x6f,
+  0xbb, 0xa6, 0xda, 0x91, 0x55, 0x96, 0xab, 0x97, 0xad, 0xbb, 0xce, 0x07,
+  0x54, 0xc9, 0x34, 0xca, 0x82, 0x88, 0xa4, 0x1b, 0xd8, 0x29, 0x59, 0x2c,
+  0x6d, 0xf5, 0xc4, 0x7f, 0x68, 0x37, 0x8e, 0xf3, 0xbc, 0xdc, 0xd3, 0x4e,
+  0xe2, 0xfa, 0x16, 0x5c, 0x1b, 0xcd, 0xf2, 0x04, 0x9b, 0x7f, 0x9c, 0xd8,
+  0x6d, 0x03, 0xe3, 0x84, 0x4b, 0x06, 0x8c, 0xfc, 0xcf, 0x7f, 0xfc, 0x27,
+  0xec, 0xb4, 0xa9, 0x77, 0xa4, 0xb1, 0x32, 0xb0, 0x0d, 0x08, 0x34, 0x38,
+  0xb2, 0xa3, 0x71, 0x69, 0x48, 0xb2, 0xcb, 0x06, 0xca, 0x84, 0xbb, 0x2f,
+  0xa1, 0xcb, 0x2d, 0x1c, 0x72, 0x47, 0x6c, 0xe1, 0xdc, 0x63, 0x64, 0x9f,
+  0xc0, 0x39, 0xf3, 0x26, 0xa3, 0x53, 0xc9, 0x73, 0xd9, 0x68, 0x97, 0xb0,
+  0xfb, 0x0a, 0x7b, 0x4e, 0x85, 0xf0, 0xf9, 0xe8, 0x5c, 0x50, 0xc8, 0x69,
+  0x9f, 0xbc, 0x96, 0xad, 0x15, 0x4b, 0x77, 0xde, 0xe8, 0xf2, 0x07, 0x36,
+  0xfc, 0xbc, 0x04, 0x21, 0xfc, 0xfd, 0x50, 0x36, 0x2a, 0x2b, 0x61, 0xa7,
+  0x35, 0x2e, 0x0e, 0x7b, 0x30, 0xb4, 0x42, 0x2d, 0x61, 0x67, 0x29, 0x14,
+  0x5d, 0xb3, 0xde, 0x5e, 0x90, 0x79, 0xa9, 0x71, 0x68, 0xd7, 0x64, 0x6f,
+  0x77, 0x81, 0x5d, 0x0f, 0x34, 0x4a, 0xe4, 0xc4, 0x0f, 0x14, 0xa9, 0xd3,
+  0x2d, 0x54, 0xc4, 0x9b, 0x33, 0x66, 0x92, 0x4c, 0xd6, 0xb0, 0x1e, 0x1a,
+  0x00, 0x0a, 0xe9, 0xbc, 0x63, 0x7c, 0xe4, 0xae, 0xf3, 0xcd, 0x51, 0x07,
+  0x21, 0x10, 0xf8, 0x2d, 0x0b, 0x22, 0x60, 0x73, 0x16, 0x14, 0xab, 0x4e,
+  0x72, 0xbb, 0xc4, 0x64, 0x67, 0x56, 0x57, 0xf7, 0xd8, 0x0c, 0xaf, 0xd9,
+  0x3b, 0x27, 0xa3, 0xd5, 0x15, 0x53, 0x27, 0x7e, 0xf8, 0xf0, 0xe8, 0xc5,
+  0x88, 0x31, 0x1f, 0x77, 0xa5, 0xbf, 0x20, 0x68, 0xf2, 0x02, 0x01, 0x18,
+  0xfe, 0x9c, 0xcd, 0x23, 0x90, 0xb5, 0xdd, 0x90, 0xab, 0x2d, 0xe1, 0x05,
+  0x45, 0x6d, 0x72, 0x76, 0x2d, 0xda, 0xa4, 0xb3, 0x51, 0x87, 0x20, 0xc4,
+  0x6a, 0xfb, 0x05, 0x7c, 0xa8, 0x1e, 0x84, 0x8c, 0x8e, 0x51, 0x7f, 0x3b,
+  0xb6, 0x80, 0x56, 0x9d, 0x02, 0xfe, 0x69, 0x82, 0x7f, 0xef, 0x09, 0x8d,
+  0x3a, 0x21, 0x88, 0x8f, 0xbc, 0x80, 0x8b, 0x2d, 0x75, 0x9a, 0x6c, 0x69,
+  0xad, 0x2d, 0xf3, 0x7b, 0xc2, 0x5c, 0x9c, 0xcb, 0x3e, 0xbd, 0x37, 0xd8,
+  0x86, 0x0f, 0x18, 0xfc, 0x4d, 0x01, 0x33, 0xa5, 0x6b, 0xe7, 0xe6, 0x97,
+  0xc6, 0x64, 0x7c, 0x39, 0x04, 0x80, 0x12, 0x62, 0xb1, 0x3f, 0x60, 0x8b,
+  0x23, 0x77, 0xae, 0xf4, 0xe7, 0x1d, 0x7c, 0x1e, 0x3b, 0x42, 0x64, 0x55,
+  0x6e, 0xf3, 0xc7, 0xa6, 0x32, 0x36, 0x13, 0x80, 0x70, 0x1c, 0xe5, 0xe1,
+  0x5d, 0xc9, 0x0c, 0x74, 0x01, 0x7d, 0x00, 0x74, 0x02, 0xdd, 0x07, 0x0a,
+  0x4f, 0xfc, 0xe5, 0x29, 0xbe, 0x04, 0x07, 0xbf, 0xe8, 0xae, 0xb6, 0x4f,
+  0x38, 0xf6, 0x38, 0x93, 0x84, 0xd8, 0xe9, 0xe4, 0x81, 0xf4, 0xbf, 0xb6,
+  0x0e, 0xcb, 0xfa, 0x01, 0x9a, 0x7f, 0xb4, 0x0d, 0xb6, 0xb9, 0xdd, 0x44,
+  0x8b, 0x98, 0x4a, 0x1b, 0x08, 0x01, 0xf2, 0x86, 0x71, 0x65, 0x06, 0xba,
+  0x80, 0xc9, 0x37, 0x3b, 0xdc, 0x01, 0xdf, 0x99, 0x95, 0x49, 0x59, 0x1c,
+  0x01, 0x37, 0xdf, 0x74, 0xdc, 0x1c, 0xe7, 0xc4, 0x43, 0x29, 0x7e, 0x48,
+  0xf3, 0x84, 0xac, 0xf1, 0x9c, 0x64, 0x14, 0xb2, 0x18, 0x90, 0xfb, 0xb6,
+  0x23, 0xf7, 0x05, 0xcd, 0x24, 0x15, 0xdc, 0x66, 0x2d, 0x71, 0x13, 0xa0,
+  0x8a, 0x13, 0xd3, 0x84, 0x11, 0xb6, 0x35, 0x27, 0x2c, 0x64, 0x7b, 0x63,
+  0x9f, 0xc4, 0x0f, 0x5f, 0x16, 0xf5, 0xcc, 0xfb, 0x56, 0xf4, 0x0d, 0xd2,
+  0x96, 0xe4, 0x81, 0x08, 0xbf, 0x44, 0x48, 0x27, 0x79, 0x59, 0x83, 0x65,
+  0x62, 0x04, 0x7d, 0xd8, 0x6b, 0xf1, 0x43, 0x08, 0xf9, 0xcb, 0xc5, 0xdd,
+  0x0d, 0xc4, 0xee, 0x77, 0x49, 0x17, 0x58, 0x55, 0x42, 0xf7, 0x5c, 0x51,
+  0x14, 0xbb, 0x37, 0x89, 0xba, 0xc0, 0xad, 0x4c, 0x7d, 0x76, 0x91, 0x54,
+  0x90, 0x38, 0xce, 0xbd, 0x45, 0x60, 0x71, 0x1e, 0x2a, 0xb1, 0x66, 0xab,
+  0x93, 0xc2, 0xdd, 0xb0, 0xe7, 0x29, 0x19, 0x2c, 0x43, 0x25, 0x99, 0xfe,
+  0xa5, 0x81, 0x86, 0x46, 0xea, 0x0d, 0x02, 0x75, 0x23, 0xb6, 0x47, 0xf4,
+  0x01, 0x68, 0xb8, 0xed, 0x96, 0x4e, 0x96, 0xd4, 0x82, 0xf9, 0xa0, 0xbb,
+  0xd4, 0x55, 0xa3, 0x09, 0xda, 0x3c, 0x9e, 0x05, 0x0a, 0xeb, 0x3b, 0x1c,
+  0x60, 0x26, 0xfa, 0x76, 0xa4, 0x16, 0xcd, 0x8e, 0x6c, 0xfc, 0x65, 0x67,
+  0xde, 0x58, 0x04, 0x5f, 0xb8, 0x87, 0x50, 0xfc, 0xc5, 0xc1, 0xe1, 0x78,
+  0x71, 0x36, 0x5d, 0xa8, 0x65, 0x62, 0x8d, 0xd8, 0x55, 0x08, 0x1e, 0x56,
+  0x48, 0xc4, 0xb0, 0x22, 0xf8, 0x12, 0x81, 0x38, 0x5d, 0x01, 0xaa, 0xd4,
+  0x05, 0x45, 0xdc, 0x11, 0xf0, 0xb2, 0xe6, 0x80, 0xc1, 0x2e, 0x6c, 0x04,
+  0x63, 0x82, 0xb4, 0x88, 0x79, 0xaf, 0x70, 0x53, 0xd3, 0x3a, 0xb5, 0xe8,
+  0xd7, 0xb1, 0x11, 0x78, 0x03, 0xc5, 0x6e, 0x77, 0x1c, 0x9d, 0xb2, 0x32,
+  0x9f, 0x25, 0x94, 0x11, 0x1b, 0xcb, 0x66, 0x1d, 0xab, 0x95, 0xc8, 0x29,
+  0x56, 0x5b, 0x63, 0xcf, 0x9c, 0x94, 0x38, 0xec, 0x7b, 0x20, 0x80, 0x60,
+  0x29, 0xe9, 0x24, 0x5e, 0x42, 0xa7, 0x16, 0xd0, 0xfd, 0x16, 0x10, 0xf2,
+  0xba, 0x59, 0x13, 0xc3, 0xad, 0x27, 0x0c, 0xc0, 0xb6, 0xcf, 0x13, 0x51,
+  0x5d, 0xb9, 0x3c, 0xca, 0x52, 0x7e, 0x09, 0x3d, 0xd3, 0x4d, 0x5b, 0x7e,
+  0xdc, 0x69, 0xc4, 0xab, 0xd3, 0x20, 0xe5, 0x0f, 0x3e, 0x10, 0xf6, 0x60,
+  0x05, 0x94, 0xb7, 0xbb, 0x1a, 0xce, 0xe8, 0xe5, 0x0b, 0x87, 0xc4, 0xfe,
+  0x3c, 0xa1, 0xac, 0xa8, 0xdc, 0x8a, 0x2b, 0x6b, 0x42, 0xb5, 0x1f, 0x86,
+  0x06, 0x48, 0x31, 0x11, 0x1b, 0x79, 0x93, 0x67, 0xec, 0x6b, 0xcb, 0x32,
+  0x45, 0x12, 0xc3, 0x31, 0xa1, 0x3d, 0xd3, 0x14, 0x2c, 0x13, 0x36, 0xf7,
+  0x8e, 0x61, 0x30, 0x6b, 0x3d, 0xb7, 0x36, 0x60, 0x57, 0xb4, 0xbd, 0x6a,
+  0xaa, 0x02, 0x41, 0x1f, 0xbe, 0xb5, 0x95, 0x43, 0x02, 0x22, 0xc8, 0xf5,
+  0x91, 0x98, 0xe1, 0xc8, 0x4d, 0xe9, 0x22, 0x5b, 0x5d, 0x3d, 0x78, 0x3b,
+  0xe5, 0xff, 0x2a, 0x8d, 0xab, 0x65, 0x0d, 0x94, 0x20, 0x68, 0xf4, 0xd8,
+  0x51, 0x70, 0xce, 0xef, 0x28, 0x5e, 0x24, 0x4b, 0x93, 0x9b, 0xfa, 0xe1,
+  0x25, 0xe4, 0x53, 0xb2, 0x3b, 0xea, 0xcf, 0x35, 0x19, 0xca, 0x8e, 0x82,
+  0x47, 0xdd, 0xf9, 0xe3, 0x2c, 0xd9, 0xc7, 0x7d, 0x11, 0xfe, 0x96, 0xe9,
+  0x06, 0xd1, 0x48, 0x04, 0x57, 0x40, 0x9e, 0xc8, 0x85, 0x89, 0xd5, 0xa1,
+  0x55, 0xe7, 0x94, 0xad, 0xc5, 0x84, 0x31, 0xb9, 0x61, 0x8c, 0xf1, 0x91,
+  0x35, 0x4b, 0xb6, 0xc9, 0x1a, 0x16, 0x96, 0x96, 0x16, 0xdf, 0x23, 0x44,
+  0x30, 0x54, 0xf4, 0x9c, 0xda, 0xbb, 0x25, 0x42, 0x5a, 0x53, 0x55, 0x61,
+  0xe6, 0xad, 0xd9, 0x39, 0x13, 0x4a, 0x2e, 0x9b, 0xbc, 0xe6, 0x83, 0x87,
+  0x29, 0x4f, 0x22, 0x29, 0x67, 0x60, 0xcb, 0x24, 0x31, 0xe2, 0xef, 0x69,
+  0xef, 0x10, 0x72, 0xb0, 0x4a, 0x16, 0xb7, 0xe5, 0x51, 0x4f, 0x1a, 0x7c,
+  0xa5, 0x5e, 0x2c, 0x45, 0xf5, 0x72, 0x46, 0x7e, 0xb6, 0x93, 0x88, 0x4b,
+  0xa7, 0x93, 0xe9, 0x20, 0x11, 0xab, 0x70, 0x9e, 0x90, 0x6d, 0x13, 0x5a,
+  0x77, 0x58, 0x9b, 0xea, 0xc6, 0xc3, 0xed, 0x7e, 0x2b, 0xad, 0xf4, 0x69,
+  0xc5, 0x48, 0xa9, 0xab, 0xb2, 0xd2, 0x25, 0x8b, 0xf5, 0x98, 0xb0, 0x49,
+  0xa0, 0x74, 0xee, 0x50, 0xa8, 0xad, 0x57, 0xda, 0xb2, 0x21, 0x18, 0x4f,
+  0x4b, 0x38, 0xd9, 0xbe, 0x22, 0x7d, 0x17, 0x3d, 0xf1, 0x21, 0xd2, 0x92,
+  0xe1, 0xe6, 0x0f, 0x64, 0xb6, 0xe5, 0xe0, 0xca, 0xa0, 0x26, 0xd5, 0x52,
+  0xf8, 0x29, 0x5f, 0x3d, 0x20, 0x0b, 0x3b, 0xfb, 0x7e, 0xa4, 0x3e, 0x70,
+  0x88, 0x61, 0x33, 0x63, 0x4b, 0xfd, 0x1e, 0xbe, 0x3f, 0x85, 0x48, 0xf3,
+  0x1c, 0x8c, 0x20, 0x55, 0x44, 0x71, 0x5b, 0xc2, 0xe2, 0x68, 0xc1, 0xb0,
+  0x08, 0xda, 0xcb, 0x56, 0x2a, 0xe6, 0x92, 0xba, 0xcf, 0x40, 0x56, 0x6a,
+  0x09, 0xb2, 0x9f, 0x0a, 0xce, 0xb9, 0xe1, 0x95, 0xf7, 0xa6, 0xcc, 0x29,
+  0xe3, 0x29, 0x49, 0x65, 0x2b, 0x94, 0x99, 0x6b, 0xdd, 0x17, 0x2c, 0x05,
+  0x16, 0xb3, 0xb5, 0xa1, 0x8b, 0x3a, 0xcf, 0x64, 0x6c, 0x33, 0x21, 0x53,
+  0x3b, 0xc7, 0x54, 0x8c, 0xad, 0x35, 0x67, 0x0e, 0xce, 0x2e, 0x90, 0x66,
+  0x66, 0x7a, 0x9b, 0xa0, 0x1e, 0x12, 0x1f, 0x24, 0xce, 0x6a, 0x71, 0x9f,
+  0x25, 0x61, 0x00, 0xac, 0xcc, 0x60, 0x35, 0xb1, 0x85, 0xe4, 0x19, 0x2c,
+  0x00, 0x5c, 0xa4, 0xce, 0x71, 0x26, 0xd4, 0x9e, 0xbe, 0x81, 0x81, 0x2e,
+  0xb9, 0xd6, 0x4e, 0x3e, 0xe1, 0xcf, 0x64, 0x0d, 0x28, 0x07, 0x01, 0x53,
+  0xb7, 0xca, 0xf2, 0xd7, 0xd8, 0xba, 0x0c, 0x4b, 0x6e, 0xe8, 0xe2, 0x67,
+  0xff, 0x6a, 0x47, 0x99, 0x77, 0xf1, 0x79, 0xe4, 0xe4, 0x7e, 0x0e, 0xbc,
+  0x3d, 0xeb, 0xd4, 0xf1, 0xa8, 0x47, 0x87, 0xde, 0xe9, 0x54, 0xf0, 0xf0,
+  0xc3, 0x81, 0x72, 0x32, 0x63, 0x9d, 0x3c, 0xc3, 0x75, 0x47, 0x54, 0xd5,
+  0x5e, 0xb8, 0x4d, 0x5e, 0x75, 0x55, 0x11, 0x1c, 0x71, 0x09, 0xea, 0x0f,
+  0x0b, 0x70, 0x4a, 0x4c, 0x92, 0x43, 0x35, 0x45, 0x02, 0x4e, 0x48, 0x1c,
+  0x1a, 0x84, 0x75, 0x0f, 0x9b, 0x5b, 0xeb, 0x56, 0x4a, 0x42, 0x99, 0xff,
+  0x32, 0xee, 0xb4, 0xf3, 0x05, 0x46, 0x56, 0x4d, 0xc1, 0x4a, 0x49, 0xf2,
+  0xd1, 0x10, 0xea, 0xf1, 0x2d, 0x72, 0x5b, 0xca, 0xd9, 0x9c, 0x07, 0xb9,
+  0xe8, 0xe7, 0x51, 0xa9, 0x0b, 0x38, 0x79, 0x49, 0xad, 0x0b, 0x8f, 0x40,
+  0x21, 0xea, 0x40, 0x4b, 0xa4, 0x08, 0xa8, 0x0c, 0x9e, 0x62, 0x0f, 0xd8,
+  0x20, 0x0e, 0x19, 0x3d, 0xc9, 0x00, 0x5c, 0x0d, 0x6e, 0x3f, 0xd1, 0x9d,
+  0x0a, 0xc4, 0xb9, 0x82, 0xd3, 0xb4, 0xb6, 0xc6, 0xed, 0xbb, 0x5f, 0xe1,
+  0xd9, 0x65, 0x21, 0x2c, 0x00, 0x0a, 0xba, 0xfa, 0x37, 0xfb, 0xef, 0x4c,
+  0xf2, 0x83, 0x5e, 0x5a, 0xd4, 0xbf, 0xf8, 0xd1, 0x2b, 0xfe, 0x05, 0x7c,
+  0xcc, 0x80, 0xd3, 0x69, 0x61, 0x77, 0x3a, 0x1d, 0x04, 0x5b, 0xa7, 0x4e,
+  0x5b, 0x73, 0x4a, 0xc1, 0x12, 0xdb, 0x70, 0x66, 0x4f, 0x4b, 0x0f, 0x52,
+  0xf2, 0x4d, 0x59, 0x95, 0xcd, 0x7a, 0xe3, 0xa2, 0xe7, 0xaa, 0x04, 0xff,
+  0x64, 0xb1, 0x16, 0x77, 0xb4, 0x2b, 0x58, 0x78, 0x59, 0xc9, 0x37, 0x3e,
+  0xa3, 0xea, 0x6e, 0x0b, 0xf9, 0x51, 0x4e, 0x52, 0x68, 0x9d, 0x01, 0x03,
+  0xf9, 0x1c, 0x6c, 0x6c, 0xfd, 0x98, 0x51, 0x76, 0x45, 0xc9, 0x3d, 0x07,
+  0x3e, 0xce, 0x2e, 0xf5, 0xba, 0xc9, 0x93, 0xca, 0xcb, 0x10, 0x97, 0x6e,
+  0x75, 0xea, 0x77, 0x6e, 0xb5, 0x96, 0xee, 0x05, 0xd8, 0x2f, 0x32, 0xf6,
+  0x64, 0xce, 0xc6, 0x51, 0xe5, 0x72, 0x6d, 0x4d, 0x64, 0x5a, 0xf8, 0xec,
+  0xf4, 0xff, 0x60, 0x6b, 0xed, 0xf2, 0xf8, 0xa4, 0x42, 0x21, 0x5e, 0x93,
+  0xe3, 0x20, 0x39, 0xe9, 0xa4, 0x22, 0x37, 0x3b, 0x34, 0x66, 0x1f, 0x0c,
+  0x6c, 0xc7, 0x66, 0x06, 0xb8, 0xcd, 0x4b, 0x87, 0xd5, 0x7b, 0x11, 0xbe,
+  0x70, 0xc1, 0x6a, 0x01, 0x9a, 0xdf, 0x9b, 0xaa, 0x2c, 0xd8, 0x89, 0xe9,
+  0xe3, 0x4e, 0x22, 0x87, 0x32, 0x08, 0x60, 0x0b, 0xdc, 0x4f, 0xb0, 0xfa,
+  0xbd, 0xa5, 0x08, 0xec, 0xf2, 0xe4, 0x2e, 0x99, 0x73, 0x00, 0xd0, 0x1a,
+  0xd5, 0x41, 0xa1, 0x0a, 0xd3, 0x71, 0x69, 0x19, 0x59, 0x0f, 0xf1, 0xd9,
+  0x85, 0x8e, 0x96, 0x83, 0xa1, 0x11, 0xec, 0x13, 0x73, 0xaf, 0xc5, 0xa1,
+  0x9d, 0x6f, 0x77, 0x99, 0x4b, 0x28, 0x86, 0xaf, 0xd9, 0xe0, 0xa9, 0xb5,
+  0x57, 0x1b, 0x49, 0x22, 0x62, 0x15, 0x24, 0x81, 0xb1, 0x73, 0x00, 0x97,
+  0xd4, 0xe8, 0x84, 0x84, 0x6b, 0xe3, 0xfe, 0xed, 0xfb, 0xe0, 0xde, 0x33,
+  0x39, 0x52, 0x68, 0x3f, 0x69, 0x8c, 0xfe, 0x44, 0xd9, 0xad, 0x9a, 0x6b,
+  0x78, 0x6c, 0x66, 0x5f, 0x86, 0x75, 0xdb, 0xa3, 0x54, 0x7a, 0x7a, 0x93,
+  0xc6, 0x14, 0xdd, 0x83, 0x1a, 0x5c, 0x52, 0x60, 0x7c, 0xff, 0x24, 0x3d,
+  0xed, 0x99, 0x14, 0xe5, 0xdc, 0xde, 0x6e, 0x43, 0x73, 0x15, 0x89, 0x8d,
+  0x3d, 0x09, 0xd7, 0xdc, 0x18, 0xe2, 0x27, 0x4c, 0x03, 0xa5, 0x94, 0x21,
+  0xac, 0x58, 0x97, 0x25, 0x19, 0xf9, 0x00, 0x52, 0x48, 0xc5, 0x4b, 0x08,
+  0x47, 0x72, 0x21, 0x68, 0xd1, 0xd4, 0xd4, 0x5f, 0x71, 0xc0, 0x52, 0xf1,
+  0xdd, 0x48, 0x74, 0x4b, 0x9c, 0x2f, 0x51, 0x1f, 0xbb, 0x93, 0x36, 0x68,
+  0xc0, 0x81, 0xa9, 0x55, 0x66, 0xea, 0x86, 0x3f, 0xf2, 0x41, 0x02, 0x65,
+  0x87, 0xe5, 0xc2, 0x38, 0xa9, 0x6d, 0xe9, 0x48, 0x23, 0x79, 0x55, 0x66,
+  0xd5, 0xe7, 0xd0, 0xa1, 0x4a, 0x50, 0xb1, 0xac, 0xf2, 0x64, 0x2f, 0xc1,
+  0x21, 0xfa, 0xf3, 0x88, 0xdb, 0xae, 0xdb, 0xe2, 0x58, 0x3a, 0x7e, 0x10,
+  0x8d, 0x21, 0x9a, 0x32, 0x0f, 0x4a, 0xc4, 0x4d, 0x52, 0x6d, 0x73, 0x6a,
+  0xe0, 0x92, 0x30, 0x8d, 0xa3, 0x13, 0x94, 0x6a, 0x9e, 0x55, 0x3a, 0xaf,
+  0x81, 0x9c, 0x97, 0x8c, 0x21, 0x75, 0x1b, 0xf2, 0xd8, 0x26, 0x4c, 0x3d,
+  0x88, 0xc7, 0x3d, 0x9c, 0x6f, 0xb8, 0x49, 0x37, 0xf4, 0x45, 0xae, 0xea,
+  0x9c, 0xee, 0x5d, 0xf8, 0x8f, 0xdb, 0x42, 0x2c, 0xec, 0x48, 0xa4, 0xa6,
+  0x4a, 0x9b, 0x2d, 0x77, 0x2a, 0xc2, 0x72, 0x39, 0x0e, 0xb3, 0x78, 0xe1,
+  0xe2, 0x0b, 0x71, 0x94, 0x48, 0x06, 0xeb, 0x59, 0x7d, 0x07, 0xf5, 0xcd,
+  0x30, 0x19, 0x6b, 0xab, 0x0d, 0xae, 0xfa, 0x1f, 0x7a, 0x35, 0x3e, 0xf7,
+  0x58, 0x70, 0x2b, 0x4e, 0xd7, 0xf9, 0xf8, 0x5e, 0xa6, 0x40, 0xd2, 0xf4,
+  0xa5, 0xc5, 0x20, 0xe8, 0xe1, 0x9f, 0x94, 0xa8, 0x33, 0xaa, 0x3b, 0xfb,
+  0xb1, 0xba, 0x06, 0x3f, 0x2e, 0x1d, 0x6e, 0x9b, 0xfa, 0xf4, 0x2d, 0x93,
+  0xf7, 0xb2, 0x2f, 0x2b, 0x71, 0x6d, 0x89, 0x0d, 0xd1, 0xf3, 0x67, 0x23,
+  0xf5, 0x96, 0x87, 0x01, 0xdc, 0x10, 0xa2, 0x4c, 0xff, 0xc7, 0xa0, 0xdf,
+  0x72, 0x68, 0x05, 0xdc, 0x4b, 0x11, 0xb8, 0xe2, 0x9c, 0xc9, 0xd4, 0xd4,
+  0xda, 0x20, 0x9a, 0xd6, 0x9e, 0x39, 0xc6, 0xdd, 0x59, 0xb6, 0x55, 0x70,
+  0x2b, 0x93, 0x01, 0x67, 0x91, 0xc0, 0x60, 0xd0, 0xe0, 0x62, 0x77, 0x2c,
+  0x3b, 0xe3, 0xd7, 0x47, 0xac, 0x88, 0x65, 0x84, 0xca, 0xdf, 0x4a, 0x6d,
+  0xc0, 0x09, 0x74, 0x8d, 0xc8, 0x53, 0xe8, 0x07, 0xfe, 0x18, 0x92, 0x2f,
+  0x9b, 0x3c, 0xeb, 0x60, 0xac, 0x35, 0xb8, 0x5e, 0x79, 0x10, 0x1a, 0x5f,
+  0x7b, 0xc8, 0x92, 0xfa, 0xde, 0x85, 0xe1, 0xbe, 0x4d, 0xc1, 0xb9, 0x95,
+  0xe4, 0x93, 0x48, 0x15, 0x72, 0x24, 0x09, 0x51, 0xf4, 0xea, 0xd5, 0x2b,
+  0x40, 0x3f, 0xc1, 0xf4, 0xad, 0x51, 0x4f, 0x36, 0x75, 0xbd, 0x7b, 0xf9,
+  0xf4, 0xa9, 0x7c, 0xb0, 0x33, 0x23, 0xf0, 0xfd, 0x34, 0x2b, 0xf7, 0x45,
+  0x5e, 0x26, 0xd9, 0x19, 0xee, 0x72, 0x46, 0x47, 0xc0, 0x0c, 0x9e, 0x9e,
+  0x52, 0xa5, 0x9c, 0x56, 0x25, 0x6d, 0xc8, 0xfc, 0xb6, 0x55, 0xbd, 0x1b,
+  0xad, 0x8b, 0x66, 0x54, 0x56, 0xeb, 0xa7, 0xf8, 0xfb, 0x69, 0x6e, 0x96,
+  0xdd, 0xa2, 0xa7, 0xa7, 0x34, 0x44, 0x3a, 0x36, 0x42, 0x3a, 0x36, 0x58,
+  0x7a, 0x7b, 0xfd, 0x5e, 0xcd, 0x26, 0x8b, 0xc5, 0x64, 0xae, 0xde, 0x4e,
+  0xae, 0x27, 0xf3, 0xf1, 0x4c, 0xdd, 0xbe, 0x7f, 0x3d, 0x9b, 0x5e, 0x28,
+  0xfc, 0x7f, 0x72, 0xbd, 0x98, 0x1c, 0x9f, 0x46, 0x29, 0xf5, 0x17, 0xe4,
+  0x4e, 0xa4, 0x8d, 0x17, 0xb1, 0x3a, 0xff, 0x33, 0x74, 0x5f, 0x68, 0x75,
+  0xfe, 0xec, 0xd9, 0xf7, 0x51, 0xa4, 0x2e, 0xca, 0xdd, 0x03, 0x1b, 0xbe,
+  0x7a, 0x72, 0x71, 0xca, 0x1f, 0x72, 0x53, 0xb4, 0xf3, 0xbf, 0x37, 0x14,
+  0x23, 0x5d, 0x6d, 0x3a, 0x2d, 0xd2, 0x91, 0xfa, 0x67, 0x7f, 0x2f, 0xbb,
+  0xe2, 0x3b, 0xfd, 0x4b, 0xa4, 0x26, 0x30, 0xad, 0x07, 0x6a, 0x78, 0x53,
+  0x82, 0xd9, 0xd6, 0x95, 0xac, 0xe1, 0x9d, 0x64, 0x0a, 0xd9, 0xa3, 0x4d,
+  0xea, 0xe8, 0xa0, 0xfd, 0x99, 0x95, 0xf0, 0x62, 0x8e, 0xb3, 0x58, 0xaf,
+  0xd2, 0x0d, 0xe1, 0x2d, 0xf5, 0x3b, 0x18, 0xba, 0xb9, 0x1d, 0x4c, 0x2d,
+  0x78, 0x9d, 0x21, 0x60, 0x44, 0x4a, 0xba, 0xd4, 0xf7, 0xee, 0x7e, 0xae,
+  0xe3, 0xc4, 0x72, 0x02, 0x54, 0x21, 0xa8, 0xbe, 0xd5, 0x05, 0x42, 0x79,
+  0x2e, 0x9d, 0xf6, 0xb4, 0x8d, 0xb1, 0x14, 0xd8, 0xaa, 0x5d, 0x59, 0x51,
+  0x3a, 0x14, 0x75, 0x4d, 0xb7, 0x41, 0xcf, 0x0f, 0xe4, 0x3c, 0xe5, 0x17,
+  0x21, 0xed, 0x3e, 0xd1, 0x68, 0xe6, 0x71, 0x86, 0x9a, 0x29, 0xe2, 0x9d,
+  0x52, 0xa5, 0xd2, 0xfa, 0x24, 0x13, 0x6a, 0x84, 0x34, 0x24, 0x1a, 0x6b,
+  0x99, 0x74, 0x4e, 0xb3, 0x33, 0x2c, 0x42, 0x52, 0xb1, 0x1f, 0xd1, 0x3d,
+  0xe0, 0xa2, 0xe3, 0x6e, 0xe9, 0xa5, 0x5e, 0xb1, 0xd7, 0x61, 0x29, 0x7f,
+  0x3b, 0xb6, 0x32, 0x12, 0x91, 0xd9, 0x52, 0xac, 0x4e, 0xc2, 0x3e, 0xdc,
+  0x09, 0x85, 0x15, 0xca, 0x8e, 0x21, 0xf1, 0xa3, 0xfc, 0x8a, 0x2c, 0xa2,
+  0xe3, 0xb2, 0xf0, 0x49, 0xb4, 0x56, 0x27, 0x7c, 0xb7, 0xdb, 0xd9, 0x6f,
+  0xd1, 0x7b, 0x84, 0x10, 0x33, 0x7a, 0x72, 0xc7, 0x1d, 0xbf, 0x65, 0x95,
+  0x54, 0x0f, 0x21, 0x9d, 0x04, 0x72, 0xbd, 0xe7, 0xae, 0x24, 0x8d, 0x99,
+  0x94, 0x8c, 0x26, 0xbd, 0x94, 0xba, 0xab, 0xc4, 0x91, 0xd4, 0xcd, 0x00,
+  0xfb, 0x82, 0xdb, 0x0d, 0x10, 0xa8, 0x8b, 0x55, 0x8c, 0x00, 0xd4, 0xc5,
+  0x5f, 0x72, 0xd6, 0xfc, 0x81, 0xc8, 0xf0, 0xd8, 0x6d, 0xc5, 0x3f, 0x77,
+  0x92, 0x1c, 0x17, 0xea, 0x24, 0xd8, 0x77, 0xc2, 0x11, 0x9f, 0xaa, 0x17,
+  0xda, 0xc1, 0x51, 0x64, 0x8b, 0x54, 0xbc, 0x8d, 0x36, 0x38, 0x45, 0xd2,
+  0x52, 0x1a, 0x54, 0xfa, 0xf2, 0x28, 0x72, 0xda, 0x73, 0x37, 0x11, 0x53,
+  0x94, 0x6a, 0xc5, 0x19, 0x61, 0x17, 0x76, 0x96, 0x89, 0x95, 0xe1, 0x6c,
+  0xb0, 0x61, 0x14, 0x89, 0x06, 0xa9, 0x7b, 0x05, 0xb3, 0x58, 0x32, 0x72,
+  0xf2, 0x69, 0x02, 0xa2, 0x1d, 0xdb, 0xbd, 0x73, 0x14, 0x67, 0x9a, 0xb0,
+  0x20, 0xe0, 0x9a, 0xda, 0xa2, 0x42, 0x8a, 0xb0, 0x45, 0x6a, 0xf0, 0xa3,
+  0x6c, 0x0e, 0xb6, 0xcb, 0xf5, 0xd5, 0x49, 0x4f, 0x48, 0x72, 0x7f, 0xb9,
+  0xbd, 0x6b, 0x1d, 0xf1, 0xbe, 0x94, 0x17, 0x71, 0xdd, 0x8f, 0xf2, 0xc6,
+  0x14, 0x9f, 0xe4, 0x94, 0x28, 0x14, 0x79, 0x3b, 0xde, 0xf3, 0x07, 0x48,
+  0x97, 0x8d, 0x10, 0xd3, 0xa4, 0x9c, 0xb6, 0x0f, 0x3c, 0xcf, 0xad, 0x8b,
+  0x78, 0xa3, 0xc8, 0x8b, 0x3e, 0xee, 0x6b, 0x6d, 0xcf, 0x1d, 0xd5, 0x8c,
+  0xe1, 0x22, 0xc9, 0x2d, 0x60, 0x02, 0x1e, 0xed, 0x32, 0xc2, 0x93, 0x19,
+  0x38, 0x81, 0xfc, 0x1d, 0x62, 0x9d, 0x8c, 0xc4, 0xc7, 0xf1, 0xc5, 0x15,
+  0x98, 0xdd, 0xc2, 0xe8, 0x2e, 0x4a, 0x94, 0x60, 0x76, 0x47, 0x5e, 0xca,
+  0x63, 0x33, 0xea, 0x44, 0x9c, 0x48, 0xdc, 0x18, 0x9c, 0xe3, 0xf3, 0x06,
+  0x1d, 0x1d, 0xdb, 0xd3, 0x8e, 0x07, 0x7b, 0x9b, 0xa8, 0x07, 0xe5, 0x27,
+  0x27, 0x92, 0x7b, 0xb7, 0x9d, 0x8e, 0x88, 0x36, 0x50, 0xb3, 0xd4, 0x63,
+  0xc3, 0xe1, 0xcd, 0xc8, 0xba, 0xe2, 0xb6, 0x0b, 0x2e, 0xb5, 0x9d, 0xb1,
+  0xae, 0x9e, 0x87, 0xa3, 0x55, 0x3a, 0xea, 0x59, 0x4b, 0x20, 0x6b, 0x71,
+  0x43, 0xb6, 0x2c, 0x6f, 0x49, 0x24, 0x08, 0x0f, 0xdd, 0x9d, 0x1c, 0xfa,
+  0x77, 0x09, 0xb5, 0x75, 0x01, 0x26, 0x7f, 0x4b, 0x12, 0xe5, 0xf2, 0x23,
+  0x55, 0xb4, 0x5c, 0x7d, 0xbb, 0x66, 0x47, 0xd8, 0x23, 0xf2, 0x32, 0xe9,
+  0x31, 0xd6, 0xcd, 0x92, 0xa4, 0x36, 0xae, 0x93, 0x88, 0xab, 0xda, 0x9a,
+  0x8b, 0x02, 0x32, 0xaa, 0x75, 0x95, 0x6c, 0x25, 0x8d, 0xd6, 0x19, 0xd3,
+  0xf0, 0x5d, 0x4a, 0xce, 0xc5, 0x0f, 0xc4, 0xc4, 0x1d, 0x58, 0xe2, 0xa6,
+  0x77, 0x0c, 0xb9, 0x58, 0x27, 0x7c, 0xda, 0xb5, 0xe0, 0x12, 0xce, 0x19,
+  0x95, 0x1b, 0x68, 0x1e, 0x50, 0x63, 0xc9, 0x3c, 0x1f, 0xa9, 0xc9, 0xe7,
+  0x54, 0xef, 0x7c, 0xce, 0xb1, 0x90, 0x0a, 0x78, 0x00, 0xdb, 0xb7, 0x33,
+  0x5e, 0xfc, 0x73, 0xd9, 0x48, 0xcf, 0xa1, 0x2c, 0xee, 0x91, 0x4d, 0x0c,
+  0xa0, 0x49, 0x5a, 0x9d, 0x56, 0xbb, 0x59, 0xf5, 0x0b, 0xd6, 0xcb, 0x37,
+  0x6d, 0x94, 0x72, 0x40, 0x15, 0xf9, 0x96, 0xc6, 0x52, 0x73, 0xc7, 0x97,
+  0x2b, 0x49, 0xaa, 0xb0, 0xbf, 0x74, 0xf0, 0xf9, 0x08, 0xac, 0xd3, 0x99,
+  0xb4, 0xe5, 0xaa, 0xcc, 0x90, 0x87, 0x77, 0x1a, 0x16, 0xa0, 0x9f, 0xae,
+  0x78, 0x8e, 0xba, 0xa5, 0x2f, 0x85, 0xb5, 0xdd, 0xc3, 0xc0, 0xb9, 0xd8,
+  0x52, 0x38, 0x73, 0xc1, 0xca, 0x4a, 0x96, 0x3a, 0x21, 0x52, 0xf9, 0x15,
+  0x01, 0x21, 0x44, 0x31, 0x21, 0xfa, 0xfa, 0x26, 0x08, 0x39, 0x3b, 0x69,
+  0xd0, 0x4d, 0x7c, 0x38, 0x62, 0x19, 0x01, 0x84, 0x3e, 0xdc, 0x46, 0x8c,
+  0x94, 0xc0, 0x48, 0x79, 0x65, 0xd1, 0x12, 0x7d, 0x12, 0x02, 0x34, 0x01,
+  0x2b, 0xac, 0x7a, 0xcd, 0xf1, 0x1a, 0xb0, 0x60, 0x65, 0x6c, 0x2f, 0x4f,
+  0x4b, 0x3a, 0x46, 0xb8, 0x6e, 0xba, 0x2f, 0x61, 0xce, 0xa7, 0xd4, 0x14,
+  0xd0, 0x85, 0xdc, 0xb1, 0xaf, 0x82, 0xee, 0x9e, 0x5b, 0x27, 0x99, 0xc8,
+  0x81, 0xcb, 0xcb, 0x88, 0x5b, 0xca, 0xa7, 0x47, 0x46, 0x50, 0x71, 0x07,
+  0x85, 0xcc, 0xaf, 0xd0, 0xfd, 0x44, 0x4f, 0x29, 0xa8, 0x3c, 0xa3, 0xae,
+  0x2f, 0x80, 0x48, 0xaf, 0xe8, 0xb5, 0x01, 0xae, 0x4c, 0x74, 0xb0, 0x8d,
+  0x67, 0x3f, 0xec, 0xaa, 0x6e, 0x0e, 0xca, 0x83, 0x80, 0x61, 0xbc, 0x69,
+  0x2b, 0x76, 0x16, 0x12, 0x03, 0x2d, 0x4f, 0xa3, 0x06, 0x92, 0x8c, 0xfb,
+  0xf2, 0x41, 0xed, 0x86, 0x82, 0x40, 0xba, 0x19, 0xbe, 0x1c, 0x76, 0x55,
+  0xb3, 0xa5, 0xed, 0x54, 0xc2, 0x71, 0xeb, 0x56, 0xd2, 0x4e, 0x69, 0x24,
+  0xfa, 0x17, 0x0a, 0x95, 0xde, 0x4a, 0xf5, 0x06, 0x7f, 0x85, 0x8d, 0x20,
+  0x1d, 0x8d, 0x69, 0xd6, 0x47, 0xfb, 0x96, 0xdd, 0xf5, 0x5b, 0xa3, 0x8a,
+  0xfd, 0x64, 0xa3, 0x7b, 0x63, 0xf0, 0x48, 0xba, 0x51, 0xae, 0x22, 0x9f,
+  0x84, 0xfb, 0x14, 0x28, 0x91, 0xab, 0xba, 0xae, 0x17, 0x4b, 0x8f, 0x94,
+  0xc0, 0x56, 0xf8, 0x62, 0xa4, 0x6e, 0x04, 0x28, 0x08, 0x53, 0x28, 0xef,
+  0x73, 0xd9, 0x12, 0x1b, 0x6e, 0x5b, 0x5a, 0x92, 0x1b, 0xfb, 0xc8, 0xf5,
+  0x4e, 0x27, 0xc4, 0xdd, 0x1b, 0x93, 0x6b, 0xdb, 0x82, 0x55, 0x88, 0x36,
+  0x3c, 0x62, 0x93, 0x78, 0x1b, 0x4a, 0x99, 0xac, 0x20, 0xc8, 0xc6, 0x82,
+  0xc2, 0x15, 0xd4, 0xa3, 0x04, 0x19, 0x0f, 0xd3, 0x5d, 0xd1, 0x53, 0x10,
+  0x29, 0xe1, 0x6d, 0x2b, 0xba, 0x7e, 0x64, 0x1a, 0xb8, 0x35, 0x17, 0x44,
+  0xc2, 0x40, 0xc4, 0x0c, 0x38, 0xf1, 0xf9, 0xe9, 0x2a, 0x3b, 0x4f, 0xba,
+  0x29, 0x4d, 0x3a, 0xb4, 0xa2, 0x98, 0xca, 0xea, 0x7a, 0xd3, 0xcb, 0x12,
+  0xb3, 0xa8, 0x65, 0xcc, 0x25, 0x00, 0xb9, 0x3c, 0x40, 0x21, 0xe1, 0x15,
+  0xb0, 0xff, 0x0a, 0x17, 0xa2, 0xe1, 0x25, 0x90, 0x50, 0xcb, 0x04, 0x80,
+  0xdd, 0x8c, 0x46, 0x88, 0xdc, 0x76, 0x8a, 0xf2, 0x04, 0x27, 0xba, 0x6e,
+  0x49, 0x92, 0xd2, 0x74, 0xbc, 0xe4, 0x39, 0x01, 0xb0, 0x66, 0x4b, 0x35,
+  0xe4, 0x36, 0x41, 0x51, 0x60, 0xc9, 0x24, 0x73, 0x7a, 0x33, 0xe2, 0xcd,
+  0xcc, 0x75, 0xa0, 0xf5, 0x76, 0x97, 0x73, 0xb2, 0xfa, 0x84, 0x5a, 0xf8,
+  0x54, 0x28, 0xe9, 0xbd, 0xe6, 0xb8, 0xad, 0x79, 0xa6, 0x9d, 0xeb, 0x62,
+  0x5d, 0x6f, 0xe0, 0x5e, 0xee, 0x15, 0xc6, 0x12, 0x6e, 0xea, 0x45, 0xb4,
+  0x2a, 0xdd, 0x9b, 0x95, 0xd6, 0x91, 0xde, 0xd2, 0xd3, 0x1e, 0x2a, 0x5a,
+  0xb1, 0x1d, 0x86, 0x4f, 0x55, 0xab, 0x7f, 0xcc, 0xc3, 0x65, 0x75, 0xe8,
+  0x8d, 0xa1, 0x0e, 0xa5, 0x11, 0x2e, 0x7e, 0x10, 0xa4, 0x2c, 0x9c, 0x9a,
+  0x52, 0xa8, 0xab, 0x83, 0x76, 0x79, 0x90, 0xd5, 0x70, 0xc7, 0xa0, 0x96,
+  0x8c, 0x8b, 0x62, 0x20, 0x4f, 0x4a, 0x04, 0x72, 0x07, 0xf9, 0xdf, 0xc8,
+  0xdb, 0x3a, 0xf5, 0x61, 0xe4, 0x51, 0xd9, 0x90, 0x07, 0x79, 0x82, 0xd4,
+  0x63, 0xd1, 0xb9, 0x83, 0x3b, 0xbc, 0x2b, 0x25, 0x88, 0x96, 0xaf, 0x26,
+  0x98, 0xf2, 0x37, 0xa3, 0x7e, 0xec, 0xb0, 0xc7, 0xe3, 0x41, 0x3f, 0x5a,
+  0x3d, 0x6e, 0x37, 0x62, 0x2d, 0x91, 0xb4, 0xf6, 0xeb, 0x72, 0xad, 0x09,
+  0x1a, 0x63, 0x82, 0x1b, 0x79, 0x89, 0x07, 0xd0, 0x70, 0x0f, 0x62, 0xfc,
+  0xf3, 0xa7, 0x1e, 0x5a, 0x3b, 0xf6, 0xa3, 0x61, 0x4e, 0xe1, 0xc5, 0xd6,
+  0x6b, 0x11, 0x1f, 0x46, 0x51, 0xe9, 0x1c, 0x10, 0x46, 0xea, 0x48, 0x53,
+  0x8d, 0xa4, 0x35, 0x15, 0xa8, 0x1c, 0x7f, 0x33, 0xbd, 0x6c, 0xd6, 0x5c,
+  0x36, 0xb1, 0x1b, 0x0c, 0x62, 0x84, 0x91, 0x20, 0xc3, 0xb9, 0x17, 0x18,
+  0x74, 0x23, 0xed, 0xe8, 0x6f, 0xb7, 0x95, 0xc3, 0x6c, 0x48, 0x60, 0x47,
+  0xff, 0x5d, 0xad, 0x65, 0x90, 0x6d, 0xfe, 0x0d, 0xf6, 0xa2, 0xd2, 0x53,
+  0x14, 0xc0, 0x87, 0xf9, 0x14, 0xf3, 0x8c, 0x9a, 0x16, 0x3e, 0xf9, 0x60,
+  0x99, 0xb4, 0xd4, 0xd0, 0x22, 0x1c, 0xe4, 0xf0, 0x0d, 0x69, 0x82, 0xa3,
+  0xcd, 0x67, 0x9d, 0x36, 0x61, 0x1a, 0x25, 0x33, 0x80, 0xe1, 0x96, 0x36,
+  0xf1, 0x6a, 0x85, 0xb0, 0x2d, 0x85, 0x00, 0x3e, 0xb4, 0xda, 0x13, 0xe6,
+  0x96, 0xe4, 0x5e, 0x03, 0x2d, 0xdc, 0x04, 0x82, 0x7a, 0xe9, 0x34, 0x90,
+  0xcf, 0x4c, 0x45, 0x26, 0xe7, 0xf2, 0xa6, 0x86, 0x2a, 0x5f, 0x99, 0x57,
+  0x89, 0xf4, 0x76, 0x41, 0xf2, 0xf4, 0xd8, 0xe5, 0x07, 0x37, 0xcf, 0x4e,
+  0xd5, 0x65, 0xa9, 0x82, 0xc8, 0x32, 0xb0, 0x0c, 0xfa, 0xef, 0xd9, 0xa9,
+  0xcb, 0x67, 0x78, 0xc1, 0x97, 0x12, 0xf4, 0x20, 0x76, 0xb5, 0x8e, 0x44,
+  0x87, 0x47, 0xfd, 0x1e, 0x75, 0x57, 0x8b, 0x7e, 0x39, 0xcb, 0x25, 0xf3,
+  0x49, 0x38, 0xa2, 0x78, 0x02, 0xd4, 0x8a, 0xf2, 0x33, 0xd0, 0xb8, 0x1b,
+  0xba, 0xb8, 0xd3, 0x58, 0x5f, 0xd2, 0x99, 0x88, 0x43, 0x09, 0x45, 0xed,
+  0x50, 0x5d, 0xaa, 0x21, 0x2d, 0xfd, 0x57, 0xaa, 0x86, 0x86, 0x69, 0xb0,
+  0xb7, 0x23, 0x9f, 0x9c, 0x04, 0x95, 0x4f, 0xd4, 0xb6, 0xfa, 0x87, 0x59,
+  0xbb, 0x7b, 0x77, 0xc1, 0xe3, 0xfa, 0x60, 0xeb, 0xa0, 0xe2, 0x10, 0xef,
+  0xf6, 0x54, 0xb6, 0x49, 0x51, 0x50, 0x02, 0xba, 0xd3, 0xa9, 0xac, 0x0e,
+  0xb2, 0xca, 0xef, 0x86, 0x4a, 0x5c, 0xf1, 0x24, 0xcd, 0xa5, 0x94, 0x9e,
+  0xc2, 0x31, 0x05, 0x8c, 0x5a, 0xa5, 0x3d, 0x3f, 0xa5, 0x71, 0x03, 0x97,
+  0xa5, 0x4e, 0x64, 0x76, 0x93, 0x90, 0x73, 0xe5, 0xce, 0xf4, 0xb6, 0x9a,
+  0x7a, 0x2e, 0xc6, 0x6e, 0x99, 0xba, 0xaf, 0x0c, 0x7d, 0x29, 0xd8, 0x69,
+  0xcc, 0xc7, 0xdd, 0x71, 0x47, 0xa9, 0xdb, 0x6a, 0x2c, 0xdb, 0x0e, 0x0b,
+  0xfe, 0x09, 0xa5, 0x6e, 0x94, 0x48, 0xe2, 0xdf, 0xf4, 0x4c, 0xb2, 0x36,
+  0xdb, 0x96, 0xcc, 0xd1, 0x0c, 0x17, 0xc8, 0x54, 0x21, 0xec, 0x53, 0x69,
+  0xa1, 0xb9, 0x07, 0xea, 0x4a, 0x22, 0xd2, 0xda, 0xd7, 0xdd, 0xac, 0x27,
+  0xea, 0x4d, 0x7a, 0x44, 0xeb, 0x4f, 0x80, 0x06, 0xfb, 0x20, 0x03, 0x73,
+  0xed, 0x5d, 0xff, 0x9e, 0xe3, 0x50, 0x7f, 0x9e, 0xc8, 0x80, 0x03, 0x9f,
+  0x6a, 0xb4, 0x35, 0xf7, 0x99, 0x9f, 0x84, 0xe4, 0x3a, 0x2c, 0x8b, 0xb9,
+  0x58, 0xed, 0x77, 0xd9, 0x44, 0xd4, 0xfa, 0x94, 0x66, 0xde, 0xfc, 0xba,
+  0x65, 0x2a, 0xed, 0x41, 0x31, 0xa3, 0x69, 0xf8, 0xd8, 0x83, 0x4a, 0x9e,
+  0xb2, 0x00, 0x73, 0x0e, 0x91, 0xf7, 0xdc, 0xd2, 0x6c, 0x5b, 0x0b, 0x8c,
+  0x6e, 0xda, 0xbf, 0xe6, 0xc9, 0xc2, 0x57, 0x3c, 0x0c, 0xeb, 0xe1, 0xeb,
+  0x93, 0x5e, 0xd9, 0xd2, 0x1a, 0x4a, 0xe4, 0xba, 0x86, 0x9c, 0x2c, 0xf2,
+  0x9b, 0x5c, 0x3a, 0xad, 0xee, 0xbd, 0x04, 0xe1, 0xab, 0x1e, 0xd0, 0x13,
+  0xdf, 0x2c, 0x34, 0x25, 0x2a, 0x89, 0xbc, 0x41, 0x71, 0x6d, 0x4e, 0xa6,
+  0x23, 0xb8, 0xa6, 0x8f, 0x3b, 0x84, 0x3f, 0xb9, 0x0f, 0x9a, 0x61, 0xf3,
+  0xc1, 0x3b, 0x9c, 0x6b, 0x3f, 0x88, 0xcb, 0x39, 0xf8, 0xe2, 0x31, 0xcc,
+  0xef, 0x72, 0xbc, 0x63, 0x75, 0xb2, 0x7a, 0x32, 0x65, 0x87, 0x24, 0x71,
+  0x72, 0x87, 0x47, 0x6a, 0xc2, 0x6f, 0xb2, 0x67, 0xe2, 0xf9, 0x8f, 0x29,
+  0x43, 0x6d, 0x1b, 0x5b, 0xf3, 0x04, 0x89, 0x03, 0x89, 0x8f, 0x5b, 0x5f,
+  0x04, 0x35, 0x12, 0xc4, 0xa3, 0x40, 0x25, 0x02, 0xc8, 0xf4, 0xc8, 0xd7,
+  0x74, 0x3d, 0x6e, 0x9e, 0x4b, 0xa6, 0xc6, 0x87, 0x7a, 0x9d, 0x0e, 0xd9,
+  0x23, 0x0a, 0x21, 0x87, 0x2e, 0x0b, 0xf8, 0x23, 0x00, 0xc1, 0x05, 0x4b,
+  0x88, 0x11, 0xc7, 0xc1, 0xe1, 0x94, 0x4c, 0xf6, 0xdb, 0x20, 0x39, 0x6a,
+  0x4b, 0xee, 0x5e, 0x82, 0x24, 0x8f, 0xf9, 0x3d, 0x4e, 0xb8, 0x92, 0xc7,
+  0xf8, 0x81, 0x32, 0x4f, 0xe0, 0xa4, 0x86, 0x0e, 0x9b, 0x1c, 0x91, 0x77,
+  0x29, 0xea, 0x89, 0x30, 0xaf, 0xc6, 0x03, 0x38, 0x35, 0xb6, 0xf2, 0x8e,
+  0xa0, 0xcf, 0xa0, 0x44, 0xe3, 0xee, 0xf5, 0xb8, 0x6b, 0x28, 0x1d, 0x3b,
+  0x8c, 0x12, 0xab, 0x40, 0xe0, 0x7e, 0xd4, 0x2b, 0x5f, 0x0c, 0x52, 0x86,
+  0xa8, 0x17, 0x61, 0xc2, 0x12, 0x21, 0x71, 0x9d, 0xb0, 0x00, 0x01, 0x8f,
+  0x64, 0x7c, 0x91, 0xaf, 0x14, 0x9c, 0xa7, 0xfe, 0x66, 0x8a, 0xdd, 0x4f,
+  0x49, 0x0e, 0x8e, 0x38, 0x92, 0x95, 0x58, 0x7a, 0x6c, 0xdb, 0x89, 0x8f,
+  0xa7, 0x81, 0x45, 0xbf, 0xf0, 0x6f, 0x8a, 0x96, 0x90, 0x10, 0x68, 0xdf,
+  0x2f, 0x1d, 0x2a, 0x25, 0x96, 0xd0, 0x4f, 0x17, 0x6d, 0x1f, 0x70, 0x1d,
+  0xc4, 0xdf, 0x83, 0x4c, 0xea, 0x0b, 0xd9, 0xde, 0xd1, 0x7b, 0x48, 0x64,
+  0x6d, 0x4b, 0x59, 0xa2, 0xd2, 0xb5, 0x1b, 0x8f, 0x75, 0x46, 0x63, 0x07,
+  0x1f, 0xb0, 0x25, 0x71, 0x7f, 0x79, 0xec, 0x0b, 0x78, 0x59, 0x19, 0x89,
+  0xfd, 0x2c, 0x40, 0x2f, 0x3d, 0x5a, 0x11, 0xdc, 0xda, 0x17, 0x91, 0x3d,
+  0x79, 0x31, 0xf3, 0xdf, 0x8d, 0xd4, 0x5c, 0xdf, 0x1b, 0x1b, 0x34, 0x54,
+  0x7e, 0xf7, 0x38, 0xa0, 0xad, 0x57, 0x1f, 0x1b, 0x7d, 0x88, 0xf5, 0xcb,
+  0x63, 0x7d, 0xca, 0xb9, 0xf9, 0x18, 0xd7, 0x3e, 0x2b, 0xf4, 0xde, 0x43,
+  0x92, 0x8d, 0x7e, 0xf7, 0x00, 0x42, 0x5a, 0x60, 0x08, 0x84, 0x0c, 0xc6,
+  0xf8, 0x9b, 0x1e, 0x8f, 0xc2, 0x1a, 0x41, 0xcd, 0xb7, 0x3d, 0xac, 0x04,
+  0x32, 0xea, 0xd2, 0xa0, 0xd4, 0xa4, 0x66, 0x2b, 0x3d, 0xe8, 0xda, 0x99,
+  0xca, 0xb4, 0x8f, 0x91, 0x7c, 0x7c, 0x74, 0x3b, 0x24, 0xa0, 0x80, 0xd7,
+  0x08, 0x50, 0xb9, 0xe2, 0x57, 0x6d, 0xee, 0x39, 0x25, 0x37, 0x81, 0xb2,
+  0xac, 0xa2, 0xf9, 0x2d, 0x31, 0x0c, 0x0d, 0x23, 0x90, 0x6d, 0xdd, 0x4b,
+  0x1c, 0x64, 0x90, 0x95, 0xeb, 0x3f, 0x4d, 0x28, 0xa5, 0xf7, 0x08, 0x4b,
+  0x8f, 0xfe, 0x0d, 0x8d, 0x99, 0x13, 0x1e, 0xe0, 0x40, 0x17, 0x8d, 0xfb,
+  0x6d, 0x05, 0xbf, 0x02, 0x95, 0xef, 0x52, 0x57, 0x0c, 0x71, 0xa1, 0xab,
+  0xbb, 0xdf, 0x06, 0x00, 0xca, 0x6b, 0xec, 0x97, 0xc7, 0x23, 0x0e, 0xae,
+  0xbc, 0xff, 0xaa, 0x94, 0x9e, 0xc4, 0x18, 0x4f, 0x22, 0x08, 0xc8, 0xbf,
+  0x5b, 0x86, 0x27, 0xed, 0xc4, 0x99, 0x1e, 0x7e, 0xb8, 0xed, 0x27, 0x11,
+  0x37, 0x36, 0xe4, 0x25, 0x2b, 0xa5, 0x7b, 0xc4, 0xc8, 0x26, 0xb9, 0x17,
+  0x78, 0x75, 0xf8, 0x8b, 0x23, 0x5a, 0x8f, 0x55, 0xbd, 0xf1, 0x4f, 0x14,
+  0x8c, 0x7f, 0xb4, 0x61, 0xd7, 0x62, 0x7e, 0xc8, 0xca, 0x45, 0xff, 0x61,
+  0x04, 0xaa, 0xfc, 0x13, 0x8d, 0x1e, 0x0b, 0x51, 0xb7, 0xd2, 0xf5, 0xe7,
+  0x1f, 0xb3, 0x2b, 0x2f, 0x38, 0xd5, 0x17, 0x5c, 0x14, 0x0a, 0xae, 0x6b,
+  0x43, 0xb1, 0x04, 0xa9, 0x3e, 0xed, 0x4b, 0xff, 0x0f, 0x4c, 0x7a, 0xda,
+  0xb6, 0xdb, 0xa6, 0x2c, 0xad, 0xbc, 0x40, 0x79, 0x74, 0x74, 0xf6, 0x08,
+  0x11, 0x25, 0xcd, 0xab, 0xdf, 0x7d, 0x43, 0xd7, 0xd4, 0x3c, 0xbc, 0xe4,
+  0x97, 0xad, 0x03, 0x06, 0xfa, 0x99, 0x5e, 0x85, 0x91, 0x01, 0xa7, 0x08,
+  0x18, 0x11, 0x60, 0x82, 0xb5, 0xb1, 0x6a, 0xa8, 0x9b, 0xd2, 0x7a, 0xdc,
+  0xef, 0x1f, 0xf9, 0xf1, 0xa4, 0x9e, 0x8d, 0xe3, 0xc1, 0xbd, 0x4c, 0xe2,
+  0x33, 0xbe, 0xb6, 0x72, 0x99, 0x54, 0x1e, 0x47, 0xb5, 0xef, 0x6e, 0x52,
+  0xea, 0x26, 0xcb, 0x63, 0xe7, 0x55, 0x4f, 0x50, 0x88, 0x25, 0x54, 0x49,
+  0x24, 0x8c, 0x8f, 0x49, 0x43, 0x8f, 0xa5, 0xcc, 0xaf, 0x49, 0xfb, 0x5a,
+  0x83, 0x6e, 0x46, 0x93, 0x4f, 0x91, 0xb0, 0x3c, 0x5a, 0x70, 0x3b, 0x5d,
+  0x8d, 0x17, 0xb5, 0xd3, 0x1a, 0x37, 0x69, 0x9e, 0x27, 0x3b, 0x93, 0xa9,
+  0xbf, 0x5e, 0xcd, 0xf8, 0x17, 0x0a, 0x83, 0x89, 0x6c, 0xca, 0x13, 0xd9,
+  0xef, 0x62, 0x99, 0xcb, 0x5e, 0x25, 0x55, 0x0a, 0x7f, 0xf9, 0x29, 0x01,
+  0xb3, 0x48, 0xc5, 0x3e, 0x99, 0x28, 0xba, 0x6d, 0x5b, 0x7c, 0xe4, 0xab,
+  0xe1, 0x6f, 0x95, 0xd1, 0x6c, 0x9b, 0xde, 0xde, 0xf1, 0xef, 0x11, 0x20,
+  0xbf, 0xa7, 0xd7, 0x6c, 0xee, 0x0d, 0xc1, 0x8e, 0x7f, 0xc7, 0x4c, 0x95,
+  0xcb, 0x3a, 0xf1, 0x13, 0x2a, 0x0a, 0x43, 0x91, 0x0f, 0x09, 0xed, 0x73,
+  0x23, 0x0e, 0xa7, 0xd6, 0x96, 0xa9, 0xe1, 0x5f, 0x7d, 0xf3, 0xf5, 0xa1,
+  0xbb, 0x2b, 0x35, 0xfa, 0xd4, 0x13, 0x9e, 0xd9, 0x78, 0xbd, 0x9f, 0x9c,
+  0xf2, 0x21, 0x99, 0x4e, 0xf2, 0xc8, 0x25, 0x2b, 0xad, 0x49, 0xf8, 0x7e,
+  0x79, 0xf0, 0x8b, 0x60, 0xe1, 0x64, 0xc1, 0x7f, 0xcd, 0x5d, 0x35, 0xf7,
+  0x74, 0xa0, 0xfd, 0x7d, 0xb5, 0x08, 0x44, 0x1b, 0xcb, 0xcf, 0x65, 0x76,
+  0x50, 0x9e, 0x34, 0xc7, 0xf1, 0xb7, 0xe6, 0x6b, 0x39, 0x5b, 0x8c, 0x83,
+  0x21, 0x33, 0x8d, 0x62, 0x97, 0x79, 0x10, 0xf1, 0x79, 0xce, 0xa1, 0xf9,
+  0x71, 0x37, 0x0f, 0x9d, 0x9d, 0xd5, 0x78, 0xee, 0x62, 0xff, 0x24, 0x41,
+  0x6a, 0x44, 0x27, 0x22, 0x86, 0x90, 0xfd, 0x46, 0x66, 0x15, 0xbd, 0x57,
+  0x40, 0xee, 0x09, 0xb7, 0xa4, 0xe4, 0x48, 0x05, 0x6c, 0x19, 0x47, 0x38,
+  0x91, 0x9b, 0x54, 0x0e, 0x9a, 0x3b, 0x7c, 0xe9, 0x10, 0x05, 0xc9, 0x01,
+  0x45, 0x99, 0x64, 0x89, 0xdc, 0xe4, 0xb0, 0x05, 0xd0, 0x16, 0xe4, 0x5d,
+  0xe3, 0xd6, 0x7f, 0xd5, 0xbe, 0x56, 0x74, 0x3d, 0x04, 0xee, 0x9f, 0x90,
+  0x39, 0xfb, 0xd2, 0xbe, 0xa2, 0x0b, 0xd3, 0xf3, 0xb8, 0x9a, 0x3a, 0x94,
+  0xc3, 0x86, 0x52, 0xf0, 0xc4, 0xea, 0xee, 0xdd, 0x44, 0x2d, 0x6e, 0xde,
+  0xdc, 0x7d, 0x18, 0xcf, 0x27, 0x6a, 0xba, 0x50, 0xb7, 0xf3, 0x9b, 0xbf,
+  0x4c, 0x2f, 0x27, 0x97, 0xea, 0x64, 0xbc, 0xc0, 0xcf, 0x27, 0xb1, 0xfa,
+  0x30, 0xbd, 0x7b, 0x77, 0xf3, 0xfe, 0x4e, 0x61, 0xc5, 0x7c, 0x7c, 0x7d,
+  0xf7, 0xb3, 0xba, 0x79, 0xa3, 0xc6, 0xd7, 0x3f, 0xab, 0x9f, 0xa6, 0xd7,
+  0x97, 0xb1, 0x9a, 0xfc, 0xf5, 0x76, 0x3e, 0x59, 0x2c, 0xd4, 0xcd, 0x3c,
+  0x9a, 0x5e, 0xdd, 0xce, 0xa6, 0x13, 0x7c, 0x36, 0xbd, 0xbe, 0x98, 0xbd,
+  0xbf, 0x9c, 0x5e, 0xbf, 0x55, 0xaf, 0xb1, 0xef, 0xfa, 0xe6, 0x4e, 0xcd,
+  0xa6, 0x57, 0xd3, 0x3b, 0x10, 0xbd, 0xbb, 0x51, 0x74, 0xa0, 0x23, 0x35,
+  0x9d, 0x2c, 0x88, 0xd8, 0xd5, 0x64, 0x7e, 0xf1, 0x0e, 0x3f, 0x8e, 0x5f,
+  0x4f, 0x67, 0xd3, 0xbb, 0x9f, 0xe3, 0xe8, 0xcd, 0xf4, 0xee, 0x9a, 0x68,
+  0xbe, 0xb9, 0x99, 0xa3, 0x98, 0xbc, 0x1d, 0xcf, 0xef, 0xa6, 0x17, 0xef,
+  0x67, 0xe3, 0xb9, 0xba, 0x7d, 0x3f, 0xbf, 0xbd, 0x59, 0x4c, 0x70, 0xfc,
+  0x25, 0xc8, 0x5e, 0x4f, 0xaf, 0xdf, 0xcc, 0x71, 0xca, 0xe4, 0x6a, 0x72,
+  0x7d, 0x07, 0xe4, 0xbc, 0xc6, 0x67, 0x6a, 0xf2, 0x17, 0xfc, 0xa0, 0x16,
+  0xef, 0xc6, 0xb3, 0x19, 0xdf, 0x6d, 0xfc, 0x1e, 0xdc, 0xcf, 0x89, 0x3f,
+  0x75, 0x71, 0x73, 0xfb, 0xf3, 0x7c, 0xfa, 0xf6, 0xdd, 0x9d, 0x7a, 0x77,
+  0x33, 0xbb, 0x9c, 0xe0, 0xc3, 0xd7, 0x13, 0x70, 0x36, 0x7e, 0x3d, 0x9b,
+  0xc8, 0x51, 0xb8, 0xd4, 0xc5, 0x6c, 0x3c, 0xbd, 0x8a, 0xd5, 0xe5, 0xf8,
+  0x6a, 0xfc, 0x76, 0xc2, 0xbb, 0x6e, 0x40, 0x65, 0x1e, 0xd1, 0x32, 0xe1,
+  0x4e, 0x7d, 0x78, 0x37, 0xa1, 0x8f, 0xe8, 0xbc, 0x31, 0xfe, 0x77, 0x71,
+  0x37, 0xbd, 0xb9, 0xa6, 0x6b, 0x5c, 0xdc, 0x5c, 0xdf, 0xcd, 0xf1, 0x63,
+  0x8c, 0x5b, 0xce, 0xef, 0xda, 0xad, 0x1f, 0xa6, 0x8b, 0x49, 0xac, 0xc6,
+  0xf3, 0xe9, 0x82, 0x04, 0xf2, 0x66, 0x7e, 0x73, 0x15, 0x47, 0x24, 0x4e,
+  0xec, 0xb8, 0x61, 0x22, 0xd8, 0x77, 0x3d, 0x11, 0x2a, 0x24, 0x6a, 0xd5,
+  0xd3, 0x08, 0x96, 0xd0, 0xcf, 0xef, 0x17, 0x93, 0x96, 0xa0, 0xba, 0x9c,
+  0x8c, 0x67, 0xa0, 0xb5, 0x88, 0xb0, 0x39, 0x5c, 0x4c, 0xef, 0x1f, 0x08,
+  0x3e, 0x3e, 0xfe, 0x6b, 0xa3, 0x81, 0xaa, 0x84, 0x1d, 0xee, 0x9f, 0x3f,
+  0x26, 0xf7, 0xc9, 0x22, 0xad, 0xcc, 0xae, 0x6e, 0x31, 0xf7, 0xfe, 0xf9,
+  0xe8, 0xbb, 0xd1, 0x79, 0xe4, 0xde, 0x6e, 0x7c, 0xfc, 0x85, 0xd6, 0xf1,
+  0x43, 0x96, 0x28, 0x00, 0x9c, 0xf3, 0x67, 0xcf, 0x51, 0x97, 0xfc, 0x58,
+  0x6e, 0x0a, 0xe4, 0x52, 0xd6, 0xac, 0xa3, 0x4b, 0x7a, 0x20, 0xe5, 0xfc,
+  0x28, 0xcc, 0x21, 0xa1, 0x5d, 0xb2, 0x39, 0xea, 0x40, 0xf8, 0x4e, 0xc7,
+  0xb9, 0x5f, 0x87, 0x3c, 0xa2, 0x7f, 0x0a, 0x3d, 0x12, 0xf1, 0x0d, 0xb6,
+  0x68, 0x2a, 0x06, 0x6c, 0xd5, 0xc2, 0xfc, 0xfa, 0x6b, 0xae, 0x47, 0x1f,
+  0xad, 0x5f, 0x6d, 0xf9, 0x83, 0x8f, 0x56, 0xb8, 0x1a, 0x32, 0x45, 0x7e,
+  0x73, 0x59, 0x7e, 0x2c, 0x83, 0xd0, 0x12, 0xcd, 0x75, 0xae, 0x93, 0x03,
+  0xc6, 0x62, 0xf5, 0x7a, 0x71, 0x29, 0x0e, 0x4d, 0xfc, 0xcd, 0x5a, 0xae,
+  0x58, 0x58, 0x77, 0x1b, 0x80, 0x22, 0x4e, 0x65, 0x71, 0xdd, 0xb9, 0xab,
+  0xf8, 0x99, 0x5e, 0x70, 0xea, 0x7f, 0xff, 0x17, 0x1d, 0xfc, 0xec, 0x0c,
+  0x7f, 0x7c, 0x0b, 0xca, 0x6e, 0x93, 0xc0, 0xbd, 0xfd, 0x07, 0xf0, 0xfe,
+  0x61, 0xe0, 0x8d, 0xfa, 0x4d, 0xc8, 0xff, 0x23, 0xf0, 0x46, 0x47, 0x80,
+  0x57, 0xfd, 0xbd, 0x81, 0x37, 0x4a, 0xda, 0x38, 0xf2, 0x0f, 0xe0, 0x25,
+  0xe0, 0xa5, 0xa3, 0xa2, 0xff, 0xc7, 0xc0, 0x8b, 0xcd, 0xd1, 0x00, 0x78,
+  0x91, 0xb9, 0xfd, 0x2f, 0xdd, 0x80, 0x77, 0x11, 0x09, 0x42, 0x00, 0x00
+};
+unsigned int licenses_txt_gz_len = 5880;
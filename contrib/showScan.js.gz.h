@@ -0,0 +1,106 @@
+#pragma once
+
+unsigned char showScan_js_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x57,
+  0xdf, 0x6f, 0xdb, 0x36, 0x10, 0x7e, 0x96, 0xff, 0x0a, 0xf6, 0xa5, 0xa1,
+  0x37, 0x45, 0x49, 0xd4, 0xa4, 0x1b, 0xe2, 0xe5, 0xa1, 0xf3, 0xd2, 0xa4,
+  0x40, 0x8a, 0x19, 0xce, 0xb0, 0x2c, 0x18, 0xf6, 0x40, 0x4b, 0x67, 0x9b,
+  0x1b, 0x2d, 0x69, 0x94, 0xec, 0xd8, 0x69, 0xf3, 0xbf, 0xef, 0x78, 0x24,
+  0x65, 0x49, 0xb6, 0xbb, 0x56, 0x28, 0x2a, 0x8b, 0xf7, 0xfb, 0xbb, 0xe3,
+  0x47, 0x26, 0x58, 0x09, 0xcd, 0xca, 0x04, 0x32, 0x60, 0x57, 0x2c, 0x83,
+  0x27, 0xf6, 0xdb, 0xed, 0xf8, 0xfa, 0x3a, 0xba, 0x37, 0x2b, 0xbc, 0x3f,
+  0xe8, 0x05, 0x46, 0x9e, 0x88, 0x05, 0x68, 0xd1, 0x52, 0x18, 0x81, 0x2e,
+  0x0b, 0x48, 0x2a, 0xb9, 0x82, 0x21, 0x49, 0x39, 0x7b, 0x73, 0x1a, 0xb2,
+  0x27, 0x99, 0xa5, 0xf9, 0x53, 0x24, 0xb3, 0x0c, 0xf4, 0x83, 0x4c, 0xab,
+  0xf9, 0x49, 0x73, 0xe5, 0x16, 0xe4, 0x6c, 0x5e, 0x85, 0xec, 0x2c, 0x42,
+  0xd5, 0xb3, 0x53, 0x7c, 0x58, 0x1d, 0x22, 0xcf, 0x2a, 0x9d, 0xab, 0xd2,
+  0x7d, 0x8e, 0x3e, 0xc4, 0x18, 0xee, 0xa3, 0xa8, 0xe6, 0xd1, 0xe8, 0x03,
+  0xfb, 0x8e, 0xc5, 0x83, 0xc0, 0xa7, 0x92, 0xad, 0x44, 0x39, 0xd2, 0xf9,
+  0x4c, 0x8b, 0x05, 0xaa, 0x4c, 0x97, 0x19, 0x26, 0x91, 0x67, 0x8c, 0x93,
+  0x0b, 0x58, 0x57, 0xac, 0xcf, 0x3e, 0xf5, 0x82, 0xe0, 0xe4, 0xc4, 0x7d,
+  0x47, 0x13, 0x98, 0xc9, 0x6c, 0x84, 0xae, 0xa8, 0x9e, 0x86, 0x40, 0xe8,
+  0x84, 0x33, 0xcc, 0xc4, 0xfc, 0x8b, 0x2e, 0xe8, 0x8d, 0x71, 0x43, 0x56,
+  0xe9, 0x25, 0x60, 0x62, 0x41, 0xd0, 0xd2, 0x9e, 0x4a, 0xa5, 0xac, 0x87,
+  0x03, 0x8e, 0x9b, 0x8a, 0x63, 0x84, 0x86, 0x5b, 0xd7, 0xb6, 0xd8, 0xe8,
+  0x74, 0x47, 0x87, 0xac, 0x5e, 0x06, 0xbd, 0x5e, 0x50, 0x17, 0xf1, 0x04,
+  0x93, 0x99, 0x7a, 0xb7, 0x12, 0x52, 0x89, 0x89, 0x42, 0xfc, 0xa9, 0x92,
+  0x4a, 0x6f, 0xe8, 0xdd, 0xa8, 0x1f, 0x0b, 0x4f, 0xf3, 0x64, 0xb9, 0x80,
+  0xac, 0x8a, 0x12, 0x0d, 0xa2, 0x82, 0x6b, 0x05, 0xe6, 0x8b, 0xb3, 0x23,
+  0xab, 0x71, 0x44, 0xc8, 0x06, 0x81, 0x86, 0x6a, 0xa9, 0x33, 0xf6, 0xea,
+  0x15, 0xf7, 0xbd, 0x79, 0x80, 0xc9, 0xcd, 0xdd, 0x18, 0xb2, 0x14, 0xb4,
+  0xcc, 0x66, 0x43, 0x07, 0xda, 0xeb, 0xd7, 0x8c, 0x1b, 0xfd, 0xc0, 0x9a,
+  0x47, 0x33, 0xa8, 0x9c, 0x08, 0x5d, 0x52, 0x5a, 0xe8, 0x91, 0x7d, 0xfe,
+  0x7c, 0x50, 0x07, 0xd6, 0x05, 0x3a, 0x34, 0x39, 0x08, 0x75, 0x5c, 0x1b,
+  0xf4, 0x8d, 0x3e, 0x65, 0xf2, 0x82, 0xa9, 0x57, 0xc9, 0x1c, 0xfb, 0x04,
+  0xae, 0x43, 0x3e, 0xb7, 0xa9, 0x50, 0x25, 0x90, 0x0a, 0xc2, 0xd1, 0x44,
+  0x43, 0xa4, 0xe9, 0x28, 0x97, 0x59, 0x55, 0x52, 0xca, 0x1c, 0x56, 0xe8,
+  0xdc, 0x9a, 0x1a, 0x24, 0x66, 0x90, 0x2f, 0xc0, 0x60, 0x73, 0xc5, 0x48,
+  0x12, 0x11, 0xb6, 0x59, 0x35, 0x70, 0xf2, 0x22, 0xc1, 0xf1, 0xc1, 0x94,
+  0x84, 0x6a, 0x0f, 0x2e, 0x79, 0xf4, 0x22, 0x6e, 0x33, 0x29, 0xe5, 0x33,
+  0x5c, 0x62, 0x93, 0x7e, 0xb8, 0x08, 0x09, 0x68, 0xd0, 0x58, 0xd5, 0x30,
+  0x57, 0xb9, 0x2e, 0x2f, 0x9d, 0xdd, 0xef, 0x8d, 0x35, 0x2a, 0x87, 0xaa,
+  0xf2, 0x49, 0x44, 0xcb, 0x12, 0x48, 0x86, 0xb1, 0xcc, 0xf8, 0xf8, 0x24,
+  0x16, 0x50, 0xce, 0xf7, 0x84, 0xe7, 0x75, 0xf6, 0x61, 0x33, 0x4f, 0x72,
+  0x49, 0x9b, 0x31, 0xc2, 0xda, 0xb9, 0xb5, 0xa6, 0x29, 0xe9, 0x05, 0xfb,
+  0x70, 0x19, 0x52, 0x1f, 0xbe, 0x15, 0x18, 0x53, 0x9d, 0x4c, 0xc0, 0x0c,
+  0x51, 0x9d, 0xbe, 0x5f, 0xf3, 0x3a, 0x09, 0xd5, 0xd9, 0xd4, 0xb0, 0x2b,
+  0x5e, 0x3e, 0xd3, 0xf9, 0xb2, 0x68, 0x15, 0x76, 0x63, 0x56, 0x78, 0xb7,
+  0x02, 0xab, 0x47, 0xab, 0x53, 0x04, 0x87, 0x33, 0x63, 0x2c, 0xd1, 0xf0,
+  0x74, 0x80, 0xaf, 0x9f, 0xea, 0x5c, 0x22, 0x05, 0xd9, 0xac, 0x9a, 0xe3,
+  0xe2, 0xf7, 0x57, 0x76, 0xba, 0x2c, 0xde, 0xf7, 0xff, 0xc8, 0xc2, 0x8f,
+  0x8b, 0xed, 0x0a, 0xda, 0x7a, 0xa3, 0x3f, 0xe5, 0x5f, 0x34, 0xe3, 0x89,
+  0x03, 0xde, 0xa6, 0xe8, 0x57, 0x09, 0xfe, 0x7d, 0x13, 0x70, 0x5f, 0x68,
+  0x59, 0x81, 0xc5, 0xae, 0x33, 0x07, 0xd6, 0xd5, 0xa5, 0xf5, 0x44, 0xa3,
+  0x10, 0x14, 0x96, 0x6a, 0x2e, 0xdb, 0xcc, 0x63, 0x44, 0x6e, 0x04, 0x82,
+  0x42, 0x98, 0x74, 0x14, 0xec, 0x09, 0xc2, 0xb7, 0x19, 0x18, 0x3e, 0x09,
+  0x9a, 0xea, 0x51, 0x91, 0x97, 0xd2, 0xf4, 0x33, 0xf2, 0x35, 0xc1, 0x3a,
+  0x5a, 0x0f, 0xf6, 0xab, 0x6c, 0xb6, 0x2a, 0x9b, 0x03, 0x2a, 0xcf, 0x5b,
+  0x95, 0xe7, 0xb6, 0x4a, 0x99, 0x08, 0xfc, 0xdf, 0x44, 0xe9, 0x2c, 0x19,
+  0xaf, 0x67, 0xa4, 0x4b, 0x7d, 0xb2, 0x2d, 0xab, 0xcb, 0xe9, 0xd7, 0x7b,
+  0x12, 0xf3, 0x96, 0x53, 0xc6, 0x71, 0xc6, 0x69, 0x27, 0xda, 0x7e, 0xf8,
+  0x2f, 0xf4, 0xd1, 0xa5, 0xad, 0xc1, 0x41, 0x23, 0x4d, 0xbc, 0x03, 0xba,
+  0x85, 0x55, 0x83, 0x91, 0x40, 0xf3, 0x4f, 0x4c, 0xa8, 0x62, 0x2e, 0x2e,
+  0x2d, 0x0d, 0xbf, 0x90, 0x33, 0x06, 0x48, 0x11, 0x87, 0x1d, 0xd8, 0x5e,
+  0xd6, 0x1e, 0x28, 0x71, 0xaf, 0x18, 0x95, 0x50, 0x8d, 0xe4, 0x1a, 0xd4,
+  0x58, 0x20, 0x4c, 0x35, 0x0b, 0xa6, 0xb0, 0xc2, 0x11, 0xda, 0x0a, 0xec,
+  0x36, 0x0b, 0x4c, 0xd6, 0x4d, 0xcb, 0x7b, 0x24, 0x06, 0xbe, 0x7b, 0xaa,
+  0xb5, 0x0f, 0x3a, 0x7b, 0xac, 0x91, 0x87, 0xa6, 0xed, 0x50, 0x81, 0xd0,
+  0x44, 0x0a, 0x78, 0xca, 0xac, 0x2f, 0xe8, 0xc1, 0x93, 0xa0, 0x6f, 0x18,
+  0xbf, 0x66, 0xef, 0x49, 0x9e, 0x6e, 0x22, 0x51, 0x14, 0x68, 0x37, 0x9c,
+  0x4b, 0x85, 0xf8, 0xd7, 0x2e, 0xd2, 0x7c, 0xe1, 0x58, 0x9d, 0x5c, 0xbb,
+  0x88, 0xd8, 0xa3, 0x6b, 0xb3, 0xab, 0xef, 0x64, 0x89, 0x9b, 0x1a, 0xab,
+  0x65, 0x47, 0x1a, 0x0c, 0x7f, 0x1d, 0x85, 0x2c, 0xcf, 0x1e, 0x48, 0x69,
+  0x4c, 0x0b, 0xa1, 0x65, 0x56, 0x46, 0x01, 0xcd, 0x6e, 0x50, 0xb9, 0x48,
+  0x3b, 0xc8, 0x8d, 0xee, 0x1e, 0xef, 0x68, 0x95, 0x40, 0xeb, 0xf4, 0xcb,
+  0x8c, 0xab, 0xb5, 0xd9, 0x17, 0xd5, 0x48, 0x30, 0x66, 0x9b, 0xa4, 0x3b,
+  0xdd, 0xfa, 0x7a, 0x6b, 0xdb, 0xc2, 0x7a, 0x72, 0x9c, 0xa1, 0x79, 0xf1,
+  0x42, 0x6d, 0xde, 0x4b, 0xe4, 0x07, 0xbc, 0x66, 0xd4, 0xa5, 0x24, 0x1b,
+  0xe5, 0x50, 0xb7, 0x13, 0xec, 0xd6, 0xc6, 0x22, 0x95, 0x4b, 0x43, 0x5b,
+  0x6f, 0xcd, 0x9d, 0xe1, 0x22, 0x3a, 0xdf, 0x8a, 0x6e, 0xb6, 0xac, 0xd8,
+  0x18, 0x9c, 0x8d, 0x92, 0x06, 0x6d, 0x2f, 0xe4, 0x5b, 0x27, 0x61, 0xe7,
+  0xa7, 0xbf, 0xbb, 0xbc, 0x3d, 0xdf, 0xde, 0x59, 0x36, 0x6a, 0xef, 0x11,
+  0xf3, 0x11, 0x69, 0xfb, 0x67, 0x51, 0xca, 0xa4, 0xc1, 0x2e, 0x8e, 0x58,
+  0x4e, 0xd7, 0x31, 0x3d, 0xec, 0xa5, 0xe9, 0x85, 0x72, 0xd8, 0x71, 0xc1,
+  0x9b, 0x69, 0x87, 0xad, 0x68, 0xc6, 0xd6, 0xdb, 0x45, 0x95, 0x16, 0x59,
+  0xa9, 0x50, 0xf4, 0xc8, 0xd9, 0x71, 0x9d, 0xe9, 0x49, 0x4c, 0x5a, 0x0d,
+  0x2e, 0xae, 0x03, 0xed, 0xa2, 0x68, 0x2e, 0x5b, 0x3f, 0x76, 0x61, 0x8c,
+  0xbf, 0x88, 0x63, 0xfc, 0xb5, 0x40, 0xc6, 0x61, 0xf7, 0xb7, 0x8b, 0x79,
+  0x08, 0xcb, 0xf8, 0x7f, 0xc1, 0x64, 0x35, 0x9a, 0x82, 0x9e, 0x3d, 0x68,
+  0xc6, 0x5f, 0x86, 0x33, 0x0e, 0xdb, 0x11, 0x9b, 0x80, 0xc6, 0x07, 0x10,
+  0x8d, 0x11, 0xd2, 0xe3, 0xc6, 0xe4, 0x1d, 0x80, 0x37, 0xb6, 0xf8, 0xda,
+  0x3b, 0x73, 0x9b, 0x9e, 0xdf, 0x5c, 0x9c, 0x0e, 0x76, 0x25, 0x66, 0x24,
+  0xcf, 0xad, 0xc4, 0x5d, 0x82, 0x5b, 0xb9, 0xff, 0xaa, 0x27, 0x92, 0xee,
+  0x59, 0x46, 0xc2, 0xfd, 0x5d, 0xbc, 0xdf, 0x50, 0x8f, 0x16, 0x62, 0xfd,
+  0x0b, 0x6e, 0x2d, 0x91, 0x25, 0xe6, 0x10, 0x32, 0x17, 0x6b, 0xdf, 0x61,
+  0x4b, 0x26, 0xad, 0x7b, 0xb2, 0x27, 0xe2, 0x7f, 0x97, 0x50, 0x56, 0xef,
+  0x32, 0xb9, 0x30, 0xf4, 0x97, 0xbd, 0xc7, 0x43, 0x0d, 0x3c, 0xf9, 0xb0,
+  0x36, 0x83, 0xda, 0x1f, 0x9c, 0x6a, 0x0d, 0x5d, 0x02, 0xf5, 0xdd, 0xd5,
+  0x09, 0xa9, 0xe6, 0xc6, 0x1d, 0xa5, 0x4d, 0x45, 0x2e, 0xa8, 0xa5, 0xb0,
+  0x5b, 0xa1, 0xa6, 0x7f, 0x98, 0x53, 0xa3, 0xcb, 0xaa, 0xec, 0x04, 0xef,
+  0xf9, 0x2d, 0xb5, 0xc7, 0x8e, 0x9a, 0x43, 0xde, 0xe9, 0x39, 0x20, 0x05,
+  0xfd, 0x21, 0x72, 0xc0, 0xe1, 0xae, 0x75, 0xc3, 0x72, 0x59, 0xa4, 0xd8,
+  0x64, 0x3c, 0xd2, 0xff, 0x06, 0xca, 0x1a, 0xe7, 0x41, 0xcb, 0xf5, 0xee,
+  0xf9, 0xf1, 0xad, 0xa7, 0xc0, 0x4b, 0xef, 0x3f, 0xd8, 0xc2, 0x70, 0x38,
+  0x57, 0x0d, 0x00, 0x00
+};
+unsigned int showScan_js_gz_len = 1204;
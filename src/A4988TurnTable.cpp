@@ -23,10 +23,29 @@
 #include "Thread.h"
 #include "Setup.h"
 #include "PresetManager.h"
+#include "MotionPlanner.h"
 
 namespace freelss
 {
 
+/** Sleeps until the given number of nanoseconds after start */
+static void SleepUntil(const struct timespec& start, long long offsetNs)
+{
+	struct timespec deadline;
+	deadline.tv_sec = start.tv_sec + offsetNs / 1000000000LL;
+	deadline.tv_nsec = start.tv_nsec + offsetNs % 1000000000LL;
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+	{
+		// Keep sleeping
+	}
+}
+
 A4988TurnTable::A4988TurnTable()
 {
 	Setup * setup = Setup::get();
@@ -37,10 +56,14 @@ A4988TurnTable::A4988TurnTable()
 	m_directionPin = setup->motorDirPin;
 	m_stepsPerRevolution = setup->stepsPerRevolution;
 	m_stabilityDelay = PresetManager::get()->getActivePreset().stabilityDelay;
+	m_stabilityDelayEnabled = true;
+	m_planner = MotionPlanner::createFromSetup();
 }
 
 A4988TurnTable::~A4988TurnTable()
 {
+	delete m_planner;
+
 	// Disable the stepper
 	digitalWrite(m_enablePin, HIGH);
 	Thread::usleep(m_responseDelay);
@@ -70,29 +93,48 @@ void A4988TurnTable::initialize()
 
 void A4988TurnTable::step()
 {
-	digitalWrite(m_stepPin, LOW);
-	Thread::usleep(m_responseDelay);
-
+	// The driver steps on the rising edge
 	digitalWrite(m_stepPin, HIGH);
 	Thread::usleep(m_responseDelay);
 
-	// Wait the step delay (this is how speed is controlled)
-	Thread::usleep(m_stepDelay);
+	digitalWrite(m_stepPin, LOW);
 }
 
 int A4988TurnTable::rotate(real theta)
 {
-	// Get the percent of a full revolution that theta is and convert that to number of steps
-	int numSteps = (theta / (2 * PI)) * m_stepsPerRevolution;
+	// Get the percent of a full revolution that theta is and convert that to number of steps.
+	// Round it so an angle that is a whole number of steps doesn't lose one to float error.
+	int numSteps = (int) floor((theta / (2 * PI)) * m_stepsPerRevolution + 0.5);
+
+	// Reverse the motor for negative angles
+	if (numSteps < 0)
+	{
+		digitalWrite(m_directionPin, HIGH);
+		Thread::usleep(m_responseDelay);
+	}
+
+	// Plan when each step is taken so the motor speeds up and slows down smoothly
+	std::vector<long long> stepTimes;
+	long long moveTime = m_planner->plan(ABS(numSteps), stepTimes);
+
+	// Sleep until each step's deadline so the time spent stepping doesn't add up
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
 
-	// Step the required number of steps
-	for (int i = 0; i < numSteps; i++)
+	for (size_t iStep = 0; iStep < stepTimes.size(); iStep++)
 	{
+		SleepUntil(start, stepTimes[iStep]);
 		step();
 	}
 
-	// Sleep the stability delay amount
-	Thread::usleep(m_stabilityDelay);
+	if (numSteps < 0)
+	{
+		digitalWrite(m_directionPin, LOW);
+	}
+
+	// Sleep the stability delay amount after the last step is complete
+	long long stabilityDelay = m_stabilityDelayEnabled ? m_stabilityDelay * 1000LL : 0;
+	SleepUntil(start, moveTime + stabilityDelay);
 
 	return numSteps;
 }
@@ -105,4 +147,9 @@ void A4988TurnTable::setMotorEnabled(bool enabled)
 	Thread::usleep(MAX(m_responseDelay, m_stabilityDelay));
 }
 
+void A4988TurnTable::setStabilityDelayEnabled(bool enabled)
+{
+	m_stabilityDelayEnabled = enabled;
+}
+
 }
@@ -25,6 +25,8 @@
 namespace freelss
 {
 
+class MotionPlanner;
+
 /**
  * An implementation of the TurnTable class that works
  * with the A4988 motor driver.
@@ -35,20 +37,26 @@ public:
 	A4988TurnTable();
 	~A4988TurnTable();
 
-	/** Rotates this amount in radians */
+	/** Rotates this amount in radians, negative angles rotate backwards */
 	int rotate(real theta);
 
 	/** Enable/Disable the stepper motor */
 	void setMotorEnabled(bool enabled);
 
+	/** Sets whether rotate() waits the stability delay */
+	void setStabilityDelayEnabled(bool enabled);
+
 	/** Initialize the turn table */
 	static void initialize();
 
 private:
 
-	/** Move to the next step */
+	/** Pulses the step pin */
 	void step();
 
+	/** Schedules the steps of each move */
+	MotionPlanner * m_planner;
+
 	/** The time to sleep between steps in microseconds */
 	int m_stepDelay;
 
@@ -69,6 +77,9 @@ private:
 
 	/** The time to sleep between steps in microseconds */
 	int m_stabilityDelay;
+
+	/** Indicates if rotate() sleeps the stability delay */
+	bool m_stabilityDelayEnabled;
 };
 
 }
@@ -0,0 +1,90 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "AsyncFileWriter.h"
+#include "AsyncWriter.h"
+#include "Logger.h"
+
+namespace freelss
+{
+
+AsyncFileWriter::AsyncFileWriter(AsyncWriter& asyncWriter, const char * filename) :
+	m_asyncWriter(asyncWriter),
+	m_filename(filename),
+	m_block(),
+	m_fd(-1)
+{
+	m_fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+	m_block.reserve(WRITE_BLOCK_SIZE);
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+	try
+	{
+		close();
+	}
+	catch (Exception& ex)
+	{
+		ErrorLog << "Error closing " << m_filename << ": " << ex << Logger::ENDL;
+	}
+	catch (...)
+	{
+		ErrorLog << "Error closing " << m_filename << Logger::ENDL;
+	}
+}
+
+void AsyncFileWriter::write(const char * data, size_t len)
+{
+	if (m_fd == -1)
+	{
+		return;
+	}
+
+	m_block.insert(m_block.end(), data, data + len);
+
+	if (m_block.size() >= WRITE_BLOCK_SIZE)
+	{
+		m_asyncWriter.write(m_fd, m_filename, m_block);
+		m_block.reserve(WRITE_BLOCK_SIZE);
+	}
+}
+
+void AsyncFileWriter::close()
+{
+	if (m_fd == -1)
+	{
+		return;
+	}
+
+	int fd = m_fd;
+	m_fd = -1;
+
+	m_asyncWriter.write(fd, m_filename, m_block);
+	m_asyncWriter.close(fd, m_filename);
+}
+
+bool AsyncFileWriter::is_open() const
+{
+	return m_fd != -1;
+}
+
+}
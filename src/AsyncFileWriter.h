@@ -0,0 +1,55 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "IWriter.h"
+
+namespace freelss
+{
+
+class AsyncWriter;
+
+/**
+ * Writes a file through an AsyncWriter.  The file is opened immediately so that
+ * errors can be reported to the caller but the data is collected into blocks that
+ * are written on the AsyncWriter thread.
+ */
+class AsyncFileWriter : public IWriter
+{
+public:
+	AsyncFileWriter(AsyncWriter& asyncWriter, const char * filename);
+	~AsyncFileWriter();
+
+	void write(const char * data, size_t len);
+	void close();
+	bool is_open() const;
+
+	/** The number of bytes collected before they are handed to the writer thread */
+	static const size_t WRITE_BLOCK_SIZE = 256 * 1024;
+
+private:
+	AsyncWriter& m_asyncWriter;
+	std::string m_filename;
+	std::vector<char> m_block;
+	int m_fd;
+};
+
+}
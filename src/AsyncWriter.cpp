@@ -0,0 +1,261 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "AsyncWriter.h"
+#include "Progress.h"
+#include "Logger.h"
+#include "Tracer.h"
+
+namespace freelss
+{
+
+AsyncWriter::AsyncWriter(Progress * progress, size_t maxQueuedBytes) :
+	m_requests(),
+	m_failedFds(),
+	m_progress(progress),
+	m_maxQueuedBytes(maxQueuedBytes),
+	m_queuedBytes(0),
+	m_running(false),
+	m_busy(false),
+	m_error("")
+{
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_cond, NULL);
+}
+
+AsyncWriter::~AsyncWriter()
+{
+	pthread_mutex_lock(&m_mutex);
+	bool running = m_running;
+	m_stopRequested = true;
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+
+	if (running)
+	{
+		try
+		{
+			join();
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << ex << Logger::ENDL;
+		}
+	}
+
+	// Only reached with requests left if the thread never started
+	for (std::list<Request>::iterator it = m_requests.begin(); it != m_requests.end(); ++it)
+	{
+		if (it->close)
+		{
+			::close(it->fd);
+		}
+	}
+
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+}
+
+void AsyncWriter::write(int fd, const std::string& filename, std::vector<char>& data)
+{
+	if (!data.empty())
+	{
+		enqueue(fd, filename, data, false);
+	}
+}
+
+void AsyncWriter::close(int fd, const std::string& filename)
+{
+	std::vector<char> data;
+	enqueue(fd, filename, data, true);
+}
+
+void AsyncWriter::enqueue(int fd, const std::string& filename, std::vector<char>& data, bool close)
+{
+	pthread_mutex_lock(&m_mutex);
+
+	// Start the thread the first time it is needed
+	if (!m_running)
+	{
+		try
+		{
+			execute();
+		}
+		catch (...)
+		{
+			pthread_mutex_unlock(&m_mutex);
+			throw;
+		}
+
+		m_running = true;
+	}
+
+	// Apply backpressure until the writer catches up.  An oversized block is allowed into an empty queue.
+	while (!m_requests.empty() && m_queuedBytes + data.size() > m_maxQueuedBytes)
+	{
+		pthread_cond_wait(&m_cond, &m_mutex);
+	}
+
+	m_requests.push_back(Request());
+
+	Request& request = m_requests.back();
+	request.fd = fd;
+	request.filename = filename;
+	request.data.swap(data);
+	request.close = close;
+
+	m_queuedBytes += request.data.size();
+
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void AsyncWriter::flush()
+{
+	pthread_mutex_lock(&m_mutex);
+
+	while (!m_requests.empty() || m_busy)
+	{
+		pthread_cond_wait(&m_cond, &m_mutex);
+	}
+
+	std::string error = m_error;
+	m_error = "";
+
+	pthread_mutex_unlock(&m_mutex);
+
+	if (!error.empty())
+	{
+		throw Exception(error);
+	}
+}
+
+std::string AsyncWriter::process(Request& request)
+{
+	std::string error;
+
+	// Skip the rest of a file that has already failed
+	bool failed = m_failedFds.find(request.fd) != m_failedFds.end();
+
+	if (!failed)
+	{
+		const char * data = request.data.empty() ? NULL : &request.data[0];
+		size_t remaining = request.data.size();
+
+		while (remaining > 0)
+		{
+			ssize_t numWritten = ::write(request.fd, data, remaining);
+			if (numWritten < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				error = "Error writing " + request.filename + ": " + strerror(errno);
+				break;
+			}
+
+			data += numWritten;
+			remaining -= numWritten;
+		}
+	}
+
+	if (request.close)
+	{
+		if (!failed && error.empty() && fsync(request.fd) != 0)
+		{
+			error = "Error syncing " + request.filename + ": " + strerror(errno);
+		}
+
+		if (::close(request.fd) != 0 && error.empty() && !failed)
+		{
+			error = "Error closing " + request.filename + ": " + strerror(errno);
+		}
+
+		m_failedFds.erase(request.fd);
+	}
+	else if (!error.empty())
+	{
+		m_failedFds.insert(request.fd);
+	}
+
+	return error;
+}
+
+void AsyncWriter::run()
+{
+	pthread_mutex_lock(&m_mutex);
+
+	while (true)
+	{
+		while (m_requests.empty() && !m_stopRequested)
+		{
+			pthread_cond_wait(&m_cond, &m_mutex);
+		}
+
+		// Queued data is still written when a stop is requested
+		if (m_requests.empty())
+		{
+			break;
+		}
+
+		Request request;
+		request.data.swap(m_requests.front().data);
+		request.fd = m_requests.front().fd;
+		request.filename = m_requests.front().filename;
+		request.close = m_requests.front().close;
+		m_requests.pop_front();
+
+		m_busy = true;
+		pthread_mutex_unlock(&m_mutex);
+
+		std::string error;
+		{
+			TraceScope trace("disk write");
+			error = process(request);
+		}
+
+		if (!error.empty())
+		{
+			ErrorLog << error << Logger::ENDL;
+
+			if (m_progress != NULL)
+			{
+				m_progress->setError(error);
+			}
+		}
+
+		pthread_mutex_lock(&m_mutex);
+		if (!error.empty() && m_error.empty())
+		{
+			m_error = error;
+		}
+
+		m_queuedBytes -= request.data.size();
+		m_busy = false;
+		pthread_cond_broadcast(&m_cond);
+	}
+
+	pthread_mutex_unlock(&m_mutex);
+}
+
+}
@@ -0,0 +1,89 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "Thread.h"
+
+namespace freelss
+{
+
+class Progress;
+
+/**
+ * Writes data to files on a dedicated thread so that slow storage, such as a
+ * network share, doesn't hold up the caller.  The amount of queued data is bounded
+ * and callers block when the queue is full.  Errors are logged and reported to
+ * the Progress object if one is given.
+ */
+class AsyncWriter : public Thread
+{
+public:
+	AsyncWriter(Progress * progress = NULL, size_t maxQueuedBytes = DEFAULT_MAX_QUEUED_BYTES);
+
+	/** Writes and closes anything still in the queue and stops the thread */
+	~AsyncWriter();
+
+	/**
+	 * Queues the data to be written to the given file descriptor.  The contents of data
+	 * are swapped out to avoid a copy so data is empty when this returns.
+	 */
+	void write(int fd, const std::string& filename, std::vector<char>& data);
+
+	/** Queues the file descriptor to be synced to disk and closed */
+	void close(int fd, const std::string& filename);
+
+	/** Blocks until everything queued has been written.  Throws if any of the writes failed. */
+	void flush();
+
+	void run();
+
+	/** The default limit on the number of bytes waiting to be written */
+	static const size_t DEFAULT_MAX_QUEUED_BYTES = 16 * 1024 * 1024;
+
+private:
+
+	struct Request
+	{
+		int fd;
+		std::string filename;
+		std::vector<char> data;
+		bool close;
+	};
+
+	/** Adds the request to the queue and takes the contents of data */
+	void enqueue(int fd, const std::string& filename, std::vector<char>& data, bool close);
+
+	/** Performs the request on the writer thread and returns any error */
+	std::string process(Request& request);
+
+	pthread_mutex_t m_mutex;
+	pthread_cond_t m_cond;
+	std::list<Request> m_requests;
+	std::set<int> m_failedFds;
+	Progress * m_progress;
+	size_t m_maxQueuedBytes;
+	size_t m_queuedBytes;
+	bool m_running;
+	bool m_busy;
+	std::string m_error;
+};
+
+}
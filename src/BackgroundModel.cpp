@@ -0,0 +1,138 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "BackgroundModel.h"
+#include "Image.h"
+
+namespace freelss
+{
+
+BackgroundModel::BackgroundModel(size_t maxNumBackgrounds) :
+	m_backgrounds(),
+	m_maxNumBackgrounds(maxNumBackgrounds)
+{
+	// Do nothing
+}
+
+BackgroundModel::~BackgroundModel()
+{
+	clear();
+}
+
+void BackgroundModel::clear()
+{
+	for (size_t iBack = 0; iBack < m_backgrounds.size(); iBack++)
+	{
+		delete m_backgrounds[iBack].image;
+	}
+
+	m_backgrounds.clear();
+}
+
+void BackgroundModel::add(const Image& image, real rotation)
+{
+	Background background;
+	background.rotation = rotation;
+	background.image = new Image(image);
+
+	if (m_maxNumBackgrounds > 0 && m_backgrounds.size() >= m_maxNumBackgrounds)
+	{
+		delete m_backgrounds.front().image;
+		m_backgrounds.erase(m_backgrounds.begin());
+	}
+
+	m_backgrounds.push_back(background);
+}
+
+Image * BackgroundModel::getBackground(real rotation)
+{
+	Image * closest = NULL;
+	real closestDistance = 0;
+
+	for (size_t iBack = 0; iBack < m_backgrounds.size(); iBack++)
+	{
+		// The rotations are the same on either side of a full revolution
+		real distance = fmod(ABS(m_backgrounds[iBack].rotation - rotation), (real) (2 * PI));
+		distance = MIN(distance, (real) (2 * PI) - distance);
+
+		if (closest == NULL || distance < closestDistance)
+		{
+			closest = m_backgrounds[iBack].image;
+			closestDistance = distance;
+		}
+	}
+
+	return closest;
+}
+
+bool BackgroundModel::interpolate(real rotation, Image& out)
+{
+	// Find the closest backgrounds on either side of the rotation
+	const Background * before = NULL;
+	const Background * after = NULL;
+
+	for (size_t iBack = 0; iBack < m_backgrounds.size(); iBack++)
+	{
+		const Background& background = m_backgrounds[iBack];
+		if (background.rotation <= rotation && (before == NULL || background.rotation > before->rotation))
+		{
+			before = &background;
+		}
+		else if (background.rotation > rotation && (after == NULL || background.rotation < after->rotation))
+		{
+			after = &background;
+		}
+	}
+
+	if (before == NULL || after == NULL)
+	{
+		Image * closest = getBackground(rotation);
+		if (closest == NULL)
+		{
+			return false;
+		}
+
+		memcpy(out.getPixels(), closest->getPixels(), out.getPixelBufferSize());
+		return true;
+	}
+
+	// The weight of the after background in 1/256ths
+	int weight = ROUND(256 * (rotation - before->rotation) / (after->rotation - before->rotation));
+
+	unsigned char * a = before->image->getPixels();
+	unsigned char * b = after->image->getPixels();
+	unsigned char * o = out.getPixels();
+	unsigned size = out.getPixelBufferSize();
+
+	for (unsigned iPx = 0; iPx < size; iPx++)
+	{
+		o[iPx] = (unsigned char) (a[iPx] + ((((int)b[iPx] - (int)a[iPx]) * weight) >> 8));
+	}
+
+	return true;
+}
+
+size_t BackgroundModel::size() const
+{
+	return m_backgrounds.size();
+}
+
+}
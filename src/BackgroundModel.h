@@ -0,0 +1,71 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+class Image;
+
+/**
+ * Laser-off images of the scene taken at different table rotations.  They
+ * stand in for the laser-off image of a frame that doesn't have its own.
+ */
+class BackgroundModel
+{
+public:
+	/** @param maxNumBackgrounds - The oldest background is removed to add one past this many, 0 for no limit */
+	BackgroundModel(size_t maxNumBackgrounds = 0);
+	~BackgroundModel();
+
+	/** Removes all the backgrounds */
+	void clear();
+
+	/** Adds a copy of a laser-off image taken at the given rotation in radians */
+	void add(const Image& image, real rotation);
+
+	/** Returns the background taken closest to the given rotation or NULL if there are none */
+	Image * getBackground(real rotation);
+
+	/**
+	 * Blends the backgrounds taken before and after the given rotation in proportion to how
+	 * close they are to it.  The closest background is copied if the rotation isn't between two.
+	 * Returns false if there are no backgrounds.
+	 */
+	bool interpolate(real rotation, Image& out);
+
+	/** Returns the number of backgrounds */
+	size_t size() const;
+
+private:
+	struct Background
+	{
+		real rotation;
+		Image * image;
+	};
+
+	/** The backgrounds in the order they were added */
+	std::vector<Background> m_backgrounds;
+
+	size_t m_maxNumBackgrounds;
+};
+
+}
@@ -27,10 +27,41 @@
 #include "Setup.h"
 #include "LocationMapper.h"
 #include "Logger.h"
+#include "TurnTable.h"
+
+/** The table is turned this many degrees both ways to capture the laser on the calibration object */
+#define LASER_PLANE_TABLE_ANGLE 10.0
+
+/** The number of times the laser line is captured at each table angle */
+#define LASER_PLANE_CAPTURES_PER_ANGLE 2
+
+/** The number of random planes tried when fitting the laser plane */
+#define LASER_PLANE_RANSAC_ITERATIONS 500
+
+/** Points further than this from the laser plane in mm aren't on the calibration object */
+#define LASER_PLANE_INLIER_DISTANCE 0.5
+
+/** The fewest points the laser plane is fit to */
+#define LASER_PLANE_MIN_INLIERS 20
+
+/** The number of halvings used to find the row the origin is seen at */
+#define ORIGIN_ROW_SEARCH_ITERATIONS 30
 
 namespace freelss
 {
 
+void Calibrator::calculateCameraRay(const Vector3& cameraLocation, real xPixel, real yPixel, Ray * ray)
+{
+	// Use the scanner's rays so calibration sees through the same lens model, including the camera calibration
+	LocationMapper locMapper(cameraLocation, cameraLocation);
+
+	PixelLocation pixel;
+	pixel.x = xPixel;
+	pixel.y = yPixel;
+
+	locMapper.calculateCameraRay(pixel, ray);
+}
+
 real Calibrator::computeCameraZ(real pixelY)
 {
 	// Read the Y-value for the camera from Database
@@ -39,22 +70,15 @@ real Calibrator::computeCameraZ(real pixelY)
 	Camera * camera = Camera::getInstance();
 	real cameraY = setup->cameraLocation.y;
 
-	// Camera focal length
-	real focalLength = camera->getFocalLength();
-
-	// Use trig to detect the distance to the camera
-	real pixelSpacing = (real)camera->getSensorHeight() / (real)camera->getImageHeight();
-
 	InfoLog << "cameraY: " << cameraY << " mm" << Logger::ENDL;
 	InfoLog << "pixelY: " << pixelY << " row" << Logger::ENDL;
-	InfoLog << "Pixel Spacing: " << pixelSpacing << " mm" << Logger::ENDL;
-
-	real sy = (pixelY - (camera->getImageHeight() / 2.0)) * pixelSpacing;
 
-	InfoLog << "sy on sensor: " << sy << " mm" << Logger::ENDL;
-	InfoLog << "focal length: " << focalLength << " mm" << Logger::ENDL;
+	// The table center is in the middle column
+	Ray ray;
+	calculateCameraRay(setup->cameraLocation, (camera->getImageWidth() - 1) / 2.0f, pixelY, &ray);
 
-	real theta = atan(sy / focalLength);
+	// Use trig to detect the distance to the camera
+	real theta = atan2(-ray.direction.y, -ray.direction.z);
 	InfoLog << "angle is : " << (theta / (PI * 2)) * 360.0 << " degrees" << Logger::ENDL;
 	real z = cameraY  / tan(theta);
 
@@ -64,13 +88,13 @@ real Calibrator::computeCameraZ(real pixelY)
 }
 
 
-void Calibrator::calculateLaserPlane(Plane& outPlane, PixelLocation& outTop, PixelLocation& outBottom, Laser * laser, Laser::LaserSide side, const Vector3& laserLocation)
+int Calibrator::detectLaserPixels(std::vector<PixelLocation>& pixelLocations, Laser * laser, Laser::LaserSide side)
 {
 	Camera * camera = Camera::getInstance();
 	int maxNumLocations = camera->getImageHeight();
 	int numLocations = 0;
 	const double acquisitionDelay = 1.0;
-	std::vector<PixelLocation> pixelLocations(maxNumLocations);
+	pixelLocations.resize(maxNumLocations);
 
 	// Turn the lasers off and take a picture
 	laser->turnOff(Laser::ALL_LASERS);
@@ -127,35 +151,108 @@ void Calibrator::calculateLaserPlane(Plane& outPlane, PixelLocation& outTop, Pix
 		throw;
 	}
 
-	// Determine which pixels came from the object sitting on the XY plane as opposed to the background
-	int idx1 = -1;
-	int idx2 = -1;
-	int maxPixelsFromCenter = 100;  // Don't use pixels that are further than this from the center of the image
-	real centerOfImage = camera->getImageWidth() * 0.5;
-	real xStart = centerOfImage - (maxPixelsFromCenter * 0.5);
-	real xEnd = centerOfImage + (maxPixelsFromCenter * 0.5);
-	real yStart = 0;
-	real yEnd = 1700; // Don't consider the bottom of the image because the table is down there
-
-	for (int iLoc = 1; iLoc < numLocations - 1; iLoc++)
+	pixelLocations.resize(numLocations);
+
+	return numLocations;
+}
+
+void Calibrator::calculateLaserPlane(Plane& outPlane, PixelLocation& outTop, PixelLocation& outBottom, PlaneFit& outFit,
+		                             Laser * laser, Laser::LaserSide side, const Vector3& laserLocation)
+{
+	Setup * setup = Setup::get();
+	TurnTable * turnTable = TurnTable::getInstance();
+	LocationMapper locMapper(laserLocation, setup->cameraLocation);
+
+	// Capture the object square to the camera first and then turned both ways
+	const real tableAngles[] = { 0, -LASER_PLANE_TABLE_ANGLE, LASER_PLANE_TABLE_ANGLE };
+	const int numTableAngles = sizeof(tableAngles) / sizeof(tableAngles[0]);
+
+	std::vector<Vector3> points;
+	std::vector<PixelLocation> pointPixels;
+	size_t numSquarePoints = 0;
+	real tableRotation = 0;
+
+	turnTable->setMotorEnabled(true);
+
+	try
 	{
-		if (pixelLocations[iLoc].x >= xStart &&
-			pixelLocations[iLoc].x <= xEnd &&
-			pixelLocations[iLoc].y >= yStart &&
-			pixelLocations[iLoc].y <= yEnd)
+		std::vector<PixelLocation> pixelLocations;
+		for (int iAngle = 0; iAngle < numTableAngles; iAngle++)
 		{
-			// Look for some consistency first
-			if (ABS(pixelLocations[iLoc].y - pixelLocations[iLoc - 1].y) <= 1.5)
+			real rotation = DEGREES_TO_RADIANS(tableAngles[iAngle]);
+			if (rotation != tableRotation)
 			{
-				if (idx1 == -1)
-				{
-					idx1 = iLoc;
-				}
-				else
+				turnTable->rotate(rotation - tableRotation);
+				tableRotation = rotation;
+			}
+
+			// The object turns with the table about the Y axis
+			Plane objectPlane;
+			objectPlane.point = Vector3(0, 0, 0);
+			objectPlane.normal = Vector3(-sin(rotation), 0, -cos(rotation));
+
+			for (int iCapture = 0; iCapture < LASER_PLANE_CAPTURES_PER_ANGLE; iCapture++)
+			{
+				int numLocations = detectLaserPixels(pixelLocations, laser, side);
+				for (int iLoc = 0; iLoc < numLocations; iLoc++)
 				{
-					idx2 = iLoc;
+					Ray ray;
+					ColoredPoint point;
+					locMapper.calculateCameraRay(pixelLocations[iLoc], &ray);
+
+					// Pixels below the table can't be on the object
+					if (locMapper.intersectPlane(objectPlane, ray, &point, pixelLocations[iLoc]) && point.y > 0)
+					{
+						points.push_back(Vector3(point.x, point.y, point.z));
+						pointPixels.push_back(pixelLocations[iLoc]);
+					}
 				}
 			}
+
+			if (iAngle == 0)
+			{
+				numSquarePoints = points.size();
+			}
+		}
+
+		// Turn the table back to where it started
+		if (tableRotation != 0)
+		{
+			turnTable->rotate(-tableRotation);
+		}
+
+		turnTable->setMotorEnabled(false);
+	}
+	catch (...)
+	{
+		if (tableRotation != 0)
+		{
+			turnTable->rotate(-tableRotation);
+		}
+
+		turnTable->setMotorEnabled(false);
+		throw;
+	}
+
+	std::vector<bool> inliers;
+	fitLaserPlane(outPlane, outFit, inliers, points, laserLocation);
+
+	// Report the highest and lowest pixels on the object square to the camera
+	int idx1 = -1;
+	int idx2 = -1;
+	for (size_t iPt = 0; iPt < numSquarePoints; iPt++)
+	{
+		if (inliers[iPt])
+		{
+			if (idx1 == -1 || pointPixels[iPt].y < pointPixels[idx1].y)
+			{
+				idx1 = iPt;
+			}
+
+			if (idx2 == -1 || pointPixels[iPt].y > pointPixels[idx2].y)
+			{
+				idx2 = iPt;
+			}
 		}
 	}
 
@@ -164,72 +261,129 @@ void Calibrator::calculateLaserPlane(Plane& outPlane, PixelLocation& outTop, Pix
 		throw Exception("Could not positively detect which pixels corresponded to the XY plane");
 	}
 
+	outTop = pointPixels[idx1];
+	outBottom = pointPixels[idx2];
 
-	// Set the output variables
-	outTop = pixelLocations[idx1];
-	outBottom = pixelLocations[idx2];
-
-	real avgDistFromCenterPx = (ABS(pixelLocations[idx1].x - centerOfImage) + ABS(pixelLocations[idx2].x - centerOfImage)) / 2.0f;
-	InfoLog << pixelLocations[idx1].x << " " << centerOfImage << " " << pixelLocations[idx2].x << " " << idx1 << " " << idx2 << " " << xStart << " " << xEnd << Logger::ENDL;
-	InfoLog << "Avg Dist From Center of Image: " << avgDistFromCenterPx << " px" << Logger::ENDL;
-
-	outPlane = calculateLaserPlane(laserLocation, pixelLocations[idx1], pixelLocations[idx2]);
-	InfoLog << "Plane Normal: (" << outPlane.normal.x << "," << outPlane.normal.y << "," << outPlane.normal.z << ")" << Logger::ENDL;
+	InfoLog << "Plane Normal: (" << outPlane.normal.x << "," << outPlane.normal.y << "," << outPlane.normal.z << ")"
+			<< " from " << outFit.numInliers << " of " << outFit.numPoints << " points, RMS residual: "
+			<< outFit.rmsResidual << " mm, max residual: " << outFit.maxResidual << " mm" << Logger::ENDL;
 }
 
-Plane Calibrator::calculateLaserPlane(const Vector3& laserLocation, const PixelLocation& pixel1, const PixelLocation& pixel2)
+void Calibrator::fitLaserPlane(Plane& outPlane, PlaneFit& outFit, std::vector<bool>& inliers,
+		                       const std::vector<Vector3>& points, const Vector3& laserLocation)
 {
-	Setup * setup = Setup::get();
+	int numPoints = points.size();
+	if (numPoints < LASER_PLANE_MIN_INLIERS)
+	{
+		throw Exception("Could not positively detect which pixels corresponded to the XY plane");
+	}
 
-	InfoLog << "Calculating laser plane for pt (" << pixel1.x << "," << pixel1.y << ") (" << pixel2.x << "," << pixel2.y << ")" << Logger::ENDL;
+	// The points relative to the laser, which every candidate plane goes through
+	std::vector<Eigen::Vector3d> offsets(numPoints);
+	for (int iPt = 0; iPt < numPoints; iPt++)
+	{
+		offsets[iPt] = Eigen::Vector3d(points[iPt].x - laserLocation.x,
+				                       points[iPt].y - laserLocation.y,
+				                       points[iPt].z - laserLocation.z);
+	}
 
-	//
-	// Map the 2D image points to 3D points
-	//
+	// RANSAC: try the planes through the laser and two random points and keep the one with the most inliers
+	Eigen::Vector3d bestNormal = Eigen::Vector3d::Zero();
+	int bestNumInliers = 0;
+	uint32 randomState = 1;
 
-	Ray ray1, ray2;
-	LocationMapper locMapper(laserLocation, setup->cameraLocation);
-	locMapper.calculateCameraRay(pixel1, &ray1);
-	locMapper.calculateCameraRay(pixel2, &ray2);
+	for (int iIter = 0; iIter < LASER_PLANE_RANSAC_ITERATIONS; iIter++)
+	{
+		randomState = randomState * 1664525u + 1013904223u;
+		int idx1 = (randomState >> 8) % numPoints;
+		randomState = randomState * 1664525u + 1013904223u;
+		int idx2 = (randomState >> 8) % numPoints;
 
-	ColoredPoint pt1, pt2;
+		Eigen::Vector3d normal = offsets[idx1].cross(offsets[idx2]);
+		if (normal.norm() < 0.000001)
+		{
+			continue;
+		}
 
-	Plane xyPlane;
-	xyPlane.point.x = 0;
-	xyPlane.point.y = 0;
-	xyPlane.point.z = 0;
-	xyPlane.normal.x = 0;
-	xyPlane.normal.y = 0;
-	xyPlane.normal.z = -1;
+		normal.normalize();
 
-	if (!locMapper.intersectPlane(xyPlane, ray1, &pt1, pixel1))
-	{
-		throw Exception("Error intersecting XY plane at point 1");
+		int numInliers = 0;
+		for (int iPt = 0; iPt < numPoints; iPt++)
+		{
+			if (fabs(normal.dot(offsets[iPt])) <= LASER_PLANE_INLIER_DISTANCE)
+			{
+				numInliers++;
+			}
+		}
+
+		if (numInliers > bestNumInliers)
+		{
+			bestNumInliers = numInliers;
+			bestNormal = normal;
+		}
 	}
 
-	if (!locMapper.intersectPlane(xyPlane, ray2, &pt2, pixel2))
+	if (bestNumInliers < LASER_PLANE_MIN_INLIERS)
 	{
-		throw Exception("Error intersecting XY plane at point 2");
+		throw Exception("Could not positively detect which pixels corresponded to the XY plane");
 	}
 
-	InfoLog << "Intersection pt1: " << pt1.x << "," << pt1.y << "," << pt1.z << Logger::ENDL;
-	InfoLog << "Intersection pt2: " << pt2.x << "," << pt2.y << "," << pt2.z << Logger::ENDL;
+	// Least squares: the normal that minimizes the squared distances of the inliers is the
+	// eigenvector of their scatter matrix with the smallest eigenvalue.  The inliers are
+	// selected again with the refined plane before the final fit.
+	inliers.assign(numPoints, false);
+	for (int iRefine = 0; iRefine < 2; iRefine++)
+	{
+		Eigen::Matrix3d scatter = Eigen::Matrix3d::Zero();
+		int numInliers = 0;
+		for (int iPt = 0; iPt < numPoints; iPt++)
+		{
+			inliers[iPt] = fabs(bestNormal.dot(offsets[iPt])) <= LASER_PLANE_INLIER_DISTANCE;
+			if (inliers[iPt])
+			{
+				scatter += offsets[iPt] * offsets[iPt].transpose();
+				numInliers++;
+			}
+		}
 
-	//
-	// Calculate the plane
-	//
-	Plane plane;
-	plane.point.x = pt1.x;
-	plane.point.y = pt1.y;
-	plane.point.z = pt1.z;
+		if (numInliers < LASER_PLANE_MIN_INLIERS)
+		{
+			break;
+		}
 
-	Vector3 laserDir1 (laserLocation.x - pt1.x, laserLocation.y - pt1.y, laserLocation.z - pt1.z);
-	Vector3 laserDir2 (laserLocation.x - pt2.x, laserLocation.y - pt2.y, laserLocation.z - pt2.z);
+		Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(scatter);
+		bestNormal = solver.eigenvectors().col(0).normalized();
+	}
+
+	// Point the normal the same way as the one calculated from the laser location
+	Vector3 defaultNormal;
+	laserLocation.cross(defaultNormal, Vector3(laserLocation.x, 0, laserLocation.z));
+	if (bestNormal.dot(Eigen::Vector3d(defaultNormal.x, defaultNormal.y, defaultNormal.z)) < 0)
+	{
+		bestNormal = -bestNormal;
+	}
+
+	// Report the residuals of the final plane
+	double sumSq = 0;
+	outFit.numPoints = numPoints;
+	outFit.numInliers = 0;
+	outFit.maxResidual = 0;
+	for (int iPt = 0; iPt < numPoints; iPt++)
+	{
+		double residual = fabs(bestNormal.dot(offsets[iPt]));
+		inliers[iPt] = residual <= LASER_PLANE_INLIER_DISTANCE;
+		if (inliers[iPt])
+		{
+			sumSq += residual * residual;
+			outFit.maxResidual = MAX(outFit.maxResidual, (real) residual);
+			outFit.numInliers++;
+		}
+	}
 
-	laserDir1.cross(plane.normal, laserDir2);
-	plane.normal.normalize();
+	outFit.rmsResidual = outFit.numInliers > 0 ? sqrt(sumSq / outFit.numInliers) : 0;
 
-	return plane;
+	outPlane.point = laserLocation;
+	outPlane.normal = Vector3(bestNormal.x(), bestNormal.y(), bestNormal.z());
 }
 
 bool Calibrator::detectLaserX(real * laserX, PixelLocation& topLocation, PixelLocation& bottomLocation, Laser * laser, Laser::LaserSide side)
@@ -345,30 +499,13 @@ real Calibrator::computeLaserX(real cameraZ, real xPixel, real yPixel)
 	real cameraX = setup->cameraLocation.x;
 	real cameraY = setup->cameraLocation.y;
 
-	Camera * camera = Camera::getInstance();
-	real imageHeight = camera->getImageHeight();
-	real imageWidth = camera->getImageWidth();
-	real sensorWidth = camera->getSensorWidth();
-	real sensorHeight = camera->getSensorHeight();
-	real focalLength = camera->getFocalLength();
-
-	// Compute the location on the sensor in world coordinates
-	real pctX = xPixel / imageWidth;
-	real pctY = (imageHeight - yPixel) / imageHeight;
-	real worldX = cameraX + (pctX * sensorWidth) - sensorWidth * 0.5;
-	real worldY = cameraY + (pctY * sensorHeight) - sensorHeight * 0.5;
-	real worldZ = cameraZ - focalLength;
-
 	Ray ray;
+	calculateCameraRay(Vector3(cameraX, cameraY, cameraZ), xPixel, yPixel, &ray);
+
 	ray.origin.x = cameraX;
 	ray.origin.y = cameraY;
 	ray.origin.z = cameraZ;
 
-	ray.direction.x = worldX - cameraX;
-	ray.direction.y = worldY - cameraY;
-	ray.direction.z = worldZ - cameraZ;
-	ray.direction.normalize();
-
 	//
 	// Intersect the XZ plane
 	//
@@ -465,18 +602,13 @@ void Calibrator::addCalibrationLines(Image * image)
 	}
 
 	// Calculate the originY
-	real originY = 0;
-	if (calculateOriginYOnSensor(originY))
+	real originRow = 0;
+	if (calculateOriginRow(originRow))
 	{
-		// Calculate the originY
-		Camera * camera = Camera::getInstance();
-
 		unsigned xStart = (width / 2) - (width / 10);
 		unsigned xEnd = (width / 2) + (width / 10);
-		real sensorHeight = camera->getSensorHeight();
-		real sensorPct = (originY + (sensorHeight / 2)) / sensorHeight;
 
-		yCol = height - (unsigned)(sensorPct * height);
+		yCol = (unsigned) originRow;
 		if (yCol > yCount && yCol < height - yCount)
 		{
 			for (unsigned cnt = 0; cnt < yCount; cnt++)
@@ -496,38 +628,61 @@ void Calibrator::addCalibrationLines(Image * image)
 	}
 }
 
-bool Calibrator::calculateOriginYOnSensor(real& originY)
+bool Calibrator::calculateOriginRow(real& originRow)
 {
 	// NOTE: This method makes assumptions about the orientation of the camera
 
 	Setup * setup = Setup::get();
 	Camera * camera = Camera::getInstance();
+	const Vector3& cameraLocation = setup->cameraLocation;
+
+	if (cameraLocation.z <= 0)
+	{
+		ErrorLog << "!! The origin is not in front of the camera" << Logger::ENDL;
+		return false;
+	}
 
-	Plane sensorPlane;
-	sensorPlane.normal.x = 0;
-	sensorPlane.normal.y = 0;
-	sensorPlane.normal.z = -1;
-	sensorPlane.point.x = setup->cameraLocation.x;
-	sensorPlane.point.y = setup->cameraLocation.y;
-	sensorPlane.point.z = setup->cameraLocation.z - camera->getFocalLength();
-
-	// Ray from origin to the focal point
-	Ray originRay;
-	originRay.origin.x = 0;
-	originRay.origin.y = 0;
-	originRay.origin.z = 0;
-	originRay.direction = setup->cameraLocation;
-	originRay.direction.normalize();
+	LocationMapper locMapper(cameraLocation, cameraLocation);
+	PixelLocation pixel;
+	pixel.x = (camera->getImageWidth() - 1) / 2.0f;
 
-	Vector3 intersection;
-	if (!intersectPlane(originRay, sensorPlane, &intersection))
+	// The slope of the ray from the camera to the origin, the rays get steeper down the image
+	real originSlope = -cameraLocation.y / cameraLocation.z;
+	real topRow = 0;
+	real bottomRow = camera->getImageHeight() - 1;
+
+	Ray ray;
+	pixel.y = topRow;
+	locMapper.calculateCameraRay(pixel, &ray);
+	real topSlope = ray.direction.y / -ray.direction.z;
+
+	pixel.y = bottomRow;
+	locMapper.calculateCameraRay(pixel, &ray);
+	real bottomSlope = ray.direction.y / -ray.direction.z;
+
+	if (originSlope > topSlope || originSlope < bottomSlope)
 	{
-		ErrorLog << "!! Origin ray did not intersect sensor plane" << Logger::ENDL;
+		ErrorLog << "!! The origin is not in view of the camera" << Logger::ENDL;
 		return false;
 	}
 
-	// Convert from world coordinates to sensor coordinates
-	originY = intersection.y - setup->cameraLocation.y;
+	// Find the row whose ray goes through the origin
+	for (int iIter = 0; iIter < ORIGIN_ROW_SEARCH_ITERATIONS; iIter++)
+	{
+		pixel.y = (topRow + bottomRow) / 2;
+		locMapper.calculateCameraRay(pixel, &ray);
+
+		if (ray.direction.y / -ray.direction.z > originSlope)
+		{
+			topRow = pixel.y;
+		}
+		else
+		{
+			bottomRow = pixel.y;
+		}
+	}
+
+	originRow = (topRow + bottomRow) / 2;
 
 	return true;
 }
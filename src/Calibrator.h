@@ -30,6 +30,20 @@ class Calibrator
 {
 public:
 
+	/** How well a laser plane fits the laser pixels it was calculated from */
+	struct PlaneFit
+	{
+		/** The number of laser pixels mapped onto the calibration target */
+		int numPoints;
+
+		/** The number of points close enough to the plane to be on the calibration object */
+		int numInliers;
+
+		/** The RMS and max distance of the inliers to the plane in mm */
+		real rmsResidual;
+		real maxResidual;
+	};
+
 	/**
 	 * Computes the Z value (distance in XZ plane) from the camera to the
 	 * center of the turn table.  This is the automated portion of the camera
@@ -41,20 +55,28 @@ public:
 	static real computeCameraZ(real yImagePtForTableCenter);
 	static real computeLaserX(real cameraZ, real xImagePtForLaser, real yImagePtForLaser);
 
-	/** Calculates where the origin of the coordinate system is as projected onto the sensor.  Output is in sensor coordinates */
-	static bool calculateOriginYOnSensor(real& originY);
+	/** Calculates the image row that the origin of the coordinate system is seen at, in the middle column */
+	static bool calculateOriginRow(real& originRow);
 
-	static void calculateLaserPlane(Plane& outPlane, PixelLocation& outTop, PixelLocation& outBottom, Laser * laser, Laser::LaserSide side, const Vector3& laserLocation);
+	/**
+	 * Calculates a laser plane that compensates for laser misalignment (rotation and roll).
+	 * The laser line is captured several times on a flat object standing on the XY plane with the
+	 * table turned to a few angles, and the plane through the laser location is fit to all of the
+	 * detected pixels, ignoring the ones that aren't on the object.
+	 */
+	static void calculateLaserPlane(Plane& outPlane, PixelLocation& outTop, PixelLocation& outBottom, PlaneFit& outFit,
+			                        Laser * laser, Laser::LaserSide side, const Vector3& laserLocation);
 
 	/** Adds the calibration lines to the image */
 	static void addCalibrationLines(Image * image);
 
 	/**
-	 * Calculates a laser plane that compensate for laser misalignment (rotation and roll).
-	 * @param pt1 - The top (or topish) laser pixel detected on an image of an flat object sitting on the XY plane.
-	 * @param pt2 - The bottom (or bottomish) laser pixel detected on an image of an flat object sitting on the XY plane.
+	 * Fits a plane through the laser location to the points with RANSAC and then refines
+	 * it with a least squares fit to the inliers.
+	 * @param inliers - Set to whether each point is an inlier of the fitted plane.
 	 */
-	static Plane calculateLaserPlane(const Vector3& laserLocation, const PixelLocation& pt1, const PixelLocation& pt2);
+	static void fitLaserPlane(Plane& outPlane, PlaneFit& outFit, std::vector<bool>& inliers,
+			                  const std::vector<Vector3>& points, const Vector3& laserLocation);
 
 	/**
 	 * Automatically detects the laser's X value by using image processing to detect the laser location
@@ -62,6 +84,13 @@ public:
 	 */
 	static bool detectLaserX(/* out */ real * laserX , PixelLocation& topLocation, PixelLocation& bottomLocation, Laser * laser, Laser::LaserSide side);
 	static bool intersectPlane(const Ray& ray, const Plane& plane, Vector3 * intersection);
+
+private:
+	/** Calculates the ray through the pixel with the same camera model that the scanner maps points with */
+	static void calculateCameraRay(const Vector3& cameraLocation, real xPixel, real yPixel, Ray * ray);
+
+	/** Takes pictures with the laser off and on and detects the laser pixels */
+	static int detectLaserPixels(std::vector<PixelLocation>& pixelLocations, Laser * laser, Laser::LaserSide side);
 };
 
 }
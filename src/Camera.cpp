@@ -161,7 +161,16 @@ Camera * Camera::getInstance()
 		{
 			CameraAcquisitionType cameraType = GetCameraType(cameraMode);
 
-			if (cameraType == CT_MMALSTILL)
+			if (IsMockHardware())
+			{
+				MockCamera * camera = new MockCamera();
+				camera->initialize(cameraMode);
+				m_instance = camera;
+
+				CameraResolution resolution = m_instance->getCameraResolution();
+				InfoLog << "Created camera: " << resolution.name << Logger::ENDL;
+			}
+			else if (cameraType == CT_MMALSTILL)
 			{
 				MmalStillCamera * camera = new MmalStillCamera();
 				camera->setFlipRedBlue(Setup::get()->mmalFlipRedBlue);
@@ -0,0 +1,1004 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "CameraCalibrator.h"
+#include "Image.h"
+#include "Logger.h"
+
+/** Images are searched for the checkerboard at about this width so the search doesn't depend on the camera mode */
+#define CHECKERBOARD_SEARCH_WIDTH 1000
+
+/** Corners respond at least this fraction of the strongest corner */
+#define CHECKERBOARD_RESPONSE_FRACTION 0.05
+
+/** Weaker corners closer than this in search pixels to a stronger one are ignored */
+#define CHECKERBOARD_SUPPRESSION_RADIUS 5
+
+/** The radius in search pixels of the circle sampled around a corner for the alternating squares */
+#define CHECKERBOARD_SECTOR_RADIUS 5
+
+/** The smallest gray level difference between the squares around a corner */
+#define CHECKERBOARD_MIN_CONTRAST 20
+
+/** A corner must be within this fraction of the square size of where the grid predicts it */
+#define CHECKERBOARD_GRID_TOLERANCE 0.35
+
+/** The number of corners the grid is started from before giving up */
+#define CHECKERBOARD_MAX_SEEDS 10
+
+/** The smallest half size in full resolution pixels of the window corners are refined in */
+#define CORNER_REFINE_RADIUS 5
+
+/** The fewest views that the camera is calibrated from */
+#define MIN_CALIBRATION_VIEWS 3
+
+/** The maximum number of Levenberg-Marquardt iterations used to refine the calibration */
+#define CALIBRATION_ITERATIONS 100
+
+/** The number of intrinsic parameters refined and the number for the pose of each view */
+#define NUM_INTRINSIC_PARAMS 9
+#define NUM_POSE_PARAMS 6
+
+namespace freelss
+{
+
+CameraCalibrator * CameraCalibrator::m_instance = NULL;
+
+/** A grayscale image */
+struct GrayImage
+{
+	std::vector<real> pixels;
+	int width;
+	int height;
+
+	real at(int x, int y) const
+	{
+		return pixels[y * width + x];
+	}
+};
+
+/** Converts the image to gray, averaging each scale x scale block of pixels into one */
+static void ToGray(GrayImage& out, Image& image, int scale)
+{
+	int numComponents = image.getNumComponents();
+	int rowStep = image.getWidth() * numComponents;
+	const unsigned char * pixels = image.getPixels();
+	real norm = 1.0f / (scale * scale * numComponents);
+
+	out.width = image.getWidth() / scale;
+	out.height = image.getHeight() / scale;
+	out.pixels.resize(out.width * out.height);
+
+	for (int y = 0; y < out.height; y++)
+	{
+		for (int x = 0; x < out.width; x++)
+		{
+			int sum = 0;
+			for (int sy = 0; sy < scale; sy++)
+			{
+				const unsigned char * px = pixels + (y * scale + sy) * rowStep + x * scale * numComponents;
+				for (int iComp = 0; iComp < scale * numComponents; iComp++)
+				{
+					sum += px[iComp];
+				}
+			}
+
+			out.pixels[y * out.width + x] = sum * norm;
+		}
+	}
+}
+
+/** Blurs the image with a (2 * radius + 1) box, clamping at the edges */
+static void BoxBlur(GrayImage& image, int radius)
+{
+	std::vector<real> line;
+	real norm = 1.0f / (2 * radius + 1);
+
+	// Horizontally
+	line.resize(image.width);
+	for (int y = 0; y < image.height; y++)
+	{
+		real * row = &image.pixels[y * image.width];
+		for (int x = 0; x < image.width; x++)
+		{
+			real sum = 0;
+			for (int dx = -radius; dx <= radius; dx++)
+			{
+				sum += row[MIN(image.width - 1, MAX(0, x + dx))];
+			}
+
+			line[x] = sum * norm;
+		}
+
+		std::copy(line.begin(), line.end(), row);
+	}
+
+	// Vertically
+	line.resize(image.height);
+	for (int x = 0; x < image.width; x++)
+	{
+		for (int y = 0; y < image.height; y++)
+		{
+			real sum = 0;
+			for (int dy = -radius; dy <= radius; dy++)
+			{
+				sum += image.pixels[MIN(image.height - 1, MAX(0, y + dy)) * image.width + x];
+			}
+
+			line[y] = sum * norm;
+		}
+
+		for (int y = 0; y < image.height; y++)
+		{
+			image.pixels[y * image.width + x] = line[y];
+		}
+	}
+}
+
+/**
+ * Returns true if the circle around the point crosses two dark and two light squares,
+ * which tells checkerboard corners apart from other saddle shaped features.
+ */
+static bool HasAlternatingSquares(const GrayImage& image, int x, int y)
+{
+	const int numSamples = 16;
+	real samples[numSamples];
+	real minSample = 255;
+	real maxSample = 0;
+
+	for (int iSample = 0; iSample < numSamples; iSample++)
+	{
+		real angle = 2 * PI * iSample / numSamples;
+		int sx = ROUND(x + CHECKERBOARD_SECTOR_RADIUS * cos(angle));
+		int sy = ROUND(y + CHECKERBOARD_SECTOR_RADIUS * sin(angle));
+		samples[iSample] = image.at(sx, sy);
+		minSample = MIN(minSample, samples[iSample]);
+		maxSample = MAX(maxSample, samples[iSample]);
+	}
+
+	if (maxSample - minSample < CHECKERBOARD_MIN_CONTRAST)
+	{
+		return false;
+	}
+
+	// Count the changes between dark and light, ignoring the samples on the edges between squares
+	real mid = (minSample + maxSample) / 2;
+	real margin = (maxSample - minSample) * 0.2f;
+	int first = 0;
+	int prev = 0;
+	int numChanges = 0;
+	for (int iSample = 0; iSample < numSamples; iSample++)
+	{
+		int side = 0;
+		if (samples[iSample] > mid + margin)
+		{
+			side = 1;
+		}
+		else if (samples[iSample] < mid - margin)
+		{
+			side = -1;
+		}
+
+		if (side != 0)
+		{
+			if (prev != 0 && side != prev)
+			{
+				numChanges++;
+			}
+
+			if (first == 0)
+			{
+				first = side;
+			}
+
+			prev = side;
+		}
+	}
+
+	if (first != 0 && prev != first)
+	{
+		numChanges++;
+	}
+
+	return numChanges == 4;
+}
+
+/** Finds the saddle points of the image that look like checkerboard corners */
+static void FindCornerCandidates(const GrayImage& image, std::vector<PixelLocation>& candidates)
+{
+	const int step = 2;
+	int border = MAX(step, CHECKERBOARD_SECTOR_RADIUS + 1);
+	std::vector<real> response(image.width * image.height, 0);
+	real maxResponse = 0;
+
+	// The determinant of the Hessian is negative at saddle points
+	for (int y = border; y < image.height - border; y++)
+	{
+		for (int x = border; x < image.width - border; x++)
+		{
+			real center = image.at(x, y);
+			real ixx = image.at(x + step, y) - 2 * center + image.at(x - step, y);
+			real iyy = image.at(x, y + step) - 2 * center + image.at(x, y - step);
+			real ixy = (image.at(x + step, y + step) - image.at(x + step, y - step)
+					  - image.at(x - step, y + step) + image.at(x - step, y - step)) * 0.25f;
+
+			real saddle = ixy * ixy - ixx * iyy;
+			if (saddle > 0)
+			{
+				response[y * image.width + x] = saddle;
+				maxResponse = MAX(maxResponse, saddle);
+			}
+		}
+	}
+
+	real threshold = maxResponse * CHECKERBOARD_RESPONSE_FRACTION;
+	const int radius = CHECKERBOARD_SUPPRESSION_RADIUS;
+
+	candidates.clear();
+	for (int y = border; y < image.height - border; y++)
+	{
+		for (int x = border; x < image.width - border; x++)
+		{
+			int index = y * image.width + x;
+			real value = response[index];
+			if (value <= threshold)
+			{
+				continue;
+			}
+
+			// Keep only the strongest response in the neighborhood, and the first of equal ones
+			bool isMax = true;
+			for (int dy = -radius; dy <= radius && isMax; dy++)
+			{
+				int ny = y + dy;
+				if (ny < 0 || ny >= image.height)
+				{
+					continue;
+				}
+
+				for (int dx = -radius; dx <= radius; dx++)
+				{
+					int nx = x + dx;
+					if (nx < 0 || nx >= image.width || (dx == 0 && dy == 0))
+					{
+						continue;
+					}
+
+					int neighbor = ny * image.width + nx;
+					if (response[neighbor] > value || (response[neighbor] == value && neighbor < index))
+					{
+						isMax = false;
+						break;
+					}
+				}
+			}
+
+			if (isMax && HasAlternatingSquares(image, x, y))
+			{
+				PixelLocation candidate;
+				candidate.x = x;
+				candidate.y = y;
+				candidates.push_back(candidate);
+			}
+		}
+	}
+}
+
+static real DistanceSq(const PixelLocation& a, const PixelLocation& b)
+{
+	real dx = a.x - b.x;
+	real dy = a.y - b.y;
+	return dx * dx + dy * dy;
+}
+
+/**
+ * Grows a grid of corners out from the seed, predicting where each next corner is from
+ * its neighbors so it follows the perspective of the checkerboard.  The corners are
+ * written in row major order if the grid is the size of the checkerboard.
+ */
+static bool GrowGrid(const std::vector<PixelLocation>& candidates, int seed, int columns, int rows, std::vector<PixelLocation>& corners)
+{
+	typedef std::pair<int, int> GridIndex;
+	int numCandidates = candidates.size();
+	const PixelLocation& seedPt = candidates[seed];
+
+	// The closest corner gives the first axis and the closest one across from it the second
+	std::vector<std::pair<real, int> > byDistance;
+	for (int iCand = 0; iCand < numCandidates; iCand++)
+	{
+		if (iCand != seed)
+		{
+			byDistance.push_back(std::make_pair(DistanceSq(seedPt, candidates[iCand]), iCand));
+		}
+	}
+
+	if (byDistance.size() < 2)
+	{
+		return false;
+	}
+
+	std::sort(byDistance.begin(), byDistance.end());
+
+	int first = byDistance[0].second;
+	int second = -1;
+	real ux = candidates[first].x - seedPt.x;
+	real uy = candidates[first].y - seedPt.y;
+	real uLength = sqrt(byDistance[0].first);
+
+	for (size_t iDist = 1; iDist < byDistance.size() && byDistance[iDist].first < 4 * byDistance[0].first; iDist++)
+	{
+		int cand = byDistance[iDist].second;
+		real vx = candidates[cand].x - seedPt.x;
+		real vy = candidates[cand].y - seedPt.y;
+		real cosAngle = (ux * vx + uy * vy) / (uLength * sqrt(byDistance[iDist].first));
+		if (ABS(cosAngle) < 0.5)
+		{
+			second = cand;
+			break;
+		}
+	}
+
+	if (second == -1)
+	{
+		return false;
+	}
+
+	PixelLocation globalStep[2];
+	globalStep[0].x = ux;
+	globalStep[0].y = uy;
+	globalStep[1].x = candidates[second].x - seedPt.x;
+	globalStep[1].y = candidates[second].y - seedPt.y;
+
+	std::map<GridIndex, int> grid;
+	std::vector<bool> used(numCandidates, false);
+	std::list<GridIndex> queue;
+
+	grid[GridIndex(0, 0)] = seed;
+	grid[GridIndex(1, 0)] = first;
+	grid[GridIndex(0, 1)] = second;
+	used[seed] = used[first] = used[second] = true;
+	queue.push_back(GridIndex(0, 0));
+	queue.push_back(GridIndex(1, 0));
+	queue.push_back(GridIndex(0, 1));
+
+	const int directions[4][2] = { {1, 0}, {-1, 0}, {0, 1}, {0, -1} };
+
+	while (!queue.empty())
+	{
+		GridIndex node = queue.front();
+		queue.pop_front();
+		const PixelLocation& pt = candidates[grid[node]];
+
+		for (int iDir = 0; iDir < 4; iDir++)
+		{
+			int di = directions[iDir][0];
+			int dj = directions[iDir][1];
+			GridIndex next(node.first + di, node.second + dj);
+			if (grid.find(next) != grid.end())
+			{
+				continue;
+			}
+
+			// Step the same as from the corner behind this one, or as a neighboring row or column does
+			PixelLocation step;
+			std::map<GridIndex, int>::iterator behind = grid.find(GridIndex(node.first - di, node.second - dj));
+			bool haveStep = false;
+			if (behind != grid.end())
+			{
+				step.x = pt.x - candidates[behind->second].x;
+				step.y = pt.y - candidates[behind->second].y;
+				haveStep = true;
+			}
+
+			for (int side = -1; side <= 1 && !haveStep; side += 2)
+			{
+				GridIndex beside(node.first + side * dj, node.second + side * di);
+				GridIndex besideNext(beside.first + di, beside.second + dj);
+				std::map<GridIndex, int>::iterator from = grid.find(beside);
+				std::map<GridIndex, int>::iterator to = grid.find(besideNext);
+				if (from != grid.end() && to != grid.end())
+				{
+					step.x = candidates[to->second].x - candidates[from->second].x;
+					step.y = candidates[to->second].y - candidates[from->second].y;
+					haveStep = true;
+				}
+			}
+
+			if (!haveStep)
+			{
+				const PixelLocation& axis = globalStep[di != 0 ? 0 : 1];
+				int sign = di + dj;
+				step.x = axis.x * sign;
+				step.y = axis.y * sign;
+			}
+
+			PixelLocation predicted;
+			predicted.x = pt.x + step.x;
+			predicted.y = pt.y + step.y;
+
+			real tolerance = CHECKERBOARD_GRID_TOLERANCE * sqrt(step.x * step.x + step.y * step.y);
+			real bestDistSq = tolerance * tolerance;
+			int best = -1;
+			for (int iCand = 0; iCand < numCandidates; iCand++)
+			{
+				real distSq = DistanceSq(predicted, candidates[iCand]);
+				if (!used[iCand] && distSq < bestDistSq)
+				{
+					bestDistSq = distSq;
+					best = iCand;
+				}
+			}
+
+			if (best != -1)
+			{
+				grid[next] = best;
+				used[best] = true;
+				queue.push_back(next);
+			}
+		}
+	}
+
+	if ((int) grid.size() != columns * rows)
+	{
+		return false;
+	}
+
+	int minI = INT_MAX, maxI = INT_MIN, minJ = INT_MAX, maxJ = INT_MIN;
+	for (std::map<GridIndex, int>::iterator it = grid.begin(); it != grid.end(); ++it)
+	{
+		minI = MIN(minI, it->first.first);
+		maxI = MAX(maxI, it->first.first);
+		minJ = MIN(minJ, it->first.second);
+		maxJ = MAX(maxJ, it->first.second);
+	}
+
+	int numI = maxI - minI + 1;
+	int numJ = maxJ - minJ + 1;
+
+	// Either axis of the grid can be the checkerboard's columns
+	bool transposed;
+	if (numI == columns && numJ == rows)
+	{
+		transposed = false;
+	}
+	else if (numI == rows && numJ == columns)
+	{
+		transposed = true;
+	}
+	else
+	{
+		return false;
+	}
+
+	corners.resize(columns * rows);
+	for (int iRow = 0; iRow < rows; iRow++)
+	{
+		for (int iCol = 0; iCol < columns; iCol++)
+		{
+			GridIndex index = transposed ? GridIndex(minI + iRow, minJ + iCol) : GridIndex(minI + iCol, minJ + iRow);
+			corners[iRow * columns + iCol] = candidates[grid[index]];
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Moves the corner to where the image gradients in the window around it are all
+ * perpendicular to the direction to the corner, which is only true at the corner.
+ */
+static bool RefineCorner(const GrayImage& image, PixelLocation& corner, int radius)
+{
+	double cx = corner.x;
+	double cy = corner.y;
+
+	for (int iIter = 0; iIter < 20; iIter++)
+	{
+		int x0 = ROUND(cx);
+		int y0 = ROUND(cy);
+		if (x0 - radius < 1 || y0 - radius < 1 || x0 + radius >= image.width - 1 || y0 + radius >= image.height - 1)
+		{
+			return false;
+		}
+
+		Eigen::Matrix2d a = Eigen::Matrix2d::Zero();
+		Eigen::Vector2d b = Eigen::Vector2d::Zero();
+		for (int dy = -radius; dy <= radius; dy++)
+		{
+			for (int dx = -radius; dx <= radius; dx++)
+			{
+				int x = x0 + dx;
+				int y = y0 + dy;
+				double gx = (image.at(x + 1, y) - image.at(x - 1, y)) * 0.5;
+				double gy = (image.at(x, y + 1) - image.at(x, y - 1)) * 0.5;
+				double weight = exp(-(dx * dx + dy * dy) / (double) (radius * radius));
+
+				double gxx = weight * gx * gx;
+				double gxy = weight * gx * gy;
+				double gyy = weight * gy * gy;
+
+				a(0, 0) += gxx;
+				a(0, 1) += gxy;
+				a(1, 0) += gxy;
+				a(1, 1) += gyy;
+				b(0) += gxx * x + gxy * y;
+				b(1) += gxy * x + gyy * y;
+			}
+		}
+
+		if (a.determinant() < 0.000001)
+		{
+			return false;
+		}
+
+		Eigen::Vector2d refined = a.inverse() * b;
+		double shift = (refined - Eigen::Vector2d(cx, cy)).norm();
+		cx = refined(0);
+		cy = refined(1);
+
+		if (shift < 0.01)
+		{
+			break;
+		}
+	}
+
+	if (ABS(cx - corner.x) > radius || ABS(cy - corner.y) > radius)
+	{
+		return false;
+	}
+
+	corner.x = cx;
+	corner.y = cy;
+
+	return true;
+}
+
+/** Estimates the homography from the checkerboard's plane to the image with the normalized DLT */
+static Eigen::Matrix3d EstimateHomography(const std::vector<PixelLocation>& corners, int columns)
+{
+	int numCorners = corners.size();
+
+	// Normalize both sets of points to the origin with an average distance of sqrt(2)
+	Eigen::Matrix3d normalization[2];
+	for (int iSet = 0; iSet < 2; iSet++)
+	{
+		double meanX = 0, meanY = 0;
+		for (int iPt = 0; iPt < numCorners; iPt++)
+		{
+			meanX += iSet == 0 ? iPt % columns : corners[iPt].x;
+			meanY += iSet == 0 ? iPt / columns : corners[iPt].y;
+		}
+
+		meanX /= numCorners;
+		meanY /= numCorners;
+
+		double meanDist = 0;
+		for (int iPt = 0; iPt < numCorners; iPt++)
+		{
+			double dx = (iSet == 0 ? iPt % columns : corners[iPt].x) - meanX;
+			double dy = (iSet == 0 ? iPt / columns : corners[iPt].y) - meanY;
+			meanDist += sqrt(dx * dx + dy * dy);
+		}
+
+		double scale = sqrt(2.0) * numCorners / meanDist;
+		normalization[iSet] << scale, 0, -scale * meanX,
+				               0, scale, -scale * meanY,
+				               0, 0, 1;
+	}
+
+	Eigen::MatrixXd a(2 * numCorners, 9);
+	for (int iPt = 0; iPt < numCorners; iPt++)
+	{
+		Eigen::Vector3d model = normalization[0] * Eigen::Vector3d(iPt % columns, iPt / columns, 1);
+		Eigen::Vector3d image = normalization[1] * Eigen::Vector3d(corners[iPt].x, corners[iPt].y, 1);
+
+		double mx = model(0), my = model(1);
+		double u = image(0), v = image(1);
+
+		a.row(2 * iPt) << -mx, -my, -1, 0, 0, 0, u * mx, u * my, u;
+		a.row(2 * iPt + 1) << 0, 0, 0, -mx, -my, -1, v * mx, v * my, v;
+	}
+
+	Eigen::JacobiSVD<Eigen::MatrixXd> svd(a, Eigen::ComputeFullV);
+	Eigen::VectorXd h = svd.matrixV().col(8);
+
+	Eigen::Matrix3d normalized;
+	normalized << h(0), h(1), h(2),
+			      h(3), h(4), h(5),
+			      h(6), h(7), h(8);
+
+	Eigen::Matrix3d homography = normalization[1].inverse() * normalized * normalization[0];
+	return homography / homography(2, 2);
+}
+
+/** The row of Zhang's constraint matrix for columns i and j of the homography */
+static Eigen::Matrix<double, 1, 6> HomographyConstraint(const Eigen::Matrix3d& h, int i, int j)
+{
+	Eigen::Matrix<double, 1, 6> v;
+	v << h(0, i) * h(0, j),
+		 h(0, i) * h(1, j) + h(1, i) * h(0, j),
+		 h(1, i) * h(1, j),
+		 h(2, i) * h(0, j) + h(0, i) * h(2, j),
+		 h(2, i) * h(1, j) + h(1, i) * h(2, j),
+		 h(2, i) * h(2, j);
+	return v;
+}
+
+/** Projects the corners of every view with the parameters and writes the differences from the detected corners */
+static void ComputeResiduals(const Eigen::VectorXd& params, const std::vector<std::vector<PixelLocation> >& corners,
+		                     const std::vector<int>& columns, Eigen::VectorXd& residuals)
+{
+	double fx = params(0), fy = params(1), cx = params(2), cy = params(3);
+	double k1 = params(4), k2 = params(5), p1 = params(6), p2 = params(7), k3 = params(8);
+
+	int index = 0;
+	for (size_t iView = 0; iView < corners.size(); iView++)
+	{
+		int offset = NUM_INTRINSIC_PARAMS + iView * NUM_POSE_PARAMS;
+		Eigen::Vector3d rotation(params(offset), params(offset + 1), params(offset + 2));
+		Eigen::Vector3d translation(params(offset + 3), params(offset + 4), params(offset + 5));
+
+		double angle = rotation.norm();
+		Eigen::Matrix3d r = angle > 0 ? Eigen::AngleAxisd(angle, rotation / angle).toRotationMatrix() : Eigen::Matrix3d::Identity();
+
+		const std::vector<PixelLocation>& viewCorners = corners[iView];
+		for (size_t iPt = 0; iPt < viewCorners.size(); iPt++)
+		{
+			Eigen::Vector3d pt = r * Eigen::Vector3d(iPt % columns[iView], iPt / columns[iView], 0) + translation;
+			double x = pt(0) / pt(2);
+			double y = pt(1) / pt(2);
+
+			// Brown-Conrady distortion
+			double r2 = x * x + y * y;
+			double radial = 1 + r2 * (k1 + r2 * (k2 + r2 * k3));
+			double xd = x * radial + 2 * p1 * x * y + p2 * (r2 + 2 * x * x);
+			double yd = y * radial + p1 * (r2 + 2 * y * y) + 2 * p2 * x * y;
+
+			residuals(index++) = fx * xd + cx - viewCorners[iPt].x;
+			residuals(index++) = fy * yd + cy - viewCorners[iPt].y;
+		}
+	}
+}
+
+CameraCalibrator::CameraCalibrator() :
+	m_views(),
+	m_imageWidth(0),
+	m_imageHeight(0)
+{
+	// Do nothing
+}
+
+CameraCalibrator * CameraCalibrator::get()
+{
+	if (CameraCalibrator::m_instance == NULL)
+	{
+		CameraCalibrator::m_instance = new CameraCalibrator();
+	}
+
+	return CameraCalibrator::m_instance;
+}
+
+void CameraCalibrator::release()
+{
+	delete CameraCalibrator::m_instance;
+	CameraCalibrator::m_instance = NULL;
+}
+
+bool CameraCalibrator::findCorners(Image& image, int columns, int rows, std::vector<PixelLocation>& corners)
+{
+	if (columns < 2 || rows < 2)
+	{
+		throw Exception("The checkerboard must have at least 2 inner corners across and down");
+	}
+
+	// Search a smaller, blurred copy of the image
+	int scale = MAX(1, (int) image.getWidth() / CHECKERBOARD_SEARCH_WIDTH);
+	GrayImage search;
+	ToGray(search, image, scale);
+	BoxBlur(search, 1);
+	BoxBlur(search, 1);
+
+	std::vector<PixelLocation> candidates;
+	FindCornerCandidates(search, candidates);
+
+	int numCorners = columns * rows;
+	if ((int) candidates.size() < numCorners)
+	{
+		DebugLog << "Found " << candidates.size() << " checkerboard corner candidates, expected " << numCorners << Logger::ENDL;
+		return false;
+	}
+
+	// Start the grid from the corners closest to the middle of the candidates, which are most likely on the checkerboard
+	PixelLocation middle;
+	middle.x = 0;
+	middle.y = 0;
+	for (size_t iCand = 0; iCand < candidates.size(); iCand++)
+	{
+		middle.x += candidates[iCand].x / candidates.size();
+		middle.y += candidates[iCand].y / candidates.size();
+	}
+
+	std::vector<std::pair<real, int> > seeds;
+	for (size_t iCand = 0; iCand < candidates.size(); iCand++)
+	{
+		seeds.push_back(std::make_pair(DistanceSq(middle, candidates[iCand]), (int) iCand));
+	}
+
+	std::sort(seeds.begin(), seeds.end());
+
+	bool found = false;
+	for (size_t iSeed = 0; iSeed < seeds.size() && iSeed < CHECKERBOARD_MAX_SEEDS && !found; iSeed++)
+	{
+		found = GrowGrid(candidates, seeds[iSeed].second, columns, rows, corners);
+	}
+
+	if (!found)
+	{
+		DebugLog << "Could not fit a " << columns << "x" << rows << " grid to " << candidates.size() << " checkerboard corner candidates" << Logger::ENDL;
+		return false;
+	}
+
+	// Refine the corners in the full resolution image
+	GrayImage full;
+	ToGray(full, image, 1);
+	BoxBlur(full, 1);
+
+	int radius = MAX(CORNER_REFINE_RADIUS, 2 * scale);
+	for (int iCorner = 0; iCorner < numCorners; iCorner++)
+	{
+		PixelLocation& corner = corners[iCorner];
+		corner.x = (corner.x + 0.5f) * scale - 0.5f;
+		corner.y = (corner.y + 0.5f) * scale - 0.5f;
+
+		if (!RefineCorner(full, corner, radius))
+		{
+			DebugLog << "Could not refine checkerboard corner " << iCorner << Logger::ENDL;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool CameraCalibrator::addView(Image& image, int columns, int rows)
+{
+	if (!m_views.empty() && ((int) image.getWidth() != m_imageWidth || (int) image.getHeight() != m_imageHeight))
+	{
+		throw Exception("The camera mode changed since the last checkerboard view, clear the views to start again");
+	}
+
+	View view;
+	view.columns = columns;
+	view.rows = rows;
+	if (!findCorners(image, columns, rows, view.corners))
+	{
+		return false;
+	}
+
+	m_imageWidth = image.getWidth();
+	m_imageHeight = image.getHeight();
+	m_views.push_back(view);
+
+	return true;
+}
+
+int CameraCalibrator::getNumViews() const
+{
+	return m_views.size();
+}
+
+void CameraCalibrator::clearViews()
+{
+	m_views.clear();
+}
+
+real CameraCalibrator::calibrate(CameraIntrinsics& intrinsics)
+{
+	int numViews = m_views.size();
+	if (numViews < MIN_CALIBRATION_VIEWS)
+	{
+		throw Exception("At least " + ToString(MIN_CALIBRATION_VIEWS) + " views of the checkerboard are needed to calibrate the camera");
+	}
+
+	//
+	// Linear estimate of the intrinsics from the homographies
+	//
+
+	// Pixel coordinates are normalized so the constraints are well conditioned
+	double scale = 2.0 / (m_imageWidth + m_imageHeight);
+	Eigen::Matrix3d normalization;
+	normalization << scale, 0, -scale * m_imageWidth * 0.5,
+			         0, scale, -scale * m_imageHeight * 0.5,
+			         0, 0, 1;
+
+	std::vector<Eigen::Matrix3d> homographies;
+	Eigen::MatrixXd constraints(2 * numViews + 1, 6);
+	for (int iView = 0; iView < numViews; iView++)
+	{
+		homographies.push_back(EstimateHomography(m_views[iView].corners, m_views[iView].columns));
+
+		Eigen::Matrix3d normalized = normalization * homographies.back();
+		constraints.row(2 * iView) = HomographyConstraint(normalized, 0, 1);
+		constraints.row(2 * iView + 1) = HomographyConstraint(normalized, 0, 0) - HomographyConstraint(normalized, 1, 1);
+	}
+
+	// The pixels have no skew
+	constraints.row(2 * numViews) << 0, 1, 0, 0, 0, 0;
+
+	Eigen::JacobiSVD<Eigen::MatrixXd> svd(constraints, Eigen::ComputeFullV);
+	Eigen::VectorXd b = svd.matrixV().col(5);
+	double b11 = b(0), b12 = b(1), b22 = b(2), b13 = b(3), b23 = b(4), b33 = b(5);
+
+	double denom = b11 * b22 - b12 * b12;
+	double v0 = (b12 * b13 - b11 * b23) / denom;
+	double lambda = b33 - (b13 * b13 + v0 * (b12 * b13 - b11 * b23)) / b11;
+	if (denom <= 0 || lambda / b11 <= 0)
+	{
+		throw Exception("The checkerboard views are too similar, tilt the checkerboard a different way in each view");
+	}
+
+	double alpha = sqrt(lambda / b11);
+	double beta = sqrt(lambda * b11 / denom);
+	double u0 = -b13 * alpha * alpha / lambda;
+
+	Eigen::Matrix3d normalizedK;
+	normalizedK << alpha, 0, u0,
+			       0, beta, v0,
+			       0, 0, 1;
+
+	Eigen::Matrix3d k = normalization.inverse() * normalizedK;
+	Eigen::Matrix3d kInverse = k.inverse();
+
+	//
+	// The pose of the checkerboard in each view
+	//
+
+	int numParams = NUM_INTRINSIC_PARAMS + NUM_POSE_PARAMS * numViews;
+	Eigen::VectorXd params = Eigen::VectorXd::Zero(numParams);
+	params(0) = k(0, 0);
+	params(1) = k(1, 1);
+	params(2) = k(0, 2);
+	params(3) = k(1, 2);
+
+	std::vector<std::vector<PixelLocation> > corners;
+	std::vector<int> columns;
+	int numCorners = 0;
+
+	for (int iView = 0; iView < numViews; iView++)
+	{
+		const Eigen::Matrix3d& h = homographies[iView];
+		double viewScale = 1.0 / (kInverse * h.col(0)).norm();
+
+		// The checkerboard is in front of the camera
+		if ((kInverse * h.col(2))(2) < 0)
+		{
+			viewScale = -viewScale;
+		}
+
+		Eigen::Vector3d r1 = viewScale * kInverse * h.col(0);
+		Eigen::Vector3d r2 = viewScale * kInverse * h.col(1);
+		Eigen::Vector3d t = viewScale * kInverse * h.col(2);
+
+		Eigen::Matrix3d r;
+		r.col(0) = r1;
+		r.col(1) = r2;
+		r.col(2) = r1.cross(r2);
+
+		// Use the closest rotation matrix
+		Eigen::JacobiSVD<Eigen::Matrix3d> rotationSvd(r, Eigen::ComputeFullU | Eigen::ComputeFullV);
+		r = rotationSvd.matrixU() * rotationSvd.matrixV().transpose();
+
+		Eigen::AngleAxisd angleAxis(r);
+		Eigen::Vector3d rotation = angleAxis.angle() * angleAxis.axis();
+
+		int offset = NUM_INTRINSIC_PARAMS + iView * NUM_POSE_PARAMS;
+		params.segment(offset, 3) = rotation;
+		params.segment(offset + 3, 3) = t;
+
+		corners.push_back(m_views[iView].corners);
+		columns.push_back(m_views[iView].columns);
+		numCorners += m_views[iView].corners.size();
+	}
+
+	//
+	// Refine everything along with the lens distortion with Levenberg-Marquardt
+	//
+
+	Eigen::VectorXd residuals(2 * numCorners);
+	Eigen::VectorXd stepResiduals(2 * numCorners);
+	Eigen::MatrixXd jacobian(2 * numCorners, numParams);
+
+	ComputeResiduals(params, corners, columns, residuals);
+	double cost = residuals.squaredNorm();
+	double damping = 0.001;
+
+	for (int iIter = 0; iIter < CALIBRATION_ITERATIONS; iIter++)
+	{
+		// Forward difference Jacobian
+		for (int iParam = 0; iParam < numParams; iParam++)
+		{
+			Eigen::VectorXd stepParams = params;
+			double delta = 0.000001 * MAX(1.0, ABS(params(iParam)));
+			stepParams(iParam) += delta;
+			ComputeResiduals(stepParams, corners, columns, stepResiduals);
+			jacobian.col(iParam) = (stepResiduals - residuals) / delta;
+		}
+
+		Eigen::MatrixXd jtj = jacobian.transpose() * jacobian;
+		Eigen::VectorXd jtr = jacobian.transpose() * residuals;
+
+		bool improved = false;
+		double prevCost = cost;
+		while (!improved && damping < 1e10)
+		{
+			Eigen::MatrixXd damped = jtj;
+			for (int iParam = 0; iParam < numParams; iParam++)
+			{
+				damped(iParam, iParam) += damping * MAX(jtj(iParam, iParam), 1e-12);
+			}
+
+			Eigen::VectorXd newParams = params - damped.ldlt().solve(jtr);
+			ComputeResiduals(newParams, corners, columns, stepResiduals);
+			double newCost = stepResiduals.squaredNorm();
+
+			if (newCost < cost)
+			{
+				params = newParams;
+				residuals = stepResiduals;
+				cost = newCost;
+				damping = MAX(damping * 0.1, 1e-12);
+				improved = true;
+			}
+			else
+			{
+				damping *= 10;
+			}
+		}
+
+		if (!improved || prevCost - cost < 1e-12 * prevCost)
+		{
+			break;
+		}
+	}
+
+	intrinsics.focalX = params(0);
+	intrinsics.focalY = params(1);
+	intrinsics.principalX = params(2);
+	intrinsics.principalY = params(3);
+	intrinsics.k1 = params(4);
+	intrinsics.k2 = params(5);
+	intrinsics.p1 = params(6);
+	intrinsics.p2 = params(7);
+	intrinsics.k3 = params(8);
+	intrinsics.imageWidth = m_imageWidth;
+	intrinsics.imageHeight = m_imageHeight;
+
+	real rmsError = sqrt(cost / numCorners);
+
+	InfoLog << "Calibrated the camera from " << numViews << " views, focal length: (" << intrinsics.focalX << ", " << intrinsics.focalY
+			<< ") px, principal point: (" << intrinsics.principalX << ", " << intrinsics.principalY << ") px, distortion: k1="
+			<< intrinsics.k1 << " k2=" << intrinsics.k2 << " k3=" << intrinsics.k3 << " p1=" << intrinsics.p1 << " p2=" << intrinsics.p2
+			<< ", RMS reprojection error: " << rmsError << " px" << Logger::ENDL;
+
+	return rmsError;
+}
+
+}
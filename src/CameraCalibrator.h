@@ -0,0 +1,88 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+class Image;
+
+/**
+ * Calibrates the camera's focal lengths, principal point and lens distortion from
+ * pictures of a checkerboard held in different poses (Zhang, "A Flexible New Technique
+ * for Camera Calibration").  The views are kept between captures until calibrate() is called.
+ */
+class CameraCalibrator
+{
+public:
+
+	/** Returns the singleton instance */
+	static CameraCalibrator * get();
+
+	/** Releases the singleton instance */
+	static void release();
+
+	/**
+	 * Detects the checkerboard's inner corners in the image and keeps them as a view.
+	 * Returns false if the whole checkerboard wasn't found.
+	 * @param columns - The number of inner corners across the checkerboard.
+	 * @param rows - The number of inner corners down the checkerboard.
+	 */
+	bool addView(Image& image, int columns, int rows);
+
+	/** Returns the number of views that have been added */
+	int getNumViews() const;
+
+	/** Removes all the views */
+	void clearViews();
+
+	/**
+	 * Estimates the intrinsics from the views and returns the RMS reprojection error in pixels.
+	 * Throws an exception if there aren't enough views.
+	 */
+	real calibrate(CameraIntrinsics& intrinsics);
+
+	/**
+	 * Finds the inner corners of the checkerboard in row major order.
+	 * Returns false if the whole checkerboard wasn't found.
+	 */
+	static bool findCorners(Image& image, int columns, int rows, std::vector<PixelLocation>& corners);
+
+private:
+	CameraCalibrator();
+
+	/** The corners of the checkerboard in a view */
+	struct View
+	{
+		std::vector<PixelLocation> corners;
+		int columns;
+		int rows;
+	};
+
+	std::vector<View> m_views;
+	int m_imageWidth;
+	int m_imageHeight;
+
+	/** The singleton instance */
+	static CameraCalibrator * m_instance;
+};
+
+}
@@ -0,0 +1,180 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "ContentEncoder.h"
+
+#define ENCODE_CHUNK_SIZE 16384
+
+namespace freelss
+{
+
+ContentEncoder::ContentEncoder(Encoding encoding, int level) :
+	m_encoding(encoding),
+	m_finished(false)
+{
+	memset(&m_stream, 0, sizeof(m_stream));
+
+	if (m_encoding != CE_IDENTITY)
+	{
+		// Adding 16 to the window bits writes a gzip header and trailer instead of a zlib one
+		int windowBits = (m_encoding == CE_GZIP) ? 15 + 16 : 15;
+
+		if (deflateInit2(&m_stream, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		{
+			throw Exception("Error initializing the zlib compressor");
+		}
+	}
+}
+
+ContentEncoder::~ContentEncoder()
+{
+	if (m_encoding != CE_IDENTITY)
+	{
+		deflateEnd(&m_stream);
+	}
+}
+
+ContentEncoder::Encoding ContentEncoder::getEncoding() const
+{
+	return m_encoding;
+}
+
+void ContentEncoder::encode(const void * data, size_t size, std::vector<char>& output, bool finish)
+{
+	if (m_finished)
+	{
+		throw Exception("Data was given to a finished ContentEncoder");
+	}
+
+	m_finished = finish;
+
+	if (m_encoding == CE_IDENTITY)
+	{
+		const char * bytes = (const char *) data;
+		output.insert(output.end(), bytes, bytes + size);
+		return;
+	}
+
+	m_stream.next_in = (Bytef *) data;
+	m_stream.avail_in = (uInt) size;
+
+	int flush = finish ? Z_FINISH : Z_NO_FLUSH;
+	int status;
+
+	do
+	{
+		size_t offset = output.size();
+		output.resize(offset + ENCODE_CHUNK_SIZE);
+
+		m_stream.next_out = (Bytef *) &output[offset];
+		m_stream.avail_out = ENCODE_CHUNK_SIZE;
+
+		status = deflate(&m_stream, flush);
+		if (status == Z_STREAM_ERROR)
+		{
+			throw Exception("Error compressing the response");
+		}
+
+		output.resize(offset + ENCODE_CHUNK_SIZE - m_stream.avail_out);
+
+	} while (m_stream.avail_out == 0 || (finish && status != Z_STREAM_END));
+}
+
+const char * ContentEncoder::toString(Encoding encoding)
+{
+	switch (encoding)
+	{
+	case CE_GZIP:
+		return "gzip";
+
+	case CE_DEFLATE:
+		return "deflate";
+
+	default:
+		return "identity";
+	}
+}
+
+ContentEncoder::Encoding ContentEncoder::negotiate(const char * acceptEncoding)
+{
+	real gzipQuality = getQuality(acceptEncoding, CE_GZIP);
+	real deflateQuality = getQuality(acceptEncoding, CE_DEFLATE);
+
+	if (gzipQuality > 0 && gzipQuality >= deflateQuality)
+	{
+		return CE_GZIP;
+	}
+	else if (deflateQuality > 0)
+	{
+		return CE_DEFLATE;
+	}
+
+	return CE_IDENTITY;
+}
+
+bool ContentEncoder::accepts(const char * acceptEncoding, Encoding encoding)
+{
+	return encoding == CE_IDENTITY || getQuality(acceptEncoding, encoding) > 0;
+}
+
+real ContentEncoder::getQuality(const char * acceptEncoding, Encoding encoding)
+{
+	if (acceptEncoding == NULL || encoding == CE_IDENTITY)
+	{
+		return 0;
+	}
+
+	std::string name = toString(encoding);
+	std::stringstream header(acceptEncoding);
+	std::string item;
+	real wildcardQuality = 0;
+
+	while (std::getline(header, item, ','))
+	{
+		// Split the coding from its parameters, e.g. "gzip;q=0.5"
+		size_t semiPos = item.find(';');
+		std::string coding = TrimString(item.substr(0, semiPos));
+		std::transform(coding.begin(), coding.end(), coding.begin(), ::tolower);
+
+		real quality = 1;
+		if (semiPos != std::string::npos)
+		{
+			std::string param = TrimString(item.substr(semiPos + 1));
+			if (param.size() > 2 && (param[0] == 'q' || param[0] == 'Q') && param[1] == '=')
+			{
+				quality = ToReal(param.substr(2));
+			}
+		}
+
+		if (coding == name || (encoding == CE_GZIP && coding == "x-gzip"))
+		{
+			return quality;
+		}
+		else if (coding == "*")
+		{
+			wildcardQuality = quality;
+		}
+	}
+
+	return wildcardQuality;
+}
+
+}
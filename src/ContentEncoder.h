@@ -0,0 +1,73 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+/**
+ * Compresses HTTP response bodies a block at a time with zlib so that large
+ * responses can be streamed without holding the whole result in memory.
+ */
+class ContentEncoder
+{
+public:
+
+	/** The supported values for the Content-Encoding header */
+	enum Encoding { CE_IDENTITY, CE_GZIP, CE_DEFLATE };
+
+	ContentEncoder(Encoding encoding, int level = DEFAULT_LEVEL);
+	~ContentEncoder();
+
+	/**
+	 * Compresses the data and appends the result to output.
+	 * @param finish - Must be true for the last block of data and flushes the rest of the stream.
+	 */
+	void encode(const void * data, size_t size, std::vector<char>& output, bool finish);
+
+	Encoding getEncoding() const;
+
+	/** Returns the name of the encoding as used in the Content-Encoding header */
+	static const char * toString(Encoding encoding);
+
+	/** Returns the preferred encoding allowed by the Accept-Encoding header, which may be NULL */
+	static Encoding negotiate(const char * acceptEncoding);
+
+	/** Returns true if the Accept-Encoding header allows the given encoding */
+	static bool accepts(const char * acceptEncoding, Encoding encoding);
+
+	/** The default compression level.  Favors speed since the Pi's CPU is usually slower than the network. */
+	static const int DEFAULT_LEVEL = 1;
+
+private:
+
+	/** Returns the quality value given to the encoding by the Accept-Encoding header */
+	static real getQuality(const char * acceptEncoding, Encoding encoding);
+
+	ContentEncoder(const ContentEncoder& ) { /* NO COPYING */ }
+	ContentEncoder& operator = (const ContentEncoder& ) { return * this; /* NO ASSIGNMENT */ }
+
+	z_stream m_stream;
+	Encoding m_encoding;
+	bool m_finished;
+};
+
+}
@@ -0,0 +1,169 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "ContinuousRotator.h"
+#include "TurnTable.h"
+#include "Setup.h"
+#include "Logger.h"
+
+namespace freelss
+{
+
+ContinuousRotator::ContinuousRotator(TurnTable * turnTable, real radiansPerSecond, real rangeRadians) :
+	m_turnTable(turnTable),
+	m_radiansPerStep(0),
+	m_secondsPerStep(0),
+	m_numSteps(0),
+	m_stepTimes(),
+	m_cs(),
+	m_complete(false)
+{
+	if (radiansPerSecond <= 0)
+	{
+		throw Exception("The continuous rotation speed must be positive");
+	}
+
+	int stepsPerRevolution = MAX(1, Setup::get()->stepsPerRevolution);
+
+	m_radiansPerStep = (2 * PI) / stepsPerRevolution;
+	m_secondsPerStep = m_radiansPerStep / radiansPerSecond;
+	m_numSteps = ceil(rangeRadians / m_radiansPerStep);
+	m_stepTimes.reserve(m_numSteps + 1);
+}
+
+void ContinuousRotator::run()
+{
+	double startTime = GetTimeInSeconds();
+
+	StepTime stepTime;
+	stepTime.time = startTime;
+	stepTime.rotation = 0;
+
+	m_cs.enter();
+	m_stepTimes.push_back(stepTime);
+	m_cs.leave();
+
+	try
+	{
+		for (int iStep = 1; iStep <= m_numSteps && !m_stopRequested; iStep++)
+		{
+			// Sleep until the step's deadline so the time spent stepping doesn't add up
+			double sleepTime = startTime + iStep * m_secondsPerStep - GetTimeInSeconds();
+			if (sleepTime > 0)
+			{
+				Thread::usleep((unsigned long) (sleepTime * 1000000.0));
+			}
+
+			// The step pulse is sent at the start of the rotation
+			stepTime.time = GetTimeInSeconds();
+			stepTime.rotation = iStep * m_radiansPerStep;
+			m_turnTable->rotate(m_radiansPerStep);
+
+			m_cs.enter();
+			m_stepTimes.push_back(stepTime);
+			m_cs.leave();
+		}
+	}
+	catch (Exception& ex)
+	{
+		ErrorLog << "Error rotating the table: " << ex << Logger::ENDL;
+	}
+	catch (...)
+	{
+		ErrorLog << "Unknown error rotating the table" << Logger::ENDL;
+	}
+
+	m_cs.enter();
+	m_complete = true;
+	m_cs.leave();
+}
+
+real ContinuousRotator::getRotationAt(double timeSec)
+{
+	real rotation = 0;
+
+	m_cs.enter();
+	try
+	{
+		if (!m_stepTimes.empty())
+		{
+			// Find the first step taken after the time
+			size_t lo = 0;
+			size_t hi = m_stepTimes.size();
+			while (lo < hi)
+			{
+				size_t mid = (lo + hi) / 2;
+				if (m_stepTimes[mid].time <= timeSec)
+				{
+					lo = mid + 1;
+				}
+				else
+				{
+					hi = mid;
+				}
+			}
+
+			if (lo == 0)
+			{
+				rotation = m_stepTimes.front().rotation;
+			}
+			else if (lo == m_stepTimes.size())
+			{
+				// Extrapolate at the constant speed until the next step is taken, unless the table stopped
+				const StepTime& last = m_stepTimes.back();
+				rotation = last.rotation;
+				if (!m_complete)
+				{
+					real fraction = MIN(1.0, (timeSec - last.time) / m_secondsPerStep);
+					rotation += fraction * m_radiansPerStep;
+				}
+			}
+			else
+			{
+				const StepTime& before = m_stepTimes[lo - 1];
+				const StepTime& after = m_stepTimes[lo];
+				real fraction = (timeSec - before.time) / (after.time - before.time);
+				rotation = before.rotation + fraction * (after.rotation - before.rotation);
+			}
+		}
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+	m_cs.leave();
+
+	return rotation;
+}
+
+bool ContinuousRotator::isComplete()
+{
+	bool complete;
+
+	m_cs.enter();
+	complete = m_complete;
+	m_cs.leave();
+
+	return complete;
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "Thread.h"
+#include "CriticalSection.h"
+
+namespace freelss
+{
+
+class TurnTable;
+
+/**
+ * Turns the table at a constant angular velocity from a background thread
+ * and records when each step was taken so the rotation of the table at the
+ * time a video frame was captured can be looked up.
+ */
+class ContinuousRotator : public Thread
+{
+public:
+
+	/**
+	 * @param turnTable - The table to turn.
+	 * @param radiansPerSecond - The speed to turn the table at.
+	 * @param rangeRadians - How far to turn the table before stopping.
+	 */
+	ContinuousRotator(TurnTable * turnTable, real radiansPerSecond, real rangeRadians);
+
+	/** The overridden thread method that steps the table */
+	void run();
+
+	/**
+	 * Returns the rotation of the table at the given time, from GetTimeInSeconds(),
+	 * relative to where it was when the thread started.  It is interpolated between the
+	 * steps on either side of the time.
+	 */
+	real getRotationAt(double timeSec);
+
+	/** Indicates if the table has turned the full range */
+	bool isComplete();
+
+private:
+	/** When a step was taken and the rotation after it */
+	struct StepTime
+	{
+		double time;
+		real rotation;
+	};
+
+	TurnTable * m_turnTable;
+	real m_radiansPerStep;
+	double m_secondsPerStep;
+	int m_numSteps;
+
+	/** Every step taken so far in order */
+	std::vector<StepTime> m_stepTimes;
+
+	/** Protection for the step times */
+	CriticalSection m_cs;
+	bool m_complete;
+};
+
+}
@@ -0,0 +1,290 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "FloatFormatter.h"
+
+namespace freelss
+{
+
+static const uint64_t POWERS_OF_10[] =
+{
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL
+};
+
+/** Powers of 10 that are exactly representable as doubles */
+static const double EXACT_POWERS_OF_10[] =
+{
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAX_EXACT_POWER_OF_10 22
+
+/** The most significant digits a float ever needs to round trip */
+#define MAX_FLOAT_DIGITS 9
+
+/** Returns the value multiplied by 10^power with a single rounding */
+static inline double ScaleByPowerOf10(double value, int power)
+{
+	return power >= 0 ? value * EXACT_POWERS_OF_10[power] : value / EXACT_POWERS_OF_10[-power];
+}
+
+int FloatFormatter::formatDigits(char * out, uint64_t value, int minDigits)
+{
+	// Write the digits backwards into a scratch buffer
+	char digits[24];
+	int numDigits = 0;
+
+	do
+	{
+		digits[numDigits++] = (char) ('0' + value % 10);
+		value /= 10;
+	} while (value != 0);
+
+	while (numDigits < minDigits)
+	{
+		digits[numDigits++] = '0';
+	}
+
+	for (int iDigit = 0; iDigit < numDigits; iDigit++)
+	{
+		out[iDigit] = digits[numDigits - iDigit - 1];
+	}
+
+	return numDigits;
+}
+
+int FloatFormatter::formatFixed(char * out, real value, int precision)
+{
+	precision = MAX(0, MIN(precision, 9));
+
+	double dvalue = value;
+	double scaled = fabs(dvalue) * POWERS_OF_10[precision];
+
+	// Fall back to the C library for values that don't fit in 64 bits
+	if (dvalue != dvalue || scaled >= 1.0e18)
+	{
+		return snprintf(out, MAX_FIXED_LENGTH, "%.*f", precision, dvalue);
+	}
+
+	char * start = out;
+
+	if (signbit(dvalue))
+	{
+		* out++ = '-';
+	}
+
+	// Round half to even like printf.  The scaling is exact for floats when precision <= 6.
+	double whole = floor(scaled);
+	double remainder = scaled - whole;
+	uint64_t fixed = (uint64_t) whole;
+	if (remainder > 0.5 || (remainder == 0.5 && (fixed & 1) != 0))
+	{
+		fixed++;
+	}
+
+	out += formatDigits(out, fixed / POWERS_OF_10[precision], 1);
+
+	if (precision > 0)
+	{
+		* out++ = '.';
+		out += formatDigits(out, fixed % POWERS_OF_10[precision], precision);
+	}
+
+	return (int) (out - start);
+}
+
+int FloatFormatter::formatUnsigned(char * out, uint32 value)
+{
+	return formatDigits(out, value, 1);
+}
+
+int FloatFormatter::formatDecimal(char * out, uint64_t digits, int numDigits, int exponent)
+{
+	// Drop the trailing zeros
+	while (numDigits > 1 && digits % 10 == 0)
+	{
+		digits /= 10;
+		numDigits--;
+	}
+
+	char text[MAX_FLOAT_DIGITS + 1];
+	formatDigits(text, digits, numDigits);
+
+	char * start = out;
+	int numWhole = exponent + 1;
+
+	if (exponent >= -5 && exponent < 9)
+	{
+		if (numWhole <= 0)
+		{
+			// 0.000ddd
+			* out++ = '0';
+			* out++ = '.';
+			for (int iZero = 0; iZero < -numWhole; iZero++)
+			{
+				* out++ = '0';
+			}
+
+			memcpy(out, text, numDigits);
+			out += numDigits;
+		}
+		else if (numWhole < numDigits)
+		{
+			// ddd.ddd
+			memcpy(out, text, numWhole);
+			out += numWhole;
+			* out++ = '.';
+			memcpy(out, text + numWhole, numDigits - numWhole);
+			out += numDigits - numWhole;
+		}
+		else
+		{
+			// ddd000
+			memcpy(out, text, numDigits);
+			out += numDigits;
+			for (int iZero = numDigits; iZero < numWhole; iZero++)
+			{
+				* out++ = '0';
+			}
+		}
+	}
+	else
+	{
+		// d.ddde-XX
+		* out++ = text[0];
+		if (numDigits > 1)
+		{
+			* out++ = '.';
+			memcpy(out, text + 1, numDigits - 1);
+			out += numDigits - 1;
+		}
+
+		* out++ = 'e';
+		* out++ = exponent < 0 ? '-' : '+';
+		out += formatDigits(out, exponent < 0 ? -exponent : exponent, 2);
+	}
+
+	return (int) (out - start);
+}
+
+int FloatFormatter::formatShortestSlow(char * out, real32 value)
+{
+	// Try increasing precision until the text reads back as the same value
+	char text[MAX_SHORTEST_LENGTH + 8];
+	for (int precision = 1; precision <= MAX_FLOAT_DIGITS; precision++)
+	{
+		snprintf(text, sizeof(text), "%.*g", precision, (double) value);
+		if (strtof(text, NULL) == value)
+		{
+			break;
+		}
+	}
+
+	int length = strlen(text);
+	memcpy(out, text, length);
+
+	return length;
+}
+
+int FloatFormatter::formatShortest(char * out, real32 value)
+{
+	if (value != value || isinf(value))
+	{
+		return formatShortestSlow(out, value);
+	}
+
+	char * start = out;
+
+	if (signbit(value))
+	{
+		* out++ = '-';
+		value = -value;
+	}
+
+	if (value == 0)
+	{
+		* out++ = '0';
+		return (int) (out - start);
+	}
+
+	//
+	// Any decimal strictly between the midpoints to the neighboring floats reads back as
+	// this float.  The sums are exact in double precision.
+	//
+	double dvalue = value;
+	double low = (dvalue + nextafterf(value, 0)) * 0.5;
+	double high = (dvalue + nextafterf(value, FLT_MAX)) * 0.5;
+
+	// A decimal exactly on a midpoint reads back as the neighbor with the even mantissa
+	uint32 bits;
+	memcpy(&bits, &value, sizeof(bits));
+	bool evenMantissa = (bits & 1) == 0;
+
+	int exponent = (int) floor(log10(dvalue));
+
+	// Every scale factor used below must be an exact power of 10
+	if (exponent < MAX_FLOAT_DIGITS - 1 - MAX_EXACT_POWER_OF_10 || exponent >= MAX_EXACT_POWER_OF_10)
+	{
+		return (int) (out - start) + formatShortestSlow(out, value);
+	}
+
+	if (dvalue < ScaleByPowerOf10(1.0, exponent))
+	{
+		exponent--;
+	}
+	else if (dvalue >= ScaleByPowerOf10(10.0, exponent))
+	{
+		exponent++;
+	}
+
+	for (int numDigits = 1; numDigits <= MAX_FLOAT_DIGITS; numDigits++)
+	{
+		int power = numDigits - 1 - exponent;
+
+		// The closest decimal with numDigits significant digits
+		double digits = floor(ScaleByPowerOf10(dvalue, power) + 0.5);
+
+		//
+		// The candidate is rounded once when it is rebuilt.  Since low and high are
+		// representable, a strict comparison against them is still exact.  Equality
+		// can only be trusted when the candidate is an integer that fits in a double.
+		//
+		double candidate = ScaleByPowerOf10(digits, -power);
+		bool exact = power <= 0 && candidate < 9007199254740992.0;
+		bool onMidpoint = exact && evenMantissa && (candidate == low || candidate == high);
+
+		if ((candidate > low && candidate < high) || onMidpoint)
+		{
+			if (digits >= EXACT_POWERS_OF_10[numDigits])
+			{
+				// Rounded up to the next power of 10
+				return (int) (out - start) + formatDecimal(out, (uint64_t) (digits / 10), numDigits, exponent + 1);
+			}
+
+			return (int) (out - start) + formatDecimal(out, (uint64_t) digits, numDigits, exponent);
+		}
+	}
+
+	return (int) (out - start) + formatShortestSlow(out, value);
+}
+
+}
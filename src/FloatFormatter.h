@@ -0,0 +1,74 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+/**
+ * Formats numbers as text directly into a caller supplied buffer.
+ * This avoids the locale and stream overhead of iostreams when writing
+ * large ASCII point clouds.
+ */
+class FloatFormatter
+{
+public:
+	/**
+	 * Writes the value with the given number of digits after the decimal point,
+	 * equivalent to std::fixed with std::setprecision(precision).
+	 * @param out - Must have room for at least MAX_FIXED_LENGTH characters.
+	 * @return The number of characters written.  The output is not null terminated.
+	 */
+	static int formatFixed(char * out, real value, int precision);
+
+	/**
+	 * Writes the shortest text that reads back as exactly the same float.  Numbers
+	 * with a decimal exponent in [-5, 9) are written without an exponent.
+	 * @param out - Must have room for at least MAX_SHORTEST_LENGTH characters.
+	 * @return The number of characters written.  The output is not null terminated.
+	 */
+	static int formatShortest(char * out, real32 value);
+
+	/**
+	 * Writes the unsigned integer.
+	 * @param out - Must have room for at least 10 characters.
+	 * @return The number of characters written.  The output is not null terminated.
+	 */
+	static int formatUnsigned(char * out, uint32 value);
+
+	/** The largest number of characters that formatFixed will write for precision <= 9 */
+	static const int MAX_FIXED_LENGTH = 48;
+
+	/** The largest number of characters that formatShortest will write */
+	static const int MAX_SHORTEST_LENGTH = 24;
+
+private:
+	/** Writes the digits of the value and returns the number of characters written */
+	static int formatDigits(char * out, uint64_t value, int minDigits);
+
+	/** Lays out the significant digits with the decimal point or exponent and returns the number of characters written */
+	static int formatDecimal(char * out, uint64_t digits, int numDigits, int exponent);
+
+	/** The slow path for values outside of the range handled by formatShortest */
+	static int formatShortestSlow(char * out, real32 value);
+};
+
+}
@@ -0,0 +1,80 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "GpioDevice.h"
+#include "MockGpioDevice.h"
+#include "PigpioGpioDevice.h"
+#include "Thread.h"
+
+/** The time to sleep between checks of whether a waveform is complete, in microseconds */
+#define WAVEFORM_POLL_DELAY 500
+
+namespace freelss
+{
+
+GpioDevice * GpioDevice::m_instance = NULL;
+
+GpioDevice::GpioDevice()
+{
+	// Do nothing
+}
+
+GpioDevice::~GpioDevice()
+{
+	// Do nothing
+}
+
+GpioDevice * GpioDevice::get()
+{
+	if (m_instance == NULL)
+	{
+		if (IsMockHardware())
+		{
+			m_instance = new MockGpioDevice();
+		}
+		else
+		{
+#ifdef PIGPIO
+			m_instance = new PigpioGpioDevice();
+#else
+			throw Exception("FreeLSS was built without pigpio, rebuild it with PIGPIO=1 for hardware timed GPIO");
+#endif
+		}
+	}
+
+	return m_instance;
+}
+
+void GpioDevice::release()
+{
+	delete m_instance;
+	m_instance = NULL;
+}
+
+void GpioDevice::waitForWaveform()
+{
+	while (isWaveformBusy())
+	{
+		Thread::usleep(WAVEFORM_POLL_DELAY);
+	}
+}
+
+}
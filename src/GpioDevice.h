@@ -0,0 +1,87 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+/**
+ * Drives GPIO pins directly and plays waveforms of pin changes whose timing
+ * is kept by the hardware instead of by sleeping.  Pins use the wiringPi numbering.
+ */
+class GpioDevice
+{
+public:
+
+	/** A pin change followed by a delay before the next one */
+	struct Pulse
+	{
+		Pulse() : pin(-1), value(0), delay(0) { }
+		Pulse(int pin, int value, unsigned delay) : pin(pin), value(value), delay(delay) { }
+
+		/** The pin to change or -1 to only delay */
+		int pin;
+
+		/** The value to write to the pin */
+		int value;
+
+		/** The time in microseconds until the next pulse */
+		unsigned delay;
+	};
+
+	/** Returns the singleton instance */
+	static GpioDevice * get();
+
+	/** Releases the singleton instance */
+	static void release();
+
+	virtual ~GpioDevice();
+
+	/** Makes the pin an output and sets its value */
+	virtual void setOutput(int pin, int value) = 0;
+
+	/** Sets the value of an output pin */
+	virtual void write(int pin, int value) = 0;
+
+	/**
+	 * Plays the pulses once any waveform already being played is complete.
+	 * Returns without waiting for them to be played.
+	 */
+	virtual void sendWaveform(const std::vector<Pulse>& pulses) = 0;
+
+	/** Returns true if a waveform is being played */
+	virtual bool isWaveformBusy() = 0;
+
+	/** Returns the most pulses that can be sent in one waveform */
+	virtual int getMaxWaveformPulses() = 0;
+
+	/** Sleeps until all of the waveforms have been played */
+	void waitForWaveform();
+
+protected:
+	GpioDevice();
+
+private:
+	/** The singleton instance */
+	static GpioDevice * m_instance;
+};
+
+}
@@ -28,6 +28,7 @@
 #include "Scanner.h"
 #include "Camera.h"
 #include "Calibrator.h"
+#include "CameraCalibrator.h"
 #include "UpdateManager.h"
 #include "Progress.h"
 #include "MemWriter.h"
@@ -38,6 +39,13 @@
 #include "BootConfigManager.h"
 #include "PointCloudRenderer.h"
 #include "PlyReader.h"
+#include "WorkerPool.h"
+#include "ContentEncoder.h"
+#include "ProgressChannel.h"
+#include "JsonWriter.h"
+#include "JsonReader.h"
+#include "ScanCatalog.h"
+#include "Metrics.h"
 #include <three.min.js.h>
 #include <OrbitControls.js.h>
 #include <PLYLoader.js.h>
@@ -46,16 +54,30 @@
 #include <CanvasRenderer.js.h>
 #include <SoftwareRenderer.js.h>
 #include <Projector.js.h>
+#include <three.min.js.gz.h>
+#include <OrbitControls.js.gz.h>
+#include <PLYLoader.js.gz.h>
+#include <showScan.js.gz.h>
+#include <licenses.txt.gz.h>
+#include <CanvasRenderer.js.gz.h>
+#include <SoftwareRenderer.js.gz.h>
+#include <Projector.js.gz.h>
 
 #define POSTBUFFERSIZE 2048
 #define MAX_PIN 40
+#define HTTP_THREAD_POOL_SIZE 4
+#define HTTP_NUM_WORKER_THREADS 2
+#define COMPRESSED_READ_SIZE 65536
+#define API_PREFIX "/api/v1"
+#define MAX_JSON_BODY_SIZE 65536
+#define API_DEFAULT_SCAN_LIMIT 100
 
 namespace freelss
 {
 
 struct RequestInfo
 {
-	enum HttpMethod { UNKNOWN, GET, POST };
+	enum HttpMethod { UNKNOWN, GET, POST, PUT, DELETE };
 
 	RequestInfo()
 	{
@@ -66,6 +88,12 @@ struct RequestInfo
 		url = "";
 		uploadDataSize = 0;
 		method = UNKNOWN;
+		deferred = false;
+		response = NULL;
+		responseCode = MHD_HTTP_OK;
+		jsonBody = false;
+		body = "";
+		startTime = 0;
 	}
 
 	std::string url;
@@ -76,20 +104,134 @@ struct RequestInfo
 	const char * uploadData;
 	std::map<std::string, std::string> arguments;
 	HttpMethod method;
+
+	/** True if the request is being processed by the worker pool */
+	bool deferred;
+
+	/** The response produced by the worker pool, queued once the connection is resumed */
+	MHD_Response * response;
+	unsigned int responseCode;
+
+	/** True if the upload is JSON, which is buffered in body instead of going through the post processor */
+	bool jsonBody;
+	std::string body;
+
+	/** When the request arrived, for the request latency metric */
+	double startTime;
 };
 
-static int BuildError(struct MHD_Connection *connection, const std::string& message, int httpCode = MHD_HTTP_INTERNAL_SERVER_ERROR)
+static int ProcessPageRequest(RequestInfo * reqInfo);
+
+/**
+ * Queues the response and releases our reference to it.  Deferred requests
+ * can't queue from the worker thread so the response is held until MHD resumes the connection.
+ */
+static int SendResponse(RequestInfo * reqInfo, unsigned int httpCode, MHD_Response * response)
+{
+	if (reqInfo->deferred)
+	{
+		if (reqInfo->response != NULL)
+		{
+			MHD_destroy_response (reqInfo->response);
+		}
+
+		reqInfo->response = response;
+		reqInfo->responseCode = httpCode;
+		return MHD_YES;
+	}
+
+	int ret = MHD_queue_response (reqInfo->connection, httpCode, response);
+	MHD_destroy_response (response);
+
+	return ret;
+}
+
+static bool IsApiRequest(RequestInfo * reqInfo)
+{
+	return StartsWith(reqInfo->url, API_PREFIX "/");
+}
+
+static int SendJson(RequestInfo * reqInfo, unsigned int httpCode, const std::string& json)
+{
+	MHD_Response *response = MHD_create_response_from_buffer (json.size(), (void *) json.c_str(), MHD_RESPMEM_MUST_COPY);
+	MHD_add_response_header (response, "Content-Type", "application/json");
+	MHD_add_response_header (response, "Cache-Control", "no-cache, no-store, must-revalidate");
+
+	return SendResponse(reqInfo, httpCode, response);
+}
+
+/** Sends the metrics in the Prometheus text format */
+static int SendMetrics(RequestInfo * reqInfo)
+{
+	std::stringstream sstr;
+	Metrics::get()->write(sstr);
+
+	std::string metrics = sstr.str();
+	MHD_Response *response = MHD_create_response_from_buffer (metrics.size(), (void *) metrics.c_str(), MHD_RESPMEM_MUST_COPY);
+	MHD_add_response_header (response, "Content-Type", "text/plain; version=0.0.4");
+	MHD_add_response_header (response, "Cache-Control", "no-cache, no-store, must-revalidate");
+
+	return SendResponse(reqInfo, MHD_HTTP_OK, response);
+}
+
+static int BuildError(RequestInfo * reqInfo, const std::string& message, int httpCode = MHD_HTTP_INTERNAL_SERVER_ERROR)
 {
+	// API clients get the error as JSON
+	if (IsApiRequest(reqInfo))
+	{
+		JsonWriter json;
+		json.beginObject();
+		json.name("error");
+		json.value(message);
+		json.endObject();
+
+		SendJson(reqInfo, httpCode, json.str());
+		return MHD_YES;
+	}
+
 	std::string errorStr = "<html><body><h1><b>ERROR</b><br>" + message + "</h1></body></html>";
 
 	struct MHD_Response * response = MHD_create_response_from_buffer (
 		errorStr.length(), (void *) errorStr.c_str(), MHD_RESPMEM_MUST_COPY);
-	MHD_queue_response (connection, httpCode, response);
-	MHD_destroy_response (response);
+	SendResponse(reqInfo, httpCode, response);
 
 	return MHD_YES;
 }
 
+/** Runs a long request on the worker pool and then resumes the suspended connection */
+class DeferredRequest : public WorkerTask
+{
+public:
+	DeferredRequest(RequestInfo * reqInfo) :
+		m_reqInfo(reqInfo)
+	{
+		// Do nothing
+	}
+
+	void run()
+	{
+		try
+		{
+			ProcessPageRequest(m_reqInfo);
+		}
+		catch (Exception & ex)
+		{
+			ErrorLog << "!! " << ex << Logger::ENDL;
+			BuildError(m_reqInfo, ex.c_str());
+		}
+		catch (...)
+		{
+			ErrorLog << "!! Unknown Error" << Logger::ENDL;
+			BuildError(m_reqInfo, "Unknown Error");
+		}
+
+		MHD_resume_connection (m_reqInfo->connection);
+	}
+
+private:
+	RequestInfo * m_reqInfo;
+};
+
 static int StorePostToMap (void *cls, enum MHD_ValueKind kind,
 	      const char *key, const char *filename, const char *content_type,
           const char *transfer_encoding, const char *data,
@@ -159,6 +301,15 @@ static void RequestCompleted (void *cls, struct MHD_Connection *connection,
       MHD_destroy_post_processor (reqInfo->postProcessor);
   }
 
+  if (reqInfo->response != NULL)
+  {
+      MHD_destroy_response (reqInfo->response);
+  }
+
+  Metrics * metrics = Metrics::get();
+  metrics->httpRequestsInFlight.add(-1);
+  metrics->httpRequestSeconds.observe(GetTimeInSeconds() - reqInfo->startTime);
+
   delete reqInfo;
   *con_cls = NULL;
 }
@@ -234,6 +385,12 @@ static void SavePreset(RequestInfo * reqInfo)
 		preset->imageThresholdMode = (ImageProcessor::ThresholdMode) ToInt(imageThresholdMode);
 	}
 
+	std::string peakEstimator = reqInfo->arguments[WebContent::PEAK_ESTIMATOR];
+	if (!peakEstimator.empty())
+	{
+		preset->peakEstimator = (ImageProcessor::PeakEstimator) ToInt(peakEstimator);
+	}
+
 	std::string laserThreshold = reqInfo->arguments[WebContent::LASER_MAGNITUDE_THRESHOLD];
 	if (!laserThreshold.empty())
 	{
@@ -246,6 +403,24 @@ static void SavePreset(RequestInfo * reqInfo)
 		preset->stabilityDelay = ToInt(stabilityDelay.c_str());
 	}
 
+	std::string settleThreshold = reqInfo->arguments[WebContent::SETTLE_THRESHOLD];
+	if (!settleThreshold.empty())
+	{
+		preset->settleThreshold = ToReal(settleThreshold.c_str());
+	}
+
+	std::string continuousRotationSpeed = reqInfo->arguments[WebContent::CONTINUOUS_ROTATION_SPEED];
+	if (!continuousRotationSpeed.empty())
+	{
+		preset->continuousRotationSpeed = ToReal(continuousRotationSpeed.c_str());
+	}
+
+	std::string backgroundInterval = reqInfo->arguments[WebContent::BACKGROUND_INTERVAL];
+	if (!backgroundInterval.empty())
+	{
+		preset->backgroundInterval = MAX(1, ToInt(backgroundInterval.c_str()));
+	}
+
 	std::string maxLaserWidth = reqInfo->arguments[WebContent::MAX_LASER_WIDTH];
 	if (!maxLaserWidth.empty())
 	{
@@ -276,6 +451,9 @@ static void SavePreset(RequestInfo * reqInfo)
 	preset->generateXyz = !reqInfo->arguments[WebContent::GENERATE_XYZ].empty();
 	preset->enableBurstModeForStillImages = !reqInfo->arguments[WebContent::ENABLE_BURST_MODE].empty();
 	preset->createBaseForObject = !reqInfo->arguments[WebContent::CREATE_BASE_FOR_OBJECT].empty();
+	preset->enableSettleDetection = !reqInfo->arguments[WebContent::ENABLE_SETTLE_DETECTION].empty();
+	preset->continuousRotation = !reqInfo->arguments[WebContent::CONTINUOUS_ROTATION].empty();
+	preset->dualLaserSingleCapture = !reqInfo->arguments[WebContent::DUAL_LASER_SINGLE_CAPTURE].empty();
 
 	if (reqInfo->arguments[WebContent::SEPARATE_LASERS_BY_COLOR].empty())
 	{
@@ -604,6 +782,15 @@ static void SaveSetup(RequestInfo * reqInfo)
 		setup->motorStepDelay = ToInt(stepDelay);
 	}
 
+	std::string acceleration = reqInfo->arguments[WebContent::MOTOR_ACCELERATION];
+	if (!acceleration.empty())
+	{
+		setup->motorAcceleration = MAX(0, ToInt(acceleration));
+	}
+
+	setup->motorSCurve = !reqInfo->arguments[WebContent::MOTOR_S_CURVE].empty();
+	setup->enableGpioWaveforms = !reqInfo->arguments[WebContent::ENABLE_GPIO_WAVEFORMS].empty();
+
 	std::string dirPin = reqInfo->arguments[WebContent::DIRECTION_PIN];
 	if (!dirPin.empty())
 	{
@@ -665,12 +852,63 @@ static void SaveSetup(RequestInfo * reqInfo)
 	// Overriden focal length value
 	setup->overriddenFocalLength = reqInfo->arguments[WebContent::OVERRIDDEN_FOCAL_LENGTH];
 
+	// Camera calibration checkerboard
+	std::string checkerboardColumns = reqInfo->arguments[WebContent::CHECKERBOARD_COLUMNS];
+	if (!checkerboardColumns.empty())
+	{
+		setup->checkerboardColumns = MAX(ToInt(checkerboardColumns), 2);
+	}
+
+	std::string checkerboardRows = reqInfo->arguments[WebContent::CHECKERBOARD_ROWS];
+	if (!checkerboardRows.empty())
+	{
+		setup->checkerboardRows = MAX(ToInt(checkerboardRows), 2);
+	}
+
 	// Experimental
 	setup->enableExperimental = !reqInfo->arguments[WebContent::ENABLE_EXPERIMENTAL].empty();
 
 	// Flip Red/Blue
 	setup->mmalFlipRedBlue = !reqInfo->arguments[WebContent::FLIP_RED_BLUE].empty();
 
+	// Debug logging
+	setup->enableDebugLogging = !reqInfo->arguments[WebContent::ENABLE_DEBUG_LOGGING].empty();
+	Logger::setLevel(setup->enableDebugLogging ? Logger::LL_DEBUG : Logger::LL_INFO);
+
+	// Simulated scene
+	if (IsMockHardware())
+	{
+		std::string mockObject = TrimString(reqInfo->arguments[WebContent::MOCK_OBJECT]);
+		if (!mockObject.empty())
+		{
+			setup->mockObject = mockObject;
+		}
+
+		std::string mockObjectSize = reqInfo->arguments[WebContent::MOCK_OBJECT_SIZE];
+		if (!mockObjectSize.empty())
+		{
+			setup->mockObjectSize = ConvertUnitOfLength(ToReal(mockObjectSize), srcUnits, UL_MILLIMETERS);
+		}
+
+		std::string mockObjectOffset = reqInfo->arguments[WebContent::MOCK_OBJECT_OFFSET];
+		if (!mockObjectOffset.empty())
+		{
+			setup->mockObjectOffset = ConvertUnitOfLength(ToReal(mockObjectOffset), srcUnits, UL_MILLIMETERS);
+		}
+
+		std::string mockNoise = reqInfo->arguments[WebContent::MOCK_NOISE];
+		if (!mockNoise.empty())
+		{
+			setup->mockNoise = ToReal(mockNoise);
+		}
+
+		std::string mockAmbientLight = reqInfo->arguments[WebContent::MOCK_AMBIENT_LIGHT];
+		if (!mockAmbientLight.empty())
+		{
+			setup->mockAmbientLight = ToInt(mockAmbientLight);
+		}
+	}
+
 	//
 	// Save the properties
 	//
@@ -701,12 +939,21 @@ static void SaveSetup(RequestInfo * reqInfo)
 
 static int StartRequest(RequestInfo * reqInfo)
 {
-	if (reqInfo->method == RequestInfo::POST)
+	if (reqInfo->method == RequestInfo::POST || reqInfo->method == RequestInfo::PUT)
 	{
+		// The API accepts JSON which the post processor doesn't handle
+		const char * contentType = MHD_lookup_connection_value (reqInfo->connection, MHD_HEADER_KIND, "Content-Type");
+		if (IsApiRequest(reqInfo) && contentType != NULL && strncasecmp(contentType, "application/json", 16) == 0)
+		{
+			reqInfo->jsonBody = true;
+			return MHD_YES;
+		}
+
 		reqInfo->postProcessor = MHD_create_post_processor (reqInfo->connection, POSTBUFFERSIZE, &StorePostToMap, (void *) reqInfo);
-		if (NULL == reqInfo->postProcessor)
+
+		// The request info is freed when the request completes
+		if (NULL == reqInfo->postProcessor && reqInfo->method == RequestInfo::POST)
 		{
-			  delete reqInfo;
 			  return MHD_NO;
 		}
 	}
@@ -729,8 +976,7 @@ static int ShowScanProgress(RequestInfo * reqInfo)
 	std::string page = WebContent::scanRunning(progress, remainingTime, task, reqInfo->url, setup->enablePointCloudRenderer, rotation, pixelRadius);
 	MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 	MHD_add_response_header (response, "Content-Type", "text/html");
-	int ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-	MHD_destroy_response (response);
+	int ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 
 	return ret;
 }
@@ -772,153 +1018,464 @@ static bool LineIntersect(PixelLocation * out, const PixelLocation& p1, const Pi
 	return true;
 }
 
-static int RetrieveFile(RequestInfo * reqInfo, const std::string& url)
+/** Formats the time as an HTTP date */
+static std::string ToHttpDate(time_t time)
 {
-	std::string filename;
+	struct tm tm;
+	char buffer[64];
 
-	if (url.find("/dl/") == 0)
+	gmtime_r(&time, &tm);
+	strftime(buffer, sizeof(buffer), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+
+	return buffer;
+}
+
+/** Parses an HTTP date.  Returns -1 if the date isn't valid. */
+static time_t FromHttpDate(const char * date)
+{
+	struct tm tm;
+	memset(&tm, 0, sizeof(tm));
+
+	if (strptime(date, "%a, %d %b %Y %H:%M:%S GMT", &tm) == NULL)
 	{
-		filename = url.substr(4);
+		return (time_t) -1;
 	}
-	else
+
+	return timegm(&tm);
+}
+
+/** Returns an entity tag that changes whenever the file is rewritten.  Each encoding of the file gets its own tag. */
+static std::string ToEntityTag(const struct stat& fileInfo, ContentEncoder::Encoding encoding)
+{
+	std::stringstream sstr;
+	sstr << "\"" << std::hex << (uint64_t) fileInfo.st_size << "-" << (uint64_t) fileInfo.st_mtime;
+
+	if (encoding != ContentEncoder::CE_IDENTITY)
 	{
-		filename = url.substr(5);
+		sstr << "-" << ContentEncoder::toString(encoding);
 	}
 
-	size_t dotPos = filename.find(".");
-	std::string id = "";
-	std::string ext = "";
+	sstr << "\"";
 
-	int ret = MHD_YES;
-	if (dotPos != std::string::npos)
+	return sstr.str();
+}
+
+/** Returns true if the client's cached copy of the file is still current */
+static bool IsNotModified(RequestInfo * reqInfo, const std::string& etag, time_t lastModified)
+{
+	const char * ifNoneMatch = MHD_lookup_connection_value (reqInfo->connection, MHD_HEADER_KIND, "If-None-Match");
+	if (ifNoneMatch != NULL)
 	{
-		id = filename.substr(0, dotPos);
-		ext = filename.substr(dotPos + 1);
+		std::string value = ifNoneMatch;
+		return TrimString(value) == "*" || value.find(etag) != std::string::npos;
 	}
 
-	if (ext == "ply" || ext == "jpg" || ext == "stl" || ext == "db" || ext == "png" || ext == "csv" || ext == "xyz" || ext == "log")
+	const char * ifModifiedSince = MHD_lookup_connection_value (reqInfo->connection, MHD_HEADER_KIND, "If-Modified-Since");
+	if (ifModifiedSince != NULL)
 	{
-		std::string mimeType;
+		time_t since = FromHttpDate(ifModifiedSince);
+		return since != (time_t) -1 && lastModified <= since;
+	}
 
-		// Get the mime type
-		if (ext == "jpg")
+	return false;
+}
+
+/** Parses a non-negative decimal integer */
+static bool ParseUnsigned(const std::string& str, uint64_t& value)
+{
+	if (str.empty() || str.size() > 18)
+	{
+		return false;
+	}
+
+	value = 0;
+	for (size_t iChar = 0; iChar < str.size(); iChar++)
+	{
+		if (str[iChar] < '0' || str[iChar] > '9')
 		{
-			mimeType = "image/jpeg";
+			return false;
 		}
-		else if (ext == "png")
+
+		value = value * 10 + (str[iChar] - '0');
+	}
+
+	return true;
+}
+
+/**
+ * Parses a Range header with a single byte range into the first and last byte offsets.
+ * Returns false if the header should be ignored and the whole file sent.  Multiple
+ * ranges aren't supported and are ignored.
+ * @param unsatisfiable - Set to true if the range lies outside of the file.
+ */
+static bool ParseByteRange(const std::string& header, uint64_t fileSize, uint64_t& first, uint64_t& last, bool& unsatisfiable)
+{
+	const std::string prefix = "bytes=";
+	unsatisfiable = false;
+
+	if (header.compare(0, prefix.size(), prefix) != 0 || header.find(',') != std::string::npos)
+	{
+		return false;
+	}
+
+	std::string spec = header.substr(prefix.size());
+	size_t dashPos = spec.find('-');
+	if (dashPos == std::string::npos)
+	{
+		return false;
+	}
+
+	std::string firstStr = TrimString(spec.substr(0, dashPos));
+	std::string lastStr = TrimString(spec.substr(dashPos + 1));
+	uint64_t value;
+
+	// The last N bytes of the file
+	if (firstStr.empty())
+	{
+		if (!ParseUnsigned(lastStr, value))
 		{
-			mimeType = "image/png";
+			return false;
 		}
-		else if (ext == "csv")
+
+		if (value == 0 || fileSize == 0)
 		{
-			mimeType = "text/csv";
+			unsatisfiable = true;
+			return true;
 		}
-		else
+
+		first = fileSize - MIN(value, fileSize);
+		last = fileSize - 1;
+		return true;
+	}
+
+	if (!ParseUnsigned(firstStr, first))
+	{
+		return false;
+	}
+
+	if (lastStr.empty())
+	{
+		last = fileSize - 1;
+	}
+	else if (ParseUnsigned(lastStr, value))
+	{
+		if (value < first)
 		{
-			mimeType = "application/octet-stream";
+			return false;
 		}
 
-		// Construct the filename
-		std::string directory = (reqInfo->url.find("/dl/") == 0) ? GetScanOutputDir() : GetDebugOutputDir();
-		std::stringstream filename;
+		last = MIN(value, fileSize - 1);
+	}
+	else
+	{
+		return false;
+	}
 
-		filename << directory << "/" << atol(id.c_str()) << "." << ext;
+	unsatisfiable = first >= fileSize;
+	return true;
+}
 
-		std::string contentDisposition = "attachment; filename=\"" + id + "." + ext + "\"";
+/** The state of a file download that is compressed as it is sent */
+struct CompressedFileReader
+{
+	CompressedFileReader(int fd, ContentEncoder::Encoding encoding) :
+		fd(fd),
+		encoder(encoding),
+		output(),
+		outputPos(0),
+		endOfFile(false)
+	{
+		// Do nothing
+	}
 
-		// Read the file
-		FILE * fp = fopen(filename.str().c_str(), "rb");
-		if (fp != NULL)
-		{
-			unsigned long fileSize = 0;
+	int fd;
+	ContentEncoder encoder;
+	std::vector<char> output;
+	size_t outputPos;
+	bool endOfFile;
+};
+
+/** Called by MHD for the next block of a compressed download */
+static ssize_t ReadCompressedFile(void * cls, uint64_t pos, char * buf, size_t max)
+{
+	CompressedFileReader * reader = (CompressedFileReader *) cls;
 
-			fseek(fp, 0, SEEK_END);
-			fileSize = ftell(fp);
-			fseek(fp, 0, SEEK_SET);
+	try
+	{
+		// Compress the next part of the file once the previous output has been sent
+		while (reader->outputPos == reader->output.size())
+		{
+			if (reader->endOfFile)
+			{
+				return MHD_CONTENT_READER_END_OF_STREAM;
+			}
 
-			byte * fileData = (byte *) malloc(fileSize);
-			if (fileData != NULL)
+			char input[COMPRESSED_READ_SIZE];
+			ssize_t numRead = read(reader->fd, input, sizeof(input));
+			if (numRead < 0)
 			{
-				if (fread((void *)fileData, 1, fileSize, fp) == 0)
+				if (errno == EINTR)
 				{
-					ErrorLog << "Error reading from file: " << filename.str() << Logger::ENDL;
+					continue;
 				}
 
-				fclose(fp);
-
-				MHD_Response *response = MHD_create_response_from_buffer (fileSize, (void *) fileData, MHD_RESPMEM_MUST_FREE);
-				MHD_add_response_header (response, "Content-Type", mimeType.c_str());
-				MHD_add_response_header (response, "Content-Disposition", contentDisposition.c_str());
-				MHD_add_response_header (response, "Cache-Control", "no-cache, no-store, must-revalidate");
-				MHD_add_response_header (response, "Pragma", "no-cache");
-				MHD_add_response_header (response, "Expires", "0");
-				MHD_add_response_header (response, "Pragma-directive", "no-cache");
-				MHD_add_response_header (response, "Cache-directive", "no-cache");
-				ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-				MHD_destroy_response (response);
+				ErrorLog << "Error reading file for a compressed download: " << strerror(errno) << Logger::ENDL;
+				return MHD_CONTENT_READER_END_WITH_ERROR;
 			}
-			else
-			{
-				fclose(fp);
-				std::string message = "Out of memory";
-				ret = BuildError(reqInfo->connection, message, MHD_HTTP_INTERNAL_SERVER_ERROR);
-			}
-		}
-		else
-		{
-			std::string message = "Error opening file to read for download: " + filename.str();
-			ret = BuildError(reqInfo->connection, message, MHD_HTTP_BAD_REQUEST);
+
+			reader->endOfFile = numRead == 0;
+			reader->output.clear();
+			reader->outputPos = 0;
+			reader->encoder.encode(input, numRead, reader->output, reader->endOfFile);
 		}
 	}
-	else
+	catch (Exception& ex)
 	{
-		std::string message = "Invalid File Extension Requested";
-		ret = BuildError(reqInfo->connection, message, MHD_HTTP_BAD_REQUEST);
+		ErrorLog << ex << Logger::ENDL;
+		return MHD_CONTENT_READER_END_WITH_ERROR;
 	}
 
-	return ret;
+	size_t numBytes = MIN(max, reader->output.size() - reader->outputPos);
+	memcpy(buf, &reader->output[reader->outputPos], numBytes);
+	reader->outputPos += numBytes;
+
+	return numBytes;
 }
 
-static int LivePly(RequestInfo * reqInfo)
+static void FreeCompressedFile(void * cls)
 {
-	HttpServer * server = reqInfo->server;
-	Scanner * scanner = server->getScanner();
-	int ret = MHD_YES;
-	size_t fileSize = 0;
-	byte * fileData = NULL;
+	CompressedFileReader * reader = (CompressedFileReader *) cls;
+	close(reader->fd);
+	delete reader;
+}
 
-	Scanner::LiveData liveData = scanner->getLiveDataLock();
-	try
-	{
-		size_t numPoints = liveData.leftLaserResults->size() + liveData.rightLaserResults->size();
+/**
+ * Queues a response that streams the file with sendfile.  Conditional requests and
+ * single byte range requests are supported.  Compressible files are sent with the best encoding
+ * the client accepts unless a range was requested.  The response takes ownership of fd.
+ */
+static int SendFile(RequestInfo * reqInfo, int fd, const struct stat& fileInfo, const std::string& mimeType,
+		            const std::string& contentDisposition, bool compressible)
+{
+	const char * acceptEncoding = MHD_lookup_connection_value (reqInfo->connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_ACCEPT_ENCODING);
+	const char * range = MHD_lookup_connection_value (reqInfo->connection, MHD_HEADER_KIND, "Range");
 
-		PlyWriter plyWriter;
-		plyWriter.setTotalNumPoints((int)numPoints);
-		plyWriter.setDataFormat(PLY_BINARY);
+	// Ranges refer to the uncompressed file
+	ContentEncoder::Encoding encoding = ContentEncoder::CE_IDENTITY;
+	if (compressible && range == NULL)
+	{
+		encoding = ContentEncoder::negotiate(acceptEncoding);
+	}
 
-		MemWriter memWriter;
-		plyWriter.begin(&memWriter);
+	uint64_t fileSize = fileInfo.st_size;
+	std::string etag = ToEntityTag(fileInfo, encoding);
+	std::string lastModified = ToHttpDate(fileInfo.st_mtime);
+	unsigned int httpCode = MHD_HTTP_OK;
+	std::string contentRange = "";
+	MHD_Response * response = NULL;
+	uint64_t first = 0;
+	uint64_t last = 0;
 
-		for (size_t iRec = 0; iRec < liveData.leftLaserResults->size(); iRec++)
+	if (IsNotModified(reqInfo, etag, fileInfo.st_mtime))
+	{
+		close(fd);
+		httpCode = MHD_HTTP_NOT_MODIFIED;
+		response = MHD_create_response_from_buffer (0, NULL, MHD_RESPMEM_PERSISTENT);
+	}
+	else if (encoding != ContentEncoder::CE_IDENTITY)
+	{
+		CompressedFileReader * reader = new CompressedFileReader(fd, encoding);
+		response = MHD_create_response_from_callback (MHD_SIZE_UNKNOWN, COMPRESSED_READ_SIZE, &ReadCompressedFile, reader, &FreeCompressedFile);
+		if (response == NULL)
 		{
-			plyWriter.writePoints(&liveData.leftLaserResults->at(iRec).point, 1);
+			FreeCompressedFile(reader);
+			return BuildError(reqInfo, "Error creating the response for the download", MHD_HTTP_INTERNAL_SERVER_ERROR);
 		}
 
-		for (size_t iRec = 0; iRec < liveData.rightLaserResults->size(); iRec++)
+		MHD_add_response_header (response, "Content-Type", mimeType.c_str());
+		MHD_add_response_header (response, "Content-Disposition", contentDisposition.c_str());
+		MHD_add_response_header (response, MHD_HTTP_HEADER_CONTENT_ENCODING, ContentEncoder::toString(encoding));
+	}
+	else
+	{
+		const char * ifRange = MHD_lookup_connection_value (reqInfo->connection, MHD_HEADER_KIND, "If-Range");
+		bool unsatisfiable = false;
+
+		// A stale If-Range means the client's partial copy is out of date and needs the whole file
+		if (range != NULL && (ifRange == NULL || etag == ifRange || lastModified == ifRange) &&
+			ParseByteRange(range, fileSize, first, last, unsatisfiable))
 		{
-			plyWriter.writePoints(&liveData.rightLaserResults->at(iRec).point, 1);
-		}
+			std::stringstream sstr;
+			if (unsatisfiable)
+			{
+				close(fd);
+				httpCode = MHD_HTTP_REQUESTED_RANGE_NOT_SATISFIABLE;
+				response = MHD_create_response_from_buffer (0, NULL, MHD_RESPMEM_PERSISTENT);
+				sstr << "bytes */" << fileSize;
+			}
+			else
+			{
+				httpCode = MHD_HTTP_PARTIAL_CONTENT;
+				sstr << "bytes " << first << "-" << last << "/" << fileSize;
+			}
 
-		plyWriter.end();
+			contentRange = sstr.str();
+		}
 
-		fileSize = memWriter.getData().size();
-		fileData = (byte *) malloc(fileSize);
-		if (fileData != NULL)
+		if (response == NULL)
 		{
-			memcpy(fileData, &memWriter.getData().front(), fileSize);
+			uint64_t length = (httpCode == MHD_HTTP_PARTIAL_CONTENT) ? last - first + 1 : fileSize;
+			response = MHD_create_response_from_fd_at_offset64 (length, fd, first);
+			if (response == NULL)
+			{
+				close(fd);
+				return BuildError(reqInfo, "Error creating the response for the download", MHD_HTTP_INTERNAL_SERVER_ERROR);
+			}
+
+			MHD_add_response_header (response, "Content-Type", mimeType.c_str());
+			MHD_add_response_header (response, "Content-Disposition", contentDisposition.c_str());
 		}
 	}
-	catch (...)
+
+	if (!contentRange.empty())
+	{
+		MHD_add_response_header (response, "Content-Range", contentRange.c_str());
+	}
+
+	// Clients must check with us before using a cached copy
+	MHD_add_response_header (response, "Cache-Control", "no-cache");
+	MHD_add_response_header (response, "ETag", etag.c_str());
+	MHD_add_response_header (response, "Last-Modified", lastModified.c_str());
+	MHD_add_response_header (response, "Accept-Ranges", "bytes");
+
+	if (compressible)
+	{
+		MHD_add_response_header (response, "Vary", MHD_HTTP_HEADER_ACCEPT_ENCODING);
+	}
+
+	return SendResponse(reqInfo, httpCode, response);
+}
+
+static int RetrieveFile(RequestInfo * reqInfo, const std::string& url)
+{
+	std::string filename;
+
+	if (url.find("/dl/") == 0)
+	{
+		filename = url.substr(4);
+	}
+	else
+	{
+		filename = url.substr(5);
+	}
+
+	size_t dotPos = filename.find(".");
+	std::string id = "";
+	std::string ext = "";
+
+	int ret = MHD_YES;
+	if (dotPos != std::string::npos)
+	{
+		id = filename.substr(0, dotPos);
+		ext = filename.substr(dotPos + 1);
+	}
+
+	if (ext == "ply" || ext == "jpg" || ext == "stl" || ext == "db" || ext == "png" || ext == "csv" || ext == "xyz" || ext == "log" || ext == "json")
+	{
+		std::string mimeType;
+
+		// Get the mime type
+		if (ext == "jpg")
+		{
+			mimeType = "image/jpeg";
+		}
+		else if (ext == "png")
+		{
+			mimeType = "image/png";
+		}
+		else if (ext == "csv")
+		{
+			mimeType = "text/csv";
+		}
+		else if (ext == "json")
+		{
+			mimeType = "application/json";
+		}
+		else
+		{
+			mimeType = "application/octet-stream";
+		}
+
+		// Construct the filename
+		std::string directory = (reqInfo->url.find("/dl/") == 0) ? GetScanOutputDir() : GetDebugOutputDir();
+		std::stringstream filename;
+
+		filename << directory << "/" << atol(id.c_str()) << "." << ext;
+
+		std::string contentDisposition = "attachment; filename=\"" + id + "." + ext + "\"";
+
+		// Stream the file from disk so that memory use doesn't depend on the file size
+		struct stat fileInfo;
+		int fd = open(filename.str().c_str(), O_RDONLY);
+		if (fd != -1 && fstat(fd, &fileInfo) == 0)
+		{
+			// Images are already compressed
+			bool compressible = ext != "jpg" && ext != "png";
+			ret = SendFile(reqInfo, fd, fileInfo, mimeType, contentDisposition, compressible);
+		}
+		else
+		{
+			if (fd != -1)
+			{
+				close(fd);
+			}
+
+			std::string message = "Error opening file to read for download: " + filename.str();
+			ret = BuildError(reqInfo, message, MHD_HTTP_BAD_REQUEST);
+		}
+	}
+	else
+	{
+		std::string message = "Invalid File Extension Requested";
+		ret = BuildError(reqInfo, message, MHD_HTTP_BAD_REQUEST);
+	}
+
+	return ret;
+}
+
+static int LivePly(RequestInfo * reqInfo)
+{
+	HttpServer * server = reqInfo->server;
+	Scanner * scanner = server->getScanner();
+	int ret = MHD_YES;
+	size_t fileSize = 0;
+	byte * fileData = NULL;
+	MemWriter memWriter;
+
+	Scanner::LiveData liveData = scanner->getLiveDataLock();
+	try
+	{
+		size_t numPoints = liveData.leftLaserResults->size() + liveData.rightLaserResults->size();
+
+		PlyWriter plyWriter;
+		plyWriter.setTotalNumPoints((int)numPoints);
+		plyWriter.setDataFormat(PLY_BINARY);
+
+		plyWriter.begin(&memWriter);
+
+		for (size_t iRec = 0; iRec < liveData.leftLaserResults->size(); iRec++)
+		{
+			plyWriter.writePoints(&liveData.leftLaserResults->at(iRec).point, 1);
+		}
+
+		for (size_t iRec = 0; iRec < liveData.rightLaserResults->size(); iRec++)
+		{
+			plyWriter.writePoints(&liveData.rightLaserResults->at(iRec).point, 1);
+		}
+
+		plyWriter.end();
+	}
+	catch (...)
 	{
 		scanner->releaseLiveDataLock();
 		throw;
@@ -926,9 +1483,44 @@ static int LivePly(RequestInfo * reqInfo)
 
 	scanner->releaseLiveDataLock();
 
+	// Compress outside of the lock so the scanner isn't held up
+	const char * acceptEncoding = MHD_lookup_connection_value (reqInfo->connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_ACCEPT_ENCODING);
+	ContentEncoder::Encoding encoding = ContentEncoder::negotiate(acceptEncoding);
+	const std::vector<unsigned char>& plyData = memWriter.getData();
+	std::vector<char> compressedData;
+
+	if (encoding != ContentEncoder::CE_IDENTITY)
+	{
+		ContentEncoder encoder(encoding);
+		encoder.encode(plyData.empty() ? NULL : &plyData.front(), plyData.size(), compressedData, true);
+
+		fileSize = compressedData.size();
+		fileData = (byte *) malloc(fileSize);
+		if (fileData != NULL)
+		{
+			memcpy(fileData, &compressedData.front(), fileSize);
+		}
+	}
+	else
+	{
+		fileSize = plyData.size();
+		fileData = (byte *) malloc(fileSize);
+		if (fileData != NULL)
+		{
+			memcpy(fileData, &plyData.front(), fileSize);
+		}
+	}
+
 	if (fileData != NULL)
 	{
 		MHD_Response *response = MHD_create_response_from_buffer (fileSize, (void *) fileData, MHD_RESPMEM_MUST_FREE);
+		MHD_add_response_header (response, "Vary", MHD_HTTP_HEADER_ACCEPT_ENCODING);
+
+		if (encoding != ContentEncoder::CE_IDENTITY)
+		{
+			MHD_add_response_header (response, MHD_HTTP_HEADER_CONTENT_ENCODING, ContentEncoder::toString(encoding));
+		}
+
 		MHD_add_response_header (response, "Content-Type", "application/octet-stream");
 		MHD_add_response_header (response, "Content-Disposition", "attachment; filename=\"live.ply\"");
 		MHD_add_response_header (response, "Cache-Control", "no-cache, no-store, must-revalidate");
@@ -936,13 +1528,12 @@ static int LivePly(RequestInfo * reqInfo)
 		MHD_add_response_header (response, "Expires", "0");
 		MHD_add_response_header (response, "Pragma-directive", "no-cache");
 		MHD_add_response_header (response, "Cache-directive", "no-cache");
-		ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-		MHD_destroy_response (response);
+		ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 	}
 	else
 	{
 		std::string message = "Out of memory";
-		ret = BuildError(reqInfo->connection, message, MHD_HTTP_INTERNAL_SERVER_ERROR);
+		ret = BuildError(reqInfo, message, MHD_HTTP_INTERNAL_SERVER_ERROR);
 	}
 
 	return ret;
@@ -1036,8 +1627,7 @@ static int GetRenderImage(RequestInfo * reqInfo)
 	MHD_add_response_header (response, "Pragma-directive", "no-cache");
 	MHD_add_response_header (response, "Cache-directive", "no-cache");
 
-	int ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-	MHD_destroy_response (response);
+	int ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 
 	return ret;
 }
@@ -1088,8 +1678,7 @@ static int GetCameraImage(RequestInfo * reqInfo, bool addLines)
 	MHD_add_response_header (response, "Pragma-directive", "no-cache");
 	MHD_add_response_header (response, "Cache-directive", "no-cache");
 
-	int ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-	MHD_destroy_response (response);
+	int ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 
 	return ret;
 }
@@ -1198,11 +1787,13 @@ static std::string AutocorrectLaserMisalignment(RequestInfo * reqInfo)
 
 		Plane leftPlane;
 		PixelLocation leftTop, leftBottom;
-		Calibrator::calculateLaserPlane(leftPlane, leftTop, leftBottom, Laser::getInstance(), Laser::LEFT_LASER, setup->leftLaserLocation);
+		Calibrator::PlaneFit leftFit;
+		Calibrator::calculateLaserPlane(leftPlane, leftTop, leftBottom, leftFit, Laser::getInstance(), Laser::LEFT_LASER, setup->leftLaserLocation);
 
 		Plane rightPlane;
 		PixelLocation rightTop, rightBottom;
-		Calibrator::calculateLaserPlane(rightPlane, rightTop, rightBottom, Laser::getInstance(), Laser::RIGHT_LASER, setup->rightLaserLocation);
+		Calibrator::PlaneFit rightFit;
+		Calibrator::calculateLaserPlane(rightPlane, rightTop, rightBottom, rightFit, Laser::getInstance(), Laser::RIGHT_LASER, setup->rightLaserLocation);
 
 		Camera * camera = Camera::getInstance();
 
@@ -1221,7 +1812,98 @@ static std::string AutocorrectLaserMisalignment(RequestInfo * reqInfo)
 
 		SaveProperties();
 
-		message = "Successfully auto-corrected laser alignment";
+		std::stringstream sstr;
+		sstr << "Successfully auto-corrected laser alignment. RMS residual: "
+		     << ConvertUnitOfLength(leftFit.rmsResidual, UL_MILLIMETERS, setup->unitOfLength) << " left, "
+		     << ConvertUnitOfLength(rightFit.rmsResidual, UL_MILLIMETERS, setup->unitOfLength) << " right "
+		     << ToString(setup->unitOfLength) << ".";
+
+		message = sstr.str();
+	}
+	catch (Exception& ex)
+	{
+		message = ex;
+	}
+	catch (...)
+	{
+		message = "Unknown error occurred";
+	}
+
+	return message;
+}
+
+static std::string CaptureCheckerboard()
+{
+	std::string message;
+	Setup * setup = Setup::get();
+	CameraCalibrator * calibrator = CameraCalibrator::get();
+
+	try
+	{
+		Camera * camera = Camera::getInstance();
+		Image * image = camera->acquireImage();
+		if (image == NULL)
+		{
+			throw Exception("Error acquiring image from the camera");
+		}
+
+		bool found = false;
+		try
+		{
+			found = calibrator->addView(* image, setup->checkerboardColumns, setup->checkerboardRows);
+		}
+		catch (...)
+		{
+			camera->releaseImage(image);
+			throw;
+		}
+
+		camera->releaseImage(image);
+
+		std::stringstream sstr;
+		if (found)
+		{
+			sstr << "Captured checkerboard view " << calibrator->getNumViews() << ".";
+		}
+		else
+		{
+			sstr << "The " << setup->checkerboardColumns << "x" << setup->checkerboardRows
+			     << " checkerboard corners were not found, " << calibrator->getNumViews() << " views captured.";
+		}
+
+		message = sstr.str();
+	}
+	catch (Exception& ex)
+	{
+		message = ex;
+	}
+	catch (...)
+	{
+		message = "Unknown error occurred";
+	}
+
+	return message;
+}
+
+static std::string CalibrateCamera()
+{
+	std::string message;
+	Setup * setup = Setup::get();
+
+	try
+	{
+		CameraIntrinsics intrinsics;
+		real rmsError = CameraCalibrator::get()->calibrate(intrinsics);
+
+		setup->haveCameraIntrinsics = true;
+		setup->cameraIntrinsics = intrinsics;
+
+		SaveProperties();
+
+		std::stringstream sstr;
+		sstr << "Successfully calibrated the camera. RMS reprojection error: " << rmsError << " pixels.";
+
+		message = sstr.str();
 	}
 	catch (Exception& ex)
 	{
@@ -1235,6 +1917,18 @@ static std::string AutocorrectLaserMisalignment(RequestInfo * reqInfo)
 	return message;
 }
 
+static std::string ClearCameraCalibration()
+{
+	Setup * setup = Setup::get();
+
+	CameraCalibrator::get()->clearViews();
+	setup->haveCameraIntrinsics = false;
+
+	SaveProperties();
+
+	return "Cleared the camera calibration.";
+}
+
 static std::string SetCameraExposureTime(RequestInfo * reqInfo)
 {
 	std::string message;
@@ -1737,62 +2431,123 @@ static void WritePhotoSequence(RequestInfo * reqInfo)
 
 }
 
-static bool GetFileContents(RequestInfo * reqInfo, unsigned char *& data, unsigned int*& length)
+/**
+ * Looks up the embedded file for the URL.  The gzip data is the same file compressed at build time.
+ */
+static bool GetFileContents(RequestInfo * reqInfo, unsigned char *& data, unsigned int*& length,
+                            unsigned char *& gzipData, unsigned int*& gzipLength)
 {
 	data = NULL;
+	gzipData = NULL;
 
 	if (reqInfo->url == "/licenses.txt")
 	{
 		data = licenses_txt;
 		length = &licenses_txt_len;
+		gzipData = licenses_txt_gz;
+		gzipLength = &licenses_txt_gz_len;
 	}
 	else if (reqInfo->url == "/three.min.js")
 	{
 		data = three_min_js;
 		length = &three_min_js_len;
+		gzipData = three_min_js_gz;
+		gzipLength = &three_min_js_gz_len;
 	}
 	else if (reqInfo->url == "/PLYLoader.js")
 	{
 		data = PLYLoader_js;
 		length = &PLYLoader_js_len;
+		gzipData = PLYLoader_js_gz;
+		gzipLength = &PLYLoader_js_gz_len;
 	}
 	else if (reqInfo->url == "/OrbitControls.js")
 	{
 		data = OrbitControls_js;
 		length = &OrbitControls_js_len;
+		gzipData = OrbitControls_js_gz;
+		gzipLength = &OrbitControls_js_gz_len;
 	}
 	else if (reqInfo->url == "/showScan.js")
 	{
 		data = showScan_js;
 		length = &showScan_js_len;
+		gzipData = showScan_js_gz;
+		gzipLength = &showScan_js_gz_len;
 	}
 	else if (reqInfo->url == "/CanvasRenderer.js")
 	{
 		data = CanvasRenderer_js;
 		length = &CanvasRenderer_js_len;
+		gzipData = CanvasRenderer_js_gz;
+		gzipLength = &CanvasRenderer_js_gz_len;
 	}
 	else if (reqInfo->url == "/SoftwareRenderer.js")
 	{
 		data = SoftwareRenderer_js;
 		length = &SoftwareRenderer_js_len;
+		gzipData = SoftwareRenderer_js_gz;
+		gzipLength = &SoftwareRenderer_js_gz_len;
 	}
 	else if (reqInfo->url == "/Projector.js")
 	{
 		data = Projector_js;
 		length = &Projector_js_len;
+		gzipData = Projector_js_gz;
+		gzipLength = &Projector_js_gz_len;
 	}
 
 	return data != NULL;
 }
 
-static int ProcessPageRequest(RequestInfo * reqInfo)
+/** Sends an embedded file, precompressed if the client accepts gzip */
+static int SendFileContents(RequestInfo * reqInfo, unsigned char * data, unsigned int * length,
+                            unsigned char * gzipData, unsigned int * gzipLength)
+{
+	const char * acceptEncoding = MHD_lookup_connection_value (reqInfo->connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_ACCEPT_ENCODING);
+	bool compressed = gzipData != NULL && ContentEncoder::accepts(acceptEncoding, ContentEncoder::CE_GZIP);
+
+	MHD_Response *response = compressed ?
+			MHD_create_response_from_buffer (*gzipLength, (void *) gzipData, MHD_RESPMEM_PERSISTENT) :
+			MHD_create_response_from_buffer (*length, (void *) data, MHD_RESPMEM_PERSISTENT);
+
+	MHD_add_response_header (response, "Content-Type", "text/plain");
+	MHD_add_response_header (response, "Vary", MHD_HTTP_HEADER_ACCEPT_ENCODING);
+
+	if (compressed)
+	{
+		MHD_add_response_header (response, MHD_HTTP_HEADER_CONTENT_ENCODING, ContentEncoder::toString(ContentEncoder::CE_GZIP));
+	}
+
+	return SendResponse(reqInfo, MHD_HTTP_OK, response);
+}
+
+/** Builds the scan page with the page of past scans given by the "page" argument */
+static std::string ScanPage(RequestInfo * reqInfo)
+{
+	ScanCatalog * catalog = ScanCatalog::get();
+	size_t numScans = 0;
+	size_t firstIndex = MAX(0, ToInt(reqInfo->arguments["page"])) * WebContent::SCANS_PER_PAGE;
+	std::vector<ScanResult> scans = catalog->getScans(firstIndex, WebContent::SCANS_PER_PAGE, numScans);
+
+	// Show the last page if the page is past the end
+	if (scans.empty() && numScans > 0)
+	{
+		firstIndex = ((numScans - 1) / WebContent::SCANS_PER_PAGE) * WebContent::SCANS_PER_PAGE;
+		scans = catalog->getScans(firstIndex, WebContent::SCANS_PER_PAGE, numScans);
+	}
+
+	return WebContent::scan(scans, firstIndex, numScans);
+}
+
+static int DispatchPageRequest(RequestInfo * reqInfo)
 {
 	HttpServer * server = reqInfo->server;
 	int ret = MHD_YES;
 	unsigned char * fileData = NULL;
 	unsigned int * fileSize = NULL;
-
-	MHD_get_connection_values (reqInfo->connection, MHD_GET_ARGUMENT_KIND, &StoreToMap, (void *) reqInfo);
+	unsigned char * gzipFileData = NULL;
+	unsigned int * gzipFileSize = NULL;
 
 	if (server->getScanner()->isRunning())
 	{
@@ -1865,8 +2620,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::settings(message);
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 
 			InfoLog << "Done." << Logger::ENDL;
 		}
@@ -1892,8 +2646,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::setup(message);
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url.find("/network") == 0)
 		{
@@ -1910,8 +2663,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::network(message, hiddenEssid);
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url.find("/mounts") == 0)
 		{
@@ -1931,8 +2683,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::mounts(message, MountManager::get()->getValidMounts());
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url.find("/security") == 0)
 		{
@@ -1948,8 +2699,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::security(message);
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url.find("/writePhotos") == 0)
 		{
@@ -1964,8 +2714,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 				std::string page = WebContent::writePhotos(MountManager::get()->getValidMounts());
 				MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 				MHD_add_response_header (response, "Content-Type", "text/html");
-				ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-				MHD_destroy_response (response);
+				ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 			}
 
 		}
@@ -2027,6 +2776,18 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			{
 				message = AutocorrectLaserMisalignment(reqInfo);
 			}
+			else if (reqInfo->method == RequestInfo::POST && cmd == "captureCheckerboard")
+			{
+				message = CaptureCheckerboard();
+			}
+			else if (reqInfo->method == RequestInfo::POST && cmd == "calibrateCamera")
+			{
+				message = CalibrateCamera();
+			}
+			else if (reqInfo->method == RequestInfo::POST && cmd == "clearCameraCalibration")
+			{
+				message = ClearCameraCalibration();
+			}
 			else if (reqInfo->method == RequestInfo::POST && cmd == "setLightIntensity")
 			{
 				std::string intensityStr = reqInfo->arguments["intensity"];
@@ -2043,8 +2804,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 				std::string page = WebContent::cal1(message);
 				MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 				MHD_add_response_header (response, "Content-Type", "text/html");
-				ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-				MHD_destroy_response (response);
+				ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 			}
 		}
 		else if (reqInfo->url.find("/dl/") == 0 || reqInfo->url.find("/dbg/") == 0)
@@ -2075,11 +2835,10 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			}
 			else
 			{
-				std::string page = WebContent::scan(server->getScanner()->getPastScanResults());
+				std::string page = ScanPage(reqInfo);
 				MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 				MHD_add_response_header (response, "Content-Type", "text/html");
-				ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-				MHD_destroy_response (response);
+				ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 			}
 		}
 		else if (reqInfo->url == "/del")
@@ -2094,16 +2853,17 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 				// Execute the command
 				if (system(cmd.str().c_str()) != -1)
 				{
-					std::string page = WebContent::scan(server->getScanner()->getPastScanResults());
+					ScanCatalog::get()->removeScan(ToInt(id.c_str()));
+
+					std::string page = ScanPage(reqInfo);
 					MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 					MHD_add_response_header (response, "Content-Type", "text/html");
-					ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-					MHD_destroy_response (response);
+					ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 				}
 				else
 				{
 					std::string message = std::string("Error deleting scan");
-					ret = BuildError(reqInfo->connection, message, MHD_HTTP_INTERNAL_SERVER_ERROR);
+					ret = BuildError(reqInfo, message, MHD_HTTP_INTERNAL_SERVER_ERROR);
 				}
 			}
 		}
@@ -2125,8 +2885,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::showUpdate(update, message);
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url == "/applyUpdate" && reqInfo->method == RequestInfo::POST)
 		{
@@ -2165,8 +2924,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::updateApplied(update, message, success);
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url == "/reboot" && reqInfo->method == RequestInfo::POST)
 		{
@@ -2178,15 +2936,11 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = "Rebooting...";
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
-		else if (GetFileContents(reqInfo, fileData, fileSize))
+		else if (GetFileContents(reqInfo, fileData, fileSize, gzipFileData, gzipFileSize))
 		{
-			MHD_Response *response = MHD_create_response_from_buffer (*fileSize, (void *) fileData, MHD_RESPMEM_MUST_COPY);
-			MHD_add_response_header (response, "Content-Type", "text/plain");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendFileContents(reqInfo, fileData, fileSize, gzipFileData, gzipFileSize);
 		}
 		else if (reqInfo->url == "/view")
 		{
@@ -2197,8 +2951,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::viewScanRender(id, reqInfo->url, rotation, pixelRadius);
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url == "/viewPly")
 		{
@@ -2209,8 +2962,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 			std::string page = WebContent::viewScan(filename.str());
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url == "/onMount")
 		{
@@ -2224,16 +2976,14 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url == "/restoreDefaults")
 		{
 			std::string page = WebContent::restoreDefaults();
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url.find("/renderImage") == 0)
 		{
@@ -2242,7 +2992,7 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 		else
 		{
 			std::string message = std::string("Not Found: ") + reqInfo->url;
-			ret = BuildError(reqInfo->connection, message, MHD_HTTP_NOT_FOUND);
+			ret = BuildError(reqInfo, message, MHD_HTTP_NOT_FOUND);
 		}
 	}
 
@@ -2259,19 +3009,15 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 
 			MHD_Response *response = MHD_create_response_from_buffer (page.size(), (void *) page.c_str(), MHD_RESPMEM_MUST_COPY);
 			MHD_add_response_header (response, "Content-Type", "text/html");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendResponse(reqInfo, MHD_HTTP_OK, response);
 		}
 		else if (reqInfo->url.find("/renderImage") == 0)
 		{
 			ret = GetRenderImage(reqInfo);
 		}
-		else if (GetFileContents(reqInfo, fileData, fileSize))
+		else if (GetFileContents(reqInfo, fileData, fileSize, gzipFileData, gzipFileSize))
 		{
-			MHD_Response *response = MHD_create_response_from_buffer (*fileSize, (void *) fileData, MHD_RESPMEM_MUST_COPY);
-			MHD_add_response_header (response, "Content-Type", "text/plain");
-			ret = MHD_queue_response (reqInfo->connection, MHD_HTTP_OK, response);
-			MHD_destroy_response (response);
+			ret = SendFileContents(reqInfo, fileData, fileSize, gzipFileData, gzipFileSize);
 		}
 		else
 		{
@@ -2282,24 +3028,915 @@ static int ProcessPageRequest(RequestInfo * reqInfo)
 	return ret;
 }
 
-static int ContinueRequest(RequestInfo * reqInfo)
+/** Returns true if the request can take long enough that it shouldn't hold up an MHD thread */
+static bool IsLongRequest(RequestInfo * reqInfo)
 {
-	int ret = MHD_YES;
-
-	Setup * setup = Setup::get();
+	const std::string& url = reqInfo->url;
+	std::string cmd = reqInfo->arguments["cmd"];
 
-	// HTTP Basic Auth
+	// Rendering and PLY serialization
+	if (url == "/livePly" || url.find("/renderImage") == 0)
+	{
+		return true;
+	}
 
-	bool authenticated = false;
+	// Operations that wait on the hardware or the network
+	if (url == "/" && cmd == "stopScan")
+	{
+		return true;
+	}
 
-	if (setup->enableAuthentication)
+	if (reqInfo->method == RequestInfo::POST && url.find("/cal1") == 0)
 	{
-		char * pass = NULL;
-		char * user = MHD_basic_auth_get_username_password (reqInfo->connection, &pass);
-		try
-		{
-			if (pass != NULL)
-			{
+		return cmd == "autoCalibrate" || cmd == "calibrateLasers" || cmd == "generateDebug" || cmd == "rotateTable" ||
+			   cmd == "captureCheckerboard" || cmd == "calibrateCamera";
+	}
+
+	return url == "/checkUpdate" || url == "/applyUpdate";
+}
+
+/**
+ * Returns true if the request changes the settings or uses the hardware and must not
+ * run at the same time as any other request.  Everything else only reads and can run concurrently.
+ */
+static bool IsExclusiveRequest(RequestInfo * reqInfo)
+{
+	const std::string& url = reqInfo->url;
+	unsigned char * fileData = NULL;
+	unsigned int * fileSize = NULL;
+	unsigned char * gzipFileData = NULL;
+	unsigned int * gzipFileSize = NULL;
+
+	if (reqInfo->method != RequestInfo::GET || !reqInfo->arguments["cmd"].empty())
+	{
+		return true;
+	}
+
+	if (url == "/" || url == "/livePly" || url == "/preview" || url == "/view" || url == "/viewPly" ||
+		url.find("/renderImage") == 0 || url.find("/dl/") == 0 || url.find("/dbg/") == 0 ||
+		GetFileContents(reqInfo, fileData, fileSize, gzipFileData, gzipFileSize))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+/** Suspends the connection and hands the request to the worker pool */
+static int DeferRequest(RequestInfo * reqInfo)
+{
+	WorkerPool * workerPool = reqInfo->server->getWorkerPool();
+	if (workerPool == NULL)
+	{
+		throw Exception("The server is stopping");
+	}
+
+	reqInfo->deferred = true;
+	MHD_suspend_connection (reqInfo->connection);
+
+	try
+	{
+		workerPool->submit(new DeferredRequest(reqInfo));
+	}
+	catch (...)
+	{
+		reqInfo->deferred = false;
+		MHD_resume_connection (reqInfo->connection);
+		throw;
+	}
+
+	return MHD_YES;
+}
+
+static int SendProgress(RequestInfo * reqInfo, const std::string& json)
+{
+	return SendJson(reqInfo, MHD_HTTP_OK, json);
+}
+
+/** Completes a suspended progress request once the progress changes */
+class ProgressRequest : public ProgressSubscriber
+{
+public:
+	ProgressRequest(RequestInfo * reqInfo) :
+		m_reqInfo(reqInfo)
+	{
+		// Do nothing
+	}
+
+	void publish(const std::string& json)
+	{
+		SendProgress(m_reqInfo, json);
+		MHD_resume_connection (m_reqInfo->connection);
+	}
+
+private:
+	RequestInfo * m_reqInfo;
+};
+
+/**
+ * Long-polls the scan progress.  The client passes the version of the progress it has
+ * and the request is held until there is a newer one.
+ */
+static int PollProgress(RequestInfo * reqInfo)
+{
+	ProgressChannel * channel = reqInfo->server->getProgressChannel();
+	unsigned version = (unsigned) ToInt(reqInfo->arguments["version"]);
+	std::string json;
+
+	if (channel->getLatest(version, json))
+	{
+		return SendProgress(reqInfo, json);
+	}
+
+	reqInfo->deferred = true;
+	MHD_suspend_connection (reqInfo->connection);
+	channel->subscribe(new ProgressRequest(reqInfo), version);
+
+	return MHD_YES;
+}
+
+/** Queues the response generated by the worker pool */
+static int SendDeferredResponse(RequestInfo * reqInfo)
+{
+	MHD_Response * response = reqInfo->response;
+	reqInfo->response = NULL;
+	reqInfo->deferred = false;
+
+	if (response == NULL)
+	{
+		return BuildError(reqInfo, "No response was generated");
+	}
+
+	return SendResponse(reqInfo, reqInfo->responseCode, response);
+}
+
+/**
+ * Runs the dispatcher while holding the request lock.  Long requests and requests that
+ * would have to wait for the lock are handed to the worker pool so they don't tie up the MHD threads.
+ */
+static int SynchronizeRequest(RequestInfo * reqInfo, bool exclusive, bool longRequest, int (*dispatch)(RequestInfo *))
+{
+	HttpServer * server = reqInfo->server;
+
+	if (reqInfo->deferred)
+	{
+		server->beginRequest(exclusive);
+	}
+	else if (longRequest || !server->tryBeginRequest(exclusive))
+	{
+		return DeferRequest(reqInfo);
+	}
+
+	int ret = MHD_YES;
+	try
+	{
+		ret = dispatch(reqInfo);
+	}
+	catch (...)
+	{
+		server->endRequest();
+		throw;
+	}
+
+	server->endRequest();
+
+	return ret;
+}
+
+static std::string ToString(Scanner::Task task)
+{
+	switch (task)
+	{
+	case Scanner::GENERATE_SCAN:
+		return "scan";
+
+	case Scanner::GENERATE_DEBUG:
+		return "debug";
+
+	case Scanner::GENERATE_PHOTOS:
+		return "photos";
+	}
+
+	return "unknown";
+}
+
+/** Writes the scanner state and the latest progress */
+static void WriteStatus(JsonWriter& json, HttpServer * server)
+{
+	Scanner * scanner = server->getScanner();
+
+	std::string progress;
+	server->getProgressChannel()->getLatest(0, progress);
+
+	json.beginObject();
+	json.name("version");
+	json.value(FREELSS_VERSION_NAME);
+	json.name("majorVersion");
+	json.value(FREELSS_VERSION_MAJOR);
+	json.name("minorVersion");
+	json.value(FREELSS_VERSION_MINOR);
+	json.name("running");
+	json.value(scanner->isRunning());
+	json.name("task");
+	json.value(ToString(scanner->getTask()));
+	json.name("activePresetId");
+	json.value(PresetManager::get()->getActivePreset().id);
+	json.name("freeSpaceMb");
+	json.value(GetFreeSpaceMb());
+	json.name("progress");
+	json.rawValue(progress);
+	json.endObject();
+}
+
+/** Writes the scan and the URLs its files can be downloaded from */
+static void WriteScan(JsonWriter& json, const ScanResult& result)
+{
+	long long scanDate = result.getScanDate();
+
+	json.beginObject();
+	json.name("id");
+	json.value(scanDate);
+	json.name("numPoints");
+	json.value(result.numPoints);
+	json.name("numFaces");
+	json.value(result.numFaces);
+	json.name("files");
+	json.beginArray();
+
+	for (size_t iFile = 0; iFile < result.files.size(); iFile++)
+	{
+		const ScanResultFile& file = result.files[iFile];
+
+		std::stringstream url;
+		url << "/dl/" << scanDate << "." << file.extension;
+
+		json.beginObject();
+		json.name("extension");
+		json.value(file.extension);
+		json.name("size");
+		json.value((long long) file.fileSize);
+		json.name("url");
+		json.value(url.str());
+		json.endObject();
+	}
+
+	json.endArray();
+	json.endObject();
+}
+
+/**
+ * Writes the preset.  The members have the same names as the preset properties
+ * so a preset that is read can be sent back to update it.
+ */
+static void WritePreset(JsonWriter& json, const Preset& preset)
+{
+	json.beginObject();
+	json.name("id");
+	json.value(preset.id);
+	json.name("name");
+	json.value(preset.name);
+	json.name("active");
+	json.value(PresetManager::get()->getActivePreset().id == preset.id);
+	json.name("laserSide");
+	json.value((int) preset.laserSide);
+	json.name("cameraMode");
+	json.value((int) preset.cameraMode);
+	json.name("cameraExposureTime");
+	json.value((int) preset.cameraExposureTime);
+	json.name("laserThreshold");
+	json.value(preset.laserThreshold);
+	json.name("minLaserWidth");
+	json.value(preset.minLaserWidth);
+	json.name("maxLaserWidth");
+	json.value(preset.maxLaserWidth);
+	json.name("maxTriangleEdgeLength");
+	json.value(preset.maxTriangleEdgeLength);
+	json.name("numLaserRowBins");
+	json.value(preset.numLaserRowBins);
+	json.name("stabilityDelay");
+	json.value(preset.stabilityDelay);
+	json.name("enableSettleDetection");
+	json.value(preset.enableSettleDetection);
+	json.name("settleThreshold");
+	json.value(preset.settleThreshold);
+	json.name("continuousRotation");
+	json.value(preset.continuousRotation);
+	json.name("continuousRotationSpeed");
+	json.value(preset.continuousRotationSpeed);
+	json.name("dualLaserSingleCapture");
+	json.value(preset.dualLaserSingleCapture);
+	json.name("backgroundInterval");
+	json.value(preset.backgroundInterval);
+	json.name("framesPerRevolution");
+	json.value(preset.framesPerRevolution);
+	json.name("generateXyz");
+	json.value(preset.generateXyz);
+	json.name("generateStl");
+	json.value(preset.generateStl);
+	json.name("generatePly");
+	json.value(preset.generatePly);
+	json.name("plyDataFormat");
+	json.value((int) preset.plyDataFormat);
+	json.name("createBaseForObject");
+	json.value(preset.createBaseForObject);
+	json.name("enableBurstModeForStillImages");
+	json.value(preset.enableBurstModeForStillImages);
+	json.name("noiseRemovalSetting");
+	json.value((int) preset.noiseRemovalSetting);
+	json.name("imageThresholdMode");
+	json.value((int) preset.imageThresholdMode);
+	json.name("peakEstimator");
+	json.value((int) preset.peakEstimator);
+	json.name("groundPlaneHeight");
+	json.value(preset.groundPlaneHeight);
+	json.name("laserMergeAction");
+	json.value((int) preset.laserMergeAction);
+	json.endObject();
+}
+
+static int SendPresets(RequestInfo * reqInfo, unsigned int httpCode)
+{
+	PresetManager * presetMgr = PresetManager::get();
+	const std::vector<Preset>& presets = presetMgr->getPresets();
+
+	JsonWriter json;
+	json.beginObject();
+	json.name("activePresetId");
+	json.value(presetMgr->getActivePreset().id);
+	json.name("presets");
+	json.beginArray();
+
+	for (size_t iPre = 0; iPre < presets.size(); iPre++)
+	{
+		WritePreset(json, presets[iPre]);
+	}
+
+	json.endArray();
+	json.endObject();
+
+	return SendJson(reqInfo, httpCode, json.str());
+}
+
+static int SendPreset(RequestInfo * reqInfo, unsigned int httpCode, const Preset& preset)
+{
+	JsonWriter json;
+	WritePreset(json, preset);
+
+	return SendJson(reqInfo, httpCode, json.str());
+}
+
+/**
+ * Checks that the name can be given to the preset.  The name becomes part of the property names
+ * so it can't contain the property delimiters.  Returns the HTTP error code or MHD_HTTP_OK if the name is valid.
+ */
+static unsigned int ValidatePresetName(const std::string& name, int presetId, std::string& message)
+{
+	if (name.empty() || name.find_first_of(".=\r\n") != std::string::npos)
+	{
+		message = "The preset name must not be empty or contain '.', '=', or line breaks";
+		return MHD_HTTP_BAD_REQUEST;
+	}
+
+	const std::vector<Preset>& presets = PresetManager::get()->getPresets();
+	for (size_t iPre = 0; iPre < presets.size(); iPre++)
+	{
+		if (presets[iPre].name == name && presets[iPre].id != presetId)
+		{
+			message = "A preset with that name already exists";
+			return MHD_HTTP_CONFLICT;
+		}
+	}
+
+	return MHD_HTTP_OK;
+}
+
+/**
+ * Updates the preset from the request arguments.  The arguments are decoded as preset
+ * properties so only the values that were given change.  Unknown names are ignored.
+ */
+static void DecodePresetArguments(RequestInfo * reqInfo, Preset& preset)
+{
+	std::vector<Property> properties;
+	std::string prefix = "presets." + preset.name + ".";
+
+	std::map<std::string, std::string>::iterator it;
+	for (it = reqInfo->arguments.begin(); it != reqInfo->arguments.end(); ++it)
+	{
+		if (it->first != "id" && it->first != "name" && it->first != "active")
+		{
+			properties.push_back(Property(prefix + it->first, it->second));
+		}
+	}
+
+	bool isActivePreset = false;
+	preset.decodeProperties(properties, preset.name, isActivePreset);
+}
+
+/** Returns the preset named by the ID in the path or NULL if it doesn't exist */
+static Preset * GetRequestedPreset(RequestInfo * reqInfo)
+{
+	return PresetManager::get()->getPreset(ToInt(reqInfo->arguments["id"]));
+}
+
+/** Returns the scan named by the ID in the path.  Returns false if it doesn't exist. */
+static bool GetRequestedScan(RequestInfo * reqInfo, ScanResult& result)
+{
+	time_t scanDate = atol(reqInfo->arguments["id"].c_str());
+
+	return ScanCatalog::get()->getScan(scanDate, result);
+}
+
+static int ApiGetStatus(RequestInfo * reqInfo)
+{
+	JsonWriter json;
+	WriteStatus(json, reqInfo->server);
+
+	return SendJson(reqInfo, MHD_HTTP_OK, json.str());
+}
+
+/**
+ * Starts a scan.  The optional "preset" argument is the ID of the preset to scan with.  It is
+ * activated the same way as from the settings page.  The optional "degrees" argument defaults to a full rotation.
+ */
+static int ApiStartScan(RequestInfo * reqInfo)
+{
+	HttpServer * server = reqInfo->server;
+	if (server->getScanner()->isRunning())
+	{
+		return BuildError(reqInfo, "A scan is already running", MHD_HTTP_CONFLICT);
+	}
+
+	std::string degrees = reqInfo->arguments["degrees"];
+	real range = degrees.empty() ? 360 : ToReal(degrees);
+	if (range <= 0 || range > 360)
+	{
+		return BuildError(reqInfo, "The degrees must be greater than 0 and at most 360", MHD_HTTP_BAD_REQUEST);
+	}
+
+	std::string presetId = reqInfo->arguments["preset"];
+	if (!presetId.empty())
+	{
+		PresetManager * presetMgr = PresetManager::get();
+		Preset * preset = presetMgr->getPreset(ToInt(presetId));
+		if (preset == NULL)
+		{
+			return BuildError(reqInfo, "Preset not found", MHD_HTTP_NOT_FOUND);
+		}
+
+		if (preset->id != presetMgr->getActivePreset().id)
+		{
+			ActivatePreset(preset->id);
+			server->reinitialize();
+		}
+	}
+
+	// Reinitializing replaces the scanner
+	Scanner * scanner = server->getScanner();
+	scanner->setRange(range);
+	scanner->setTask(Scanner::GENERATE_SCAN);
+	scanner->execute();
+	InfoLog << "Starting scan..." << Logger::ENDL;
+
+	// Give the scanner time to start
+	Thread::usleep(500000);
+
+	JsonWriter json;
+	WriteStatus(json, server);
+
+	return SendJson(reqInfo, MHD_HTTP_ACCEPTED, json.str());
+}
+
+static int ApiStopScan(RequestInfo * reqInfo)
+{
+	HttpServer * server = reqInfo->server;
+	if (!server->getScanner()->isRunning())
+	{
+		return BuildError(reqInfo, "No scan is running", MHD_HTTP_CONFLICT);
+	}
+
+	InfoLog << "Stopping scan..." << Logger::ENDL;
+	server->getScanner()->stop();
+
+	// Wait for the scanner to stop
+	server->getScanner()->join();
+
+	InfoLog << "Scan stopped" << Logger::ENDL;
+
+	JsonWriter json;
+	WriteStatus(json, server);
+
+	return SendJson(reqInfo, MHD_HTTP_OK, json.str());
+}
+
+/** Lists the scans, most recent first.  The optional "offset" and "limit" arguments select a page of them. */
+static int ApiListScans(RequestInfo * reqInfo)
+{
+	std::string limit = reqInfo->arguments["limit"];
+	size_t offset = MAX(0, ToInt(reqInfo->arguments["offset"]));
+	size_t count = limit.empty() ? API_DEFAULT_SCAN_LIMIT : MAX(0, ToInt(limit));
+	size_t numScans = 0;
+
+	std::vector<ScanResult> results = ScanCatalog::get()->getScans(offset, count, numScans);
+
+	JsonWriter json;
+	json.beginObject();
+	json.name("total");
+	json.value((long long) numScans);
+	json.name("offset");
+	json.value((long long) offset);
+	json.name("scans");
+	json.beginArray();
+
+	for (size_t iRes = 0; iRes < results.size(); iRes++)
+	{
+		WriteScan(json, results[iRes]);
+	}
+
+	json.endArray();
+	json.endObject();
+
+	return SendJson(reqInfo, MHD_HTTP_OK, json.str());
+}
+
+static int ApiGetScan(RequestInfo * reqInfo)
+{
+	ScanResult result;
+	if (!GetRequestedScan(reqInfo, result))
+	{
+		return BuildError(reqInfo, "Scan not found", MHD_HTTP_NOT_FOUND);
+	}
+
+	JsonWriter json;
+	WriteScan(json, result);
+
+	return SendJson(reqInfo, MHD_HTTP_OK, json.str());
+}
+
+static int ApiGetScanTiming(RequestInfo * reqInfo)
+{
+	time_t scanDate = atol(reqInfo->arguments["id"].c_str());
+	std::map<std::string, real> stats;
+
+	if (!reqInfo->server->getScanner()->getPastScanTimingStats(scanDate, stats))
+	{
+		return BuildError(reqInfo, "No timing stats were recorded for the scan", MHD_HTTP_NOT_FOUND);
+	}
+
+	JsonWriter json;
+	json.beginObject();
+	json.name("id");
+	json.value((long long) scanDate);
+	json.name("timing");
+	json.beginObject();
+
+	for (std::map<std::string, real>::iterator it = stats.begin(); it != stats.end(); ++it)
+	{
+		json.name(it->first);
+		json.value(it->second);
+	}
+
+	json.endObject();
+	json.endObject();
+
+	return SendJson(reqInfo, MHD_HTTP_OK, json.str());
+}
+
+static int ApiListPresets(RequestInfo * reqInfo)
+{
+	return SendPresets(reqInfo, MHD_HTTP_OK);
+}
+
+static int ApiGetPreset(RequestInfo * reqInfo)
+{
+	Preset * preset = GetRequestedPreset(reqInfo);
+	if (preset == NULL)
+	{
+		return BuildError(reqInfo, "Preset not found", MHD_HTTP_NOT_FOUND);
+	}
+
+	return SendPreset(reqInfo, MHD_HTTP_OK, *preset);
+}
+
+/** Creates a preset from the default settings and the values given */
+static int ApiCreatePreset(RequestInfo * reqInfo)
+{
+	if (reqInfo->server->getScanner()->isRunning())
+	{
+		return BuildError(reqInfo, "Presets can't be changed while scanning", MHD_HTTP_CONFLICT);
+	}
+
+	// Names are stored encoded because they are shown on the settings page
+	std::string name = reqInfo->arguments["name"];
+	HtmlEncode(name);
+
+	std::string message;
+	unsigned int httpCode = ValidatePresetName(name, -1, message);
+	if (httpCode != MHD_HTTP_OK)
+	{
+		return BuildError(reqInfo, message, httpCode);
+	}
+
+	Preset preset;
+	preset.name = name;
+	DecodePresetArguments(reqInfo, preset);
+
+	PresetManager * presetMgr = PresetManager::get();
+	int presetId = presetMgr->addPreset(preset);
+	SaveProperties();
+
+	InfoLog << "Created preset " << name << Logger::ENDL;
+
+	return SendPreset(reqInfo, MHD_HTTP_CREATED, *presetMgr->getPreset(presetId));
+}
+
+static int ApiUpdatePreset(RequestInfo * reqInfo)
+{
+	if (reqInfo->server->getScanner()->isRunning())
+	{
+		return BuildError(reqInfo, "Presets can't be changed while scanning", MHD_HTTP_CONFLICT);
+	}
+
+	Preset * preset = GetRequestedPreset(reqInfo);
+	if (preset == NULL)
+	{
+		return BuildError(reqInfo, "Preset not found", MHD_HTTP_NOT_FOUND);
+	}
+
+	if (reqInfo->arguments.find("name") != reqInfo->arguments.end())
+	{
+		std::string name = reqInfo->arguments["name"];
+		HtmlEncode(name);
+
+		std::string message;
+		unsigned int httpCode = ValidatePresetName(name, preset->id, message);
+		if (httpCode != MHD_HTTP_OK)
+		{
+			return BuildError(reqInfo, message, httpCode);
+		}
+
+		preset->name = name;
+	}
+
+	DecodePresetArguments(reqInfo, *preset);
+	SaveProperties();
+
+	// Apply the settings if the preset is being used
+	int presetId = preset->id;
+	if (PresetManager::get()->getActivePreset().id == presetId)
+	{
+		reqInfo->server->reinitialize();
+	}
+
+	InfoLog << "Updated preset " << preset->name << Logger::ENDL;
+
+	return SendPreset(reqInfo, MHD_HTTP_OK, *PresetManager::get()->getPreset(presetId));
+}
+
+static int ApiDeletePreset(RequestInfo * reqInfo)
+{
+	if (reqInfo->server->getScanner()->isRunning())
+	{
+		return BuildError(reqInfo, "Presets can't be changed while scanning", MHD_HTTP_CONFLICT);
+	}
+
+	PresetManager * presetMgr = PresetManager::get();
+	Preset * preset = GetRequestedPreset(reqInfo);
+	if (preset == NULL)
+	{
+		return BuildError(reqInfo, "Preset not found", MHD_HTTP_NOT_FOUND);
+	}
+
+	if (presetMgr->getPresets().size() <= 1)
+	{
+		return BuildError(reqInfo, "The last preset can't be deleted", MHD_HTTP_CONFLICT);
+	}
+
+	bool wasActive = presetMgr->getActivePreset().id == preset->id;
+	presetMgr->removePreset(preset->id);
+	SaveProperties();
+
+	if (wasActive)
+	{
+		reqInfo->server->reinitialize();
+	}
+
+	InfoLog << "Preset Deleted." << Logger::ENDL;
+
+	return SendPresets(reqInfo, MHD_HTTP_OK);
+}
+
+static int ApiActivatePreset(RequestInfo * reqInfo)
+{
+	if (reqInfo->server->getScanner()->isRunning())
+	{
+		return BuildError(reqInfo, "Presets can't be changed while scanning", MHD_HTTP_CONFLICT);
+	}
+
+	Preset * preset = GetRequestedPreset(reqInfo);
+	if (preset == NULL)
+	{
+		return BuildError(reqInfo, "Preset not found", MHD_HTTP_NOT_FOUND);
+	}
+
+	ActivatePreset(preset->id);
+	reqInfo->server->reinitialize();
+
+	return SendPreset(reqInfo, MHD_HTTP_OK, *preset);
+}
+
+/** How an API request is synchronized with the other requests */
+enum ApiAccess { AA_UNSYNCHRONIZED, AA_SHARED, AA_EXCLUSIVE };
+
+struct ApiRoute
+{
+	RequestInfo::HttpMethod method;
+
+	/** The path after the API prefix.  The ":id" segment matches a numeric ID which is passed as the "id" argument. */
+	const char * path;
+
+	int (*handler)(RequestInfo *);
+	ApiAccess access;
+
+	/** True if the handler waits on the hardware and should run on the worker pool */
+	bool longRequest;
+};
+
+static const ApiRoute API_ROUTES[] =
+{
+	{ RequestInfo::GET,    "/status",                ApiGetStatus,      AA_SHARED,         false },
+	{ RequestInfo::GET,    "/progress",              PollProgress,      AA_UNSYNCHRONIZED, false },
+	{ RequestInfo::POST,   "/scan",                  ApiStartScan,      AA_EXCLUSIVE,      true  },
+	{ RequestInfo::DELETE, "/scan",                  ApiStopScan,       AA_EXCLUSIVE,      true  },
+	{ RequestInfo::GET,    "/scans",                 ApiListScans,      AA_SHARED,         false },
+	{ RequestInfo::GET,    "/scans/:id",             ApiGetScan,        AA_SHARED,         false },
+	{ RequestInfo::GET,    "/scans/:id/timing",      ApiGetScanTiming,  AA_SHARED,         false },
+	{ RequestInfo::GET,    "/presets",               ApiListPresets,    AA_SHARED,         false },
+	{ RequestInfo::POST,   "/presets",               ApiCreatePreset,   AA_EXCLUSIVE,      false },
+	{ RequestInfo::GET,    "/presets/:id",           ApiGetPreset,      AA_SHARED,         false },
+	{ RequestInfo::PUT,    "/presets/:id",           ApiUpdatePreset,   AA_EXCLUSIVE,      true  },
+	{ RequestInfo::DELETE, "/presets/:id",           ApiDeletePreset,   AA_EXCLUSIVE,      true  },
+	{ RequestInfo::POST,   "/presets/:id/activate",  ApiActivatePreset, AA_EXCLUSIVE,      true  }
+};
+
+/**
+ * Finds the route for an API request.  The routes are indexed by path so
+ * finding one doesn't get slower as routes are added.
+ */
+class ApiRouter
+{
+public:
+	ApiRouter()
+	{
+		for (size_t iRoute = 0; iRoute < sizeof(API_ROUTES) / sizeof(API_ROUTES[0]); iRoute++)
+		{
+			m_routes[API_ROUTES[iRoute].path].push_back(&API_ROUTES[iRoute]);
+		}
+	}
+
+	/**
+	 * Returns the route for the request and stores the ID from the path as the "id" argument.
+	 * Returns NULL and sets httpCode to the reason if the request doesn't match a route.
+	 */
+	const ApiRoute * find(RequestInfo * reqInfo, unsigned int& httpCode) const
+	{
+		const std::string& url = reqInfo->url;
+
+		// Replace the numeric segments with the ID placeholder
+		std::string path;
+		std::string id;
+		size_t pos = strlen(API_PREFIX);
+		while (pos < url.size())
+		{
+			size_t end = url.find('/', pos + 1);
+			if (end == std::string::npos)
+			{
+				end = url.size();
+			}
+
+			if (end - pos > 1 && strspn(url.c_str() + pos + 1, "0123456789") == end - pos - 1)
+			{
+				id = url.substr(pos + 1, end - pos - 1);
+				path += "/:id";
+			}
+			else
+			{
+				path.append(url, pos, end - pos);
+			}
+
+			pos = end;
+		}
+
+		std::map<std::string, std::vector<const ApiRoute *> >::const_iterator it = m_routes.find(path);
+		if (it == m_routes.end())
+		{
+			httpCode = MHD_HTTP_NOT_FOUND;
+			return NULL;
+		}
+
+		const std::vector<const ApiRoute *>& routes = it->second;
+		for (size_t iRoute = 0; iRoute < routes.size(); iRoute++)
+		{
+			if (routes[iRoute]->method == reqInfo->method)
+			{
+				if (!id.empty())
+				{
+					reqInfo->arguments["id"] = id;
+				}
+
+				httpCode = MHD_HTTP_OK;
+				return routes[iRoute];
+			}
+		}
+
+		httpCode = MHD_HTTP_METHOD_NOT_ALLOWED;
+		return NULL;
+	}
+
+private:
+	/** The routes for each path */
+	std::map<std::string, std::vector<const ApiRoute *> > m_routes;
+};
+
+static const ApiRouter API_ROUTER;
+
+/** Handles the JSON API.  The arguments can be given in the query string, as form data, or as a JSON object. */
+static int ProcessApiRequest(RequestInfo * reqInfo)
+{
+	// Parse the JSON once, a deferred request already has the arguments
+	if (reqInfo->jsonBody && !reqInfo->body.empty())
+	{
+		std::string body;
+		body.swap(reqInfo->body);
+
+		try
+		{
+			JsonReader reader(body);
+			reader.readObject(reqInfo->arguments);
+		}
+		catch (Exception& ex)
+		{
+			return BuildError(reqInfo, ex, MHD_HTTP_BAD_REQUEST);
+		}
+	}
+
+	unsigned int httpCode = MHD_HTTP_OK;
+	const ApiRoute * route = API_ROUTER.find(reqInfo, httpCode);
+	if (route == NULL)
+	{
+		return BuildError(reqInfo, httpCode == MHD_HTTP_NOT_FOUND ? "Not Found" : "Method Not Allowed", httpCode);
+	}
+
+	if (route->access == AA_UNSYNCHRONIZED)
+	{
+		return route->handler(reqInfo);
+	}
+
+	return SynchronizeRequest(reqInfo, route->access == AA_EXCLUSIVE, route->longRequest, route->handler);
+}
+
+static int ProcessPageRequest(RequestInfo * reqInfo)
+{
+	if (!reqInfo->deferred)
+	{
+		MHD_get_connection_values (reqInfo->connection, MHD_GET_ARGUMENT_KIND, &StoreToMap, (void *) reqInfo);
+
+		// The progress channel and metrics don't touch the scanner so they don't need to be synchronized
+		if (reqInfo->url == "/progress")
+		{
+			return PollProgress(reqInfo);
+		}
+		else if (reqInfo->url == "/metrics")
+		{
+			return SendMetrics(reqInfo);
+		}
+	}
+
+	if (IsApiRequest(reqInfo))
+	{
+		return ProcessApiRequest(reqInfo);
+	}
+
+	return SynchronizeRequest(reqInfo, IsExclusiveRequest(reqInfo), IsLongRequest(reqInfo), DispatchPageRequest);
+}
+
+static int ContinueRequest(RequestInfo * reqInfo)
+{
+	int ret = MHD_YES;
+
+	Setup * setup = Setup::get();
+
+	// HTTP Basic Auth
+
+	bool authenticated = false;
+
+	if (setup->enableAuthentication)
+	{
+		char * pass = NULL;
+		char * user = MHD_basic_auth_get_username_password (reqInfo->connection, &pass);
+		try
+		{
+			if (pass != NULL)
+			{
 				// Generate hash for the password
 				std::string password = pass;
 				unsigned char hash[SHA_DIGEST_LENGTH];
@@ -2327,11 +3964,17 @@ static int ContinueRequest(RequestInfo * reqInfo)
 
 	if (authenticated)
 	{
-		if (reqInfo->method == RequestInfo::POST && reqInfo->uploadDataSize != 0)
+		if (reqInfo->postProcessor != NULL && reqInfo->uploadDataSize != 0)
 		{
 			MHD_post_process (reqInfo->postProcessor, reqInfo->uploadData, reqInfo->uploadDataSize);
 			reqInfo->uploadDataSize = 0;
 		}
+		else if (reqInfo->jsonBody && reqInfo->uploadDataSize != 0 &&
+				 reqInfo->body.size() + reqInfo->uploadDataSize <= MAX_JSON_BODY_SIZE)
+		{
+			reqInfo->body.append(reqInfo->uploadData, reqInfo->uploadDataSize);
+			reqInfo->uploadDataSize = 0;
+		}
 		else if (reqInfo->method == RequestInfo::GET || reqInfo->uploadDataSize == 0)
 		{
 			// Process the request
@@ -2339,7 +3982,7 @@ static int ContinueRequest(RequestInfo * reqInfo)
 		}
 		else
 		{
-			ret = BuildError(reqInfo->connection, "Bad Request", MHD_HTTP_BAD_REQUEST);
+			ret = BuildError(reqInfo, "Bad Request", MHD_HTTP_BAD_REQUEST);
 		}
 	}
 	else
@@ -2367,6 +4010,8 @@ static int ConnectionHandler (void *cls, struct MHD_Connection *connection,
 		if (*con_cls == NULL)
 		{
 			RequestInfo * reqInfo = new RequestInfo();
+			reqInfo->startTime = GetTimeInSeconds();
+			Metrics::get()->httpRequestsInFlight.add(1);
 			reqInfo->server = (HttpServer *) cls;
 			reqInfo->connection = connection;
 			reqInfo->url = url;
@@ -2379,6 +4024,14 @@ static int ConnectionHandler (void *cls, struct MHD_Connection *connection,
 			{
 				reqInfo->method = RequestInfo::POST;
 			}
+			else if (strcmp(method, "PUT") == 0)
+			{
+				reqInfo->method = RequestInfo::PUT;
+			}
+			else if (strcmp(method, "DELETE") == 0)
+			{
+				reqInfo->method = RequestInfo::DELETE;
+			}
 
 			*con_cls = reqInfo;
 			reqInfo->uploadData = upload_data;
@@ -2390,21 +4043,30 @@ static int ConnectionHandler (void *cls, struct MHD_Connection *connection,
 		else
 		{
 			RequestInfo * reqInfo = (RequestInfo *) *con_cls;
-			reqInfo->uploadData = upload_data;
-			reqInfo->uploadDataSize = * upload_data_size;
-			ret = ContinueRequest(reqInfo);
-			* upload_data_size = reqInfo->uploadDataSize;
+
+			// The worker pool has finished with the request and resumed the connection
+			if (reqInfo->deferred)
+			{
+				ret = SendDeferredResponse(reqInfo);
+			}
+			else
+			{
+				reqInfo->uploadData = upload_data;
+				reqInfo->uploadDataSize = * upload_data_size;
+				ret = ContinueRequest(reqInfo);
+				* upload_data_size = reqInfo->uploadDataSize;
+			}
 		}
 	}
 	catch (Exception & ex)
 	{
 		ErrorLog << "!! " << ex << Logger::ENDL;
-		ret = BuildError(connection, ex.c_str());
+		ret = (*con_cls != NULL) ? BuildError((RequestInfo *) *con_cls, ex.c_str()) : MHD_NO;
 	}
 	catch (...)
 	{
 		ErrorLog << "!! Unknown Error" << Logger::ENDL;
-		ret = BuildError(connection, "Unknown Error");
+		ret = (*con_cls != NULL) ? BuildError((RequestInfo *) *con_cls, "Unknown Error") : MHD_NO;
 	}
 
 	return ret;
@@ -2430,8 +4092,18 @@ void HttpServer::release()
 
 HttpServer::HttpServer() :
 	m_daemon(NULL),
-	m_scanner(NULL)
+	m_scanner(NULL),
+	m_workerPool(NULL),
+	m_progressChannel(new ProgressChannel())
 {
+	pthread_rwlockattr_t attr;
+	pthread_rwlockattr_init(&attr);
+
+	// Don't let a steady stream of viewers starve out requests that need exclusive access
+	pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+	pthread_rwlock_init(&m_requestLock, &attr);
+	pthread_rwlockattr_destroy(&attr);
+
 	reinitialize();
 }
 
@@ -2439,6 +4111,8 @@ HttpServer::~HttpServer()
 {
 	stop();
 	delete m_scanner;
+	delete m_progressChannel;
+	pthread_rwlock_destroy(&m_requestLock);
 }
 
 void HttpServer::start(int port)
@@ -2448,11 +4122,26 @@ void HttpServer::start(int port)
 		stop();
 	}
 
-	m_daemon = MHD_start_daemon (MHD_USE_SELECT_INTERNALLY, port, NULL, NULL,
+	m_workerPool = new WorkerPool(HTTP_NUM_WORKER_THREADS);
+	m_progressChannel->setHoldSubscribers(true);
+
+	m_daemon = MHD_start_daemon (MHD_USE_EPOLL_INTERNALLY | MHD_USE_SUSPEND_RESUME, port, NULL, NULL,
 	                             &ConnectionHandler, this, MHD_OPTION_NOTIFY_COMPLETED, RequestCompleted, NULL,
-	                             MHD_OPTION_THREAD_POOL_SIZE, 1, MHD_OPTION_END);
+	                             MHD_OPTION_THREAD_POOL_SIZE, HTTP_THREAD_POOL_SIZE, MHD_OPTION_END);
+
+	// Fall back to select if libmicrohttpd was built without epoll support
+	if (m_daemon == NULL)
+	{
+		m_daemon = MHD_start_daemon (MHD_USE_SELECT_INTERNALLY | MHD_USE_SUSPEND_RESUME, port, NULL, NULL,
+		                             &ConnectionHandler, this, MHD_OPTION_NOTIFY_COMPLETED, RequestCompleted, NULL,
+		                             MHD_OPTION_THREAD_POOL_SIZE, HTTP_THREAD_POOL_SIZE, MHD_OPTION_END);
+	}
+
 	if (m_daemon == NULL)
 	{
+		delete m_workerPool;
+		m_workerPool = NULL;
+
 		std::stringstream sstr;
 		sstr << "Error starting server on port " << port;
 		throw Exception(sstr.str());
@@ -2461,6 +4150,11 @@ void HttpServer::start(int port)
 
 void HttpServer::stop()
 {
+	// Finish the deferred requests first since MHD can't be stopped with suspended connections
+	m_progressChannel->setHoldSubscribers(false);
+	delete m_workerPool;
+	m_workerPool = NULL;
+
 	if (m_daemon != NULL)
 	{
 		MHD_stop_daemon (m_daemon);
@@ -2480,6 +4174,8 @@ void HttpServer::reinitialize()
 
 	delete m_scanner;
 	m_scanner = new Scanner();
+	m_scanner->getProgress().setListener(m_progressChannel);
+	m_progressChannel->progressChanged(m_scanner->getProgress());
 
 	InfoLog << "Reinitialized." << Logger::ENDL;
 }
@@ -2489,4 +4185,34 @@ Scanner * HttpServer::getScanner()
 	return  m_scanner;
 }
 
+WorkerPool * HttpServer::getWorkerPool()
+{
+	return m_workerPool;
+}
+
+ProgressChannel * HttpServer::getProgressChannel()
+{
+	return m_progressChannel;
+}
+
+void HttpServer::beginRequest(bool exclusive)
+{
+	int val = exclusive ? pthread_rwlock_wrlock(&m_requestLock) : pthread_rwlock_rdlock(&m_requestLock);
+	if (val != 0)
+	{
+		throw Exception(std::string("Error locking the request lock: ") + strerror(val));
+	}
+}
+
+bool HttpServer::tryBeginRequest(bool exclusive)
+{
+	int val = exclusive ? pthread_rwlock_trywrlock(&m_requestLock) : pthread_rwlock_tryrdlock(&m_requestLock);
+	return val == 0;
+}
+
+void HttpServer::endRequest()
+{
+	pthread_rwlock_unlock(&m_requestLock);
+}
+
 }
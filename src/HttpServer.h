@@ -27,7 +27,8 @@ namespace freelss
 {
 
 class Scanner;
-
+class WorkerPool;
+class ProgressChannel;
 
 class HttpServer
 {
@@ -43,10 +44,30 @@ public:
 	static void release();
 
 	Scanner * getScanner();
+
+	/** The pool that long running requests are handed off to */
+	WorkerPool * getWorkerPool();
+
+	/** Pushes the scanner's progress to clients */
+	ProgressChannel * getProgressChannel();
+
+	/**
+	 * Synchronizes a request with the other requests being served.  Exclusive requests
+	 * run alone while the rest can run concurrently.  Every begin must be followed by endRequest().
+	 */
+	void beginRequest(bool exclusive);
+
+	/** Same as beginRequest() but returns false instead of waiting if the request can't start right away */
+	bool tryBeginRequest(bool exclusive);
+
+	void endRequest();
 private:
 	HttpServer();
 	MHD_Daemon *m_daemon;
 	Scanner * m_scanner;
+	WorkerPool * m_workerPool;
+	ProgressChannel * m_progressChannel;
+	pthread_rwlock_t m_requestLock;
 	static HttpServer * m_instance;
 };
 }
@@ -21,11 +21,7 @@
 #include "Main.h"
 #include "Image.h"
 #include "Camera.h"
-
-static void InitBuffer(jpeg_compress_struct* cinfo) { }
-static boolean EmptyBuffer(jpeg_compress_struct* cinfo) { return TRUE; }
-static void TermBuffer(jpeg_compress_struct* cinfo) { }
-
+#include "JpegEncoder.h"
 
 namespace freelss
 {
@@ -35,7 +31,8 @@ Image::Image() :
 	m_numComponents(0),
 	m_width(0),
 	m_height(0),
-	m_owner(true)
+	m_owner(true),
+	m_timestamp(0)
 {
 	Camera * camera = Camera::getInstance();
 	m_height = camera->getImageHeight();
@@ -48,7 +45,8 @@ Image::Image(unsigned width, unsigned height, unsigned numComponents):
 	m_numComponents(numComponents),
 	m_width(width),
 	m_height(height),
-	m_owner(true)
+	m_owner(true),
+	m_timestamp(0)
 {
 	// Do nothing
 }
@@ -58,7 +56,8 @@ Image::Image(const Image& a) :
 	m_numComponents(a.m_numComponents),
 	m_width(a.m_width),
 	m_height(a.m_height),
-	m_owner(true)
+	m_owner(true),
+	m_timestamp(a.m_timestamp)
 {
 	if (a.m_pixels != NULL)
 	{
@@ -123,50 +122,20 @@ unsigned Image::getPixelBufferSize() const
 	return m_width * m_height * m_numComponents;
 }
 
-void Image::convertToJpeg(Image& image, byte* buffer, unsigned * size)
+double Image::getTimestamp() const
 {
-	size_t bufferSize = * size;
-
-	struct jpeg_destination_mgr dmgr;
-	dmgr.init_destination    = InitBuffer;
-	dmgr.empty_output_buffer = EmptyBuffer;
-	dmgr.term_destination    = TermBuffer;
-	dmgr.next_output_byte    = buffer;
-	dmgr.free_in_buffer      = bufferSize;
-
-	struct jpeg_compress_struct cinfo;
-
-	struct jpeg_error_mgr       jerr;
-	cinfo.err = jpeg_std_error(&jerr);
-	jpeg_create_compress(&cinfo);
-
-	cinfo.dest = &dmgr;
-	cinfo.image_width      = image.getWidth();
-	cinfo.image_height     = image.getHeight();
-	cinfo.input_components = image.getNumComponents();
-	cinfo.in_color_space   = JCS_RGB;
-
-	jpeg_set_defaults(&cinfo);
-	jpeg_set_quality (&cinfo, 90, true);
-	jpeg_start_compress(&cinfo, true);
-
-	unsigned rowSize = cinfo.image_width * cinfo.input_components;
-
-	JSAMPROW rowPointer;
-	unsigned char * pixels = image.getPixels();
-
-	// Write the JPEG data
-	while (cinfo.next_scanline < cinfo.image_height)
-	{
-		rowPointer = (JSAMPROW) &pixels[cinfo.next_scanline * rowSize];
-		jpeg_write_scanlines(&cinfo, &rowPointer, 1);
-	}
-
-	jpeg_finish_compress(&cinfo);
+	return m_timestamp;
+}
 
-	* size = bufferSize - dmgr.free_in_buffer;
+void Image::setTimestamp(double timestamp)
+{
+	m_timestamp = timestamp;
 }
 
+void Image::convertToJpeg(Image& image, byte* buffer, unsigned * size)
+{
+	JpegEncoder::get()->encode(image, buffer, size);
+}
 
 void Image::writeJpeg(Image& image, const std::string& filename)
 {
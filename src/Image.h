@@ -48,7 +48,13 @@ public:
 	/** The size of the allocated pixel buffer */
 	unsigned getPixelBufferSize() const;
 
-	/** Converts the image to a JPEG */
+	/** Returns when the camera delivered the image in the GetTimeInSeconds() clock, or 0 if unknown */
+	double getTimestamp() const;
+
+	/** Sets when the camera delivered the image */
+	void setTimestamp(double timestamp);
+
+	/** Converts the image to a JPEG using the JpegEncoder singleton */
 	static void convertToJpeg(Image& image, byte* buffer, unsigned * size);
 
 	/** Writes the image as a JPEG */
@@ -62,6 +68,7 @@ private:
 	unsigned m_width;
 	unsigned m_height;
 	bool m_owner;
+	double m_timestamp;
 };
 
 }
@@ -35,6 +35,68 @@ namespace freelss
 
 const unsigned ImageProcessor::RANGE_DISTANCE_THRESHOLD = 5;
 
+/**
+ * The peak estimation kernels below return the subpixel offset of the laser
+ * center from the sample they are given.  They are written with selects instead
+ * of branches so they can be inlined into the per-row loop without mispredictions.
+ */
+
+/** Computes the unrounded center of mass of the given samples */
+static inline real CenterOfMassOffset(const real * samples, int numSamples)
+{
+	real totalSum = 0;
+	real weightedSum = 0;
+	for (int iSample = 0; iSample < numSamples; iSample++)
+	{
+		totalSum += samples[iSample];
+		weightedSum += samples[iSample] * iSample;
+	}
+
+	// An empty range has its center in the middle
+	const real safeTotal = totalSum > 0 ? totalSum : 1;
+	return totalSum > 0 ? weightedSum / safeTotal : (numSamples - 1) * 0.5f;
+}
+
+/** Fits a parabola through the peak sample and its two neighbors */
+static inline real ParabolicPeakOffset(real left, real center, real right)
+{
+	const real denom = left - 2 * center + right;
+	const real safeDenom = denom != 0 ? denom : 1;
+	const real offset = 0.5f * (left - right) / safeDenom;
+	return denom < 0 ? MAX(-0.5f, MIN(0.5f, offset)) : 0;
+}
+
+/** Fits a Gaussian through the peak sample and its two neighbors */
+static inline real GaussianPeakOffset(real left, real center, real right)
+{
+	// The log of the samples turns the Gaussian fit into a parabolic fit
+	const real MIN_SAMPLE = 0.001f;
+	return ParabolicPeakOffset(logf(MAX(left, MIN_SAMPLE)),
+			                   logf(MAX(center, MIN_SAMPLE)),
+			                   logf(MAX(right, MIN_SAMPLE)));
+}
+
+/**
+ * Blais-Rioux detector.  Finds the zero crossing of the 4th order derivative
+ * filter g(i) = f(i-2) + f(i-1) - f(i+1) - f(i+2) next to the peak sample.
+ * @param f - The 7 samples centered on the peak sample (f[3]).
+ */
+static inline real BlaisRiouxPeakOffset(const real * f)
+{
+	const real gPrev = f[0] + f[1] - f[3] - f[4];
+	const real g0 = f[1] + f[2] - f[4] - f[5];
+	const real gNext = f[2] + f[3] - f[5] - f[6];
+
+	// A negative response at the peak means the crossing is to the right of it
+	const bool crossesRight = g0 < 0;
+	const real a = crossesRight ? g0 : gPrev;
+	const real b = crossesRight ? gNext : g0;
+	const real denom = a - b;
+	const real safeDenom = denom != 0 ? denom : 1;
+	const real fraction = denom != 0 ? MAX(0.0f, MIN(1.0f, a / safeDenom)) : 0.5f;
+
+	return crossesRight ? fraction : fraction - 1;
+}
 
 ImageProcessor::ImageProcessor()
 {
@@ -46,6 +108,7 @@ ImageProcessor::ImageProcessor()
 	m_minLaserWidth = preset.minLaserWidth;
 
 	m_thresholdMode = preset.imageThresholdMode;
+	m_peakEstimator = preset.peakEstimator;
 	switch (m_thresholdMode)
 	{
 	case THM_STATIC:
@@ -76,7 +139,8 @@ ImageProcessor::~ImageProcessor()
 }
 
 int ImageProcessor::process(Image& before, Image& after, Image * debuggingImage, PixelLocation * laserLocations,
-		int maxNumLocations, int& firstRowLaserCol, int& numRowsBadFromColor, int& numRowsBadFromNumRanges, const char * debuggingCsvFile)
+		int maxNumLocations, int& firstRowLaserCol, int& numRowsBadFromColor, int& numRowsBadFromNumRanges, const char * debuggingCsvFile,
+		int firstCol, int endCol)
 {	
 	const real MAX_MAGNITUDE_SQ = 255 * 255 * 3; // The maximum pixel magnitude sq we can see
 	const real INV_MAX_MAGNITUDE_SQ = 1.0f / MAX_MAGNITUDE_SQ;
@@ -103,6 +167,16 @@ int ImageProcessor::process(Image& before, Image& after, Image * debuggingImage,
 	unsigned components = before.getNumComponents();
 	unsigned rowStep = width * components;
 
+	// Only search the requested columns
+	if (endCol < 0 || endCol > (int)width)
+	{
+		endCol = width;
+	}
+
+	firstCol = MAX(0, MIN(firstCol, endCol));
+	const unsigned colStart = firstCol * components;
+	const unsigned colEnd = endCol * components;
+
 	int numLocations = 0;
 	int numMerged = 0;
 
@@ -112,7 +186,8 @@ int ImageProcessor::process(Image& before, Image& after, Image * debuggingImage,
 	unsigned char * ar = a;
 	unsigned char * br = b;
 	unsigned char * dr = d;
-	m_magnitudes.resize(width);
+	// The columns outside of the search have no laser in them
+	m_magnitudes.assign(width, 0);
 
 	real * magnitudes = &m_magnitudes.front();
 
@@ -122,13 +197,13 @@ int ImageProcessor::process(Image& before, Image& after, Image * debuggingImage,
 	for (unsigned iRow = 0; iRow < height; iRow++)
 	{
 		// Compute the magnitudes
-		int imageColumn = 0;
+		int imageColumn = firstCol;
 		real rowMagCumSum = 0;
 		int magCols = 0;
 		real maxMag = 0;
 		real minMag = 255;
 		bool inRange = false;
-		for (unsigned iCol = 0; iCol < rowStep; iCol += components)
+		for (unsigned iCol = colStart; iCol < colEnd; iCol += components)
 		{
 			// Perform image subtraction
 
@@ -186,7 +261,7 @@ int ImageProcessor::process(Image& before, Image& after, Image * debuggingImage,
 		}
 
 
-		imageColumn = 0;
+		imageColumn = firstCol;
 
 		// The column that the laser started and ended on
 		int numLaserRanges = 0;
@@ -195,7 +270,7 @@ int ImageProcessor::process(Image& before, Image& after, Image * debuggingImage,
 		m_laserRanges[numLaserRanges].energy = 0;
 		int numRowOut = 0;
 
-		for (unsigned iCol = 0; iCol < rowStep && magCols > 0; iCol += components)
+		for (unsigned iCol = colStart; iCol < colEnd && magCols > 0; iCol += components)
 		{
 			real mag = magnitudes[imageColumn];
 
@@ -303,7 +378,7 @@ int ImageProcessor::process(Image& before, Image& after, Image * debuggingImage,
 					int rangeChoice = detectBestLaserRange(m_laserRanges, numLaserRanges, prevLaserCol);
 					prevLaserCol = m_laserRanges[rangeChoice].centerCol;
 
-					real centerCol = detectLaserRangeCenter(m_laserRanges[rangeChoice], ar, br);
+					real centerCol = detectLaserRangeCenter(m_laserRanges[rangeChoice], magnitudes, width);
 
 					laserLocations[numLocations].x = centerCol;
 					laserLocations[numLocations].y = iRow;
@@ -451,35 +526,51 @@ real ImageProcessor::computeMeanAverage(unsigned char * br, int numSteps, int st
 	return avg;
 }
 
-real ImageProcessor::detectLaserRangeCenter(const ImageProcessor::LaserRange& range, unsigned char * ar, unsigned char * br)
+real ImageProcessor::detectLaserRangeCenter(const ImageProcessor::LaserRange& range, const real * magnitudes, int width)
 {
-	int startCol = range.startCol;
-	real centerCol = startCol;
-	int endCol = range.endCol;
-	int components = 3;
+	const int startCol = range.startCol;
+	const int endCol = range.endCol;
 
-	float totalSum = 0.0;
-	float weightedSum = 0.0;
-	int cCol = 0;
-	for (int bCol = startCol; bCol < endCol; bCol++)
+	if (m_peakEstimator == PE_CENTER_OF_MASS)
 	{
-		int iCol = bCol * components;
-		const int r = (int)br[iCol + 0] - (int)ar[iCol + 0];
-		const int g = (int)br[iCol + 1] - (int)ar[iCol + 1];
-		const int b = (int)br[iCol + 2] - (int)ar[iCol + 2];
+		return startCol + CenterOfMassOffset(magnitudes + startCol, endCol - startCol);
+	}
 
-		float mag = r * r + g * g + b * b;
-		totalSum += mag;
-		weightedSum += mag * cCol;
+	// Find the brightest column in the range
+	int peakCol = startCol;
+	for (int iCol = startCol + 1; iCol < endCol; iCol++)
+	{
+		peakCol = magnitudes[iCol] > magnitudes[peakCol] ? iCol : peakCol;
+	}
 
-		cCol++;
+	// The samples centered on the peak, clamped to the image
+	const int lastCol = width - 1;
+	real samples[7];
+	for (int iSample = 0; iSample < 7; iSample++)
+	{
+		samples[iSample] = magnitudes[MAX(0, MIN(lastCol, peakCol + iSample - 3))];
 	}
 
-	// Compute the center of mass
-	centerCol = startCol + ROUND(weightedSum / totalSum);
+	real offset;
+	switch (m_peakEstimator)
+	{
+	case PE_GAUSSIAN:
+		offset = GaussianPeakOffset(samples[2], samples[3], samples[4]);
+		break;
+
+	case PE_PARABOLIC:
+		offset = ParabolicPeakOffset(samples[2], samples[3], samples[4]);
+		break;
 
+	case PE_BLAIS_RIOUX:
+		offset = BlaisRiouxPeakOffset(samples);
+		break;
+
+	default:
+		throw Exception("Unsupported peak estimator");
+	}
 
-	return centerCol;
+	return peakCol + offset;
 }
 
 int ImageProcessor::detectBestLaserRange(ImageProcessor::LaserRange * ranges, int numRanges, int prevLaserCol)
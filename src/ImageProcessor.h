@@ -35,6 +35,9 @@ public:
 	/** The mode and amount of thresholding */
 	enum ThresholdMode { THM_STATIC, THM_LOW, THM_MEDIUM, THM_HIGH };
 
+	/** The method used to locate the subpixel center of a laser range */
+	enum PeakEstimator { PE_CENTER_OF_MASS, PE_GAUSSIAN, PE_PARABOLIC, PE_BLAIS_RIOUX };
+
 	/**
 	 * Detects the laser in x, y pixel coordinates.
 	 * @param debuggingImage - If non-NULL, it will be populated with the processed image that was used to detect the laser locations.
@@ -42,10 +45,13 @@ public:
 	 * @param laserLocations - Output variable to store the laser locations.
 	 * @param maxNumLocations - The maximum number of locations to store in @p laserLocations.
 	 * @param percentPixelsOverThreshold - The percentage of pixels that were over the threshold amount.
+	 * @param firstCol - The first column to search for the laser.
+	 * @param endCol - The column after the last one to search for the laser or -1 to search to the end of the row.
 	 * @return Returns the number of locations written to @p laserLocations.
 	 */
 	int process(Image& before, Image& after, Image * debuggingImage, PixelLocation * laserLocations, int maxNumLocations,
-			    int& firstRowLaserCol, int& numRowsBadFromColor, int& numRowsBadFromNumRanges, const char * debuggingCsvFile);
+			    int& firstRowLaserCol, int& numRowsBadFromColor, int& numRowsBadFromNumRanges, const char * debuggingCsvFile,
+			    int firstCol = 0, int endCol = -1);
 
 	static void toHsv(real r, real g, real b, Hsv * hsv);
 
@@ -65,7 +71,12 @@ private:
 
 	int detectBestLaserRange(ImageProcessor::LaserRange * ranges, int numRanges, int prevLaserCol);
 
-	real detectLaserRangeCenter(const ImageProcessor::LaserRange& range, unsigned char * ar, unsigned char * br);
+	/**
+	 * Computes the subpixel column of the laser within the given range.
+	 * @param magnitudes - The difference magnitudes for every column in the row.
+	 * @param width - The number of columns in @p magnitudes.
+	 */
+	real detectLaserRangeCenter(const ImageProcessor::LaserRange& range, const real * magnitudes, int width);
 
 	real computeMeanAverage(unsigned char * br, int numSteps, int stepSize);
 
@@ -75,6 +86,7 @@ private:
 	/** The LaserRanges for each column */
 	LaserRange * m_laserRanges;
 	ImageProcessor::ThresholdMode m_thresholdMode;
+	ImageProcessor::PeakEstimator m_peakEstimator;
 	real m_laserMagnitudeThreshold;
 	real m_laserThresholdFactor;
 	int m_maxLaserWidth;
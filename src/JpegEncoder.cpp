@@ -0,0 +1,87 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "JpegEncoder.h"
+#include "LibJpegEncoder.h"
+#include "Logger.h"
+
+#ifndef MOCK
+#include "MmalJpegEncoder.h"
+#endif
+
+namespace freelss
+{
+
+JpegEncoder * JpegEncoder::m_instance = NULL;
+CriticalSection JpegEncoder::m_cs;
+
+JpegEncoder::~JpegEncoder()
+{
+	// Do nothing
+}
+
+JpegEncoder * JpegEncoder::get()
+{
+	m_cs.enter();
+
+	if (m_instance == NULL)
+	{
+#ifndef MOCK
+		MmalJpegEncoder * encoder = NULL;
+		try
+		{
+			encoder = new MmalJpegEncoder();
+			encoder->initialize();
+			m_instance = encoder;
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << "Error creating the MMAL JPEG encoder, falling back to libjpeg, error=" << ex << Logger::ENDL;
+			delete encoder;
+		}
+		catch (...)
+		{
+			ErrorLog << "Error creating the MMAL JPEG encoder, falling back to libjpeg" << Logger::ENDL;
+			delete encoder;
+		}
+#endif
+		if (m_instance == NULL)
+		{
+			m_instance = new LibJpegEncoder();
+		}
+
+		InfoLog << "Created JPEG encoder: " << m_instance->getName() << Logger::ENDL;
+	}
+
+	m_cs.leave();
+
+	return m_instance;
+}
+
+void JpegEncoder::release()
+{
+	m_cs.enter();
+	delete m_instance;
+	m_instance = NULL;
+	m_cs.leave();
+}
+
+}
@@ -0,0 +1,63 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "CriticalSection.h"
+
+namespace freelss
+{
+
+class Image;
+
+/**
+ * Interface for compressing images to JPEG.  Implementations keep their compressor
+ * state between calls so that repeated encodes of the same image size are cheap.
+ */
+class JpegEncoder
+{
+public:
+	virtual ~JpegEncoder();
+
+	/**
+	 * Converts the image to a JPEG.
+	 * @param buffer - The buffer to write the JPEG data to.
+	 * @param size - The size of buffer on input and the size of the JPEG data on output.
+	 */
+	virtual void encode(Image& image, byte * buffer, unsigned * size) = 0;
+
+	/** Returns the name of the encoder */
+	virtual std::string getName() const = 0;
+
+	/** Returns the singleton instance. The MMAL hardware encoder is used if it can be created. */
+	static JpegEncoder * get();
+
+	/** Releases the singleton instance */
+	static void release();
+
+	/** The quality of the generated JPEG images */
+	static const int QUALITY = 90;
+
+private:
+	static JpegEncoder * m_instance;
+	static CriticalSection m_cs;
+};
+
+}
@@ -0,0 +1,210 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "JpegWriter.h"
+#include "Image.h"
+#include "AsyncWriter.h"
+#include "AsyncFileWriter.h"
+#include "Logger.h"
+
+namespace freelss
+{
+
+JpegWriter::JpegWriter(AsyncWriter& asyncWriter, int maxPending) :
+	m_asyncWriter(asyncWriter),
+	m_buffer(),
+	m_jobs(),
+	m_maxPending(MAX(maxPending, 1)),
+	m_running(false),
+	m_busy(false),
+	m_error("")
+{
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_cond, NULL);
+}
+
+JpegWriter::~JpegWriter()
+{
+	pthread_mutex_lock(&m_mutex);
+	bool running = m_running;
+	m_stopRequested = true;
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+
+	if (running)
+	{
+		try
+		{
+			join();
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << ex << Logger::ENDL;
+		}
+	}
+
+	// Only reached with jobs left if the thread never started
+	for (std::list<Job>::iterator it = m_jobs.begin(); it != m_jobs.end(); ++it)
+	{
+		delete it->image;
+	}
+
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+}
+
+void JpegWriter::write(Image * image, const std::string& filename)
+{
+	Job job;
+	job.image = image;
+	job.filename = filename;
+
+	pthread_mutex_lock(&m_mutex);
+
+	// Start the thread the first time it is needed
+	if (!m_running)
+	{
+		try
+		{
+			execute();
+		}
+		catch (...)
+		{
+			pthread_mutex_unlock(&m_mutex);
+			delete image;
+			throw;
+		}
+
+		m_running = true;
+	}
+
+	// Wait for room in the queue
+	while (m_jobs.size() >= m_maxPending)
+	{
+		pthread_cond_wait(&m_cond, &m_mutex);
+	}
+
+	m_jobs.push_back(job);
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void JpegWriter::flush()
+{
+	pthread_mutex_lock(&m_mutex);
+
+	while (!m_jobs.empty() || m_busy)
+	{
+		pthread_cond_wait(&m_cond, &m_mutex);
+	}
+
+	std::string error = m_error;
+	m_error = "";
+
+	pthread_mutex_unlock(&m_mutex);
+
+	if (!error.empty())
+	{
+		throw Exception(error);
+	}
+
+	m_asyncWriter.flush();
+}
+
+void JpegWriter::writeJpeg(Image& image, const std::string& filename)
+{
+	// The JPEG is always smaller than the raw pixels
+	unsigned imageSize = image.getPixelBufferSize();
+	if (m_buffer.size() < imageSize)
+	{
+		m_buffer.resize(imageSize);
+	}
+
+	Image::convertToJpeg(image, &m_buffer[0], &imageSize);
+
+	AsyncFileWriter fout(m_asyncWriter, filename.c_str());
+	if (!fout.is_open())
+	{
+		throw Exception("Error opening file for writing: " + filename);
+	}
+
+	fout.write((const char *)&m_buffer[0], imageSize);
+	fout.close();
+}
+
+void JpegWriter::run()
+{
+	pthread_mutex_lock(&m_mutex);
+
+	while (true)
+	{
+		while (m_jobs.empty() && !m_stopRequested)
+		{
+			pthread_cond_wait(&m_cond, &m_mutex);
+		}
+
+		// Pending images are still written when a stop is requested
+		if (m_jobs.empty())
+		{
+			break;
+		}
+
+		Job job = m_jobs.front();
+		m_jobs.pop_front();
+		m_busy = true;
+		pthread_cond_broadcast(&m_cond);
+		pthread_mutex_unlock(&m_mutex);
+
+		std::string error;
+		try
+		{
+			writeJpeg(* job.image, job.filename);
+		}
+		catch (Exception& ex)
+		{
+			error = ex;
+		}
+		catch (...)
+		{
+			error = "Unknown error writing " + job.filename;
+		}
+
+		delete job.image;
+
+		if (!error.empty())
+		{
+			ErrorLog << "Error writing JPEG: " << error << Logger::ENDL;
+		}
+
+		pthread_mutex_lock(&m_mutex);
+		if (!error.empty() && m_error.empty())
+		{
+			m_error = error;
+		}
+
+		m_busy = false;
+		pthread_cond_broadcast(&m_cond);
+	}
+
+	pthread_mutex_unlock(&m_mutex);
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "Thread.h"
+
+namespace freelss
+{
+
+class Image;
+class AsyncWriter;
+
+/**
+ * Encodes images to JPEG on a background thread so that the caller can continue
+ * acquiring images while the previous ones are encoded.  The encoded images are
+ * handed to an AsyncWriter to be written to disk.
+ */
+class JpegWriter : public Thread
+{
+public:
+	/**
+	 * @param maxPending - The maximum number of images that can be waiting to be written
+	 * before write() blocks.
+	 */
+	JpegWriter(AsyncWriter& asyncWriter, int maxPending = 3);
+
+	/** Writes any pending images and stops the thread */
+	~JpegWriter();
+
+	/**
+	 * Queues the image to be written to the given file.  The writer takes ownership
+	 * of the image and deletes it once it is written.
+	 */
+	void write(Image * image, const std::string& filename);
+
+	/** Blocks until all queued images are encoded and written.  Throws if any of them failed. */
+	void flush();
+
+	void run();
+
+private:
+
+	struct Job
+	{
+		Image * image;
+		std::string filename;
+	};
+
+	/** Encodes the image and queues it to be written */
+	void writeJpeg(Image& image, const std::string& filename);
+
+	AsyncWriter& m_asyncWriter;
+	std::vector<byte> m_buffer;
+	pthread_mutex_t m_mutex;
+	pthread_cond_t m_cond;
+	std::list<Job> m_jobs;
+	size_t m_maxPending;
+	bool m_running;
+	bool m_busy;
+	std::string m_error;
+};
+
+}
@@ -0,0 +1,247 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "JsonReader.h"
+
+namespace freelss
+{
+
+JsonReader::JsonReader(const std::string& json) :
+	m_json(json),
+	m_pos(0)
+{
+	// Do nothing
+}
+
+void JsonReader::readObject(std::map<std::string, std::string>& members)
+{
+	skipWhitespace();
+	expect('{');
+	skipWhitespace();
+
+	if (m_pos < m_json.size() && m_json[m_pos] == '}')
+	{
+		m_pos++;
+	}
+	else
+	{
+		while (true)
+		{
+			skipWhitespace();
+			std::string name = readString();
+			skipWhitespace();
+			expect(':');
+			skipWhitespace();
+
+			if (m_pos >= m_json.size())
+			{
+				error("Missing value");
+			}
+
+			char ch = m_json[m_pos];
+			if (ch == '"')
+			{
+				members[name] = readString();
+			}
+			else if (ch == '{' || ch == '[')
+			{
+				error("Nested values are not supported");
+			}
+			else
+			{
+				std::string literal = readLiteral();
+				if (literal != "null")
+				{
+					members[name] = literal;
+				}
+			}
+
+			skipWhitespace();
+			if (m_pos < m_json.size() && m_json[m_pos] == ',')
+			{
+				m_pos++;
+				continue;
+			}
+
+			expect('}');
+			break;
+		}
+	}
+
+	skipWhitespace();
+	if (m_pos != m_json.size())
+	{
+		error("Unexpected data after the object");
+	}
+}
+
+void JsonReader::skipWhitespace()
+{
+	while (m_pos < m_json.size() && isspace((unsigned char) m_json[m_pos]))
+	{
+		m_pos++;
+	}
+}
+
+void JsonReader::expect(char ch)
+{
+	if (m_pos >= m_json.size() || m_json[m_pos] != ch)
+	{
+		error(std::string("Expected '") + ch + "'");
+	}
+
+	m_pos++;
+}
+
+std::string JsonReader::readString()
+{
+	expect('"');
+
+	std::string str;
+	while (m_pos < m_json.size())
+	{
+		char ch = m_json[m_pos++];
+		if (ch == '"')
+		{
+			return str;
+		}
+		else if (ch != '\\')
+		{
+			str += ch;
+			continue;
+		}
+
+		if (m_pos >= m_json.size())
+		{
+			break;
+		}
+
+		ch = m_json[m_pos++];
+		switch (ch)
+		{
+		case '"':
+		case '\\':
+		case '/':
+			str += ch;
+			break;
+
+		case 'b':
+			str += '\b';
+			break;
+
+		case 'f':
+			str += '\f';
+			break;
+
+		case 'n':
+			str += '\n';
+			break;
+
+		case 'r':
+			str += '\r';
+			break;
+
+		case 't':
+			str += '\t';
+			break;
+
+		case 'u':
+		{
+			if (m_pos + 4 > m_json.size())
+			{
+				error("Truncated unicode escape");
+			}
+
+			char * end = NULL;
+			std::string hex = m_json.substr(m_pos, 4);
+			unsigned codePoint = strtoul(hex.c_str(), &end, 16);
+			if (end != hex.c_str() + 4)
+			{
+				error("Invalid unicode escape");
+			}
+
+			m_pos += 4;
+			appendUtf8(str, codePoint);
+			break;
+		}
+
+		default:
+			error("Invalid escape");
+		}
+	}
+
+	error("Unterminated string");
+	return str;
+}
+
+std::string JsonReader::readLiteral()
+{
+	size_t start = m_pos;
+	while (m_pos < m_json.size() && (isalnum((unsigned char) m_json[m_pos]) || m_json[m_pos] == '-' ||
+			m_json[m_pos] == '+' || m_json[m_pos] == '.'))
+	{
+		m_pos++;
+	}
+
+	std::string literal = m_json.substr(start, m_pos - start);
+	if (literal == "true" || literal == "false" || literal == "null")
+	{
+		return literal;
+	}
+
+	// Make sure it is a number
+	char * end = NULL;
+	strtod(literal.c_str(), &end);
+	if (literal.empty() || end != literal.c_str() + literal.size() ||
+		strspn(literal.c_str(), "0123456789+-.eE") != literal.size())
+	{
+		m_pos = start;
+		error("Invalid value");
+	}
+
+	return literal;
+}
+
+void JsonReader::appendUtf8(std::string& out, unsigned codePoint)
+{
+	if (codePoint < 0x80)
+	{
+		out += (char) codePoint;
+	}
+	else if (codePoint < 0x800)
+	{
+		out += (char) (0xC0 | (codePoint >> 6));
+		out += (char) (0x80 | (codePoint & 0x3F));
+	}
+	else
+	{
+		out += (char) (0xE0 | (codePoint >> 12));
+		out += (char) (0x80 | ((codePoint >> 6) & 0x3F));
+		out += (char) (0x80 | (codePoint & 0x3F));
+	}
+}
+
+void JsonReader::error(const std::string& message)
+{
+	throw Exception("Invalid JSON: " + message + " at position " + ToString((int) m_pos));
+}
+
+}
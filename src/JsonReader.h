@@ -0,0 +1,64 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+/**
+ * Parses the JSON objects sent to the API.  Only flat objects are supported, which
+ * is all the API accepts.  The values are stored as text the same way form fields are
+ * so they can be handled by the existing request code.
+ */
+class JsonReader
+{
+public:
+	JsonReader(const std::string& json);
+
+	/**
+	 * Reads the members of an object into the map.  Strings are unescaped, numbers and booleans
+	 * are stored as written and null members are skipped.  Throws an Exception if the JSON is malformed.
+	 */
+	void readObject(std::map<std::string, std::string>& members);
+
+private:
+
+	void skipWhitespace();
+
+	/** Consumes the expected character or throws */
+	void expect(char ch);
+
+	std::string readString();
+
+	/** Reads a number, true, false, or null */
+	std::string readLiteral();
+
+	/** Appends the code point as UTF-8 */
+	static void appendUtf8(std::string& out, unsigned codePoint);
+
+	/** Throws an exception describing the problem at the current position */
+	void error(const std::string& message);
+
+	const std::string& m_json;
+	size_t m_pos;
+};
+
+}
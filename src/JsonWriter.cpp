@@ -0,0 +1,198 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "JsonWriter.h"
+#include "FloatFormatter.h"
+
+namespace freelss
+{
+
+JsonWriter::JsonWriter() :
+	m_json(""),
+	m_empty(),
+	m_afterName(false)
+{
+	// Do nothing
+}
+
+void JsonWriter::separate()
+{
+	if (m_afterName)
+	{
+		m_afterName = false;
+		return;
+	}
+
+	if (!m_empty.empty())
+	{
+		if (!m_empty.back())
+		{
+			m_json += ',';
+		}
+
+		m_empty.back() = false;
+	}
+}
+
+void JsonWriter::beginObject()
+{
+	separate();
+	m_json += '{';
+	m_empty.push_back(true);
+}
+
+void JsonWriter::endObject()
+{
+	m_json += '}';
+	m_empty.pop_back();
+}
+
+void JsonWriter::beginArray()
+{
+	separate();
+	m_json += '[';
+	m_empty.push_back(true);
+}
+
+void JsonWriter::endArray()
+{
+	m_json += ']';
+	m_empty.pop_back();
+}
+
+void JsonWriter::name(const std::string& name)
+{
+	separate();
+	appendString(m_json, name);
+	m_json += ':';
+	m_afterName = true;
+}
+
+void JsonWriter::value(const std::string& value)
+{
+	separate();
+	appendString(m_json, value);
+}
+
+void JsonWriter::value(const char * value)
+{
+	separate();
+	appendString(m_json, value);
+}
+
+void JsonWriter::value(real value)
+{
+	separate();
+	appendNumber(m_json, value);
+}
+
+void JsonWriter::value(double value)
+{
+	separate();
+	appendNumber(m_json, (real) value);
+}
+
+void JsonWriter::value(int value)
+{
+	char buffer[16];
+	snprintf(buffer, sizeof(buffer), "%d", value);
+
+	separate();
+	m_json += buffer;
+}
+
+void JsonWriter::value(long long value)
+{
+	char buffer[24];
+	snprintf(buffer, sizeof(buffer), "%lld", value);
+
+	separate();
+	m_json += buffer;
+}
+
+void JsonWriter::value(bool value)
+{
+	separate();
+	m_json += value ? "true" : "false";
+}
+
+void JsonWriter::nullValue()
+{
+	separate();
+	m_json += "null";
+}
+
+void JsonWriter::rawValue(const std::string& json)
+{
+	separate();
+	m_json += json;
+}
+
+const std::string& JsonWriter::str() const
+{
+	return m_json;
+}
+
+void JsonWriter::appendString(std::string& out, const std::string& str)
+{
+	out += '"';
+
+	for (size_t iChar = 0; iChar < str.size(); iChar++)
+	{
+		unsigned char ch = str[iChar];
+		if (ch == '"' || ch == '\\')
+		{
+			out += '\\';
+			out += ch;
+		}
+		else if (ch == '\n')
+		{
+			out += "\\n";
+		}
+		else if (ch < 0x20)
+		{
+			char escaped[8];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", ch);
+			out += escaped;
+		}
+		else
+		{
+			out += ch;
+		}
+	}
+
+	out += '"';
+}
+
+void JsonWriter::appendNumber(std::string& out, real value)
+{
+	if (value != value || value > FLT_MAX || value < -FLT_MAX)
+	{
+		out += "null";
+		return;
+	}
+
+	char buffer[FloatFormatter::MAX_SHORTEST_LENGTH];
+	int length = FloatFormatter::formatShortest(buffer, value);
+	out.append(buffer, length);
+}
+
+}
@@ -0,0 +1,78 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+/**
+ * Builds a JSON document.  The separators between members and array elements
+ * are written automatically so callers only describe the structure.
+ */
+class JsonWriter
+{
+public:
+	JsonWriter();
+
+	void beginObject();
+	void endObject();
+	void beginArray();
+	void endArray();
+
+	/** Writes the name of the next member of the current object */
+	void name(const std::string& name);
+
+	void value(const std::string& value);
+	void value(const char * value);
+	void value(real value);
+	void value(double value);
+	void value(int value);
+	void value(long long value);
+	void value(bool value);
+	void nullValue();
+
+	/** Writes a value that is already encoded as JSON */
+	void rawValue(const std::string& json);
+
+	/** Returns the document written so far */
+	const std::string& str() const;
+
+	/** Appends the string as a quoted JSON string */
+	static void appendString(std::string& out, const std::string& str);
+
+	/** Appends the number as a JSON number.  JSON has no representation for NaN or infinity so they are written as null. */
+	static void appendNumber(std::string& out, real value);
+
+private:
+
+	/** Writes the separator needed before the next value */
+	void separate();
+
+	std::string m_json;
+
+	/** One entry per open object or array, true until the first value is written to it */
+	std::vector<bool> m_empty;
+
+	/** True if a member name was written and its value is next */
+	bool m_afterName;
+};
+
+}
@@ -20,7 +20,14 @@
 
 #include "Main.h"
 #include "Laser.h"
+#ifndef MOCK
 #include "RelayLaser.h"
+#endif
+#include "WaveformLaser.h"
+#include "MockLaser.h"
+#include "GpioDevice.h"
+#include "Setup.h"
+#include "Logger.h"
 
 namespace freelss
 {
@@ -41,7 +48,29 @@ Laser * Laser::getInstance()
 {
 	if (m_instance == NULL)
 	{
-		m_instance = new RelayLaser();
+		// The waveforms go to the mock GPIO device when the hardware is simulated
+		if (Setup::get()->enableGpioWaveforms)
+		{
+			try
+			{
+				m_instance = new WaveformLaser(GpioDevice::get());
+			}
+			catch (Exception& ex)
+			{
+				ErrorLog << "Error creating the waveform laser, using the pins directly instead, error=" << ex << Logger::ENDL;
+			}
+		}
+
+		if (m_instance == NULL && IsMockHardware())
+		{
+			m_instance = new MockLaser();
+		}
+#ifndef MOCK
+		else if (m_instance == NULL)
+		{
+			m_instance = new RelayLaser();
+		}
+#endif
 	}
 
 	return m_instance;
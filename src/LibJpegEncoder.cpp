@@ -0,0 +1,163 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "LibJpegEncoder.h"
+#include "Image.h"
+
+namespace freelss
+{
+
+/** The libjpeg compressor along with the error and destination managers that it uses */
+struct LibJpegEncoderState
+{
+	/** NOTE: This must be first so that the state can be found from cinfo->err */
+	struct jpeg_error_mgr error;
+	struct jpeg_destination_mgr destination;
+	struct jpeg_compress_struct cinfo;
+	jmp_buf setjmpBuffer;
+	char message[JMSG_LENGTH_MAX];
+};
+
+static void ErrorExit(j_common_ptr cinfo)
+{
+	LibJpegEncoderState * state = (LibJpegEncoderState *) cinfo->err;
+	(* cinfo->err->format_message) (cinfo, state->message);
+
+	// Return control to the setjmp point
+	longjmp(state->setjmpBuffer, 1);
+}
+
+static void InitBuffer(j_compress_ptr cinfo) { }
+static void TermBuffer(j_compress_ptr cinfo) { }
+
+static boolean EmptyBuffer(j_compress_ptr cinfo)
+{
+	// The output buffer is never grown so running out of space is an error
+	LibJpegEncoderState * state = (LibJpegEncoderState *) cinfo->err;
+	strncpy(state->message, "The JPEG output buffer is too small", JMSG_LENGTH_MAX);
+	longjmp(state->setjmpBuffer, 1);
+
+	return FALSE;
+}
+
+LibJpegEncoder::LibJpegEncoder() :
+	m_cs(),
+	m_state(NULL),
+	m_rows(),
+	m_width(0),
+	m_height(0),
+	m_numComponents(0)
+{
+	m_state = new LibJpegEncoderState();
+
+	m_state->cinfo.err = jpeg_std_error(&m_state->error);
+	m_state->error.error_exit = ErrorExit;
+
+	m_state->destination.init_destination = InitBuffer;
+	m_state->destination.empty_output_buffer = EmptyBuffer;
+	m_state->destination.term_destination = TermBuffer;
+
+	jpeg_create_compress(&m_state->cinfo);
+	m_state->cinfo.dest = &m_state->destination;
+}
+
+LibJpegEncoder::~LibJpegEncoder()
+{
+	jpeg_destroy_compress(&m_state->cinfo);
+	delete m_state;
+}
+
+std::string LibJpegEncoder::getName() const
+{
+	return "libjpeg";
+}
+
+void LibJpegEncoder::encode(Image& image, byte * buffer, unsigned * size)
+{
+	m_cs.enter();
+	try
+	{
+		compress(image, buffer, size);
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+	m_cs.leave();
+}
+
+void LibJpegEncoder::compress(Image& image, byte * buffer, unsigned * size)
+{
+	struct jpeg_compress_struct * cinfo = &m_state->cinfo;
+
+	unsigned width = image.getWidth();
+	unsigned height = image.getHeight();
+	unsigned numComponents = image.getNumComponents();
+	unsigned rowSize = width * numComponents;
+	unsigned char * pixels = image.getPixels();
+
+	m_state->destination.next_output_byte = buffer;
+	m_state->destination.free_in_buffer = * size;
+
+	if (setjmp(m_state->setjmpBuffer))
+	{
+		jpeg_abort_compress(cinfo);
+		throw Exception(std::string("Error encoding JPEG: ") + m_state->message);
+	}
+
+	// Only reset the compression parameters when the image layout changes
+	if (width != m_width || height != m_height || numComponents != m_numComponents)
+	{
+		cinfo->image_width      = width;
+		cinfo->image_height     = height;
+		cinfo->input_components = numComponents;
+		cinfo->in_color_space   = numComponents == 1 ? JCS_GRAYSCALE : JCS_RGB;
+
+		jpeg_set_defaults(cinfo);
+		jpeg_set_quality(cinfo, JpegEncoder::QUALITY, TRUE);
+		cinfo->dct_method = JDCT_IFAST;
+
+		m_rows.resize(height);
+		m_width = width;
+		m_height = height;
+		m_numComponents = numComponents;
+	}
+
+	for (unsigned iRow = 0; iRow < height; iRow++)
+	{
+		m_rows[iRow] = (JSAMPROW) &pixels[iRow * rowSize];
+	}
+
+	jpeg_start_compress(cinfo, TRUE);
+
+	// Hand libjpeg all of the remaining rows at once instead of one per call
+	while (cinfo->next_scanline < cinfo->image_height)
+	{
+		jpeg_write_scanlines(cinfo, &m_rows[cinfo->next_scanline], cinfo->image_height - cinfo->next_scanline);
+	}
+
+	jpeg_finish_compress(cinfo);
+
+	* size -= m_state->destination.free_in_buffer;
+}
+
+}
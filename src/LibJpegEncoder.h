@@ -0,0 +1,56 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "JpegEncoder.h"
+
+namespace freelss
+{
+
+// Forward declaration
+struct LibJpegEncoderState;
+
+/**
+ * Software JPEG encoder.  The compressor object and its tables are created once
+ * and reused for every image.  Linking against libjpeg-turbo gives the SIMD code paths.
+ */
+class LibJpegEncoder : public JpegEncoder
+{
+public:
+	LibJpegEncoder();
+	~LibJpegEncoder();
+
+	void encode(Image& image, byte * buffer, unsigned * size);
+
+	std::string getName() const;
+
+private:
+	void compress(Image& image, byte * buffer, unsigned * size);
+
+	CriticalSection m_cs;
+	LibJpegEncoderState * m_state;
+	std::vector<JSAMPROW> m_rows;
+	unsigned m_width;
+	unsigned m_height;
+	unsigned m_numComponents;
+};
+
+}
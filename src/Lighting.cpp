@@ -20,7 +20,10 @@
 #include "Main.h"
 #include "Lighting.h"
 #include "Setup.h"
+
+#ifndef MOCK
 #include <softPwm.h>
+#endif
 
 namespace freelss
 {
@@ -49,10 +52,13 @@ Lighting::Lighting() :
 	Setup * setup = Setup::get();
 	m_pin = setup->lightingPin;
 
-	if (setup->enableLighting)
+	// The simulated lighting only keeps the intensity
+#ifndef MOCK
+	if (setup->enableLighting && !IsMockHardware())
 	{
 		softPwmCreate(m_pin, m_intensity, 100);
 	}
+#endif
 }
 
 
@@ -60,7 +66,13 @@ void Lighting::setIntensity(int intensity)
 {
 	if (intensity >= 0 && intensity <= 100)
 	{
-		softPwmWrite (m_pin, intensity);
+#ifndef MOCK
+		if (!IsMockHardware())
+		{
+			softPwmWrite (m_pin, intensity);
+		}
+#endif
+
 		m_intensity = intensity;
 	}
 }
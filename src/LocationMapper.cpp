@@ -25,6 +25,12 @@
 #include "Logger.h"
 #include "Setup.h"
 
+/** The spacing in pixels of the rays in the undistorted ray table, the rays between them are interpolated */
+#define RAY_TABLE_STEP 4
+
+/** The number of iterations used to undo the lens distortion */
+#define UNDISTORT_ITERATIONS 20
+
 namespace freelss
 {
 
@@ -35,7 +41,10 @@ LocationMapper::LocationMapper(const Vector3& laserLoc, const Vector3& cameraLoc
 	m_cameraX(cameraLoc.x),
 	m_cameraY(cameraLoc.y),
 	m_cameraZ(cameraLoc.z),
-	m_groundPlaneHeight(0)
+	m_groundPlaneHeight(0),
+	m_rayTable(),
+	m_rayTableColumns(0),
+	m_rayTableRows(0)
 {
 	Camera * camera = Camera::getInstance();
 	m_imageHeight = camera->getImageHeight();
@@ -44,12 +53,68 @@ LocationMapper::LocationMapper(const Vector3& laserLoc, const Vector3& cameraLoc
 	m_sensorWidth = camera->getSensorWidth();
 	m_sensorHeight = camera->getSensorHeight();
 
-	m_maxObjectSize = Setup::get()->maxObjectSize;
+	Setup * setup = Setup::get();
+	m_maxObjectSize = setup->maxObjectSize;
 	m_groundPlaneHeight = PresetManager::get()->getActivePreset().groundPlaneHeight;
 
+	if (setup->haveCameraIntrinsics)
+	{
+		buildRayTable(setup->cameraIntrinsics);
+	}
+
 	calculateLaserPlane();
 }
 
+void LocationMapper::buildRayTable(const CameraIntrinsics& intrinsics)
+{
+	// The intrinsics scale to other resolutions with the same field of view
+	if (intrinsics.imageWidth <= 0 || intrinsics.imageHeight <= 0 ||
+		ABS((real) intrinsics.imageWidth * m_imageHeight - (real) intrinsics.imageHeight * m_imageWidth) > 0.01f * intrinsics.imageWidth * m_imageHeight)
+	{
+		ErrorLog << "The camera was calibrated at " << intrinsics.imageWidth << "x" << intrinsics.imageHeight
+				 << ", not using the calibration for " << m_imageWidth << "x" << m_imageHeight << " images" << Logger::ENDL;
+		return;
+	}
+
+	real scaleX = m_imageWidth / (real) intrinsics.imageWidth;
+	real scaleY = m_imageHeight / (real) intrinsics.imageHeight;
+	real focalX = intrinsics.focalX * scaleX;
+	real focalY = intrinsics.focalY * scaleY;
+	real principalX = (intrinsics.principalX + 0.5f) * scaleX - 0.5f;
+	real principalY = (intrinsics.principalY + 0.5f) * scaleY - 0.5f;
+
+	// One extra ray past the last pixel so every pixel is between two rays
+	m_rayTableColumns = (m_imageWidth - 1) / RAY_TABLE_STEP + 2;
+	m_rayTableRows = (m_imageHeight - 1) / RAY_TABLE_STEP + 2;
+	m_rayTable.resize(m_rayTableColumns * m_rayTableRows * 2);
+
+	for (int iRow = 0; iRow < m_rayTableRows; iRow++)
+	{
+		for (int iCol = 0; iCol < m_rayTableColumns; iCol++)
+		{
+			real xd = (iCol * RAY_TABLE_STEP - principalX) / focalX;
+			real yd = (iRow * RAY_TABLE_STEP - principalY) / focalY;
+
+			// Invert the Brown-Conrady distortion by fixed point iteration
+			real x = xd;
+			real y = yd;
+			for (int iIter = 0; iIter < UNDISTORT_ITERATIONS; iIter++)
+			{
+				real r2 = x * x + y * y;
+				real radial = 1 + r2 * (intrinsics.k1 + r2 * (intrinsics.k2 + r2 * intrinsics.k3));
+				real dx = 2 * intrinsics.p1 * x * y + intrinsics.p2 * (r2 + 2 * x * x);
+				real dy = intrinsics.p1 * (r2 + 2 * y * y) + 2 * intrinsics.p2 * x * y;
+				x = (xd - dx) / radial;
+				y = (yd - dy) / radial;
+			}
+
+			real * ray = &m_rayTable[(iRow * m_rayTableColumns + iCol) * 2];
+			ray[0] = x;
+			ray[1] = y;
+		}
+	}
+}
+
 void LocationMapper::mapPoints(PixelLocation * laserLocations,
 		                       Image * image,
 		                       ColoredPoint * points,
@@ -148,6 +213,38 @@ void LocationMapper::calculateLaserPlane()
 
 void LocationMapper::calculateCameraRay(const PixelLocation& imagePixel,  Ray * ray)
 {
+	if (!m_rayTable.empty())
+	{
+		// Interpolate between the four closest rays in the table
+		real col = imagePixel.x / RAY_TABLE_STEP;
+		real row = imagePixel.y / RAY_TABLE_STEP;
+		int col0 = MIN(MAX((int) col, 0), m_rayTableColumns - 2);
+		int row0 = MIN(MAX((int) row, 0), m_rayTableRows - 2);
+		real colFrac = col - col0;
+		real rowFrac = row - row0;
+
+		const real * ray00 = &m_rayTable[(row0 * m_rayTableColumns + col0) * 2];
+		const real * ray01 = ray00 + 2;
+		const real * ray10 = ray00 + m_rayTableColumns * 2;
+		const real * ray11 = ray10 + 2;
+
+		real x = (ray00[0] + (ray01[0] - ray00[0]) * colFrac) * (1 - rowFrac) + (ray10[0] + (ray11[0] - ray10[0]) * colFrac) * rowFrac;
+		real y = (ray00[1] + (ray01[1] - ray00[1]) * colFrac) * (1 - rowFrac) + (ray10[1] + (ray11[1] - ray10[1]) * colFrac) * rowFrac;
+
+		// The image Y axis points down and the camera looks down the negative Z axis
+		ray->direction.x = x;
+		ray->direction.y = -y;
+		ray->direction.z = -1;
+
+		// Start the ray on the sensor like the uncalibrated ray
+		ray->origin.x = m_cameraX + ray->direction.x * m_focalLength;
+		ray->origin.y = m_cameraY + ray->direction.y * m_focalLength;
+		ray->origin.z = m_cameraZ - m_focalLength;
+
+		ray->direction.normalize();
+		return;
+	}
+
 	// Performance Note: Most of this could be pre-computed
 	// and all the division could be removed.
 	
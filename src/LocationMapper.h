@@ -60,6 +60,12 @@ public:
 		
 private:
 
+	/**
+	 * Precomputes the undistorted ray of every RAY_TABLE_STEP'th pixel so that
+	 * calculateCameraRay only interpolates between them.
+	 */
+	void buildRayTable(const CameraIntrinsics& intrinsics);
+
 	Plane m_laserPlane;
 	real m_laserX;
 	real m_laserY;
@@ -74,6 +80,11 @@ private:
 	real m_sensorHeight;
 	real m_maxObjectSize;
 	real m_groundPlaneHeight;
+
+	/** The undistorted direction (x, y) of the rays at z = 1 in camera coordinates, empty if the camera isn't calibrated */
+	std::vector<real> m_rayTable;
+	int m_rayTableColumns;
+	int m_rayTableRows;
 };
 
 }
@@ -17,91 +17,314 @@
  *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
  ****************************************************************************
 */
+
 #include "Main.h"
 #include "Logger.h"
+#include "Thread.h"
+
+/** The longest line that is formatted before it is queued in pieces */
+#define LOG_LINE_SIZE 4096
+
+/** How long the log thread sleeps when there is nothing to write */
+#define LOG_IDLE_SLEEP_USEC 50000
 
 namespace freelss
 {
-Logger InfoLog(stdout);
-Logger ErrorLog(stderr);
+
+LevelLogger<Logger::LL_DEBUG> DebugLog;
+LevelLogger<Logger::LL_INFO> InfoLog;
+LevelLogger<Logger::LL_ERROR> ErrorLog;
 const char * Logger::ENDL = "\n";
+volatile int Logger::m_level = Logger::LL_INFO;
 
-Logger::Logger(FILE * fp) :
-	m_fp(fp)
+/** A queued log line */
+struct LogMessage
 {
-	// Do nothing
-}
+	LogMessage * next;
+	int level;
+	struct timeval time;
+	size_t length;
+	char text[1];
+};
 
-Logger& Logger::operator << (const std::string& str)
-{
-	fprintf(m_fp, "%s", str.c_str());
-	return *this;
-}
+/** The line being formatted by each thread */
+static __thread char t_line[LOG_LINE_SIZE];
+static __thread size_t t_lineLength = 0;
+static __thread int t_lineLevel = 0;
 
-Logger& Logger::operator << (const char * str)
-{
-	fprintf(m_fp, "%s", str);
-	return *this;
-}
+/**
+ * The queued lines, most recent first.  Producers push with a compare-and-swap
+ * and the log thread takes the whole list at once, so there is no ABA problem.
+ */
+static LogMessage * volatile g_messages = NULL;
 
-Logger& Logger::operator << (unsigned long number)
-{
-	fprintf(m_fp, "%lu", number);
-	return *this;
-}
+static const char * LEVEL_NAMES[] = { "DEBUG", "INFO ", "ERROR" };
 
-Logger& Logger::operator << (long number)
+/** Writes the queued lines to the console and to a size rotated file */
+class LogWriter : public Thread
 {
-	fprintf(m_fp, "%ld", number);
-	return *this;
-}
+public:
+	LogWriter(const std::string& filename, long maxFileSize, int numFiles) :
+		m_filename(filename),
+		m_maxFileSize(maxFileSize),
+		m_numFiles(numFiles),
+		m_fp(NULL),
+		m_fileSize(0)
+	{
+		openFile();
+	}
 
-Logger& Logger::operator << (unsigned int number)
-{
-	fprintf(m_fp, "%u", number);
-	return *this;
-}
+	~LogWriter()
+	{
+		if (m_fp != NULL)
+		{
+			fclose(m_fp);
+		}
+	}
+
+	void run()
+	{
+		while (!m_stopRequested)
+		{
+			if (!writeQueued())
+			{
+				Thread::usleep(LOG_IDLE_SLEEP_USEC);
+			}
+		}
+
+		writeQueued();
+	}
+
+	/** Writes the lines that are queued.  Returns false if there were none. */
+	bool writeQueued()
+	{
+		LogMessage * messages = __sync_lock_test_and_set(&g_messages, (LogMessage *) NULL);
+		if (messages == NULL)
+		{
+			return false;
+		}
+
+		// Put the lines back in the order they were logged
+		LogMessage * ordered = NULL;
+		while (messages != NULL)
+		{
+			LogMessage * next = messages->next;
+			messages->next = ordered;
+			ordered = messages;
+			messages = next;
+		}
+
+		while (ordered != NULL)
+		{
+			LogMessage * next = ordered->next;
+			write(ordered);
+			free(ordered);
+			ordered = next;
+		}
+
+		fflush(stdout);
+		fflush(stderr);
+
+		if (m_fp != NULL)
+		{
+			fflush(m_fp);
+		}
+
+		return true;
+	}
+
+private:
+
+	void write(const LogMessage * message)
+	{
+		fwrite(message->text, 1, message->length, message->level == Logger::LL_ERROR ? stderr : stdout);
+
+		if (m_fp == NULL)
+		{
+			return;
+		}
+
+		if (m_fileSize >= m_maxFileSize)
+		{
+			rotate();
+		}
 
-Logger& Logger::operator << (int number)
+		struct tm tm;
+		localtime_r(&message->time.tv_sec, &tm);
+
+		char prefix[48];
+		int prefixLen = snprintf(prefix, sizeof(prefix), "%04d-%02d-%02d %02d:%02d:%02d.%03d %s ",
+								 tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+								 (int) (message->time.tv_usec / 1000), LEVEL_NAMES[message->level]);
+
+		fwrite(prefix, 1, prefixLen, m_fp);
+		fwrite(message->text, 1, message->length, m_fp);
+		m_fileSize += prefixLen + message->length;
+	}
+
+	void openFile()
+	{
+		m_fp = fopen(m_filename.c_str(), "a");
+		if (m_fp == NULL)
+		{
+			fprintf(stderr, "Error opening log file %s: %s\n", m_filename.c_str(), strerror(errno));
+			return;
+		}
+
+		m_fileSize = ftell(m_fp);
+	}
+
+	/** Shifts each log file to the next number, dropping the oldest */
+	void rotate()
+	{
+		fclose(m_fp);
+		m_fp = NULL;
+
+		for (int iFile = m_numFiles - 1; iFile >= 1; iFile--)
+		{
+			std::stringstream src, dst;
+			src << m_filename << "." << iFile;
+			dst << m_filename << "." << (iFile + 1);
+			rename(src.str().c_str(), dst.str().c_str());
+		}
+
+		if (m_numFiles > 0)
+		{
+			std::string dst = m_filename + ".1";
+			rename(m_filename.c_str(), dst.c_str());
+		}
+		else
+		{
+			unlink(m_filename.c_str());
+		}
+
+		openFile();
+	}
+
+	std::string m_filename;
+	long m_maxFileSize;
+	int m_numFiles;
+	FILE * m_fp;
+	long m_fileSize;
+};
+
+/** The log thread, NULL until Logger::start() is called */
+static LogWriter * volatile g_writer = NULL;
+
+/** Queues the line or writes it directly if the log thread isn't running */
+static void QueueLine(int level, const char * text, size_t length)
 {
-	fprintf(m_fp, "%d", number);
-	return *this;
+	if (g_writer == NULL)
+	{
+		fwrite(text, 1, length, level == Logger::LL_ERROR ? stderr : stdout);
+		return;
+	}
+
+	LogMessage * message = (LogMessage *) malloc(sizeof(LogMessage) + length);
+	if (message == NULL)
+	{
+		return;
+	}
+
+	message->level = level;
+	gettimeofday(&message->time, NULL);
+	message->length = length;
+	memcpy(message->text, text, length);
+
+	LogMessage * head;
+	do
+	{
+		head = g_messages;
+		message->next = head;
+	}
+	while (!__sync_bool_compare_and_swap(&g_messages, head, message));
 }
 
-Logger& Logger::operator << (unsigned short number)
+void Logger::setLevel(Logger::Level level)
 {
-	fprintf(m_fp, "%hu", number);
-	return *this;
+	m_level = level;
 }
 
-Logger& Logger::operator << (short number)
+Logger::Level Logger::getLevel()
 {
-	fprintf(m_fp, "%hd", number);
-	return *this;
+	return (Logger::Level) m_level;
 }
 
-Logger& Logger::operator << (unsigned char number)
+void Logger::start(const std::string& filename, long maxFileSize, int numFiles)
 {
-	fprintf(m_fp, "%hhu", number);
-	return *this;
+	if (g_writer != NULL)
+	{
+		return;
+	}
+
+	LogWriter * writer = new LogWriter(filename, maxFileSize, numFiles);
+	writer->execute();
+
+	g_writer = writer;
 }
 
-Logger& Logger::operator << (char number)
+void Logger::stop()
 {
-	fprintf(m_fp, "%hhd", number);
-	return *this;
+	LogWriter * writer = g_writer;
+	if (writer == NULL)
+	{
+		return;
+	}
+
+	// Lines logged from now on go straight to the console
+	g_writer = NULL;
+	__sync_synchronize();
+
+	writer->stop();
+	writer->join();
+
+	// Catch anything that was queued while the thread was finishing
+	writer->writeQueued();
+
+	delete writer;
 }
 
-Logger& Logger::operator << (float number)
+void Logger::append(int level, const char * str, size_t len)
 {
-	fprintf(m_fp, "%f", number);
-	return *this;
+	// Finish the line of a different level first
+	if (t_lineLength != 0 && t_lineLevel != level)
+	{
+		QueueLine(t_lineLevel, t_line, t_lineLength);
+		t_lineLength = 0;
+	}
+
+	t_lineLevel = level;
+
+	while (len > 0)
+	{
+		size_t numCopied = MIN(len, LOG_LINE_SIZE - t_lineLength);
+		memcpy(t_line + t_lineLength, str, numCopied);
+		t_lineLength += numCopied;
+		str += numCopied;
+		len -= numCopied;
+
+		// Queue the line once it is complete or the buffer is full
+		if (t_lineLength == LOG_LINE_SIZE || t_line[t_lineLength - 1] == '\n')
+		{
+			QueueLine(level, t_line, t_lineLength);
+			t_lineLength = 0;
+		}
+	}
 }
 
-Logger& Logger::operator << (double number)
+void Logger::appendFormat(int level, const char * format, ...)
 {
-	fprintf(m_fp, "%f", number);
-	return *this;
+	char buffer[64];
+
+	va_list args;
+	va_start(args, format);
+	int length = vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+
+	if (length > 0)
+	{
+		append(level, buffer, MIN((size_t) length, sizeof(buffer) - 1));
+	}
 }
 
 }
@@ -20,32 +20,141 @@
 
 #pragma once
 
+/**
+ * The lowest log level that is compiled in.  Logging below it is removed by the
+ * compiler, so defining it as 1 removes the debug logging from a build entirely.
+ */
+#ifndef FREELSS_MIN_LOG_LEVEL
+#define FREELSS_MIN_LOG_LEVEL 0
+#endif
 
 namespace freelss
 {
 
+/**
+ * Formats log lines into a buffer belonging to the calling thread and hands each
+ * complete line to a background thread through a lock-free queue.  The background
+ * thread writes the lines to the console and to a log file that is rotated by size.
+ * Until start() is called the lines are written to the console directly.
+ */
 class Logger
 {
-
 public:
-	Logger(FILE * fp);
-	Logger& operator << (const std::string& str);
-	Logger& operator << (const char * str);
-	Logger& operator << (unsigned long number);
-	Logger& operator << (long number);
-	Logger& operator << (unsigned int number);
-	Logger& operator << (int number);
-	Logger& operator << (unsigned short number);
-	Logger& operator << (short number);
-	Logger& operator << (unsigned char number);
-	Logger& operator << (char number);
-	Logger& operator << (float number);
-	Logger& operator << (double number);
+	enum Level { LL_DEBUG, LL_INFO, LL_ERROR };
+
+	/** Sets the lowest level that is logged */
+	static void setLevel(Logger::Level level);
+	static Logger::Level getLevel();
+
+	/**
+	 * Starts the thread that writes the log.
+	 * @param filename - The log file, which is appended to.
+	 * @param maxFileSize - The size in bytes at which the log file is rotated.
+	 * @param numFiles - The number of rotated log files to keep.
+	 */
+	static void start(const std::string& filename, long maxFileSize, int numFiles);
+
+	/** Writes the queued lines and stops the thread that writes the log */
+	static void stop();
+
 	static const char * ENDL;
-private:
-	FILE * m_fp;
+
+protected:
+	/** Adds the text to the calling thread's line, which is queued once it ends with a newline */
+	static void append(int level, const char * str, size_t len);
+	static void appendFormat(int level, const char * format, ...) __attribute__ ((format (printf, 2, 3)));
+
+	/** The lowest level that is logged */
+	static volatile int m_level;
+};
+
+/**
+ * Logs at a single level.  The level check is inlined so disabled logging
+ * costs a branch instead of formatting.
+ */
+template <int LEVEL>
+class LevelLogger : public Logger
+{
+public:
+	bool isEnabled() const
+	{
+		return LEVEL >= FREELSS_MIN_LOG_LEVEL && LEVEL >= m_level;
+	}
+
+	LevelLogger& operator << (const std::string& str)
+	{
+		if (isEnabled()) append(LEVEL, str.c_str(), str.size());
+		return *this;
+	}
+
+	LevelLogger& operator << (const char * str)
+	{
+		if (isEnabled()) append(LEVEL, str, strlen(str));
+		return *this;
+	}
+
+	LevelLogger& operator << (unsigned long number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%lu", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (long number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%ld", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (unsigned int number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%u", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (int number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%d", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (unsigned short number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%hu", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (short number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%hd", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (unsigned char number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%hhu", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (char number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%hhd", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (float number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%f", number);
+		return *this;
+	}
+
+	LevelLogger& operator << (double number)
+	{
+		if (isEnabled()) appendFormat(LEVEL, "%f", number);
+		return *this;
+	}
 };
 
-extern Logger InfoLog;
-extern Logger ErrorLog;
+extern LevelLogger<Logger::LL_DEBUG> DebugLog;
+extern LevelLogger<Logger::LL_INFO> InfoLog;
+extern LevelLogger<Logger::LL_ERROR> ErrorLog;
 }
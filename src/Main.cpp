@@ -21,8 +21,12 @@
 #include "Main.h"
 #include "Camera.h"
 #include "Scanner.h"
+#include "TurnTable.h"
+#include "Laser.h"
+#ifndef MOCK
 #include "A4988TurnTable.h"
 #include "RelayLaser.h"
+#endif
 #include "PresetManager.h"
 #include "HttpServer.h"
 #include "PresetManager.h"
@@ -35,11 +39,27 @@
 #include "MountManager.h"
 #include "BootConfigManager.h"
 #include "MmalUtil.h"
+#include "JpegEncoder.h"
+#include "ScanCatalog.h"
+#include "Tracer.h"
+#include "Metrics.h"
+#include "GpioDevice.h"
+#include "CameraCalibrator.h"
 #include <curl/curl.h>
 #include <algorithm>
 
+#define LOG_FILE_NAME "freelss.log"
+#define LOG_MAX_FILE_SIZE (1024 * 1024)
+#define LOG_NUM_FILES 3
+
 static std::string FREELSS_HOME_DIR = "/var/lib/freelss";
 
+#ifdef MOCK
+static bool USE_MOCK_HARDWARE = true;
+#else
+static bool USE_MOCK_HARDWARE = false;
+#endif
+
 static bool SortRecordByRow(const freelss::DataPoint& a, const freelss::DataPoint& b)
 {
 	return a.pixel.y < b.pixel.y;
@@ -65,8 +85,15 @@ struct InitSingletons
 	InitSingletons()
 	{
 		freelss::PresetManager::get();
-		freelss::A4988TurnTable::initialize();
-		freelss::RelayLaser::initialize();
+
+#ifndef MOCK
+		if (!freelss::IsMockHardware())
+		{
+			freelss::A4988TurnTable::initialize();
+			freelss::RelayLaser::initialize();
+		}
+#endif
+
 		freelss::UpdateManager::get();
 		freelss::Setup::get();
 		freelss::Lighting::get();
@@ -74,18 +101,30 @@ struct InitSingletons
 		freelss::HttpServer::get();
 		freelss::MountManager::get();
 		freelss::BootConfigManager::get();
+		freelss::ScanCatalog::get();
+		freelss::Tracer::get();
+		freelss::Metrics::get();
 
 #ifndef MOCK
-		freelss::MmalUtil::get();
+		if (!freelss::IsMockHardware())
+		{
+			freelss::MmalUtil::get();
+		}
 #endif
 	}
 
 	~InitSingletons()
 	{
 		freelss::HttpServer::release();
+		freelss::ScanCatalog::release();
+		freelss::Tracer::release();
+		freelss::Metrics::release();
 		freelss::Laser::release();
 		freelss::Camera::release();
+		freelss::CameraCalibrator::release();
+		freelss::JpegEncoder::release();
 		freelss::TurnTable::release();
+		freelss::GpioDevice::release();
 		freelss::UpdateManager::release();
 		freelss::PresetManager::release();
 		freelss::Lighting::release();
@@ -101,17 +140,35 @@ struct InitSingletons
 	}
 };
 
+/** Starts and stops writing the log file */
+struct InitLogger
+{
+	InitLogger(const std::string& homeDir)
+	{
+		freelss::Logger::start(homeDir + "/" + LOG_FILE_NAME, LOG_MAX_FILE_SIZE, LOG_NUM_FILES);
+	}
+
+	~InitLogger()
+	{
+		freelss::Logger::stop();
+	}
+};
+
 /** Initializes and destroys the Raspberry Pi subsystem */
 struct InitBcmHost
 {
 	InitBcmHost()
 	{
+#ifndef MOCK
 		bcm_host_init();
+#endif
 	}
 
 	~InitBcmHost()
 	{
+#ifndef MOCK
 		bcm_host_deinit();
+#endif
 	}
 };
 namespace freelss
@@ -132,23 +189,38 @@ namespace freelss
 int main(int argc, char **argv)
 {
 	int retVal = 0;
-#ifndef MOCK
-	pid_t pid = fork();
-	if (pid < 0)
+
+	// Simulate the turn table, lasers, lighting and camera instead of using the Raspberry Pi's
+	for (int iArg = 1; iArg < argc; iArg++)
 	{
-		freelss::ErrorLog << "Error forking process!!!" << freelss::Logger::ENDL;
-		return 1;
+		if (strcmp(argv[iArg], "--mock") == 0)
+		{
+			freelss::SetMockHardware(true);
+		}
 	}
-	else if (pid != 0)
+
+	// Stay in the foreground with simulated hardware so it can be run under a profiler
+	if (!freelss::IsMockHardware())
 	{
-		return 0;
+		pid_t pid = fork();
+		if (pid < 0)
+		{
+			freelss::ErrorLog << "Error forking process!!!" << freelss::Logger::ENDL;
+			return 1;
+		}
+		else if (pid != 0)
+		{
+			return 0;
+		}
 	}
-#endif
 
 	// Create the output directories if they don't exist
 	std::string homeDir = freelss::GetAppHomeDir();
 	mkdir(homeDir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
 
+	// Write the log from a background thread
+	InitLogger logger(homeDir);
+
 	// Migrate to the new directory structure
 	freelss::MigrateHome();
 
@@ -167,7 +239,12 @@ int main(int argc, char **argv)
 	try
 	{
 		// Setup wiring pi
-		wiringPiSetup();
+#ifndef MOCK
+		if (!freelss::IsMockHardware())
+		{
+			wiringPiSetup();
+		}
+#endif
 
 		// Initialize Curl
 		InitCurl curl();
@@ -251,6 +328,16 @@ std::string GetAppHomeDir()
 	return FREELSS_HOME_DIR;
 }
 
+bool IsMockHardware()
+{
+	return USE_MOCK_HARDWARE;
+}
+
+void SetMockHardware(bool mock)
+{
+	USE_MOCK_HARDWARE = mock;
+}
+
 std::string GetScanOutputDir()
 {
 	return GetAppHomeDir() + "/scans";
@@ -447,7 +534,10 @@ void LoadProperties()
 	}
 
 	// Load the hardware setup information
-	Setup::get()->decodeProperties(properties);
+	Setup * setup = Setup::get();
+	setup->decodeProperties(properties);
+
+	Logger::setLevel(setup->enableDebugLogging ? Logger::LL_DEBUG : Logger::LL_INFO);
 }
 
 void SaveProperties()
@@ -30,6 +30,7 @@ The origin is the center of the turn table.
 #include <png.h>
 
 // MMAL/BCM
+#ifndef MOCK
 #include <bcm_host.h>
 #include <interface/vcos/vcos.h>
 #include <mmal/mmal.h>
@@ -38,6 +39,7 @@ The origin is the center of the turn table.
 #include <mmal_util_params.h>
 #include <mmal_default_components.h>
 #include <mmal_connection.h>
+#endif
 
 // MICROHTTPD
 #include <microhttpd.h>
@@ -46,13 +48,21 @@ The origin is the center of the turn table.
 #include <jpeglib.h>
 
 // LIBIW
+#ifndef MOCK
 #include <iwlib.h>
+#else
+#include <net/if.h>
+#endif
 
 // OpenSSL
 #include <openssl/sha.h>
 
+// ZLIB
+#include <zlib.h>
+
 // Eigen
 #include <Eigen/Geometry>
+#include <Eigen/Eigenvalues>
 
 #include <string>
 #include <vector>
@@ -75,6 +85,7 @@ The origin is the center of the turn table.
 #include <limits.h>
 #include <memory.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <errno.h>
 #include <sysexits.h>
 #include <setjmp.h>
@@ -85,6 +96,8 @@ The origin is the center of the turn table.
 #include <sys/time.h>
 #include <sys/stat.h>
 #include <sys/statvfs.h>
+#include <sys/inotify.h>
+#include <sys/ioctl.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <sys/utsname.h>
@@ -222,6 +235,28 @@ struct FaceMap
 	std::vector<unsigned> triangles;
 };
 
+/** The camera's focal lengths and principal point in pixels and its lens distortion */
+struct CameraIntrinsics
+{
+	real focalX;
+	real focalY;
+	real principalX;
+	real principalY;
+
+	/** Radial distortion coefficients */
+	real k1;
+	real k2;
+	real k3;
+
+	/** Tangential distortion coefficients */
+	real p1;
+	real p2;
+
+	/** The size of the images the values were calibrated with */
+	int imageWidth;
+	int imageHeight;
+};
+
 struct Ray
 {
 	Vector3 origin;
@@ -266,8 +301,14 @@ struct ScanResultFile
 
 struct ScanResult
 {
+	ScanResult() : files(), numPoints(0), numFaces(0) { }
+
 	time_t getScanDate() const;
 	std::vector<ScanResultFile> files;
+
+	/** The number of points and faces in the mesh or 0 if unknown */
+	int numPoints;
+	int numFaces;
 };
 
 struct SoftwareUpdate
@@ -309,6 +350,10 @@ void SaveProperties();
 void MigrateHome();
 std::string UrlDecode(const std::string& in);
 std::string GetAppHomeDir();
+
+/** Returns true if the hardware is simulated instead of using the Raspberry Pi's */
+bool IsMockHardware();
+void SetMockHardware(bool mock);
 std::string GetScanOutputDir();
 std::string GetDebugOutputDir();
 std::string GetPropertiesFile();
@@ -318,6 +363,11 @@ std::string TrimString(const std::string& str);
 
 
 // Include wiringPi
+#ifndef MOCK
 #include <wiringPi.h>
+#else
+#define LOW 0
+#define HIGH 1
+#endif
 
 
@@ -0,0 +1,267 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "MeshExporter.h"
+#include "Thread.h"
+#include "CriticalSection.h"
+#include "Progress.h"
+#include "AsyncWriter.h"
+#include "AsyncFileWriter.h"
+#include "PlyWriter.h"
+#include "XyzWriter.h"
+#include "StlWriter.h"
+#include "Logger.h"
+#include "Tracer.h"
+
+namespace freelss
+{
+
+/** Writes a single output file on its own thread */
+class MeshExportTask : public Thread
+{
+public:
+	MeshExportTask(MeshExporter::Format format, const std::string& filename, PlyDataFormat plyDataFormat,
+			       const std::vector<DataPoint>& results, const FaceMap& faces, AsyncWriter& asyncWriter) :
+		format(format),
+		filename(filename),
+		plyDataFormat(plyDataFormat),
+		results(results),
+		faces(faces),
+		asyncWriter(asyncWriter),
+		progress(),
+		error(""),
+		writingTime(0),
+		m_cs(),
+		m_done(false)
+	{
+		// Do nothing
+	}
+
+	void run()
+	{
+		double time1 = GetTimeInSeconds();
+
+		try
+		{
+			write();
+		}
+		catch (Exception& ex)
+		{
+			error = ex;
+		}
+		catch (...)
+		{
+			error = "Unknown error writing " + filename;
+		}
+
+		writingTime = GetTimeInSeconds() - time1;
+
+		m_cs.enter();
+		m_done = true;
+		m_cs.leave();
+	}
+
+	bool isDone()
+	{
+		m_cs.enter();
+		bool done = m_done;
+		m_cs.leave();
+
+		return done;
+	}
+
+	MeshExporter::Format format;
+	std::string filename;
+	PlyDataFormat plyDataFormat;
+	const std::vector<DataPoint>& results;
+	const FaceMap& faces;
+	AsyncWriter& asyncWriter;
+	Progress progress;
+	std::string error;
+	double writingTime;
+
+private:
+
+	void write()
+	{
+		Tracer::get()->setThreadName("Export " + filename.substr(filename.find_last_of('/') + 1));
+		TraceScope trace("export");
+
+		AsyncFileWriter fout(asyncWriter, filename.c_str());
+		if (!fout.is_open())
+		{
+			throw Exception("Error opening file for writing: " + filename);
+		}
+
+		if (format == MeshExporter::MEF_PLY)
+		{
+			writePly(fout);
+		}
+		else if (format == MeshExporter::MEF_XYZ)
+		{
+			XyzWriter xyzWriter;
+			xyzWriter.write(fout, results, progress);
+		}
+		else if (format == MeshExporter::MEF_STL)
+		{
+			StlWriter stlWriter;
+			stlWriter.write(fout, results, faces, progress);
+		}
+		else
+		{
+			throw Exception("Unsupported mesh export format");
+		}
+
+		fout.close();
+	}
+
+	void writePly(IWriter& fout)
+	{
+		progress.setLabel("Generating PLY file");
+		progress.setPercent(0);
+
+		PlyWriter plyWriter;
+		plyWriter.setDataFormat(plyDataFormat);
+		plyWriter.setTotalNumPoints((int)results.size());
+		plyWriter.setTotalNumFacesFromFaceMap(faces);
+		plyWriter.begin(&fout);
+
+		real percent = 0;
+		for (size_t iRec = 0; iRec < results.size(); iRec++)
+		{
+			real newPct = 100.0f * iRec / results.size();
+			if (newPct - percent > 0.1)
+			{
+				progress.setPercent(newPct);
+				percent = newPct;
+			}
+
+			plyWriter.writePoints(&results[iRec].point, 1);
+		}
+
+		plyWriter.writeFaces(faces);
+		plyWriter.end();
+	}
+
+	CriticalSection m_cs;
+	bool m_done;
+};
+
+MeshExporter::MeshExporter(const std::vector<DataPoint>& results, const FaceMap& faces, AsyncWriter& asyncWriter) :
+	m_results(results),
+	m_faces(faces),
+	m_asyncWriter(asyncWriter),
+	m_tasks()
+{
+	// Do nothing
+}
+
+MeshExporter::~MeshExporter()
+{
+	for (size_t iTask = 0; iTask < m_tasks.size(); iTask++)
+	{
+		delete m_tasks[iTask];
+	}
+}
+
+void MeshExporter::add(MeshExporter::Format format, const std::string& filename, PlyDataFormat plyDataFormat)
+{
+	m_tasks.push_back(new MeshExportTask(format, filename, plyDataFormat, m_results, m_faces, m_asyncWriter));
+}
+
+void MeshExporter::exportAll(Progress& progress)
+{
+	if (m_tasks.empty())
+	{
+		return;
+	}
+
+	progress.setLabel("Writing scan files");
+	progress.setPercent(0);
+
+	size_t numStarted = 0;
+	try
+	{
+		for (; numStarted < m_tasks.size(); numStarted++)
+		{
+			m_tasks[numStarted]->execute();
+		}
+
+		// Report the combined progress of the writers until they all finish
+		bool done = false;
+		while (!done)
+		{
+			done = true;
+			real percent = 0;
+
+			for (size_t iTask = 0; iTask < m_tasks.size(); iTask++)
+			{
+				done = done && m_tasks[iTask]->isDone();
+				percent += m_tasks[iTask]->progress.getPercent();
+			}
+
+			progress.setPercent(percent / m_tasks.size());
+
+			if (!done)
+			{
+				Thread::usleep(100000);
+			}
+		}
+	}
+	catch (...)
+	{
+		for (size_t iTask = 0; iTask < numStarted; iTask++)
+		{
+			m_tasks[iTask]->join();
+		}
+
+		throw;
+	}
+
+	for (size_t iTask = 0; iTask < m_tasks.size(); iTask++)
+	{
+		m_tasks[iTask]->join();
+	}
+
+	for (size_t iTask = 0; iTask < m_tasks.size(); iTask++)
+	{
+		if (!m_tasks[iTask]->error.empty())
+		{
+			throw Exception(m_tasks[iTask]->error);
+		}
+	}
+}
+
+double MeshExporter::getWritingTime(MeshExporter::Format format) const
+{
+	double writingTime = 0;
+	for (size_t iTask = 0; iTask < m_tasks.size(); iTask++)
+	{
+		if (m_tasks[iTask]->format == format)
+		{
+			writingTime += m_tasks[iTask]->writingTime;
+		}
+	}
+
+	return writingTime;
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+class AsyncWriter;
+class Progress;
+class MeshExportTask;
+
+/**
+ * Writes the scan results to each of the requested file formats.  The writers share
+ * the same read-only results and faces and each one runs on its own thread.
+ */
+class MeshExporter
+{
+public:
+
+	/** The supported output formats */
+	enum Format { MEF_PLY, MEF_XYZ, MEF_STL };
+
+	MeshExporter(const std::vector<DataPoint>& results, const FaceMap& faces, AsyncWriter& asyncWriter);
+	~MeshExporter();
+
+	/** Adds an output file of the given format */
+	void add(MeshExporter::Format format, const std::string& filename, PlyDataFormat plyDataFormat = PLY_BINARY);
+
+	/** Runs all of the writers and blocks until they finish.  Throws the first error that any of them encountered. */
+	void exportAll(Progress& progress);
+
+	/** Returns the number of seconds spent writing the given format */
+	double getWritingTime(MeshExporter::Format format) const;
+
+private:
+	const std::vector<DataPoint>& m_results;
+	const FaceMap& m_faces;
+	AsyncWriter& m_asyncWriter;
+	std::vector<MeshExportTask *> m_tasks;
+};
+
+}
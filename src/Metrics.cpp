@@ -0,0 +1,243 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "Metrics.h"
+
+#define METRIC_PREFIX "freelss_"
+
+namespace freelss
+{
+
+/** Bucket bounds in seconds, wide enough for both a frame stage and facetizing a large scan */
+static const double LATENCY_BUCKETS[] = { 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30, 60, 300 };
+
+static const double POINTS_PER_FRAME_BUCKETS[] = { 0, 10, 50, 100, 250, 500, 1000, 2000, 4000 };
+
+/** The label of each Metrics::Stage */
+static const char * STAGE_NAMES[] = { "rotation", "image_acquisition", "laser", "image_processing", "point_mapping",
+		                              "point_processing", "laser_merge", "facetization", "ply_writing", "stl_writing",
+		                              "xyz_writing" };
+
+#define NUM_BUCKETS(b) ((int) (sizeof(b) / sizeof(b[0])))
+
+static void WriteHeader(std::ostream& out, const char * name, const char * type, const char * help)
+{
+	out << "# HELP " << METRIC_PREFIX << name << " " << help << "\n";
+	out << "# TYPE " << METRIC_PREFIX << name << " " << type << "\n";
+}
+
+static void WriteValue(std::ostream& out, const char * name, const char * type, const char * help, long long value)
+{
+	WriteHeader(out, name, type, help);
+	out << METRIC_PREFIX << name << " " << value << "\n";
+}
+
+MetricCounter::MetricCounter() :
+	m_value(0)
+{
+	// Do nothing
+}
+
+void MetricCounter::increment(long long amount)
+{
+	__sync_fetch_and_add(&m_value, amount);
+}
+
+long long MetricCounter::getValue() const
+{
+	// A plain read of a 64-bit value isn't atomic on 32-bit ARM
+	return __sync_fetch_and_add(&m_value, 0);
+}
+
+MetricGauge::MetricGauge() :
+	m_value(0)
+{
+	// Do nothing
+}
+
+void MetricGauge::add(long long amount)
+{
+	__sync_fetch_and_add(&m_value, amount);
+}
+
+long long MetricGauge::getValue() const
+{
+	return __sync_fetch_and_add(&m_value, 0);
+}
+
+MetricHistogram::MetricHistogram(const double * bounds, int numBounds) :
+	m_bounds(bounds),
+	m_numBounds(numBounds),
+	m_buckets(new long long[numBounds + 1]),
+	m_count(0),
+	m_sum(0)
+{
+	for (int iBkt = 0; iBkt <= m_numBounds; iBkt++)
+	{
+		m_buckets[iBkt] = 0;
+	}
+}
+
+MetricHistogram::~MetricHistogram()
+{
+	delete [] m_buckets;
+}
+
+void MetricHistogram::observe(double value)
+{
+	int iBkt = 0;
+	while (iBkt < m_numBounds && value > m_bounds[iBkt])
+	{
+		iBkt++;
+	}
+
+	__sync_fetch_and_add(&m_buckets[iBkt], 1);
+	__sync_fetch_and_add(&m_count, 1);
+	__sync_fetch_and_add(&m_sum, (long long) (value * 1000000.0 + 0.5));
+}
+
+void MetricHistogram::write(std::ostream& out, const std::string& name, const std::string& labels) const
+{
+	std::string labelPrefix = labels.empty() ? "" : labels + ",";
+	long long cumulative = 0;
+
+	for (int iBkt = 0; iBkt <= m_numBounds; iBkt++)
+	{
+		cumulative += __sync_fetch_and_add(&m_buckets[iBkt], 0);
+
+		out << METRIC_PREFIX << name << "_bucket{" << labelPrefix << "le=\"";
+		if (iBkt < m_numBounds)
+		{
+			out << m_bounds[iBkt];
+		}
+		else
+		{
+			out << "+Inf";
+		}
+		out << "\"} " << cumulative << "\n";
+	}
+
+	std::string labelSet = labels.empty() ? "" : "{" + labels + "}";
+	long long sum = __sync_fetch_and_add(const_cast<volatile long long *>(&m_sum), 0);
+	long long count = __sync_fetch_and_add(const_cast<volatile long long *>(&m_count), 0);
+
+	out << METRIC_PREFIX << name << "_sum" << labelSet << " " << (sum / 1000000.0) << "\n";
+	out << METRIC_PREFIX << name << "_count" << labelSet << " " << count << "\n";
+}
+
+Metrics * Metrics::m_instance = NULL;
+
+Metrics * Metrics::get()
+{
+	if (m_instance == NULL)
+	{
+		m_instance = new Metrics();
+	}
+
+	return m_instance;
+}
+
+void Metrics::release()
+{
+	delete m_instance;
+	m_instance = NULL;
+}
+
+Metrics::Metrics() :
+	framesProcessed(),
+	emptyFrames(),
+	frameRetries(),
+	rowsBadFromColor(),
+	rowsBadFromNumRanges(),
+	scansCompleted(),
+	pointsPerFrame(POINTS_PER_FRAME_BUCKETS, NUM_BUCKETS(POINTS_PER_FRAME_BUCKETS)),
+	httpRequestsInFlight(),
+	httpRequestSeconds(LATENCY_BUCKETS, NUM_BUCKETS(LATENCY_BUCKETS))
+{
+	for (int iStage = 0; iStage < MS_NUM_STAGES; iStage++)
+	{
+		m_stageSeconds[iStage] = new MetricHistogram(LATENCY_BUCKETS, NUM_BUCKETS(LATENCY_BUCKETS));
+	}
+}
+
+Metrics::~Metrics()
+{
+	for (int iStage = 0; iStage < MS_NUM_STAGES; iStage++)
+	{
+		delete m_stageSeconds[iStage];
+	}
+}
+
+void Metrics::observeStage(Metrics::Stage stage, double seconds)
+{
+	m_stageSeconds[stage]->observe(seconds);
+}
+
+void Metrics::write(std::ostream& out)
+{
+	// Keep the full precision of the sums
+	out << std::setprecision(12);
+
+	WriteValue(out, "frames_processed_total", "counter", "Frames scanned.", framesProcessed.getValue());
+	WriteValue(out, "empty_frames_total", "counter", "Laser images where the laser wasn't detected.", emptyFrames.getValue());
+	WriteValue(out, "frame_retries_total", "counter", "Frames that were captured again.", frameRetries.getValue());
+	WriteValue(out, "rows_bad_from_color_total", "counter", "Image rows rejected because of the laser color.", rowsBadFromColor.getValue());
+	WriteValue(out, "rows_bad_from_num_ranges_total", "counter", "Image rows rejected because of too many laser ranges.", rowsBadFromNumRanges.getValue());
+	WriteValue(out, "scans_completed_total", "counter", "Scans that ran to completion.", scansCompleted.getValue());
+
+	WriteHeader(out, "points_per_frame", "histogram", "Points mapped from each laser image.");
+	pointsPerFrame.write(out, "points_per_frame", "");
+
+	WriteHeader(out, "stage_seconds", "histogram", "Time spent in each stage of a scan.  Frame stages are observed once per frame.");
+	for (int iStage = 0; iStage < MS_NUM_STAGES; iStage++)
+	{
+		m_stageSeconds[iStage]->write(out, "stage_seconds", std::string("stage=\"") + STAGE_NAMES[iStage] + "\"");
+	}
+
+	WriteHeader(out, "http_request_seconds", "histogram", "Time from the start of an HTTP request until it completed.");
+	httpRequestSeconds.write(out, "http_request_seconds", "");
+
+	WriteValue(out, "http_requests_in_flight", "gauge", "HTTP requests being processed.", httpRequestsInFlight.getValue());
+	WriteValue(out, "resident_memory_bytes", "gauge", "Resident set size of the process.", getResidentSetSize());
+}
+
+long long Metrics::getResidentSetSize()
+{
+	FILE * fp = fopen("/proc/self/statm", "r");
+	if (fp == NULL)
+	{
+		return -1;
+	}
+
+	long size = 0;
+	long resident = 0;
+	int numRead = fscanf(fp, "%ld %ld", &size, &resident);
+	fclose(fp);
+
+	if (numRead != 2)
+	{
+		return -1;
+	}
+
+	return (long long) resident * sysconf(_SC_PAGESIZE);
+}
+
+}
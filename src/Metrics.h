@@ -0,0 +1,130 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+/** A count that only goes up.  Updating it is a single atomic add so it never blocks the scan. */
+class MetricCounter
+{
+public:
+	MetricCounter();
+
+	void increment(long long amount = 1);
+	long long getValue() const;
+
+private:
+	mutable volatile long long m_value;
+};
+
+/** A value that can go up and down */
+class MetricGauge
+{
+public:
+	MetricGauge();
+
+	void add(long long amount);
+	long long getValue() const;
+
+private:
+	mutable volatile long long m_value;
+};
+
+/**
+ * Counts observations into fixed buckets.  The buckets, count, and sum are
+ * each updated atomically without a lock, so a scrape may see an observation in the
+ * count before it reaches the sum, which Prometheus tolerates.
+ */
+class MetricHistogram
+{
+public:
+	/**
+	 * @param bounds - The ascending upper bounds of the buckets, the +Inf bucket is implied.
+	 */
+	MetricHistogram(const double * bounds, int numBounds);
+	~MetricHistogram();
+
+	void observe(double value);
+
+	/** Writes the buckets, sum and count in the Prometheus text format */
+	void write(std::ostream& out, const std::string& name, const std::string& labels) const;
+
+private:
+	MetricHistogram(const MetricHistogram& ) { /* NO COPYING */ }
+	MetricHistogram& operator = (const MetricHistogram& ) { return * this; /* NO ASSIGNMENT */ }
+
+	const double * m_bounds;
+	int m_numBounds;
+
+	/** The number of observations in each bucket, not cumulative.  The last one is +Inf. */
+	volatile long long * m_buckets;
+	volatile long long m_count;
+
+	/** The sum in millionths so it can be added atomically */
+	volatile long long m_sum;
+};
+
+/**
+ * The scanner and web server metrics, exposed in the Prometheus text format
+ * at /metrics so that a fleet of scanners can be monitored.
+ */
+class Metrics
+{
+public:
+
+	/** The stages of a scan that are timed, these follow Scanner::TimingStats */
+	enum Stage { MS_ROTATION, MS_IMAGE_ACQUISITION, MS_LASER, MS_IMAGE_PROCESSING, MS_POINT_MAPPING,
+		         MS_POINT_PROCESSING, MS_LASER_MERGE, MS_FACETIZATION, MS_PLY_WRITING, MS_STL_WRITING,
+		         MS_XYZ_WRITING, MS_NUM_STAGES };
+
+	static Metrics * get();
+	static void release();
+
+	/** Records how long a stage took in seconds */
+	void observeStage(Metrics::Stage stage, double seconds);
+
+	/** Writes all of the metrics in the Prometheus text exposition format */
+	void write(std::ostream& out);
+
+	/** Returns the resident set size of the process in bytes or -1 if it is unavailable */
+	static long long getResidentSetSize();
+
+	MetricCounter framesProcessed;
+	MetricCounter emptyFrames;
+	MetricCounter frameRetries;
+	MetricCounter rowsBadFromColor;
+	MetricCounter rowsBadFromNumRanges;
+	MetricCounter scansCompleted;
+	MetricHistogram pointsPerFrame;
+	MetricGauge httpRequestsInFlight;
+	MetricHistogram httpRequestSeconds;
+
+private:
+	Metrics();
+	~Metrics();
+
+	static Metrics * m_instance;
+
+	MetricHistogram * m_stageSeconds[MS_NUM_STAGES];
+};
+
+}
@@ -0,0 +1,419 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "MmalJpegEncoder.h"
+#include "Image.h"
+#include "Logger.h"
+
+#define ENCODE_TIMEOUT_MS 5000
+#define MIN_OUTPUT_BUFFERS 3
+
+namespace freelss
+{
+
+struct MmalJpegCallbackData
+{
+	MmalJpegCallbackData() :
+		buffer(NULL),
+		bufferSize(0),
+		size(0),
+		overflow(false),
+		pool(NULL)
+	{
+		vcos_assert(vcos_semaphore_create(&complete_semaphore, "Scanner-Jpeg-sem", 0) == VCOS_SUCCESS);
+	}
+
+	~MmalJpegCallbackData()
+	{
+		vcos_semaphore_delete(&complete_semaphore);
+	}
+
+	CriticalSection cs;
+	byte * buffer;
+	unsigned bufferSize;
+	unsigned size;
+	bool overflow;
+	VCOS_SEMAPHORE_T complete_semaphore;
+	MMAL_POOL_T * pool;
+};
+
+static void ControlCallback(MMAL_PORT_T *port, MMAL_BUFFER_HEADER_T *buffer)
+{
+	if (buffer->cmd == MMAL_EVENT_ERROR)
+	{
+		ErrorLog << "Received an error event from the JPEG encoder" << Logger::ENDL;
+	}
+
+	mmal_buffer_header_release(buffer);
+}
+
+static void InputBufferCallback(MMAL_PORT_T *port, MMAL_BUFFER_HEADER_T *buffer)
+{
+	// Return the buffer to the input pool so the next image can use it
+	mmal_buffer_header_release(buffer);
+}
+
+static void OutputBufferCallback(MMAL_PORT_T *port, MMAL_BUFFER_HEADER_T *buffer)
+{
+	MmalJpegCallbackData *pData = (MmalJpegCallbackData *)port->userdata;
+
+	bool complete = false;
+
+	if (pData)
+	{
+		pData->cs.enter();
+		if (buffer->length > 0)
+		{
+			if (pData->size + buffer->length <= pData->bufferSize)
+			{
+				mmal_buffer_header_mem_lock(buffer);
+				memcpy(pData->buffer + pData->size, buffer->data + buffer->offset, buffer->length);
+				mmal_buffer_header_mem_unlock(buffer);
+			}
+			else
+			{
+				pData->overflow = true;
+			}
+
+			pData->size += buffer->length;
+		}
+		pData->cs.leave();
+
+		complete = (buffer->flags & (MMAL_BUFFER_HEADER_FLAG_FRAME_END | MMAL_BUFFER_HEADER_FLAG_EOS)) != 0;
+	}
+	else
+	{
+		ErrorLog << "!! Received a JPEG encoder buffer callback with no state" << Logger::ENDL;
+	}
+
+	mmal_buffer_header_release(buffer);
+
+	// Send one back to the port (if still open)
+	if (pData && port->is_enabled)
+	{
+		MMAL_BUFFER_HEADER_T *new_buffer = mmal_queue_get(pData->pool->queue);
+
+		if (new_buffer)
+		{
+			mmal_port_send_buffer(port, new_buffer);
+		}
+	}
+
+	if (complete)
+	{
+		vcos_semaphore_post(&(pData->complete_semaphore));
+	}
+}
+
+MmalJpegEncoder::MmalJpegEncoder() :
+	m_callbackData(NULL),
+	m_cs(),
+	m_encoder(NULL),
+	m_inputPool(NULL),
+	m_outputPool(NULL),
+	m_width(0),
+	m_height(0)
+{
+	// Do nothing
+}
+
+MmalJpegEncoder::~MmalJpegEncoder()
+{
+	disablePorts();
+
+	if (m_encoder != NULL)
+	{
+		if (m_encoder->control->is_enabled)
+		{
+			mmal_port_disable(m_encoder->control);
+		}
+
+		mmal_component_disable(m_encoder);
+		mmal_component_destroy(m_encoder);
+	}
+
+	delete m_callbackData;
+}
+
+std::string MmalJpegEncoder::getName() const
+{
+	return "MMAL image_encode";
+}
+
+void MmalJpegEncoder::initialize()
+{
+	if (m_encoder != NULL)
+	{
+		throw Exception("JPEG encoder is already initialized");
+	}
+
+	m_callbackData = new MmalJpegCallbackData();
+
+	MMAL_COMPONENT_T * encoder = NULL;
+	MMAL_STATUS_T status = mmal_component_create(MMAL_COMPONENT_DEFAULT_IMAGE_ENCODER, &encoder);
+	if (status != MMAL_SUCCESS)
+	{
+		throw Exception("Unable to create JPEG encoder component");
+	}
+
+	if (encoder->input_num == 0 || encoder->output_num == 0)
+	{
+		mmal_component_destroy(encoder);
+		throw Exception("JPEG encoder doesn't have input/output ports");
+	}
+
+	status = mmal_port_enable(encoder->control, ControlCallback);
+	if (status != MMAL_SUCCESS)
+	{
+		mmal_component_destroy(encoder);
+		throw Exception("Unable to enable JPEG encoder control port");
+	}
+
+	status = mmal_component_enable(encoder);
+	if (status != MMAL_SUCCESS)
+	{
+		mmal_port_disable(encoder->control);
+		mmal_component_destroy(encoder);
+		throw Exception("Unable to enable JPEG encoder component");
+	}
+
+	m_encoder = encoder;
+}
+
+void MmalJpegEncoder::disablePorts()
+{
+	if (m_encoder == NULL)
+	{
+		return;
+	}
+
+	MMAL_PORT_T * input = m_encoder->input[0];
+	MMAL_PORT_T * output = m_encoder->output[0];
+
+	if (input->is_enabled)
+	{
+		mmal_port_disable(input);
+	}
+
+	if (output->is_enabled)
+	{
+		mmal_port_disable(output);
+	}
+
+	if (m_inputPool != NULL)
+	{
+		mmal_port_pool_destroy(input, m_inputPool);
+		m_inputPool = NULL;
+	}
+
+	if (m_outputPool != NULL)
+	{
+		mmal_port_pool_destroy(output, m_outputPool);
+		m_outputPool = NULL;
+	}
+
+	m_width = 0;
+	m_height = 0;
+}
+
+void MmalJpegEncoder::configure(unsigned width, unsigned height)
+{
+	disablePorts();
+
+	MMAL_PORT_T * input = m_encoder->input[0];
+	MMAL_PORT_T * output = m_encoder->output[0];
+
+	// The GPU wants the frame padded to its block size and cropped back to the real size
+	MMAL_ES_FORMAT_T * format = input->format;
+	format->type = MMAL_ES_TYPE_VIDEO;
+	format->encoding = MMAL_ENCODING_RGB24;
+	format->encoding_variant = 0;
+	format->es->video.width = VCOS_ALIGN_UP(width, 32);
+	format->es->video.height = VCOS_ALIGN_UP(height, 16);
+	format->es->video.crop.x = 0;
+	format->es->video.crop.y = 0;
+	format->es->video.crop.width = width;
+	format->es->video.crop.height = height;
+
+	if (mmal_port_format_commit(input) != MMAL_SUCCESS)
+	{
+		throw Exception("Unable to set the JPEG encoder input format");
+	}
+
+	input->buffer_num = input->buffer_num_min;
+	input->buffer_size = MAX(input->buffer_size_min, input->buffer_size_recommended);
+
+	mmal_format_copy(output->format, input->format);
+	output->format->encoding = MMAL_ENCODING_JPEG;
+
+	if (mmal_port_format_commit(output) != MMAL_SUCCESS)
+	{
+		throw Exception("Unable to set the JPEG encoder output format");
+	}
+
+	output->buffer_num = MAX(output->buffer_num_min, MIN_OUTPUT_BUFFERS);
+	output->buffer_size = MAX(output->buffer_size_min, output->buffer_size_recommended);
+
+	if (mmal_port_parameter_set_uint32(output, MMAL_PARAMETER_JPEG_Q_FACTOR, JpegEncoder::QUALITY) != MMAL_SUCCESS)
+	{
+		throw Exception("Unable to set the JPEG quality");
+	}
+
+	m_inputPool = mmal_port_pool_create(input, input->buffer_num, input->buffer_size);
+	if (m_inputPool == NULL)
+	{
+		throw Exception("Failed to create buffer header pool for JPEG encoder input port");
+	}
+
+	m_outputPool = mmal_port_pool_create(output, output->buffer_num, output->buffer_size);
+	if (m_outputPool == NULL)
+	{
+		throw Exception("Failed to create buffer header pool for JPEG encoder output port");
+	}
+
+	m_callbackData->pool = m_outputPool;
+	output->userdata = (struct MMAL_PORT_USERDATA_T *) m_callbackData;
+
+	if (mmal_port_enable(input, InputBufferCallback) != MMAL_SUCCESS)
+	{
+		throw Exception("Unable to enable the JPEG encoder input port");
+	}
+
+	if (mmal_port_enable(output, OutputBufferCallback) != MMAL_SUCCESS)
+	{
+		throw Exception("Unable to enable the JPEG encoder output port");
+	}
+
+	// Send all the buffers to the encoder output port
+	int num = mmal_queue_length(m_outputPool->queue);
+	for (int q = 0; q < num; q++)
+	{
+		MMAL_BUFFER_HEADER_T *buffer = mmal_queue_get(m_outputPool->queue);
+
+		if (buffer == NULL || mmal_port_send_buffer(output, buffer) != MMAL_SUCCESS)
+		{
+			ErrorLog << "Unable to send buffer " << q << " to the JPEG encoder output port" << Logger::ENDL;
+		}
+	}
+
+	m_width = width;
+	m_height = height;
+}
+
+void MmalJpegEncoder::encode(Image& image, byte * buffer, unsigned * size)
+{
+	m_cs.enter();
+	try
+	{
+		compress(image, buffer, size);
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+	m_cs.leave();
+}
+
+void MmalJpegEncoder::compress(Image& image, byte * buffer, unsigned * size)
+{
+	if (m_encoder == NULL)
+	{
+		throw Exception("JPEG encoder is not initialized");
+	}
+
+	if (image.getNumComponents() != 3)
+	{
+		throw Exception("The MMAL JPEG encoder only supports RGB images");
+	}
+
+	unsigned width = image.getWidth();
+	unsigned height = image.getHeight();
+
+	if (width != m_width || height != m_height)
+	{
+		configure(width, height);
+	}
+
+	MMAL_BUFFER_HEADER_T * input = mmal_queue_wait(m_inputPool->queue);
+	if (input == NULL)
+	{
+		throw Exception("Unable to get a JPEG encoder input buffer");
+	}
+
+	// Copy the image into the padded input buffer
+	unsigned rowSize = width * 3;
+	unsigned stride = VCOS_ALIGN_UP(width, 32) * 3;
+	unsigned length = stride * VCOS_ALIGN_UP(height, 16);
+	if (length > input->alloc_size)
+	{
+		mmal_buffer_header_release(input);
+		throw Exception("The JPEG encoder input buffer is too small");
+	}
+
+	const unsigned char * src = image.getPixels();
+	unsigned char * dest = input->data;
+	for (unsigned iRow = 0; iRow < height; iRow++)
+	{
+		memcpy(dest, src, rowSize);
+		src += rowSize;
+		dest += stride;
+	}
+
+	input->length = length;
+	input->offset = 0;
+	input->flags = MMAL_BUFFER_HEADER_FLAG_FRAME_END | MMAL_BUFFER_HEADER_FLAG_EOS;
+	input->pts = input->dts = MMAL_TIME_UNKNOWN;
+
+	m_callbackData->cs.enter();
+	m_callbackData->buffer = buffer;
+	m_callbackData->bufferSize = * size;
+	m_callbackData->size = 0;
+	m_callbackData->overflow = false;
+	m_callbackData->cs.leave();
+
+	if (mmal_port_send_buffer(m_encoder->input[0], input) != MMAL_SUCCESS)
+	{
+		mmal_buffer_header_release(input);
+		throw Exception("Unable to send the image to the JPEG encoder");
+	}
+
+	if (vcos_semaphore_wait_timeout(&m_callbackData->complete_semaphore, ENCODE_TIMEOUT_MS) != VCOS_SUCCESS)
+	{
+		// Reset the ports so that a late callback can't write to the caller's buffer
+		disablePorts();
+		throw Exception("Timed out waiting for the JPEG encoder");
+	}
+
+	m_callbackData->cs.enter();
+	bool overflow = m_callbackData->overflow;
+	* size = m_callbackData->size;
+	m_callbackData->buffer = NULL;
+	m_callbackData->bufferSize = 0;
+	m_callbackData->cs.leave();
+
+	if (overflow)
+	{
+		throw Exception("The JPEG output buffer is too small");
+	}
+}
+
+}
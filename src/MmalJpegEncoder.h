@@ -0,0 +1,67 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "JpegEncoder.h"
+
+namespace freelss
+{
+
+// Forward declaration
+struct MmalJpegCallbackData;
+
+/** Encodes JPEG images with the GPU using the MMAL image_encode component */
+class MmalJpegEncoder : public JpegEncoder
+{
+public:
+	MmalJpegEncoder();
+	~MmalJpegEncoder();
+
+	/**
+	 * Creates the encoder component.
+	 * NOTE: This must be called once before any calls to encode.
+	 */
+	void initialize();
+
+	void encode(Image& image, byte * buffer, unsigned * size);
+
+	std::string getName() const;
+
+private:
+
+	/** Sets the port formats and buffers for images of the given size */
+	void configure(unsigned width, unsigned height);
+
+	/** Disables the ports and destroys the buffer pools */
+	void disablePorts();
+
+	void compress(Image& image, byte * buffer, unsigned * size);
+
+	MmalJpegCallbackData * m_callbackData;
+	CriticalSection m_cs;
+	MMAL_COMPONENT_T * m_encoder;
+	MMAL_POOL_T * m_inputPool;
+	MMAL_POOL_T * m_outputPool;
+	unsigned m_width;
+	unsigned m_height;
+};
+
+}
@@ -103,6 +103,7 @@ static void EncoderBufferCallback(MMAL_PORT_T *port, MMAL_BUFFER_HEADER_T *buffe
 				 }
 
 				 pData->image = &item->image;
+				 pData->image->setTimestamp(GetTimeInSeconds());
 
 				 pData->acquire = false;
 				 mappedBuffer = true;
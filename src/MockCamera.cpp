@@ -21,13 +21,23 @@
 #include "Main.h"
 #include "MockCamera.h"
 #include "Logger.h"
+#include "Thread.h"
+#include "MockTurnTable.h"
+#include "MockLaser.h"
+#include "MockGpioDevice.h"
+#include "WaveformTurnTable.h"
+#include "WaveformLaser.h"
+#include "Setup.h"
+#include "Lighting.h"
 
 namespace freelss
 {
 
 MockCamera::MockCamera() :
 	m_imageWidth(-1),
-	m_imageHeight(-1)
+	m_imageHeight(-1),
+	m_scene(),
+	m_nextFrameTime(0)
 {
 	m_name = "MockCamera";
 	setSensorProperties(3.629, 2.722, 3.6);
@@ -45,6 +55,93 @@ Image * MockCamera::acquireImage()
 {
 	std::auto_ptr<Image> image(new Image(m_imageWidth, m_imageHeight, getImageComponents()));
 
+	// Draw the simulated scanner if the rest of the hardware is simulated
+	if (!IsMockHardware())
+	{
+		image->setTimestamp(GetTimeInSeconds());
+		drawTestPattern(image.get());
+		return image.release();
+	}
+
+	// Deliver frames at the frame rate like the video camera
+	double now = GetTimeInSeconds();
+	if (now < m_nextFrameTime)
+	{
+		Thread::usleep((unsigned long) ((m_nextFrameTime - now) * 1000000.0));
+		now = m_nextFrameTime;
+	}
+
+	m_nextFrameTime = now + 1.0 / MAX(1, m_resolution.frameRate);
+
+	// Ambient light with the lighting adding to it
+	real brightness = 0.5 + Lighting::get()->getIntensity() / 200.0;
+
+	real rotation = 0;
+	bool rightLaserOn = false;
+	bool leftLaserOn = false;
+
+	image->setTimestamp(now);
+	if (!getScannerState(now, rotation, rightLaserOn, leftLaserOn))
+	{
+		drawTestPattern(image.get());
+		return image.release();
+	}
+
+	m_scene.render(* image, rotation, rightLaserOn, leftLaserOn,
+			       getSensorWidth(), getSensorHeight(), getFocalLength(), brightness);
+
+	return image.release();
+}
+
+bool MockCamera::getScannerState(double time, real& rotation, bool& rightLaserOn, bool& leftLaserOn)
+{
+	Setup * setup = Setup::get();
+	TurnTable * turnTable = TurnTable::getInstance();
+	Laser * laser = Laser::getInstance();
+
+	// The waveform backends only run on the mock device when the hardware is simulated
+	MockGpioDevice * gpio = NULL;
+	if (dynamic_cast<WaveformTurnTable *>(turnTable) != NULL || dynamic_cast<WaveformLaser *>(laser) != NULL)
+	{
+		gpio = dynamic_cast<MockGpioDevice *>(GpioDevice::get());
+	}
+
+	MockTurnTable * mockTurnTable = dynamic_cast<MockTurnTable *>(turnTable);
+	if (mockTurnTable != NULL)
+	{
+		rotation = mockTurnTable->getRotation();
+	}
+	else if (gpio != NULL && dynamic_cast<WaveformTurnTable *>(turnTable) != NULL)
+	{
+		int numSteps = gpio->getStepCount(time);
+		rotation = numSteps * 2 * PI / MAX(1, setup->stepsPerRevolution);
+	}
+	else
+	{
+		return false;
+	}
+
+	MockLaser * mockLaser = dynamic_cast<MockLaser *>(laser);
+	if (mockLaser != NULL)
+	{
+		rightLaserOn = mockLaser->isOn(Laser::RIGHT_LASER);
+		leftLaserOn = mockLaser->isOn(Laser::LEFT_LASER);
+	}
+	else if (gpio != NULL && dynamic_cast<WaveformLaser *>(laser) != NULL)
+	{
+		rightLaserOn = gpio->getValueAt(setup->rightLaserPin, time) == setup->laserOnValue;
+		leftLaserOn = gpio->getValueAt(setup->leftLaserPin, time) == setup->laserOnValue;
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+void MockCamera::drawTestPattern(Image * image)
+{
 	// Make the image black
 	unsigned rowSpacing = image->getWidth() * image->getNumComponents();
 	unsigned char * pixels = image->getPixels();
@@ -72,8 +169,6 @@ Image * MockCamera::acquireImage()
 
 		pixels += rowSpacing;
 	}
-
-	return image.release();
 }
 
 void MockCamera::releaseImage(Image * image)
@@ -91,6 +186,11 @@ void MockCamera::setFlipRedBlue(bool flip)
 	// Do nothing
 }
 
+MockScene& MockCamera::getScene()
+{
+	return m_scene;
+}
+
 int MockCamera::getImageHeight() const
 {
 	return m_imageHeight;
@@ -21,6 +21,7 @@
 #pragma once
 #include "Image.h"
 #include "Camera.h"
+#include "MockScene.h"
 
 
 namespace freelss
@@ -52,13 +53,32 @@ public:
 	void setBurstModeEnabled(bool enable);
 
 	void setFlipRedBlue(bool flip);
+
+	/** The simulated scene, which also knows the true shape of the object */
+	MockScene& getScene();
 protected:
 	void setShutterSpeed(unsigned shutterSpeedUs);
 
 private:
 
+	/** Draws the test pattern used when the camera couldn't be created */
+	void drawTestPattern(Image * image);
+
+	/**
+	 * Reads the table rotation and lasers at the given time from the simulated hardware,
+	 * or the pin trace of the mock GPIO device when the waveform backends drive it.
+	 * Returns false if the hardware isn't simulated.
+	 */
+	bool getScannerState(double time, real& rotation, bool& rightLaserOn, bool& leftLaserOn);
+
 	int m_imageWidth;
 	int m_imageHeight;
+
+	/** The scene that is drawn when the rest of the hardware is simulated too */
+	MockScene m_scene;
+
+	/** When the next frame is available, in seconds */
+	double m_nextFrameTime;
 };
 
 }
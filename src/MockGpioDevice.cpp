@@ -0,0 +1,181 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "MockGpioDevice.h"
+#include "Setup.h"
+
+/** The most pulses in a waveform, about what pigpio allows */
+#define MOCK_MAX_WAVEFORM_PULSES 6000
+
+namespace freelss
+{
+
+MockGpioDevice::MockGpioDevice() :
+	m_events(),
+	m_playedValues(),
+	m_numSteps(0),
+	m_stepPin(-1),
+	m_directionPin(-1),
+	m_enablePin(-1),
+	m_waveformEndTime(0),
+	m_cs()
+{
+	Setup * setup = Setup::get();
+	m_stepPin = setup->motorStepPin;
+	m_directionPin = setup->motorDirPin;
+	m_enablePin = setup->motorEnablePin;
+}
+
+void MockGpioDevice::addEvent(int pin, int value, double time)
+{
+	Event event;
+	event.pin = pin;
+	event.value = value ? 1 : 0;
+	event.time = time;
+
+	// Keep the events in time order, most land at the end
+	std::list<Event>::iterator it = m_events.end();
+	while (it != m_events.begin())
+	{
+		std::list<Event>::iterator prev = it;
+		--prev;
+		if (prev->time <= time)
+		{
+			break;
+		}
+
+		it = prev;
+	}
+
+	m_events.insert(it, event);
+}
+
+void MockGpioDevice::playEvents(double time)
+{
+	while (!m_events.empty() && m_events.front().time <= time)
+	{
+		playEvent(m_events.front());
+		m_events.pop_front();
+	}
+}
+
+void MockGpioDevice::playEvent(const Event& event)
+{
+	// The driver steps on the rising edge while it is enabled
+	if (event.pin == m_stepPin && event.value && getPlayedValue(m_stepPin) != 1 && getPlayedValue(m_enablePin) == 0)
+	{
+		m_numSteps += getPlayedValue(m_directionPin) == 1 ? -1 : 1;
+	}
+
+	m_playedValues[event.pin] = event.value;
+}
+
+int MockGpioDevice::getPlayedValue(int pin) const
+{
+	std::map<int, int>::const_iterator it = m_playedValues.find(pin);
+	return it != m_playedValues.end() ? it->second : -1;
+}
+
+void MockGpioDevice::setOutput(int pin, int value)
+{
+	write(pin, value);
+}
+
+void MockGpioDevice::write(int pin, int value)
+{
+	m_cs.enter();
+	try
+	{
+		addEvent(pin, value, GetTimeInSeconds());
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+
+	m_cs.leave();
+}
+
+void MockGpioDevice::sendWaveform(const std::vector<Pulse>& pulses)
+{
+	m_cs.enter();
+	try
+	{
+		// The waveform starts once the previous one is done
+		double time = MAX(GetTimeInSeconds(), m_waveformEndTime);
+		for (size_t iPulse = 0; iPulse < pulses.size(); iPulse++)
+		{
+			const Pulse& pulse = pulses[iPulse];
+			if (pulse.pin >= 0)
+			{
+				addEvent(pulse.pin, pulse.value, time);
+			}
+
+			time += pulse.delay / 1000000.0;
+		}
+
+		m_waveformEndTime = time;
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+
+	m_cs.leave();
+}
+
+bool MockGpioDevice::isWaveformBusy()
+{
+	m_cs.enter();
+	bool busy = GetTimeInSeconds() < m_waveformEndTime;
+	m_cs.leave();
+
+	return busy;
+}
+
+int MockGpioDevice::getMaxWaveformPulses()
+{
+	return MOCK_MAX_WAVEFORM_PULSES;
+}
+
+int MockGpioDevice::getValueAt(int pin, double time)
+{
+	m_cs.enter();
+	playEvents(time);
+	int value = getPlayedValue(pin);
+	m_cs.leave();
+
+	return value;
+}
+
+int MockGpioDevice::getStepCount(double time)
+{
+	m_cs.enter();
+	playEvents(time);
+	int numSteps = m_numSteps;
+	m_cs.leave();
+
+	return numSteps;
+}
+
+}
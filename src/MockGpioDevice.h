@@ -0,0 +1,103 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "GpioDevice.h"
+#include "CriticalSection.h"
+
+namespace freelss
+{
+
+/**
+ * Plays the pin changes back in time instead of driving pins so the waveform backends can be
+ * run without the Raspberry Pi.  Waveforms take as long to play as they would on the hardware.
+ * The pin changes are folded into the pin values and the step count of the simulated stepper
+ * driver as their time passes, so only the waveforms still playing are kept.
+ */
+class MockGpioDevice : public GpioDevice
+{
+public:
+
+	MockGpioDevice();
+
+	void setOutput(int pin, int value);
+	void write(int pin, int value);
+	void sendWaveform(const std::vector<Pulse>& pulses);
+	bool isWaveformBusy();
+	int getMaxWaveformPulses();
+
+	/**
+	 * Returns the value the pin had at the given time, or -1 if it wasn't written by then.
+	 * The times asked about must not go back, the changes before the last one asked about are forgotten.
+	 */
+	int getValueAt(int pin, double time);
+
+	/**
+	 * Returns the net number of steps the stepper driver on the motor pins took by the given time.
+	 * Steps count backwards while the direction pin is high and aren't counted while the enable pin is high.
+	 */
+	int getStepCount(double time);
+
+private:
+
+	/** A pin change */
+	struct Event
+	{
+		int pin;
+		int value;
+
+		/** When the pin changes, in seconds */
+		double time;
+	};
+
+	/** Records the pin change, the lock must be held */
+	void addEvent(int pin, int value, double time);
+
+	/** Folds the pin changes up to the given time into the pin values, the lock must be held */
+	void playEvents(double time);
+
+	/** Applies the pin change to the pin values and the step count, the lock must be held */
+	void playEvent(const Event& event);
+
+	/** Returns the played value of the pin or -1 if it wasn't written, the lock must be held */
+	int getPlayedValue(int pin) const;
+
+	/** The pin changes that haven't been played yet, sorted by time */
+	std::list<Event> m_events;
+
+	/** The value of each pin as of the last time asked about */
+	std::map<int, int> m_playedValues;
+
+	/** The net number of steps as of the last time asked about */
+	int m_numSteps;
+
+	/** The stepper driver pins */
+	int m_stepPin;
+	int m_directionPin;
+	int m_enablePin;
+
+	/** When the last waveform is done playing */
+	double m_waveformEndTime;
+
+	CriticalSection m_cs;
+};
+
+}
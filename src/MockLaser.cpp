@@ -0,0 +1,80 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "MockLaser.h"
+
+namespace freelss
+{
+
+MockLaser::MockLaser() :
+	m_rightLaserOn(false),
+	m_leftLaserOn(false)
+{
+	// Do nothing
+}
+
+void MockLaser::turnOn(Laser::LaserSide laser)
+{
+	if (laser == Laser::RIGHT_LASER || laser == Laser::ALL_LASERS)
+	{
+		m_rightLaserOn = true;
+	}
+
+	if (laser == Laser::LEFT_LASER || laser == Laser::ALL_LASERS)
+	{
+		m_leftLaserOn = true;
+	}
+}
+
+void MockLaser::turnOff(Laser::LaserSide laser)
+{
+	if (laser == Laser::RIGHT_LASER || laser == Laser::ALL_LASERS)
+	{
+		m_rightLaserOn = false;
+	}
+
+	if (laser == Laser::LEFT_LASER || laser == Laser::ALL_LASERS)
+	{
+		m_leftLaserOn = false;
+	}
+}
+
+bool MockLaser::isOn(Laser::LaserSide laser)
+{
+	bool on = false;
+
+	if (laser == Laser::ALL_LASERS)
+	{
+		on = m_rightLaserOn && m_leftLaserOn;
+	}
+	else if (laser == Laser::RIGHT_LASER)
+	{
+		on = m_rightLaserOn;
+	}
+	else if (laser == Laser::LEFT_LASER)
+	{
+		on = m_leftLaserOn;
+	}
+
+	return on;
+}
+
+}
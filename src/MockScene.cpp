@@ -0,0 +1,825 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "MockScene.h"
+#include "Setup.h"
+#include "Logger.h"
+
+/** How far the laser light spreads from the center of the line in pixels */
+#define MOCK_LASER_LINE_WIDTH 4.0
+
+/** The fraction of the light that the background reflects */
+#define MOCK_BACKGROUND_ALBEDO 0.1
+
+/** The fraction of the light that the object reflects */
+#define MOCK_OBJECT_ALBEDO 0.6
+
+/** Neighboring pixels further apart than this in mm see different surfaces and the laser isn't drawn between them */
+#define MOCK_MAX_SURFACE_GAP 5.0
+
+/** The distance in mm that a shadow ray starts off the surface so it doesn't hit it */
+#define MOCK_SHADOW_EPSILON 0.01
+
+namespace freelss
+{
+
+/** Turns a point in the camera's coordinates with the table into the object's coordinates */
+static Vector3 ToObject(const Vector3& v, real c, real s)
+{
+	return Vector3(v.x * c - v.z * s, v.y, v.x * s + v.z * c);
+}
+
+/** Turns a point in the object's coordinates back into the camera's coordinates */
+static Vector3 ToCamera(const Vector3& v, real c, real s)
+{
+	return Vector3(v.x * c + v.z * s, v.y, -v.x * s + v.z * c);
+}
+
+static Vector3 Subtract(const Vector3& a, const Vector3& b)
+{
+	return Vector3(a.x - b.x, a.y - b.y, a.z - b.z);
+}
+
+/** Returns the closest point to p on the triangle (Ericson, Real-Time Collision Detection 5.1.5) */
+static Vector3 ClosestPointOnTriangle(const Vector3& p, const Vector3& a, const Vector3& b, const Vector3& c)
+{
+	Vector3 ab = Subtract(b, a);
+	Vector3 ac = Subtract(c, a);
+	Vector3 ap = Subtract(p, a);
+
+	real d1 = ab.dot(ap);
+	real d2 = ac.dot(ap);
+	if (d1 <= 0 && d2 <= 0)
+	{
+		return a;
+	}
+
+	Vector3 bp = Subtract(p, b);
+	real d3 = ab.dot(bp);
+	real d4 = ac.dot(bp);
+	if (d3 >= 0 && d4 <= d3)
+	{
+		return b;
+	}
+
+	real vc = d1 * d4 - d3 * d2;
+	if (vc <= 0 && d1 >= 0 && d3 <= 0)
+	{
+		real v = d1 / (d1 - d3);
+		return Vector3(a.x + v * ab.x, a.y + v * ab.y, a.z + v * ab.z);
+	}
+
+	Vector3 cp = Subtract(p, c);
+	real d5 = ab.dot(cp);
+	real d6 = ac.dot(cp);
+	if (d6 >= 0 && d5 <= d6)
+	{
+		return c;
+	}
+
+	real vb = d5 * d2 - d1 * d6;
+	if (vb <= 0 && d2 >= 0 && d6 <= 0)
+	{
+		real w = d2 / (d2 - d6);
+		return Vector3(a.x + w * ac.x, a.y + w * ac.y, a.z + w * ac.z);
+	}
+
+	real va = d3 * d6 - d5 * d4;
+	if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+	{
+		real w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+		return Vector3(b.x + w * (c.x - b.x), b.y + w * (c.y - b.y), b.z + w * (c.z - b.z));
+	}
+
+	real denom = 1 / (va + vb + vc);
+	real v = vb * denom;
+	real w = vc * denom;
+	return Vector3(a.x + ab.x * v + ac.x * w, a.y + ab.y * v + ac.y * w, a.z + ab.z * v + ac.z * w);
+}
+
+MockScene::MockScene() :
+	m_object(""),
+	m_shape(MS_CYLINDER),
+	m_size(80),
+	m_offset(20),
+	m_noise(0),
+	m_ambientLight(0),
+	m_triangles(),
+	m_camera(),
+	m_width(0),
+	m_height(0),
+	m_sensorWidth(1),
+	m_sensorHeight(1),
+	m_focalLength(1),
+	m_depths(),
+	m_points(),
+	m_normals(),
+	m_randomState(1)
+{
+	// Do nothing
+}
+
+void MockScene::configure()
+{
+	Setup * setup = Setup::get();
+	m_size = MAX(1, setup->mockObjectSize);
+	m_offset = setup->mockObjectOffset;
+	m_noise = MAX(0, setup->mockNoise);
+	m_ambientLight = MIN(100, MAX(0, setup->mockAmbientLight)) / 100.0;
+
+	if (setup->mockObject == m_object)
+	{
+		return;
+	}
+
+	m_object = setup->mockObject;
+	m_triangles.clear();
+
+	if (m_object == "sphere")
+	{
+		m_shape = MS_SPHERE;
+	}
+	else if (m_object == "cube")
+	{
+		m_shape = MS_CUBE;
+	}
+	else if (EndsWith(m_object, ".stl") || EndsWith(m_object, ".STL"))
+	{
+		try
+		{
+			loadStl(m_object);
+			m_shape = MS_MESH;
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << "Error loading the mock object, using a cylinder instead, error=" << ex << Logger::ENDL;
+			m_shape = MS_CYLINDER;
+		}
+	}
+	else
+	{
+		m_shape = MS_CYLINDER;
+	}
+}
+
+void MockScene::loadStl(const std::string& filename)
+{
+	std::ifstream fin (filename.c_str(), std::ios::in | std::ios::binary);
+	if (!fin.is_open())
+	{
+		throw Exception("Error opening STL file: " + filename);
+	}
+
+	fin.seekg(0, std::ios::end);
+	std::streamoff fileSize = fin.tellg();
+	fin.seekg(0, std::ios::beg);
+
+	// A binary STL is an 80 byte header, the number of triangles and 50 bytes per triangle
+	char header[80];
+	uint32 numTriangles = 0;
+	fin.read(header, sizeof(header));
+	fin.read((char *) &numTriangles, sizeof(numTriangles));
+
+	std::vector<Vector3> vertices;
+	if (fin.good() && fileSize == 84 + 50 * (std::streamoff) numTriangles)
+	{
+		vertices.reserve(numTriangles * 3);
+		for (uint32 iTri = 0; iTri < numTriangles; iTri++)
+		{
+			real32 values[12];
+			uint16 attributes;
+			fin.read((char *) values, sizeof(values));
+			fin.read((char *) &attributes, sizeof(attributes));
+
+			// Skip the normal, it is computed from the vertices
+			for (int iVert = 1; iVert <= 3; iVert++)
+			{
+				vertices.push_back(Vector3(values[iVert * 3], values[iVert * 3 + 1], values[iVert * 3 + 2]));
+			}
+		}
+	}
+	else
+	{
+		// Read each vertex line of an ASCII STL
+		fin.clear();
+		fin.seekg(0, std::ios::beg);
+
+		std::string token;
+		while (fin >> token)
+		{
+			if (token == "vertex")
+			{
+				Vector3 vertex;
+				fin >> vertex.x >> vertex.y >> vertex.z;
+				vertices.push_back(vertex);
+			}
+		}
+	}
+
+	if (vertices.size() < 3 || (!fin.eof() && fin.fail()))
+	{
+		throw Exception("Error reading STL file: " + filename);
+	}
+
+	// Center it over the table and rest it on the table
+	Vector3 minPt = vertices.front();
+	Vector3 maxPt = vertices.front();
+	for (size_t iVert = 1; iVert < vertices.size(); iVert++)
+	{
+		const Vector3& v = vertices[iVert];
+		minPt = Vector3(MIN(minPt.x, v.x), MIN(minPt.y, v.y), MIN(minPt.z, v.z));
+		maxPt = Vector3(MAX(maxPt.x, v.x), MAX(maxPt.y, v.y), MAX(maxPt.z, v.z));
+	}
+
+	Vector3 shift((minPt.x + maxPt.x) / 2, minPt.y, (minPt.z + maxPt.z) / 2);
+
+	m_triangles.clear();
+	for (size_t iVert = 0; iVert + 2 < vertices.size(); iVert += 3)
+	{
+		Triangle tri;
+		tri.v0 = Subtract(vertices[iVert], shift);
+		tri.v1 = Subtract(vertices[iVert + 1], shift);
+		tri.v2 = Subtract(vertices[iVert + 2], shift);
+
+		Subtract(tri.v1, tri.v0).cross(tri.normal, Subtract(tri.v2, tri.v0));
+		real length = sqrt(tri.normal.dot(tri.normal));
+		if (length > 0)
+		{
+			tri.normal.normalize();
+			m_triangles.push_back(tri);
+		}
+	}
+
+	InfoLog << "Loaded " << m_triangles.size() << " triangles for the mock object from " << filename << Logger::ENDL;
+}
+
+void MockScene::pixelRay(unsigned col, unsigned row, Vector3& origin, Vector3& direction) const
+{
+	origin.x = (col / (real)(m_width - 1)) * m_sensorWidth - m_sensorWidth * 0.5 + m_camera.x;
+	origin.y = ((m_height - row) / (real)(m_height - 1)) * m_sensorHeight - m_sensorHeight * 0.5 + m_camera.y;
+	origin.z = m_camera.z - m_focalLength;
+
+	direction = Subtract(origin, m_camera);
+	direction.normalize();
+}
+
+bool MockScene::intersectShape(const Vector3& origin, const Vector3& direction, real& distance, Vector3& normal) const
+{
+	real radius = m_size / 2;
+	Vector3 o(origin.x - m_offset, origin.y, origin.z);
+	const Vector3& d = direction;
+
+	distance = -1;
+
+	if (m_shape == MS_SPHERE)
+	{
+		// The sphere rests on the table
+		Vector3 oc(o.x, o.y - radius, o.z);
+		real b = oc.dot(d);
+		real disc = b * b - (oc.dot(oc) - radius * radius);
+		if (disc >= 0)
+		{
+			real t = -b - sqrt(disc);
+			if (t > 0)
+			{
+				distance = t;
+				normal = Vector3((oc.x + t * d.x) / radius, (oc.y + t * d.y) / radius, (oc.z + t * d.z) / radius);
+			}
+		}
+	}
+	else if (m_shape == MS_CYLINDER)
+	{
+		// The side of the cylinder
+		real a = d.x * d.x + d.z * d.z;
+		real b = 2 * (o.x * d.x + o.z * d.z);
+		real c = o.x * o.x + o.z * o.z - radius * radius;
+		real disc = b * b - 4 * a * c;
+		if (a > 0.000001 && disc >= 0)
+		{
+			real t = (-b - sqrt(disc)) / (2 * a);
+			real y = o.y + t * d.y;
+			if (t > 0 && y >= 0 && y <= m_size)
+			{
+				distance = t;
+				normal = Vector3((o.x + t * d.x) / radius, 0, (o.z + t * d.z) / radius);
+			}
+		}
+
+		// The top of the cylinder
+		if (ABS(d.y) > 0.000001)
+		{
+			real t = (m_size - o.y) / d.y;
+			real x = o.x + t * d.x;
+			real z = o.z + t * d.z;
+			if (t > 0 && (distance < 0 || t < distance) && x * x + z * z <= radius * radius)
+			{
+				distance = t;
+				normal = Vector3(0, 1, 0);
+			}
+		}
+	}
+	else if (m_shape == MS_CUBE)
+	{
+		// Intersect the slabs of each axis and keep the face that was entered last
+		real minPt[3] = { -radius, 0, -radius };
+		real maxPt[3] = { radius, m_size, radius };
+		real from[3] = { o.x, o.y, o.z };
+		real dir[3] = { d.x, d.y, d.z };
+
+		real tNear = -HUGE_VAL;
+		real tFar = HUGE_VAL;
+		int nearAxis = 0;
+		real nearSign = 1;
+
+		for (int axis = 0; axis < 3; axis++)
+		{
+			if (ABS(dir[axis]) < 0.000001)
+			{
+				if (from[axis] < minPt[axis] || from[axis] > maxPt[axis])
+				{
+					return false;
+				}
+
+				continue;
+			}
+
+			real t1 = (minPt[axis] - from[axis]) / dir[axis];
+			real t2 = (maxPt[axis] - from[axis]) / dir[axis];
+			real sign = -1;
+			if (t1 > t2)
+			{
+				std::swap(t1, t2);
+				sign = 1;
+			}
+
+			if (t1 > tNear)
+			{
+				tNear = t1;
+				nearAxis = axis;
+				nearSign = sign;
+			}
+
+			tFar = MIN(tFar, t2);
+		}
+
+		if (tNear <= tFar && tNear > 0)
+		{
+			distance = tNear;
+			normal = Vector3(nearAxis == 0 ? nearSign : 0, nearAxis == 1 ? nearSign : 0, nearAxis == 2 ? nearSign : 0);
+		}
+	}
+
+	return distance > 0;
+}
+
+void MockScene::castRays(real tableRotation)
+{
+	real c = cos(tableRotation);
+	real s = sin(tableRotation);
+
+	#pragma omp parallel for
+	for (int iRow = 0; iRow < (int) m_height; iRow++)
+	{
+		Vector3 origin;
+		Vector3 direction;
+		Vector3 normal;
+		real distance;
+
+		for (unsigned iCol = 0; iCol < m_width; iCol++)
+		{
+			unsigned index = iRow * m_width + iCol;
+			pixelRay(iCol, iRow, origin, direction);
+
+			// Turn the ray with the table so the object stays put
+			if (intersectShape(ToObject(origin, c, s), ToObject(direction, c, s), distance, normal))
+			{
+				m_depths[index] = distance;
+				m_points[index] = Vector3(origin.x + distance * direction.x, origin.y + distance * direction.y, origin.z + distance * direction.z);
+				m_normals[index] = ToCamera(normal, c, s);
+			}
+			else
+			{
+				m_depths[index] = HUGE_VAL;
+			}
+		}
+	}
+}
+
+void MockScene::rasterize(real tableRotation)
+{
+	real c = cos(tableRotation);
+	real s = sin(tableRotation);
+	Vector3 offset(m_offset, 0, 0);
+
+	std::fill(m_depths.begin(), m_depths.end(), HUGE_VAL);
+
+	Vector3 origin;
+	Vector3 direction;
+
+	for (size_t iTri = 0; iTri < m_triangles.size(); iTri++)
+	{
+		const Triangle& tri = m_triangles[iTri];
+		Vector3 v[3];
+		v[0] = ToCamera(Vector3(tri.v0.x + offset.x, tri.v0.y, tri.v0.z), c, s);
+		v[1] = ToCamera(Vector3(tri.v1.x + offset.x, tri.v1.y, tri.v1.z), c, s);
+		v[2] = ToCamera(Vector3(tri.v2.x + offset.x, tri.v2.y, tri.v2.z), c, s);
+		Vector3 normal = ToCamera(tri.normal, c, s);
+
+		// Skip the triangles facing away from the camera
+		if (normal.dot(Subtract(v[0], m_camera)) >= 0)
+		{
+			continue;
+		}
+
+		// Project the vertices onto the sensor
+		real cols[3];
+		real rows[3];
+		bool visible = true;
+		for (int iVert = 0; iVert < 3; iVert++)
+		{
+			Vector3 d = Subtract(v[iVert], m_camera);
+			if (d.z > -0.001)
+			{
+				visible = false;
+				break;
+			}
+
+			real scale = m_focalLength / -d.z;
+			cols[iVert] = (d.x * scale / m_sensorWidth + 0.5) * (m_width - 1);
+			rows[iVert] = m_height - (d.y * scale / m_sensorHeight + 0.5) * (m_height - 1);
+		}
+
+		if (!visible)
+		{
+			continue;
+		}
+
+		int firstCol = MAX(0, (int) ceil(MIN3(cols[0], cols[1], cols[2])));
+		int lastCol = MIN((int) m_width - 1, (int) floor(MAX3(cols[0], cols[1], cols[2])));
+		int firstRow = MAX(0, (int) ceil(MIN3(rows[0], rows[1], rows[2])));
+		int lastRow = MIN((int) m_height - 1, (int) floor(MAX3(rows[0], rows[1], rows[2])));
+
+		for (int row = firstRow; row <= lastRow; row++)
+		{
+			for (int col = firstCol; col <= lastCol; col++)
+			{
+				// Inside if the pixel is on the same side of all three edges
+				real e0 = (cols[1] - cols[0]) * (row - rows[0]) - (rows[1] - rows[0]) * (col - cols[0]);
+				real e1 = (cols[2] - cols[1]) * (row - rows[1]) - (rows[2] - rows[1]) * (col - cols[1]);
+				real e2 = (cols[0] - cols[2]) * (row - rows[2]) - (rows[0] - rows[2]) * (col - cols[2]);
+				if (!((e0 >= 0 && e1 >= 0 && e2 >= 0) || (e0 <= 0 && e1 <= 0 && e2 <= 0)))
+				{
+					continue;
+				}
+
+				// Intersect the pixel's ray with the triangle's plane for the exact point
+				pixelRay(col, row, origin, direction);
+				real denominator = direction.dot(normal);
+				if (ABS(denominator) < 0.000001)
+				{
+					continue;
+				}
+
+				real distance = Subtract(v[0], origin).dot(normal) / denominator;
+				unsigned index = row * m_width + col;
+				if (distance > 0 && distance < m_depths[index])
+				{
+					m_depths[index] = distance;
+					m_points[index] = Vector3(origin.x + distance * direction.x, origin.y + distance * direction.y, origin.z + distance * direction.z);
+					m_normals[index] = normal;
+				}
+			}
+		}
+	}
+}
+
+bool MockScene::isOccluded(const Vector3& from, const Vector3& to, real tableRotation) const
+{
+	real c = cos(tableRotation);
+	real s = sin(tableRotation);
+
+	// Work in the mesh's coordinates so the triangles don't need to be moved
+	Vector3 start = ToObject(from, c, s);
+	Vector3 end = ToObject(to, c, s);
+	start.x -= m_offset;
+	end.x -= m_offset;
+
+	Vector3 dir = Subtract(end, start);
+	real length = sqrt(dir.dot(dir));
+	dir.normalize();
+
+	start = Vector3(start.x + dir.x * MOCK_SHADOW_EPSILON, start.y + dir.y * MOCK_SHADOW_EPSILON, start.z + dir.z * MOCK_SHADOW_EPSILON);
+
+	// Moller-Trumbore ray triangle intersection
+	for (size_t iTri = 0; iTri < m_triangles.size(); iTri++)
+	{
+		const Triangle& tri = m_triangles[iTri];
+		Vector3 edge1 = Subtract(tri.v1, tri.v0);
+		Vector3 edge2 = Subtract(tri.v2, tri.v0);
+
+		Vector3 p;
+		dir.cross(p, edge2);
+		real det = edge1.dot(p);
+		if (ABS(det) < 0.000001)
+		{
+			continue;
+		}
+
+		real invDet = 1 / det;
+		Vector3 t = Subtract(start, tri.v0);
+		real u = t.dot(p) * invDet;
+		if (u < 0 || u > 1)
+		{
+			continue;
+		}
+
+		Vector3 q;
+		t.cross(q, edge1);
+		real v = dir.dot(q) * invDet;
+		if (v < 0 || u + v > 1)
+		{
+			continue;
+		}
+
+		real distance = edge2.dot(q) * invDet;
+		if (distance > 0 && distance < length)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+real MockScene::nextNoise()
+{
+	// Box-Muller transform of two uniform numbers from a linear congruential generator
+	m_randomState = m_randomState * 1664525u + 1013904223u;
+	real u1 = ((m_randomState >> 8) + 1) / 16777217.0;
+
+	m_randomState = m_randomState * 1664525u + 1013904223u;
+	real u2 = (m_randomState >> 8) / 16777216.0;
+
+	return m_noise * sqrt(-2 * log(u1)) * cos(2 * PI * u2);
+}
+
+void MockScene::render(Image& image, real tableRotation, bool rightLaserOn, bool leftLaserOn,
+		               real sensorWidth, real sensorHeight, real focalLength, real brightness)
+{
+	configure();
+
+	Setup * setup = Setup::get();
+	m_camera = setup->cameraLocation;
+	m_width = image.getWidth();
+	m_height = image.getHeight();
+	m_sensorWidth = sensorWidth;
+	m_sensorHeight = sensorHeight;
+	m_focalLength = focalLength;
+
+	m_depths.resize(m_width * m_height);
+	m_points.resize(m_width * m_height);
+	m_normals.resize(m_width * m_height);
+
+	if (m_shape == MS_MESH)
+	{
+		rasterize(tableRotation);
+	}
+	else
+	{
+		castRays(tableRotation);
+	}
+
+	// The lasers that are on and the planes they draw, which contain the laser and the table's axis
+	std::vector<Vector3> lasers;
+	std::vector<Vector3> laserNormals;
+	if (rightLaserOn)
+	{
+		lasers.push_back(setup->rightLaserLocation);
+		laserNormals.push_back(setup->rightLaserPlaneNormal);
+	}
+
+	if (leftLaserOn)
+	{
+		lasers.push_back(setup->leftLaserLocation);
+		laserNormals.push_back(setup->leftLaserPlaneNormal);
+	}
+
+	for (size_t iLaser = 0; iLaser < lasers.size(); iLaser++)
+	{
+		if (!setup->haveLaserPlaneNormals)
+		{
+			Vector3 edge(lasers[iLaser].x, 0, lasers[iLaser].z);
+			lasers[iLaser].cross(laserNormals[iLaser], edge);
+		}
+
+		laserNormals[iLaser].normalize();
+	}
+
+	unsigned numComponents = image.getNumComponents();
+	unsigned char * pixels = image.getPixels();
+	int background = (int) (255 * MOCK_BACKGROUND_ALBEDO * (m_ambientLight + brightness));
+
+	Vector3 origin;
+	Vector3 direction;
+
+	for (unsigned iRow = 0; iRow < m_height; iRow++)
+	{
+		unsigned char * row = pixels + iRow * m_width * numComponents;
+		const real * depths = &m_depths[iRow * m_width];
+		const Vector3 * points = &m_points[iRow * m_width];
+		const Vector3 * normals = &m_normals[iRow * m_width];
+
+		// Light the object from the camera and everywhere with the ambient light
+		for (unsigned iCol = 0; iCol < m_width; iCol++)
+		{
+			int level = background;
+			if (depths[iCol] != HUGE_VAL)
+			{
+				pixelRay(iCol, iRow, origin, direction);
+				real facing = MAX(0, -normals[iCol].dot(direction));
+				level = (int) (255 * MOCK_OBJECT_ALBEDO * (m_ambientLight + brightness * facing));
+			}
+
+			unsigned char * pixel = row + iCol * numComponents;
+			for (unsigned iComp = 0; iComp < numComponents; iComp++)
+			{
+				pixel[iComp] = (unsigned char) MIN(255, level);
+			}
+		}
+
+		// The laser line is where the surface facing the laser crosses the laser plane
+		for (size_t iLaser = 0; iLaser < lasers.size(); iLaser++)
+		{
+			const Vector3& laser = lasers[iLaser];
+			const Vector3& laserNormal = laserNormals[iLaser];
+
+			for (unsigned iCol = 1; iCol < m_width; iCol++)
+			{
+				if (depths[iCol - 1] == HUGE_VAL || depths[iCol] == HUGE_VAL)
+				{
+					continue;
+				}
+
+				const Vector3& p0 = points[iCol - 1];
+				const Vector3& p1 = points[iCol];
+				real d0 = Subtract(p0, laser).dot(laserNormal);
+				real d1 = Subtract(p1, laser).dot(laserNormal);
+				if ((d0 < 0) == (d1 < 0))
+				{
+					continue;
+				}
+
+				Vector3 gap = Subtract(p1, p0);
+				if (gap.dot(gap) > MOCK_MAX_SURFACE_GAP * MOCK_MAX_SURFACE_GAP ||
+					normals[iCol - 1].dot(Subtract(laser, p0)) <= 0 ||
+					normals[iCol].dot(Subtract(laser, p1)) <= 0)
+				{
+					continue;
+				}
+
+				real fraction = d0 / (d0 - d1);
+				Vector3 linePoint(p0.x + gap.x * fraction, p0.y + gap.y * fraction, p0.z + gap.z * fraction);
+				if (m_shape == MS_MESH && isOccluded(linePoint, laser, tableRotation))
+				{
+					continue;
+				}
+
+				real lineCol = iCol - 1 + fraction;
+				int firstCol = MAX(0, (int) floor(lineCol - MOCK_LASER_LINE_WIDTH));
+				int lastCol = MIN((int) m_width - 1, (int) ceil(lineCol + MOCK_LASER_LINE_WIDTH));
+
+				for (int col = firstCol; col <= lastCol; col++)
+				{
+					real intensity = 1 - ABS(col - lineCol) / MOCK_LASER_LINE_WIDTH;
+					if (intensity > 0)
+					{
+						unsigned char * red = row + col * numComponents;
+						*red = (unsigned char) MIN(255, *red + (int) (255 * intensity));
+					}
+				}
+			}
+		}
+	}
+
+	// Sensor noise
+	if (m_noise > 0)
+	{
+		unsigned size = image.getPixelBufferSize();
+		for (unsigned iPx = 0; iPx < size; iPx++)
+		{
+			int value = pixels[iPx] + (int) floor(nextNoise() + 0.5);
+			pixels[iPx] = (unsigned char) MIN(255, MAX(0, value));
+		}
+	}
+}
+
+real MockScene::distanceToSurface(const Vector3& point) const
+{
+	real radius = m_size / 2;
+	Vector3 p(point.x - m_offset, point.y, point.z);
+	real distance = 0;
+
+	if (m_shape == MS_SPHERE)
+	{
+		Vector3 fromCenter(p.x, p.y - radius, p.z);
+		distance = ABS(sqrt(fromCenter.dot(fromCenter)) - radius);
+	}
+	else if (m_shape == MS_CYLINDER)
+	{
+		real radial = sqrt(p.x * p.x + p.z * p.z) - radius;
+		real vertical = MAX(p.y - m_size, -p.y);
+		if (radial <= 0 && vertical <= 0)
+		{
+			distance = MIN(-radial, -vertical);
+		}
+		else
+		{
+			real r = MAX(radial, 0);
+			real v = MAX(vertical, 0);
+			distance = sqrt(r * r + v * v);
+		}
+	}
+	else if (m_shape == MS_CUBE)
+	{
+		real dx = ABS(p.x) - radius;
+		real dy = ABS(p.y - radius) - radius;
+		real dz = ABS(p.z) - radius;
+		if (dx <= 0 && dy <= 0 && dz <= 0)
+		{
+			distance = -MAX3(dx, dy, dz);
+		}
+		else
+		{
+			real x = MAX(dx, 0);
+			real y = MAX(dy, 0);
+			real z = MAX(dz, 0);
+			distance = sqrt(x * x + y * y + z * z);
+		}
+	}
+	else if (m_shape == MS_MESH)
+	{
+		real minDistSq = HUGE_VAL;
+		for (size_t iTri = 0; iTri < m_triangles.size(); iTri++)
+		{
+			const Triangle& tri = m_triangles[iTri];
+			Vector3 diff = Subtract(p, ClosestPointOnTriangle(p, tri.v0, tri.v1, tri.v2));
+			minDistSq = MIN(minDistSq, diff.dot(diff));
+		}
+
+		distance = sqrt(minDistSq);
+	}
+
+	return distance;
+}
+
+void MockScene::measureError(const std::vector<ColoredPoint>& points, ErrorStats& stats)
+{
+	configure();
+
+	int numPoints = points.size();
+	double sum = 0;
+	double sumSq = 0;
+	real maxError = 0;
+	int numWithin1mm = 0;
+
+	#pragma omp parallel for reduction(+:sum,sumSq,numWithin1mm) reduction(max:maxError)
+	for (int iPt = 0; iPt < numPoints; iPt++)
+	{
+		const ColoredPoint& pt = points[iPt];
+		real error = distanceToSurface(Vector3(pt.x, pt.y, pt.z));
+
+		sum += error;
+		sumSq += error * error;
+		maxError = MAX(maxError, error);
+		if (error <= 1)
+		{
+			numWithin1mm++;
+		}
+	}
+
+	stats.numPoints = numPoints;
+	stats.meanError = numPoints > 0 ? sum / numPoints : 0;
+	stats.rmsError = numPoints > 0 ? sqrt(sumSq / numPoints) : 0;
+	stats.maxError = maxError;
+	stats.percentWithin1mm = numPoints > 0 ? 100.0 * numWithin1mm / numPoints : 0;
+}
+
+}
@@ -0,0 +1,145 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "Image.h"
+
+namespace freelss
+{
+
+/**
+ * Draws what the camera would see of a known object on the turn table, including
+ * the laser lines on it, so scans can be run without the hardware.  Because the object
+ * is known exactly, the scan can be compared to it to measure how accurate the scan is.
+ * The object is a sphere, cylinder, cube or STL mesh set off from the center of the table
+ * so it moves as the table turns.
+ */
+class MockScene
+{
+public:
+
+	/** How far the points of a scan are from the surface of the object */
+	struct ErrorStats
+	{
+		int numPoints;
+		real meanError;
+		real rmsError;
+		real maxError;
+
+		/** The percent of the points within 1 mm of the surface */
+		real percentWithin1mm;
+	};
+
+	MockScene();
+
+	/**
+	 * Draws the scene with the camera, lasers and object placed as they are in the setup.
+	 * @param tableRotation - The rotation of the table in radians.
+	 * @param brightness - The amount of light the lighting puts on the object, from 0 to 1.
+	 */
+	void render(Image& image, real tableRotation, bool rightLaserOn, bool leftLaserOn,
+			    real sensorWidth, real sensorHeight, real focalLength, real brightness);
+
+	/**
+	 * Measures the distance of each point to the surface of the object.  The points are
+	 * in the coordinates of the scan, with the table turned back to where it started.
+	 */
+	void measureError(const std::vector<ColoredPoint>& points, ErrorStats& stats);
+
+private:
+
+	/** The shapes that can be simulated */
+	enum Shape { MS_SPHERE, MS_CYLINDER, MS_CUBE, MS_MESH };
+
+	struct Triangle
+	{
+		Vector3 v0;
+		Vector3 v1;
+		Vector3 v2;
+		Vector3 normal;
+	};
+
+	/** Reads the object settings from the setup and loads the mesh if the object changed */
+	void configure();
+
+	/** Reads a binary or ASCII STL file and rests it on the center of the table */
+	void loadStl(const std::string& filename);
+
+	/** Finds where the ray, in the object's coordinates, first hits the analytic shape */
+	bool intersectShape(const Vector3& origin, const Vector3& direction, real& distance, Vector3& normal) const;
+
+	/** Finds the hit for every pixel by casting a ray from it into the analytic shape */
+	void castRays(real tableRotation);
+
+	/** Finds the hit for every pixel by drawing each triangle of the mesh */
+	void rasterize(real tableRotation);
+
+	/** Returns true if the mesh blocks the line between the points, given in the camera's coordinates */
+	bool isOccluded(const Vector3& from, const Vector3& to, real tableRotation) const;
+
+	/** Returns the distance from the point, in the object's coordinates, to the surface of the object */
+	real distanceToSurface(const Vector3& point) const;
+
+	/** Returns normally distributed noise with the configured standard deviation */
+	real nextNoise();
+
+	/** The back projection ray of the pixel, the same as the location mapper's */
+	void pixelRay(unsigned col, unsigned row, Vector3& origin, Vector3& direction) const;
+
+	/** The object setting that was last loaded */
+	std::string m_object;
+	Shape m_shape;
+
+	/** The diameter of the sphere and cylinder, the height of the cylinder and the width of the cube */
+	real m_size;
+
+	/** The distance of the object's center from the center of the table */
+	real m_offset;
+
+	/** The standard deviation of the noise added to each pixel */
+	real m_noise;
+
+	/** The light on everything in the scene from 0 to 1 */
+	real m_ambientLight;
+
+	/** The mesh in the object's coordinates, without the offset */
+	std::vector<Triangle> m_triangles;
+
+	/** The camera and sensor of the current frame */
+	Vector3 m_camera;
+	unsigned m_width;
+	unsigned m_height;
+	real m_sensorWidth;
+	real m_sensorHeight;
+	real m_focalLength;
+
+	/** The distance along each pixel's ray to what it sees, or HUGE_VAL if it sees the background */
+	std::vector<real> m_depths;
+
+	/** The point and surface normal each pixel sees in the camera's coordinates */
+	std::vector<Vector3> m_points;
+	std::vector<Vector3> m_normals;
+
+	/** The state of the noise generator */
+	unsigned m_randomState;
+};
+
+}
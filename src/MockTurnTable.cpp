@@ -0,0 +1,110 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "MockTurnTable.h"
+#include "Thread.h"
+#include "Setup.h"
+#include "PresetManager.h"
+#include "MotionPlanner.h"
+
+namespace freelss
+{
+
+MockTurnTable::MockTurnTable() :
+	m_planner(NULL),
+	m_stepsPerRevolution(1),
+	m_stabilityDelay(0),
+	m_stabilityDelayEnabled(true),
+	m_motorEnabled(false),
+	m_rotation(0),
+	m_moveStartTime(0),
+	m_stepTimes(),
+	m_stepRadians(0),
+	m_cs()
+{
+	Setup * setup = Setup::get();
+	m_stepsPerRevolution = MAX(1, setup->stepsPerRevolution);
+	m_stabilityDelay = PresetManager::get()->getActivePreset().stabilityDelay;
+	m_planner = MotionPlanner::createFromSetup();
+}
+
+MockTurnTable::~MockTurnTable()
+{
+	delete m_planner;
+}
+
+int MockTurnTable::rotate(real theta)
+{
+	int numSteps = (int) floor((theta / (2 * PI)) * m_stepsPerRevolution + 0.5);
+
+	std::vector<long long> stepTimes;
+	long long moveTime = m_planner->plan(ABS(numSteps), stepTimes);
+
+	m_cs.enter();
+	if (m_motorEnabled)
+	{
+		m_moveStartTime = GetTimeInSeconds();
+		m_stepTimes = stepTimes;
+		m_stepRadians = (numSteps < 0 ? -2 * PI : 2 * PI) / m_stepsPerRevolution;
+	}
+	m_cs.leave();
+
+	// Take as long as the real table would
+	long long stabilityDelay = m_stabilityDelayEnabled ? m_stabilityDelay : 0;
+	Thread::usleep(moveTime / 1000 + stabilityDelay);
+
+	m_cs.enter();
+	m_rotation += m_stepTimes.size() * m_stepRadians;
+	m_stepTimes.clear();
+	m_cs.leave();
+
+	return numSteps;
+}
+
+real MockTurnTable::getRotation()
+{
+	m_cs.enter();
+
+	real rotation = m_rotation;
+	if (!m_stepTimes.empty())
+	{
+		long long elapsed = (long long) ((GetTimeInSeconds() - m_moveStartTime) * 1000000000.0);
+		size_t numSteps = std::upper_bound(m_stepTimes.begin(), m_stepTimes.end(), elapsed) - m_stepTimes.begin();
+		rotation += numSteps * m_stepRadians;
+	}
+
+	m_cs.leave();
+
+	return rotation;
+}
+
+void MockTurnTable::setMotorEnabled(bool enabled)
+{
+	m_motorEnabled = enabled;
+	Thread::usleep(m_stabilityDelay);
+}
+
+void MockTurnTable::setStabilityDelayEnabled(bool enabled)
+{
+	m_stabilityDelayEnabled = enabled;
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "TurnTable.h"
+#include "CriticalSection.h"
+
+namespace freelss
+{
+
+class MotionPlanner;
+
+/**
+ * A simulated turn table that takes as long to turn as the real one and
+ * keeps track of where it is so the mock camera can draw the scene at that angle.
+ */
+class MockTurnTable : public TurnTable
+{
+public:
+	MockTurnTable();
+	~MockTurnTable();
+
+	/** Rotates this amount in radians, negative angles rotate backwards */
+	int rotate(real theta);
+
+	/** Enable/Disable the stepper motor */
+	void setMotorEnabled(bool enabled);
+
+	/** Sets whether rotate() waits the stability delay */
+	void setStabilityDelayEnabled(bool enabled);
+
+	/** Returns the rotation of the table at this moment in radians, including the steps taken so far of a move */
+	real getRotation();
+
+private:
+
+	/** Schedules the steps of each move */
+	MotionPlanner * m_planner;
+
+	/** The number of steps per revolution */
+	int m_stepsPerRevolution;
+
+	/** The time to sleep after rotating in microseconds */
+	int m_stabilityDelay;
+
+	/** Indicates if rotate() sleeps the stability delay */
+	bool m_stabilityDelayEnabled;
+
+	/** The table doesn't turn when the motor is disabled */
+	bool m_motorEnabled;
+
+	/** The rotation of the table before the current move */
+	real m_rotation;
+
+	/** When the current move started */
+	double m_moveStartTime;
+
+	/** The time of each step of the current move in nanoseconds from its start */
+	std::vector<long long> m_stepTimes;
+
+	/** The radians turned by each step of the current move */
+	real m_stepRadians;
+
+	/** Protects the rotation, which the camera reads while the table turns */
+	CriticalSection m_cs;
+};
+
+}
@@ -0,0 +1,109 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "MotionPlanner.h"
+#include "Setup.h"
+
+/** The speed in steps per second the motor starts and stops at when it accelerates */
+#define MOTOR_START_SPEED 200.0
+
+namespace freelss
+{
+
+MotionPlanner * MotionPlanner::createFromSetup()
+{
+	Setup * setup = Setup::get();
+
+	// The step delay and both response delays were the time of a step before steps were scheduled
+	double maxSpeed = 1000000.0 / MAX(1, setup->motorStepDelay + 2 * setup->motorResponseDelay);
+	MotionPlanner::Profile profile = setup->motorSCurve ? MotionPlanner::MP_S_CURVE : MotionPlanner::MP_TRAPEZOIDAL;
+
+	return new MotionPlanner(profile, MOTOR_START_SPEED, maxSpeed, setup->motorAcceleration);
+}
+
+MotionPlanner::MotionPlanner(MotionPlanner::Profile profile, double startSpeed, double maxSpeed, double acceleration) :
+	m_profile(profile),
+	m_startSpeed(MIN(startSpeed, maxSpeed)),
+	m_maxSpeed(maxSpeed),
+	m_rampSteps(0)
+{
+	if (m_maxSpeed <= 0)
+	{
+		throw Exception("The maximum motor speed must be positive");
+	}
+
+	if (acceleration <= 0 || m_startSpeed <= 0)
+	{
+		m_profile = MP_CONSTANT;
+	}
+
+	if (m_profile != MP_CONSTANT)
+	{
+		// From v^2 = v0^2 + 2as
+		m_rampSteps = (m_maxSpeed * m_maxSpeed - m_startSpeed * m_startSpeed) / (2 * acceleration);
+
+		// The steepest part of the smoothstep is 1.5 times its average slope so stretch
+		// the ramp for the peak acceleration to be about the same as the trapezoid's
+		if (m_profile == MP_S_CURVE)
+		{
+			m_rampSteps *= 1.5;
+		}
+	}
+}
+
+double MotionPlanner::getSpeed(double stepsFromEnd) const
+{
+	if (m_profile == MP_CONSTANT || stepsFromEnd >= m_rampSteps)
+	{
+		return m_maxSpeed;
+	}
+
+	double x = stepsFromEnd / m_rampSteps;
+
+	if (m_profile == MP_TRAPEZOIDAL)
+	{
+		return sqrt(m_startSpeed * m_startSpeed + (m_maxSpeed * m_maxSpeed - m_startSpeed * m_startSpeed) * x);
+	}
+
+	// MP_S_CURVE
+	return m_startSpeed + (m_maxSpeed - m_startSpeed) * x * x * (3 - 2 * x);
+}
+
+long long MotionPlanner::plan(int numSteps, std::vector<long long>& stepTimes) const
+{
+	stepTimes.resize(MAX(numSteps, 0));
+
+	double time = 0;
+	for (int iStep = 0; iStep < numSteps; iStep++)
+	{
+		stepTimes[iStep] = (long long) (time * 1000000000.0 + 0.5);
+
+		// Short moves never reach full speed and decelerate as soon as they reach the middle
+		double stepsFromEnd = MIN(iStep, numSteps - 1 - iStep);
+
+		// The time until the next step
+		time += 1.0 / getSpeed(stepsFromEnd);
+	}
+
+	return (long long) (time * 1000000000.0 + 0.5);
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+/**
+ * Plans the timing of the steps of a stepper motor move so that the motor
+ * accelerates up to speed and decelerates to a stop instead of starting and
+ * stopping at full speed.  The schedule is computed before the move starts.
+ */
+class MotionPlanner
+{
+public:
+
+	/** The shape of the acceleration and deceleration ramps */
+	enum Profile { MP_CONSTANT /**< No ramps, every step is at the maximum speed */,
+		           MP_TRAPEZOIDAL /**< Constant acceleration */,
+		           MP_S_CURVE /**< Acceleration eases in and out to limit jerk */
+	             };
+
+	/**
+	 * @param profile - The shape of the ramps.
+	 * @param startSpeed - The speed the motor can start and stop at without ramping in steps per second.
+	 * @param maxSpeed - The cruising speed in steps per second.
+	 * @param acceleration - The acceleration of the trapezoidal profile in steps per second squared.
+	 */
+	MotionPlanner(MotionPlanner::Profile profile, double startSpeed, double maxSpeed, double acceleration);
+
+	/** Creates the planner for the turn table motor from the setup, the caller deletes it */
+	static MotionPlanner * createFromSetup();
+
+	/**
+	 * Computes when each step should be taken relative to the first one.
+	 * @param numSteps - The number of steps in the move.
+	 * @param stepTimes - Set to the time of each step in nanoseconds, the first one is 0.
+	 * @return The time from the first step until the move is complete in nanoseconds.
+	 */
+	long long plan(int numSteps, std::vector<long long>& stepTimes) const;
+
+private:
+
+	/** Returns the speed in steps per second at the given number of steps from the start or end of the move */
+	double getSpeed(double stepsFromEnd) const;
+
+	Profile m_profile;
+	double m_startSpeed;
+	double m_maxSpeed;
+
+	/** The number of steps it takes to ramp up to the maximum speed */
+	double m_rampSteps;
+};
+
+}
@@ -0,0 +1,171 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "PigpioGpioDevice.h"
+#include "Thread.h"
+#include "Logger.h"
+
+#ifdef PIGPIO
+#include <pigpio.h>
+
+/** The time to sleep between checks of whether the queued waveform has started, in microseconds */
+#define WAVEFORM_POLL_DELAY 500
+
+namespace freelss
+{
+
+PigpioGpioDevice::PigpioGpioDevice() :
+	m_sendingWave(-1),
+	m_queuedWave(-1)
+{
+	// Leave the signals to the application
+	gpioCfgSetInternals(gpioCfgGetInternals() | PI_CFG_NOSIGHANDLER);
+
+	int version = gpioInitialise();
+	if (version < 0)
+	{
+		throw Exception("Error initializing pigpio");
+	}
+
+	InfoLog << "Initialized pigpio version " << version << Logger::ENDL;
+}
+
+PigpioGpioDevice::~PigpioGpioDevice()
+{
+	gpioWaveTxStop();
+	gpioTerminate();
+}
+
+unsigned PigpioGpioDevice::toGpio(int pin)
+{
+	int gpio = wpiPinToGpio(pin);
+	if (gpio < 0)
+	{
+		throw Exception("Invalid GPIO pin: " + ToString(pin));
+	}
+
+	return (unsigned) gpio;
+}
+
+void PigpioGpioDevice::setOutput(int pin, int value)
+{
+	unsigned gpio = toGpio(pin);
+	gpioSetMode(gpio, PI_OUTPUT);
+	gpioWrite(gpio, value ? 1 : 0);
+}
+
+void PigpioGpioDevice::write(int pin, int value)
+{
+	gpioWrite(toGpio(pin), value ? 1 : 0);
+}
+
+void PigpioGpioDevice::deleteCompleteWaveforms()
+{
+	// The queued waveform starts once the one being played is done
+	if (m_queuedWave >= 0 && (gpioWaveTxAt() == m_queuedWave || !gpioWaveTxBusy()))
+	{
+		gpioWaveDelete(m_sendingWave);
+		m_sendingWave = m_queuedWave;
+		m_queuedWave = -1;
+	}
+
+	if (m_sendingWave >= 0 && m_queuedWave < 0 && !gpioWaveTxBusy())
+	{
+		gpioWaveDelete(m_sendingWave);
+		m_sendingWave = -1;
+	}
+}
+
+void PigpioGpioDevice::sendWaveform(const std::vector<Pulse>& pulses)
+{
+	if (pulses.empty())
+	{
+		return;
+	}
+
+	// Only one waveform can wait behind the one being played
+	deleteCompleteWaveforms();
+	while (m_queuedWave >= 0)
+	{
+		Thread::usleep(WAVEFORM_POLL_DELAY);
+		deleteCompleteWaveforms();
+	}
+
+	std::vector<gpioPulse_t> wave(pulses.size());
+	for (size_t iPulse = 0; iPulse < pulses.size(); iPulse++)
+	{
+		const Pulse& pulse = pulses[iPulse];
+		uint32_t bit = pulse.pin >= 0 ? 1u << toGpio(pulse.pin) : 0;
+
+		wave[iPulse].gpioOn = pulse.value ? bit : 0;
+		wave[iPulse].gpioOff = pulse.value ? 0 : bit;
+		wave[iPulse].usDelay = pulse.delay;
+	}
+
+	gpioWaveAddNew();
+	if (gpioWaveAddGeneric(wave.size(), &wave[0]) < 0)
+	{
+		throw Exception("Error adding the pulses to the waveform");
+	}
+
+	int waveId = gpioWaveCreate();
+	if (waveId < 0)
+	{
+		throw Exception("Error creating the waveform: " + ToString(waveId));
+	}
+
+	// Sync mode starts it after the current waveform instead of cutting it off
+	if (gpioWaveTxSend(waveId, PI_WAVE_MODE_ONE_SHOT_SYNC) < 0)
+	{
+		gpioWaveDelete(waveId);
+		throw Exception("Error sending the waveform");
+	}
+
+	if (m_sendingWave < 0)
+	{
+		m_sendingWave = waveId;
+	}
+	else
+	{
+		m_queuedWave = waveId;
+	}
+}
+
+bool PigpioGpioDevice::isWaveformBusy()
+{
+	bool busy = gpioWaveTxBusy() != 0;
+	if (!busy)
+	{
+		deleteCompleteWaveforms();
+	}
+
+	return busy;
+}
+
+int PigpioGpioDevice::getMaxWaveformPulses()
+{
+	// Leave room for a second waveform to be queued behind the one being played
+	return gpioWaveGetMaxPulses() / 2;
+}
+
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "GpioDevice.h"
+
+namespace freelss
+{
+
+/**
+ * Plays waveforms with the DMA engine through the pigpio library so the pulses
+ * are timed to the microsecond without the CPU.  Only built when PIGPIO is defined.
+ */
+class PigpioGpioDevice : public GpioDevice
+{
+public:
+	PigpioGpioDevice();
+	~PigpioGpioDevice();
+
+	void setOutput(int pin, int value);
+	void write(int pin, int value);
+	void sendWaveform(const std::vector<Pulse>& pulses);
+	bool isWaveformBusy();
+	int getMaxWaveformPulses();
+
+private:
+
+	/** Converts the wiringPi pin number to the Broadcom GPIO number that pigpio uses */
+	static unsigned toGpio(int pin);
+
+	/** Deletes the waveforms that are done playing */
+	void deleteCompleteWaveforms();
+
+	/** The waveform being played or -1 */
+	int m_sendingWave;
+
+	/** The waveform that plays after the one being played or -1 */
+	int m_queuedWave;
+};
+
+}
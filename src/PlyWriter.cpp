@@ -23,12 +23,17 @@
 #include "Preset.h"
 #include "IWriter.h"
 #include "Logger.h"
+#include "FloatFormatter.h"
+
+#define PLY_BUFFER_SIZE (256 * 1024)
 
 namespace freelss
 {
 
 PlyWriter::PlyWriter() :
 		m_writer(NULL),
+		m_buffer(PLY_BUFFER_SIZE),
+		m_bufferSize(0),
 		m_totalNumPoints(0),
 		m_totalNumFaces(0),
 		m_numPointsWritten(0),
@@ -55,6 +60,7 @@ void PlyWriter::setDataFormat(PlyDataFormat dataRepresentation)
 void PlyWriter::begin(IWriter * writer)
 {
 	m_writer = writer;
+	m_bufferSize = 0;
 
 	InfoLog << "Writing to PLY file..." << Logger::ENDL;
 
@@ -92,7 +98,7 @@ void PlyWriter::begin(IWriter * writer)
 	sstr << "end_header" << std::endl;
 
 	std::string header = sstr.str();
-	m_writer->write(header.c_str(), header.size());
+	write(header.c_str(), header.size());
 }
 
 void PlyWriter::writeFaces(const FaceMap& faces)
@@ -115,13 +121,23 @@ void PlyWriter::writeAsciiFaces(const FaceMap& faces)
 {
 	const std::vector<unsigned>& triangles = faces.triangles;
 
+	const size_t maxRecordSize = 2 + 3 * 11;
+
 	for (size_t idx = 0; idx < triangles.size(); idx += 3)
 	{
-		std::stringstream sstr;
-		sstr << "3 " << triangles[idx] << " " << triangles[idx + 1] << " " << triangles[idx + 2] << std::endl;
+		char * start = reserve(maxRecordSize);
+		char * out = start;
+
+		* out++ = '3';
+		* out++ = ' ';
+		out += FloatFormatter::formatUnsigned(out, triangles[idx]);
+		* out++ = ' ';
+		out += FloatFormatter::formatUnsigned(out, triangles[idx + 1]);
+		* out++ = ' ';
+		out += FloatFormatter::formatUnsigned(out, triangles[idx + 2]);
+		* out++ = '\n';
 
-		std::string data = sstr.str();
-		m_writer->write(data.c_str(), data.size());
+		unreserve(maxRecordSize - (out - start));
 	}
 }
 
@@ -129,6 +145,8 @@ void PlyWriter::writeBinaryFaces(const FaceMap& faces)
 {
 	const std::vector<unsigned>& triangles = faces.triangles;
 
+	const size_t recordSize = sizeof(uint8) + sizeof(uint32) * 3;
+
 	for (size_t idx = 0; idx < triangles.size(); idx += 3)
 	{
 		uint8 numVert = 3;
@@ -136,14 +154,15 @@ void PlyWriter::writeBinaryFaces(const FaceMap& faces)
 		uint32 v2 = triangles[idx + 1];
 		uint32 v3 = triangles[idx + 2];
 
-		m_writer->write((const char *)&numVert, sizeof(numVert));
-		m_writer->write((const char *)&v1, sizeof(v1));
-		m_writer->write((const char *)&v2, sizeof(v2));
-		m_writer->write((const char *)&v3, sizeof(v3));
+		char * out = reserve(recordSize);
+		memcpy(out, &numVert, sizeof(numVert)); out += sizeof(numVert);
+		memcpy(out, &v1, sizeof(v1)); out += sizeof(v1);
+		memcpy(out, &v2, sizeof(v2)); out += sizeof(v2);
+		memcpy(out, &v3, sizeof(v3));
 	}
 }
 
-void PlyWriter::writePoints(ColoredPoint * points, int numPoints)
+void PlyWriter::writePoints(const ColoredPoint * points, int numPoints)
 {
 	// Check the number of points
 	if (m_numPointsWritten + numPoints > m_totalNumPoints)
@@ -167,24 +186,44 @@ void PlyWriter::writePoints(ColoredPoint * points, int numPoints)
 	m_numPointsWritten += numPoints;
 }
 
-void PlyWriter::writeAsciiPoints(ColoredPoint * points, int numPoints)
+void PlyWriter::writeAsciiPoints(const ColoredPoint * points, int numPoints)
 {
+	const size_t maxRecordSize = 6 * (FloatFormatter::MAX_SHORTEST_LENGTH + 1) + 3 * 4;
+
 	for (int iPt = 0; iPt < numPoints; iPt++)
 	{
 		const ColoredPoint & point = points[iPt];
 
-		std::stringstream sstr;
-		sstr << point.x << " " << point.y << " " << point.z << " "
-			 << point.normal.x << " " << point.normal.y << " " << point.normal.z << " "
-			 << (int)point.r << " " << (int)point.g << " " << (int)point.b << std::endl;
+		char * start = reserve(maxRecordSize);
+		char * out = start;
+
+		out += FloatFormatter::formatShortest(out, point.x);
+		* out++ = ' ';
+		out += FloatFormatter::formatShortest(out, point.y);
+		* out++ = ' ';
+		out += FloatFormatter::formatShortest(out, point.z);
+		* out++ = ' ';
+		out += FloatFormatter::formatShortest(out, point.normal.x);
+		* out++ = ' ';
+		out += FloatFormatter::formatShortest(out, point.normal.y);
+		* out++ = ' ';
+		out += FloatFormatter::formatShortest(out, point.normal.z);
+		* out++ = ' ';
+		out += FloatFormatter::formatUnsigned(out, point.r);
+		* out++ = ' ';
+		out += FloatFormatter::formatUnsigned(out, point.g);
+		* out++ = ' ';
+		out += FloatFormatter::formatUnsigned(out, point.b);
+		* out++ = '\n';
 
-		std::string data = sstr.str();
-		m_writer->write(data.c_str(), data.size());
+		unreserve(maxRecordSize - (out - start));
 	}
 }
 
-void PlyWriter::writeBinaryPoints(ColoredPoint * points, int numPoints)
+void PlyWriter::writeBinaryPoints(const ColoredPoint * points, int numPoints)
 {
+	const size_t recordSize = sizeof(real32) * 6 + sizeof(unsigned char) * 3;
+
 	for (int iPt = 0; iPt < numPoints; iPt++)
 	{
 		const ColoredPoint & point = points[iPt];
@@ -205,20 +244,23 @@ void PlyWriter::writeBinaryPoints(ColoredPoint * points, int numPoints)
 		//
 		// Write the record
 		//
-		m_writer->write((const char *)&x, sizeof(x));
-		m_writer->write((const char *)&y, sizeof(y));
-		m_writer->write((const char *)&z, sizeof(z));
-		m_writer->write((const char *)&nx, sizeof(nx));
-		m_writer->write((const char *)&ny, sizeof(ny));
-		m_writer->write((const char *)&nz, sizeof(nz));
-		m_writer->write((const char *)&r, sizeof(r));
-		m_writer->write((const char *)&g, sizeof(g));
-		m_writer->write((const char *)&b, sizeof(b));
+		char * out = reserve(recordSize);
+		memcpy(out, &x, sizeof(x)); out += sizeof(x);
+		memcpy(out, &y, sizeof(y)); out += sizeof(y);
+		memcpy(out, &z, sizeof(z)); out += sizeof(z);
+		memcpy(out, &nx, sizeof(nx)); out += sizeof(nx);
+		memcpy(out, &ny, sizeof(ny)); out += sizeof(ny);
+		memcpy(out, &nz, sizeof(nz)); out += sizeof(nz);
+		* out++ = r;
+		* out++ = g;
+		* out = b;
 	}
 }
 
 void PlyWriter::end()
 {
+	flush();
+
 	// Ensure that all of the points were written
 	if (m_totalNumPoints != m_numPointsWritten)
 	{
@@ -228,4 +270,41 @@ void PlyWriter::end()
 	}
 }
 
+char * PlyWriter::reserve(size_t len)
+{
+	if (m_bufferSize + len > m_buffer.size())
+	{
+		flush();
+
+		if (len > m_buffer.size())
+		{
+			m_buffer.resize(len);
+		}
+	}
+
+	char * out = &m_buffer[m_bufferSize];
+	m_bufferSize += len;
+
+	return out;
+}
+
+void PlyWriter::unreserve(size_t len)
+{
+	m_bufferSize -= len;
+}
+
+void PlyWriter::write(const char * data, size_t len)
+{
+	memcpy(reserve(len), data, len);
+}
+
+void PlyWriter::flush()
+{
+	if (m_bufferSize > 0)
+	{
+		m_writer->write(&m_buffer[0], m_bufferSize);
+		m_bufferSize = 0;
+	}
+}
+
 }
@@ -34,17 +34,31 @@ public:
 	void setTotalNumPoints(int totalNumPoints);
 	void setTotalNumFacesFromFaceMap(const FaceMap& faces);
 	void begin(IWriter * writer);
-	void writePoints(ColoredPoint * points, int numPoints);
+	void writePoints(const ColoredPoint * points, int numPoints);
 	void writeFaces(const FaceMap& faces);
 	void end();
 private:
 
-	void writeAsciiPoints(ColoredPoint * points, int numPoints);
-	void writeBinaryPoints(ColoredPoint * points, int numPoints);
+	void writeAsciiPoints(const ColoredPoint * points, int numPoints);
+	void writeBinaryPoints(const ColoredPoint * points, int numPoints);
 	void writeAsciiFaces(const FaceMap& faces);
 	void writeBinaryFaces(const FaceMap& faces);
 
+	/** Returns room for len bytes at the end of the write buffer, flushing it first if needed */
+	char * reserve(size_t len);
+
+	/** Gives back the unused len bytes at the end of the last reservation */
+	void unreserve(size_t len);
+
+	/** Copies the data to the write buffer */
+	void write(const char * data, size_t len);
+
+	/** Hands the contents of the write buffer to the writer */
+	void flush();
+
 	IWriter * m_writer;
+	std::vector<char> m_buffer;
+	size_t m_bufferSize;
 	int m_totalNumPoints;
 	int m_totalNumFaces;
 	int m_numPointsWritten;
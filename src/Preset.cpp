@@ -35,6 +35,12 @@ Preset::Preset() :
 	maxTriangleEdgeLength(12), // 12mm
 	numLaserRowBins(4),
 	stabilityDelay(100000),   // 100ms
+	enableSettleDetection(false),
+	settleThreshold(0.5),     // 0.5% of the image
+	continuousRotation(false),
+	continuousRotationSpeed(3), // 3 degrees per second
+	dualLaserSingleCapture(false),
+	backgroundInterval(1),
 	id(-1),
 	framesPerRevolution(800),
 	generateXyz (false),
@@ -44,6 +50,7 @@ Preset::Preset() :
 	enableBurstModeForStillImages(false),
 	noiseRemovalSetting(NoiseRemover::NRS_MEDIUM),
 	imageThresholdMode(ImageProcessor::THM_MEDIUM),
+	peakEstimator(ImageProcessor::PE_CENTER_OF_MASS),
 	groundPlaneHeight(0),
 	laserMergeAction (LMA_PREFER_RIGHT_LASER),
 	plyDataFormat(PLY_BINARY),
@@ -63,6 +70,12 @@ void Preset::encodeProperties(std::vector<Property>& properties, bool isActivePr
 	properties.push_back(Property("presets." + name + ".maxTriangleEdgeLength", ToString(maxTriangleEdgeLength)));
 	properties.push_back(Property("presets." + name + ".numLaserRowBins", ToString(numLaserRowBins)));
 	properties.push_back(Property("presets." + name + ".stabilityDelay", ToString(stabilityDelay)));
+	properties.push_back(Property("presets." + name + ".enableSettleDetection", ToString(enableSettleDetection)));
+	properties.push_back(Property("presets." + name + ".settleThreshold", ToString(settleThreshold)));
+	properties.push_back(Property("presets." + name + ".continuousRotation", ToString(continuousRotation)));
+	properties.push_back(Property("presets." + name + ".continuousRotationSpeed", ToString(continuousRotationSpeed)));
+	properties.push_back(Property("presets." + name + ".dualLaserSingleCapture", ToString(dualLaserSingleCapture)));
+	properties.push_back(Property("presets." + name + ".backgroundInterval", ToString(backgroundInterval)));
 	properties.push_back(Property("presets." + name + ".framesPerRevolution", ToString(framesPerRevolution)));
 	properties.push_back(Property("presets." + name + ".generateXyz", ToString(generateXyz)));
 	properties.push_back(Property("presets." + name + ".generateStl", ToString(generateStl)));
@@ -74,6 +87,7 @@ void Preset::encodeProperties(std::vector<Property>& properties, bool isActivePr
 	properties.push_back(Property("presets." + name + ".createBaseForObject", ToString(createBaseForObject)));
 	properties.push_back(Property("presets." + name + ".noiseRemovalSetting", ToString((int)noiseRemovalSetting)));
 	properties.push_back(Property("presets." + name + ".imageThresholdMode", ToString((int)imageThresholdMode)));
+	properties.push_back(Property("presets." + name + ".peakEstimator", ToString((int)peakEstimator)));
 	properties.push_back(Property("presets." + name + ".cameraExposureTime", ToString((int)cameraExposureTime)));
 
 	if (isActivePreset)
@@ -130,6 +144,30 @@ void Preset::decodeProperties(const std::vector<Property>& properties, const std
 		{
 			stabilityDelay = ToInt(prop.value);
 		}
+		else if (prop.name == prefix + name + ".enableSettleDetection")
+		{
+			enableSettleDetection = ToBool(prop.value);
+		}
+		else if (prop.name == prefix + name + ".settleThreshold")
+		{
+			settleThreshold = ToReal(prop.value);
+		}
+		else if (prop.name == prefix + name + ".continuousRotation")
+		{
+			continuousRotation = ToBool(prop.value);
+		}
+		else if (prop.name == prefix + name + ".continuousRotationSpeed")
+		{
+			continuousRotationSpeed = ToReal(prop.value);
+		}
+		else if (prop.name == prefix + name + ".dualLaserSingleCapture")
+		{
+			dualLaserSingleCapture = ToBool(prop.value);
+		}
+		else if (prop.name == prefix + name + ".backgroundInterval")
+		{
+			backgroundInterval = ToInt(prop.value);
+		}
 		else if (prop.name == prefix + name + ".active")
 		{
 			isActivePreset = ToInt(prop.value) == 1;
@@ -178,6 +216,10 @@ void Preset::decodeProperties(const std::vector<Property>& properties, const std
 		{
 			imageThresholdMode = (ImageProcessor::ThresholdMode) ToInt(prop.value);
 		}
+		else if (prop.name == prefix + name + ".peakEstimator")
+		{
+			peakEstimator = (ImageProcessor::PeakEstimator) ToInt(prop.value);
+		}
 		else if (prop.name == prefix + name + ".cameraExposureTime")
 		{
 			cameraExposureTime = (CameraExposureTime) ToInt(prop.value);
@@ -62,6 +62,12 @@ public:
 	real maxTriangleEdgeLength;
 	int numLaserRowBins;
 	int stabilityDelay;
+	bool enableSettleDetection;
+	real settleThreshold;
+	bool continuousRotation;
+	real continuousRotationSpeed;
+	bool dualLaserSingleCapture;
+	int backgroundInterval;
 	int id;
 	int framesPerRevolution;
 	bool generateXyz;
@@ -71,6 +77,7 @@ public:
 	bool enableBurstModeForStillImages;
 	NoiseRemover::Setting noiseRemovalSetting;
 	ImageProcessor::ThresholdMode imageThresholdMode;
+	ImageProcessor::PeakEstimator peakEstimator;
 	real groundPlaneHeight;
 	LaserMergeAction laserMergeAction;
 	PlyDataFormat plyDataFormat;
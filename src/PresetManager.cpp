@@ -96,6 +96,48 @@ void PresetManager::removeActivePreset()
 	m_activePresetIndex = 0;
 }
 
+Preset * PresetManager::getPreset(int presetId)
+{
+	for (size_t iPro = 0; iPro < m_presets.size(); iPro++)
+	{
+		if (m_presets[iPro].id == presetId)
+		{
+			return &m_presets[iPro];
+		}
+	}
+
+	return NULL;
+}
+
+void PresetManager::removePreset(int presetId)
+{
+	// Don't allow the last preset to be removed
+	if (m_presets.size() <= 1)
+	{
+		return;
+	}
+
+	for (size_t iPro = 0; iPro < m_presets.size(); iPro++)
+	{
+		if (m_presets[iPro].id == presetId)
+		{
+			m_presets.erase(m_presets.begin() + iPro);
+
+			// Keep the same preset active or make the first preset the new active one
+			if (m_activePresetIndex == (int) iPro)
+			{
+				m_activePresetIndex = 0;
+			}
+			else if (m_activePresetIndex > (int) iPro)
+			{
+				m_activePresetIndex--;
+			}
+
+			break;
+		}
+	}
+}
+
 int PresetManager::addPreset(const Preset& inPreset)
 {
 	Preset preset = inPreset;
@@ -44,6 +44,12 @@ public:
 	/** Removes the active preset */
 	void removeActivePreset();
 
+	/** Returns the preset with the given ID or NULL if there isn't one */
+	Preset * getPreset(int presetId);
+
+	/** Removes the preset with the given ID.  The last preset can't be removed. */
+	void removePreset(int presetId);
+
 	/** Returns the presets */
 	const std::vector<Preset>& getPresets();
 
@@ -26,9 +26,21 @@ namespace freelss
 {
 
 
+const real Progress::PUBLISH_STEP = 0.5f;
+
+ProgressListener::~ProgressListener()
+{
+	// Do nothing
+}
+
 Progress::Progress() :
 	m_percent(0),
+	m_publishedPercent(0),
 	m_label(""),
+	m_error(""),
+	m_running(false),
+	m_details(),
+	m_listener(NULL),
 	m_cs()
 {
 	// Do nothing
@@ -57,19 +69,122 @@ std::string Progress::getLabel()
 	return out;
 }
 
+std::string Progress::getError()
+{
+	std::string out;
+
+	m_cs.enter();
+	out = m_error;
+	m_cs.leave();
+
+	return out;
+}
+
+bool Progress::isRunning()
+{
+	bool out;
+
+	m_cs.enter();
+	out = m_running;
+	m_cs.leave();
+
+	return out;
+}
+
+std::map<std::string, real> Progress::getDetails()
+{
+	std::map<std::string, real> out;
+
+	m_cs.enter();
+	out = m_details;
+	m_cs.leave();
+
+	return out;
+}
+
 void Progress::setPercent(real percent)
 {
 	m_cs.enter();
 	m_percent = percent;
+
+	// Only tell the listener about changes that are big enough to show or that start or finish the task
+	bool changed = ABS(percent - m_publishedPercent) >= PUBLISH_STEP ||
+			      (percent != m_publishedPercent && (percent <= 0 || percent >= 100));
+
+	if (changed)
+	{
+		m_publishedPercent = percent;
+	}
+
 	m_cs.leave();
+
+	if (changed)
+	{
+		notify();
+	}
 }
 
 void Progress::setLabel(const std::string& label)
 {
-	m_cs.enter();
 	InfoLog << label << "..." << Logger::ENDL;
+
+	m_cs.enter();
 	m_label = label;
 	m_cs.leave();
+
+	notify();
+}
+
+void Progress::setError(const std::string& error)
+{
+	m_cs.enter();
+	bool changed = m_error != error;
+	m_error = error;
+	m_cs.leave();
+
+	if (changed)
+	{
+		notify();
+	}
+}
+
+void Progress::setRunning(bool running)
+{
+	m_cs.enter();
+	bool changed = m_running != running;
+	m_running = running;
+	m_cs.leave();
+
+	if (changed)
+	{
+		notify();
+	}
+}
+
+void Progress::setDetail(const std::string& name, real value)
+{
+	m_cs.enter();
+	m_details[name] = value;
+	m_cs.leave();
+}
+
+void Progress::setListener(ProgressListener * listener)
+{
+	m_cs.enter();
+	m_listener = listener;
+	m_cs.leave();
+}
+
+void Progress::notify()
+{
+	m_cs.enter();
+	ProgressListener * listener = m_listener;
+	m_cs.leave();
+
+	if (listener != NULL)
+	{
+		listener->progressChanged(* this);
+	}
 }
 
 }
@@ -25,6 +25,21 @@
 namespace freelss
 {
 
+class Progress;
+
+/** Receives notifications of meaningful changes to a Progress object */
+class ProgressListener
+{
+public:
+	virtual ~ProgressListener();
+
+	/**
+	 * Called on the thread that changed the progress.  Implementations should return quickly
+	 * and must not change the progress.
+	 */
+	virtual void progressChanged(Progress& progress) = 0;
+};
+
 /** Tracks the progress of a task in a thread-safe manner. */
 class Progress
 {
@@ -34,16 +49,46 @@ public:
 	real getPercent();
 	std::string getLabel();
 
+	/** Returns the last error reported for the task or an empty string */
+	std::string getError();
+
+	/** Indicates if the task is running */
+	bool isRunning();
+
+	/** Returns the named statistics reported for the task */
+	std::map<std::string, real> getDetails();
+
 	void setPercent(real percent);
 	void setLabel(const std::string& label);
+	void setError(const std::string& error);
+	void setRunning(bool running);
+
+	/** Sets a named statistic.  Details don't notify the listener and are sent with the next change. */
+	void setDetail(const std::string& name, real value);
+
+	/** Sets the object to notify of changes or NULL for none */
+	void setListener(ProgressListener * listener);
+
+	/** The smallest change in percent that the listener is notified of */
+	static const real PUBLISH_STEP;
 
 private:
 	// DISABLE COPY SEMANTICS
 	Progress(const Progress&) { }
 	Progress& operator = (const Progress&) { return *this; }
 
+	/** Notifies the listener.  Must be called without holding the lock. */
+	void notify();
+
 	real m_percent;
+
+	/** The percent that the listener was last notified of */
+	real m_publishedPercent;
 	std::string m_label;
+	std::string m_error;
+	bool m_running;
+	std::map<std::string, real> m_details;
+	ProgressListener * m_listener;
 	CriticalSection m_cs;
 };
 
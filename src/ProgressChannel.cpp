@@ -0,0 +1,312 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "ProgressChannel.h"
+#include "JsonWriter.h"
+#include "Logger.h"
+
+namespace freelss
+{
+
+ProgressSubscriber::~ProgressSubscriber()
+{
+	// Do nothing
+}
+
+ProgressChannel::ProgressChannel() :
+	m_subscriptions(),
+	m_threadRunning(false),
+	m_holdSubscribers(true),
+	m_percent(0),
+	m_label(""),
+	m_error(""),
+	m_running(false),
+	m_details(),
+	m_dirty(true),
+	m_version(0),
+	m_json("")
+{
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_cond, NULL);
+}
+
+ProgressChannel::~ProgressChannel()
+{
+	pthread_mutex_lock(&m_mutex);
+	bool threadRunning = m_threadRunning;
+	m_stopRequested = true;
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+
+	if (threadRunning)
+	{
+		try
+		{
+			join();
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << ex << Logger::ENDL;
+		}
+	}
+
+	for (std::list<Subscription>::iterator it = m_subscriptions.begin(); it != m_subscriptions.end(); ++it)
+	{
+		delete it->subscriber;
+	}
+
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+}
+
+void ProgressChannel::progressChanged(Progress& progress)
+{
+	real percent = progress.getPercent();
+	std::string label = progress.getLabel();
+	std::string error = progress.getError();
+	bool running = progress.isRunning();
+	std::map<std::string, real> details = progress.getDetails();
+
+	// The encoding and publishing are left to the channel's thread so the caller isn't held up
+	pthread_mutex_lock(&m_mutex);
+	m_percent = percent;
+	m_label.swap(label);
+	m_error.swap(error);
+	m_running = running;
+	m_details.swap(details);
+	m_dirty = true;
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+}
+
+bool ProgressChannel::getLatest(unsigned version, std::string& json)
+{
+	pthread_mutex_lock(&m_mutex);
+
+	if (m_dirty)
+	{
+		encode();
+	}
+
+	bool changed = version != m_version;
+	if (changed)
+	{
+		json = m_json;
+	}
+
+	pthread_mutex_unlock(&m_mutex);
+
+	return changed;
+}
+
+void ProgressChannel::subscribe(ProgressSubscriber * subscriber, unsigned version)
+{
+	pthread_mutex_lock(&m_mutex);
+
+	// Start the thread the first time it is needed
+	if (!m_threadRunning && m_holdSubscribers)
+	{
+		try
+		{
+			execute();
+			m_threadRunning = true;
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << "Error starting the progress channel: " << ex << Logger::ENDL;
+		}
+	}
+
+	if (m_dirty)
+	{
+		encode();
+	}
+
+	std::vector<ProgressSubscriber *> ready;
+	if (version != m_version || !m_threadRunning || !m_holdSubscribers)
+	{
+		ready.push_back(subscriber);
+	}
+	else
+	{
+		Subscription subscription;
+		subscription.subscriber = subscriber;
+		subscription.expireTime = GetTimeInSeconds() + LONG_POLL_TIMEOUT_SEC;
+		subscription.version = version;
+		m_subscriptions.push_back(subscription);
+	}
+
+	std::string json = m_json;
+
+	pthread_mutex_unlock(&m_mutex);
+
+	publish(ready, json);
+}
+
+void ProgressChannel::setHoldSubscribers(bool hold)
+{
+	std::vector<ProgressSubscriber *> ready;
+
+	pthread_mutex_lock(&m_mutex);
+	m_holdSubscribers = hold;
+
+	if (!hold)
+	{
+		for (std::list<Subscription>::iterator it = m_subscriptions.begin(); it != m_subscriptions.end(); ++it)
+		{
+			ready.push_back(it->subscriber);
+		}
+
+		m_subscriptions.clear();
+	}
+
+	if (m_dirty)
+	{
+		encode();
+	}
+
+	std::string json = m_json;
+	pthread_mutex_unlock(&m_mutex);
+
+	publish(ready, json);
+}
+
+void ProgressChannel::encode()
+{
+	std::string json;
+	json.reserve(m_json.size() + 64);
+
+	m_version++;
+
+	char buffer[16];
+	snprintf(buffer, sizeof(buffer), "%u", m_version);
+
+	json += "{\"version\":";
+	json += buffer;
+	json += ",\"running\":";
+	json += m_running ? "true" : "false";
+	json += ",\"label\":";
+	JsonWriter::appendString(json, m_label);
+	json += ",\"percent\":";
+	JsonWriter::appendNumber(json, m_percent);
+	json += ",\"error\":";
+	JsonWriter::appendString(json, m_error);
+	json += ",\"details\":{";
+
+	for (std::map<std::string, real>::const_iterator it = m_details.begin(); it != m_details.end(); ++it)
+	{
+		if (it != m_details.begin())
+		{
+			json += ',';
+		}
+
+		JsonWriter::appendString(json, it->first);
+		json += ':';
+		JsonWriter::appendNumber(json, it->second);
+	}
+
+	json += "}}";
+
+	m_json.swap(json);
+	m_dirty = false;
+
+	// Another request may have encoded this version, the thread still needs to publish it
+	pthread_cond_broadcast(&m_cond);
+}
+
+void ProgressChannel::publish(std::vector<ProgressSubscriber *>& subscribers, const std::string& json)
+{
+	for (size_t iSub = 0; iSub < subscribers.size(); iSub++)
+	{
+		try
+		{
+			subscribers[iSub]->publish(json);
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << "Error publishing progress: " << ex << Logger::ENDL;
+		}
+
+		delete subscribers[iSub];
+	}
+
+	subscribers.clear();
+}
+
+void ProgressChannel::run()
+{
+	std::vector<ProgressSubscriber *> ready;
+
+	pthread_mutex_lock(&m_mutex);
+
+	while (!m_stopRequested)
+	{
+		// Wake up at least once a second to time out the subscribers
+		if (!m_dirty)
+		{
+			struct timespec deadline;
+			clock_gettime(CLOCK_REALTIME, &deadline);
+			deadline.tv_sec += 1;
+
+			pthread_cond_timedwait(&m_cond, &m_mutex, &deadline);
+		}
+
+		if (m_stopRequested)
+		{
+			break;
+		}
+
+		if (m_dirty)
+		{
+			encode();
+		}
+
+		// Release the subscribers that are behind the current version or have waited too long.
+		// The version may have been encoded by getLatest or subscribe instead of this thread.
+		double now = GetTimeInSeconds();
+		std::list<Subscription>::iterator it = m_subscriptions.begin();
+		while (it != m_subscriptions.end())
+		{
+			if (it->version != m_version || it->expireTime <= now)
+			{
+				ready.push_back(it->subscriber);
+				it = m_subscriptions.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		if (!ready.empty())
+		{
+			std::string json = m_json;
+
+			pthread_mutex_unlock(&m_mutex);
+			publish(ready, json);
+			pthread_mutex_lock(&m_mutex);
+		}
+	}
+
+	pthread_mutex_unlock(&m_mutex);
+}
+
+}
@@ -0,0 +1,113 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "Thread.h"
+#include "Progress.h"
+
+namespace freelss
+{
+
+/** Receives the progress JSON from a ProgressChannel */
+class ProgressSubscriber
+{
+public:
+	virtual ~ProgressSubscriber();
+
+	/** Called once with the latest progress.  The channel deletes the subscriber afterwards. */
+	virtual void publish(const std::string& json) = 0;
+};
+
+/**
+ * Pushes progress to long-polling clients.  Each meaningful change is encoded to
+ * JSON once and the same text is sent to every subscriber waiting for it.  Subscribers
+ * that see no change within LONG_POLL_TIMEOUT_SEC are sent the current progress.
+ */
+class ProgressChannel : public Thread, public ProgressListener
+{
+public:
+	ProgressChannel();
+	~ProgressChannel();
+
+	void progressChanged(Progress& progress);
+
+	/**
+	 * Gets the latest progress JSON if it is a different version than the one the caller has.
+	 * Returns false if the caller is up to date and should subscribe for the next change.
+	 */
+	bool getLatest(unsigned version, std::string& json);
+
+	/**
+	 * Waits for progress that is a different version than the one given.  The subscriber is
+	 * published to right away if there already is one.  The channel takes ownership of the subscriber.
+	 */
+	void subscribe(ProgressSubscriber * subscriber, unsigned version);
+
+	/**
+	 * Sets whether subscribers are held until the next change.  When disabled all waiting
+	 * subscribers are sent the latest progress and new ones are published to immediately.
+	 */
+	void setHoldSubscribers(bool hold);
+
+	void run();
+
+	/** The longest time a subscriber waits for a change */
+	static const int LONG_POLL_TIMEOUT_SEC = 25;
+
+private:
+	struct Subscription
+	{
+		ProgressSubscriber * subscriber;
+		double expireTime;
+
+		/** The version the subscriber already has */
+		unsigned version;
+	};
+
+	/**
+	 * Encodes the latest progress as the next version and wakes the channel's thread
+	 * to publish it to the waiting subscribers.  Must be called with the lock held.
+	 */
+	void encode();
+
+	/** Publishes to the subscribers and deletes them.  Must be called without the lock. */
+	static void publish(std::vector<ProgressSubscriber *>& subscribers, const std::string& json);
+
+	pthread_mutex_t m_mutex;
+	pthread_cond_t m_cond;
+	std::list<Subscription> m_subscriptions;
+	bool m_threadRunning;
+	bool m_holdSubscribers;
+
+	/** The latest progress.  Dirty is set when it hasn't been encoded yet. */
+	real m_percent;
+	std::string m_label;
+	std::string m_error;
+	bool m_running;
+	std::map<std::string, real> m_details;
+	bool m_dirty;
+
+	/** The encoded progress */
+	unsigned m_version;
+	std::string m_json;
+};
+
+}
@@ -0,0 +1,702 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "ScanCatalog.h"
+#include "PropertyReaderWriter.h"
+#include "Logger.h"
+
+#define INDEX_FILE_NAME "scans.index"
+#define INOTIFY_BUFFER_SIZE 4096
+#define PLY_HEADER_SIZE 4096
+
+namespace freelss
+{
+
+/** The extensions of the files the scanner writes for a scan */
+static const char * SCAN_FILE_EXTENSIONS[] = { "png", "ply", "stl", "xyz", "log", "csv", "json" };
+
+static bool CompareScanResultFiles(const ScanResultFile& a, const ScanResultFile& b)
+{
+	return a.extension > b.extension;
+}
+
+static bool CompareScanDate(const ScanResult& a, time_t scanDate)
+{
+	return a.getScanDate() < scanDate;
+}
+
+ScanCatalog * ScanCatalog::m_instance = NULL;
+
+ScanCatalog * ScanCatalog::get()
+{
+	if (m_instance == NULL)
+	{
+		m_instance = new ScanCatalog();
+	}
+
+	return m_instance;
+}
+
+void ScanCatalog::release()
+{
+	delete m_instance;
+	m_instance = NULL;
+}
+
+ScanCatalog::ScanCatalog() :
+	m_cs(),
+	m_directory(GetScanOutputDir()),
+	m_indexFile(GetAppHomeDir() + "/" + INDEX_FILE_NAME),
+	m_scans(),
+	m_loaded(false),
+	m_stale(false),
+	m_dirty(false),
+	m_inotifyFd(-1),
+	m_watch(-1),
+	m_threadRunning(false)
+{
+	// Do nothing
+}
+
+ScanCatalog::~ScanCatalog()
+{
+	if (m_threadRunning)
+	{
+		stop();
+		join();
+	}
+
+	if (m_dirty && !m_stale)
+	{
+		try
+		{
+			save();
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << "Error writing the scan index: " << ex << Logger::ENDL;
+		}
+	}
+
+	if (m_inotifyFd != -1)
+	{
+		close(m_inotifyFd);
+	}
+}
+
+std::vector<ScanResult> ScanCatalog::getScans(size_t offset, size_t count, size_t& numScans)
+{
+	std::vector<ScanResult> scans;
+
+	m_cs.enter();
+	try
+	{
+		load();
+
+		numScans = m_scans.size();
+		for (size_t iScan = offset; iScan < numScans && scans.size() < count; iScan++)
+		{
+			scans.push_back(m_scans[numScans - 1 - iScan]);
+		}
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+
+	m_cs.leave();
+
+	return scans;
+}
+
+bool ScanCatalog::getScan(time_t scanDate, ScanResult& result)
+{
+	bool found = false;
+
+	m_cs.enter();
+	try
+	{
+		load();
+
+		int iScan = findScan(scanDate);
+		if (iScan != -1)
+		{
+			result = m_scans[iScan];
+			found = true;
+		}
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+
+	m_cs.leave();
+
+	return found;
+}
+
+void ScanCatalog::updateScan(time_t scanDate)
+{
+	m_cs.enter();
+	try
+	{
+		load();
+
+		for (size_t iExt = 0; iExt < sizeof(SCAN_FILE_EXTENSIONS) / sizeof(SCAN_FILE_EXTENSIONS[0]); iExt++)
+		{
+			std::stringstream name;
+			name << scanDate << "." << SCAN_FILE_EXTENSIONS[iExt];
+
+			updateFile(name.str());
+		}
+
+		// The thread writes the index once the directory is quiet
+		if (!m_threadRunning)
+		{
+			save();
+		}
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+
+	m_cs.leave();
+}
+
+void ScanCatalog::removeScan(time_t scanDate)
+{
+	m_cs.enter();
+	try
+	{
+		load();
+
+		int iScan = findScan(scanDate);
+		if (iScan != -1)
+		{
+			m_scans.erase(m_scans.begin() + iScan);
+			m_dirty = true;
+		}
+
+		if (!m_threadRunning)
+		{
+			save();
+		}
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+
+	m_cs.leave();
+}
+
+void ScanCatalog::run()
+{
+	char buffer[INOTIFY_BUFFER_SIZE] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+
+	while (!m_stopRequested)
+	{
+		// Wake up at least once a second to check if the thread should stop
+		fd_set fds;
+		FD_ZERO(&fds);
+		FD_SET(m_inotifyFd, &fds);
+
+		struct timeval timeout;
+		timeout.tv_sec = 1;
+		timeout.tv_usec = 0;
+
+		int ready = select(m_inotifyFd + 1, &fds, NULL, NULL, &timeout);
+		if (ready == -1)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			ErrorLog << "Error waiting for scan directory changes: " << strerror(errno) << Logger::ENDL;
+			break;
+		}
+
+		m_cs.enter();
+		try
+		{
+			if (ready > 0)
+			{
+				ssize_t length;
+				while ((length = read(m_inotifyFd, buffer, sizeof(buffer))) > 0)
+				{
+					const char * ptr = buffer;
+					while (ptr < buffer + length)
+					{
+						const struct inotify_event * event = (const struct inotify_event *) ptr;
+						ptr += sizeof(struct inotify_event) + event->len;
+
+						// Events were dropped or the directory went away, the index has to be rebuilt
+						if (event->mask & IN_Q_OVERFLOW)
+						{
+							m_stale = true;
+						}
+						else if (event->mask & IN_IGNORED)
+						{
+							m_watch = -1;
+							m_stale = true;
+						}
+						else if (event->len > 0 && m_loaded && !m_stale)
+						{
+							updateFile(event->name);
+						}
+					}
+				}
+			}
+			// Write the index once the directory has been quiet for a second
+			else if (m_dirty && !m_stale)
+			{
+				save();
+			}
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << "Error updating the scan index: " << ex << Logger::ENDL;
+		}
+
+		m_cs.leave();
+	}
+}
+
+void ScanCatalog::load()
+{
+	if (m_loaded && !m_stale)
+	{
+		return;
+	}
+
+	// Start watching before reading so that no changes are missed
+	if (m_inotifyFd == -1)
+	{
+		m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_inotifyFd == -1)
+		{
+			ErrorLog << "Error initializing inotify, changes made outside of FreeLSS won't be seen until restarting: "
+					 << strerror(errno) << Logger::ENDL;
+		}
+	}
+
+	if (m_inotifyFd != -1 && m_watch == -1)
+	{
+		m_watch = inotify_add_watch(m_inotifyFd, m_directory.c_str(), IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+		if (m_watch == -1)
+		{
+			ErrorLog << "Error watching " << m_directory << ": " << strerror(errno) << Logger::ENDL;
+		}
+	}
+
+	if (m_inotifyFd != -1 && !m_threadRunning)
+	{
+		m_threadRunning = true;
+		execute();
+	}
+
+	// Use the index if the directory hasn't changed since it was written
+	if (!m_loaded && access(m_indexFile.c_str(), R_OK) == 0)
+	{
+		PropertyReaderWriter propReader;
+		std::vector<Property> properties = propReader.readProperties(m_indexFile);
+
+		std::map<time_t, ScanResult> scanMap;
+		std::string directoryModified;
+		int version = 0;
+
+		const std::string prefix = "scans.";
+		for (size_t iProp = 0; iProp < properties.size(); iProp++)
+		{
+			const Property& prop = properties[iProp];
+
+			if (prop.name == "catalog.version")
+			{
+				version = ToInt(prop.value);
+			}
+			else if (prop.name == "catalog.directoryModified")
+			{
+				directoryModified = prop.value;
+			}
+			else if (StartsWith(prop.name, prefix))
+			{
+				size_t dotPos = prop.name.find('.', prefix.size());
+				if (dotPos == std::string::npos)
+				{
+					continue;
+				}
+
+				time_t scanDate = atol(prop.name.substr(prefix.size(), dotPos - prefix.size()).c_str());
+				std::string key = prop.name.substr(dotPos + 1);
+				ScanResult& result = scanMap[scanDate];
+
+				if (key == "numPoints")
+				{
+					result.numPoints = ToInt(prop.value);
+				}
+				else if (key == "numFaces")
+				{
+					result.numFaces = ToInt(prop.value);
+				}
+				else if (StartsWith(key, "files."))
+				{
+					ScanResultFile file;
+					file.extension = key.substr(6);
+					file.creationTime = scanDate;
+					file.fileSize = atoll(prop.value.c_str());
+
+					result.files.push_back(file);
+				}
+			}
+		}
+
+		if (version == INDEX_VERSION && !directoryModified.empty() && directoryModified == getDirectoryModified())
+		{
+			m_scans.clear();
+			for (std::map<time_t, ScanResult>::iterator it = scanMap.begin(); it != scanMap.end(); ++it)
+			{
+				if (!it->second.files.empty())
+				{
+					std::sort(it->second.files.begin(), it->second.files.end(), CompareScanResultFiles);
+					m_scans.push_back(it->second);
+				}
+			}
+
+			m_loaded = true;
+			InfoLog << "Read " << m_scans.size() << " scans from the scan index" << Logger::ENDL;
+			return;
+		}
+
+		InfoLog << "The scan index is out of date" << Logger::ENDL;
+	}
+
+	rebuild();
+}
+
+void ScanCatalog::rebuild()
+{
+	InfoLog << "Rebuilding the scan index for " << m_directory << Logger::ENDL;
+
+	DIR * dirp = opendir(m_directory.c_str());
+	if (dirp == NULL)
+	{
+		throw Exception("Error opening scan directory: " + m_directory);
+	}
+
+	std::map<time_t, ScanResult> scanMap;
+
+	struct dirent *dp = readdir(dirp);
+	while (dp != NULL)
+	{
+		std::string name = dp->d_name;
+		std::string extension;
+		time_t scanDate;
+
+		if (parseFileName(name, scanDate, extension))
+		{
+			std::string fullPath = m_directory + "/" + name;
+			ScanResultFile file;
+
+			struct stat st;
+			if (stat(fullPath.c_str(), &st) == 0)
+			{
+				file.fileSize = st.st_size;
+			}
+			else
+			{
+				file.fileSize = 0;
+				ErrorLog << "Error obtaining stats on file: " << fullPath << ", error=" << strerror(errno) << Logger::ENDL;
+			}
+
+			file.extension = extension;
+			file.creationTime = scanDate;
+
+			scanMap[scanDate].files.push_back(file);
+		}
+
+		dp = readdir(dirp);
+	}
+
+	closedir(dirp);
+
+	m_scans.clear();
+	for (std::map<time_t, ScanResult>::iterator it = scanMap.begin(); it != scanMap.end(); ++it)
+	{
+		std::sort(it->second.files.begin(), it->second.files.end(), CompareScanResultFiles);
+		readMeshCounts(it->second);
+		m_scans.push_back(it->second);
+	}
+
+	m_loaded = true;
+	m_stale = false;
+	m_dirty = true;
+
+	save();
+}
+
+void ScanCatalog::save()
+{
+	// Changes made after this point are still waiting to be processed and make the index dirty again
+	std::string directoryModified = getDirectoryModified();
+
+	int numPending = 0;
+	if (m_inotifyFd != -1 && ioctl(m_inotifyFd, FIONREAD, &numPending) == 0 && numPending > 0)
+	{
+		return;
+	}
+
+	std::vector<Property> properties;
+	properties.push_back(Property("catalog.version", ToString(INDEX_VERSION)));
+	properties.push_back(Property("catalog.directoryModified", directoryModified));
+
+	for (size_t iScan = 0; iScan < m_scans.size(); iScan++)
+	{
+		const ScanResult& result = m_scans[iScan];
+
+		std::stringstream prefix;
+		prefix << "scans." << result.getScanDate() << ".";
+
+		properties.push_back(Property(prefix.str() + "numPoints", ToString(result.numPoints)));
+		properties.push_back(Property(prefix.str() + "numFaces", ToString(result.numFaces)));
+
+		for (size_t iFile = 0; iFile < result.files.size(); iFile++)
+		{
+			std::stringstream fileSize;
+			fileSize << result.files[iFile].fileSize;
+
+			properties.push_back(Property(prefix.str() + "files." + result.files[iFile].extension, fileSize.str()));
+		}
+	}
+
+	// Replace the index atomically so a crash doesn't leave a partial one
+	std::string tempFile = m_indexFile + ".tmp";
+
+	PropertyReaderWriter propWriter;
+	propWriter.writeProperties(properties, tempFile);
+
+	if (rename(tempFile.c_str(), m_indexFile.c_str()) != 0)
+	{
+		throw Exception("Error replacing " + m_indexFile + ": " + strerror(errno));
+	}
+
+	m_dirty = false;
+}
+
+void ScanCatalog::updateFile(const std::string& name)
+{
+	std::string extension;
+	time_t scanDate;
+
+	if (!parseFileName(name, scanDate, extension))
+	{
+		return;
+	}
+
+	std::string fullPath = m_directory + "/" + name;
+	bool isMesh = extension == "ply" || extension == "stl";
+	int iScan = findScan(scanDate);
+
+	struct stat st;
+	if (stat(fullPath.c_str(), &st) != 0)
+	{
+		if (iScan == -1)
+		{
+			return;
+		}
+
+		// Remove the deleted file and the scan along with its last file
+		ScanResult& result = m_scans[iScan];
+		for (size_t iFile = 0; iFile < result.files.size(); iFile++)
+		{
+			if (result.files[iFile].extension == extension)
+			{
+				result.files.erase(result.files.begin() + iFile);
+				m_dirty = true;
+				break;
+			}
+		}
+
+		if (result.files.empty())
+		{
+			m_scans.erase(m_scans.begin() + iScan);
+		}
+		else if (isMesh)
+		{
+			readMeshCounts(result);
+		}
+
+		return;
+	}
+
+	if (iScan == -1)
+	{
+		std::vector<ScanResult>::iterator it = std::lower_bound(m_scans.begin(), m_scans.end(), scanDate, CompareScanDate);
+		iScan = it - m_scans.begin();
+		m_scans.insert(it, ScanResult());
+	}
+
+	ScanResult& result = m_scans[iScan];
+
+	size_t iFile = 0;
+	while (iFile < result.files.size() && result.files[iFile].extension != extension)
+	{
+		iFile++;
+	}
+
+	if (iFile == result.files.size())
+	{
+		ScanResultFile file;
+		file.extension = extension;
+		file.creationTime = scanDate;
+		file.fileSize = st.st_size;
+
+		result.files.push_back(file);
+		std::sort(result.files.begin(), result.files.end(), CompareScanResultFiles);
+	}
+	else
+	{
+		result.files[iFile].fileSize = st.st_size;
+	}
+
+	if (isMesh)
+	{
+		readMeshCounts(result);
+	}
+
+	m_dirty = true;
+}
+
+int ScanCatalog::findScan(time_t scanDate)
+{
+	std::vector<ScanResult>::iterator it = std::lower_bound(m_scans.begin(), m_scans.end(), scanDate, CompareScanDate);
+	if (it == m_scans.end() || it->getScanDate() != scanDate)
+	{
+		return -1;
+	}
+
+	return it - m_scans.begin();
+}
+
+void ScanCatalog::readMeshCounts(ScanResult& result)
+{
+	bool hasPly = false;
+	bool hasStl = false;
+	for (size_t iFile = 0; iFile < result.files.size(); iFile++)
+	{
+		hasPly |= result.files[iFile].extension == "ply";
+		hasStl |= result.files[iFile].extension == "stl";
+	}
+
+	result.numPoints = 0;
+	result.numFaces = 0;
+
+	std::stringstream basePath;
+	basePath << m_directory << "/" << result.getScanDate();
+
+	if (hasPly)
+	{
+		// The element counts are in the text header of both ASCII and binary PLY files
+		std::string filename = basePath.str() + ".ply";
+		int fd = open(filename.c_str(), O_RDONLY);
+		if (fd != -1)
+		{
+			char header[PLY_HEADER_SIZE];
+			ssize_t length = read(fd, header, sizeof(header));
+			close(fd);
+
+			if (length > 0)
+			{
+				std::stringstream headerStream(std::string(header, length));
+				std::string line;
+				while (std::getline(headerStream, line) && line != "end_header")
+				{
+					int count = 0;
+					if (sscanf(line.c_str(), "element vertex %d", &count) == 1)
+					{
+						result.numPoints = count;
+					}
+					else if (sscanf(line.c_str(), "element face %d", &count) == 1)
+					{
+						result.numFaces = count;
+					}
+				}
+			}
+		}
+	}
+	else if (hasStl)
+	{
+		// Binary STL files have the number of triangles after the 80 byte header
+		std::string filename = basePath.str() + ".stl";
+		int fd = open(filename.c_str(), O_RDONLY);
+		if (fd != -1)
+		{
+			uint32 numTriangles = 0;
+			if (pread(fd, &numTriangles, sizeof(numTriangles), 80) == sizeof(numTriangles))
+			{
+				result.numFaces = (int) numTriangles;
+			}
+
+			close(fd);
+		}
+	}
+}
+
+std::string ScanCatalog::getDirectoryModified()
+{
+	struct stat st;
+	if (stat(m_directory.c_str(), &st) != 0)
+	{
+		return "";
+	}
+
+	char buffer[48];
+	snprintf(buffer, sizeof(buffer), "%ld.%09ld", (long) st.st_mtim.tv_sec, (long) st.st_mtim.tv_nsec);
+
+	return buffer;
+}
+
+bool ScanCatalog::parseFileName(const std::string& name, time_t& scanDate, std::string& extension)
+{
+	size_t dotPos = name.find_last_of(".");
+	if (dotPos == std::string::npos || dotPos == 0 || dotPos == name.size() - 1)
+	{
+		return false;
+	}
+
+	// Scan files are named by the time the scan started
+	if (strspn(name.c_str(), "0123456789") != dotPos)
+	{
+		return false;
+	}
+
+	scanDate = atol(name.substr(0, dotPos).c_str());
+	extension = name.substr(dotPos + 1);
+
+	return true;
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "Thread.h"
+#include "CriticalSection.h"
+
+namespace freelss
+{
+
+/**
+ * Keeps an index of the scans in the scan output directory so that listing them doesn't
+ * require reading and stat'ing every file.  The index is persisted next to the properties
+ * file and is only rebuilt from the directory when the directory changed while FreeLSS wasn't
+ * watching it.  While running, inotify events keep the index up to date.
+ */
+class ScanCatalog : public Thread
+{
+public:
+
+	static ScanCatalog * get();
+	static void release();
+
+	/**
+	 * Returns a page of the scans, most recent first.
+	 * @param offset - The number of recent scans to skip.
+	 * @param count - The maximum number of scans to return.
+	 * @param numScans - Set to the total number of scans.
+	 */
+	std::vector<ScanResult> getScans(size_t offset, size_t count, size_t& numScans);
+
+	/** Gets the scan with the given date.  Returns false if there is no such scan. */
+	bool getScan(time_t scanDate, ScanResult& result);
+
+	/** Refreshes the files of the scan, called once the scan has been written */
+	void updateScan(time_t scanDate);
+
+	/** Removes the scan from the catalog, called once its files have been deleted */
+	void removeScan(time_t scanDate);
+
+	/** Processes the inotify events for the scan directory */
+	void run();
+
+	/** The index format version, the index is rebuilt if it doesn't match */
+	static const int INDEX_VERSION = 1;
+
+private:
+	ScanCatalog();
+	~ScanCatalog();
+
+	/** Reads the index or rebuilds it if it is out of date.  Must be called with the lock held. */
+	void load();
+
+	/** Rebuilds the index by reading the whole scan directory.  Must be called with the lock held. */
+	void rebuild();
+
+	/** Writes the index if the scan directory hasn't changed since it was last read.  Must be called with the lock held. */
+	void save();
+
+	/** Adds, updates, or removes the file from the index based on whether it exists.  Must be called with the lock held. */
+	void updateFile(const std::string& name);
+
+	/** Returns the index of the scan in m_scans or -1 if it isn't there */
+	int findScan(time_t scanDate);
+
+	/** Reads the number of points and faces from the mesh headers */
+	void readMeshCounts(ScanResult& result);
+
+	/** Returns the modification time of the scan directory as a string */
+	std::string getDirectoryModified();
+
+	/** Splits a scan file name into its scan date and extension.  Returns false if it isn't a scan file. */
+	static bool parseFileName(const std::string& name, time_t& scanDate, std::string& extension);
+
+	static ScanCatalog * m_instance;
+
+	/** Protects all of the members below */
+	CriticalSection m_cs;
+
+	std::string m_directory;
+	std::string m_indexFile;
+
+	/** The scans ordered from oldest to newest */
+	std::vector<ScanResult> m_scans;
+
+	/** True once the index has been read */
+	bool m_loaded;
+
+	/** True if the index must be rebuilt from the directory before it is used again */
+	bool m_stale;
+
+	/** True if the index has changes that haven't been written */
+	bool m_dirty;
+
+	/** The inotify instance and the watch on the scan directory or -1 */
+	int m_inotifyFd;
+	int m_watch;
+	bool m_threadRunning;
+};
+
+}
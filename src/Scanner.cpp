@@ -27,28 +27,48 @@
 #include "Laser.h"
 #include "Camera.h"
 #include "PixelLocationWriter.h"
-#include "StlWriter.h"
-#include "XyzWriter.h"
+#include "MeshExporter.h"
 #include "LaserResultsMerger.h"
-#include "FileWriter.h"
+#include "AsyncWriter.h"
+#include "AsyncFileWriter.h"
 #include "Facetizer.h"
 #include "PropertyReaderWriter.h"
 #include "ObjectBaseCreator.h"
 #include "NoiseRemover.h"
 #include "Logger.h"
 #include "MountManager.h"
+#include "JpegWriter.h"
+#include "ScanCatalog.h"
+#include "Tracer.h"
+#include "Metrics.h"
+#include "SettleDetector.h"
+#include "ContinuousRotator.h"
+#include "BackgroundModel.h"
+#include "MockCamera.h"
 
-namespace freelss
-{
+#define TIMING_PROPERTY_PREFIX "timing."
+#define ACCURACY_PROPERTY_PREFIX "accuracy."
 
-static bool CompareScanResults(const ScanResult& a, const ScanResult& b)
-{
-	return a.getScanDate() > b.getScanDate();
-}
-static bool CompareScanResultFiles(const ScanResultFile& a, const ScanResultFile& b)
+/** Frames aren't captured again if more than this fraction failed since the problem is likely the setup */
+#define MAX_RESCAN_FRAME_FRACTION 0.1
+
+/** How far the table overshoots when turning back so it approaches a frame going forward */
+#define RESCAN_BACKLASH_RADIANS DEGREES_TO_RADIANS(2.0)
+
+/** The spacing of the laser-off images recorded for a continuous rotation scan */
+#define CONTINUOUS_BACKGROUND_DEGREES 10.0
+
+/** The widest the laser-off images can be spaced when they don't fit in memory at the normal spacing */
+#define MAX_CONTINUOUS_BACKGROUND_DEGREES 30.0
+
+/** The most memory the laser-off images of a continuous rotation scan can use */
+#define CONTINUOUS_BACKGROUND_MEMORY_MB 128
+
+/** The most memory the laser images waiting for the next laser-off picture can use */
+#define DEFERRED_FRAME_MEMORY_MB 128
+
+namespace freelss
 {
-	return a.extension > b.extension;
-}
 
 static bool ComparePseudoSteps(const DataPoint& a, const DataPoint& b)
 {
@@ -60,6 +80,11 @@ static bool ComparePseudoSteps(const DataPoint& a, const DataPoint& b)
 	return a.pixel.y < b.pixel.y;
 }
 
+static bool CompareFrames(const DataPoint& a, const DataPoint& b)
+{
+	return a.frame < b.frame;
+}
+
 Scanner::Scanner() :
 	m_laser(NULL),
 	m_camera(NULL),
@@ -69,6 +94,7 @@ Scanner::Scanner() :
 	m_running(false),
 	m_range(360),
 	m_filename(""),
+	m_scanDate(0),
 	m_progress(),
 	m_status(),
 	m_maxNumFrameRetries(5),                    // TODO: Place this in Database
@@ -91,7 +117,21 @@ Scanner::Scanner() :
 	m_laserSelection(Laser::ALL_LASERS),
 	m_task(GENERATE_SCAN),
 	m_results(),
-	m_laserDelaySec(0)
+	m_laserDelaySec(0),
+	m_settleDetector(NULL),
+	m_maxTableSettleTimeSec(0),
+	m_continuousRotation(false),
+	m_continuousRotationSpeed(0),
+	m_continuousBackgroundRadians(0),
+	m_maxContinuousBackgrounds(0),
+	m_singleCaptureDualLaser(false),
+	m_numFrames(0),
+	m_tableRotating(false),
+	m_backgroundInterval(1),
+	m_backgroundModel(NULL),
+	m_deferredFrames(),
+	m_deferredImages(),
+	m_deferredSource(NULL)
 {
 	// Do nothing
 }
@@ -101,6 +141,9 @@ Scanner::~Scanner()
 	delete [] m_laserLocations;
 	delete [] m_columnPoints;
 	delete m_imageProcessor;
+	delete m_settleDetector;
+	delete m_backgroundModel;
+	clearDeferredFrames();
 }
 
 void Scanner::setTask(Scanner::Task task)
@@ -167,6 +210,8 @@ void Scanner::prepareScan()
 	m_status.enter();
 	m_running = true;
 	m_progress.setPercent(0);
+	m_progress.setError("");
+	m_progress.setRunning(true);
 
 	m_remainingTime = 0;
 
@@ -207,7 +252,8 @@ void Scanner::prepareScan()
 
 	// Set the base output file
 	std::stringstream sstr;
-	sstr << GetScanOutputDir() << std::string("/") << time(NULL);
+	m_scanDate = time(NULL);
+	sstr << GetScanOutputDir() << std::string("/") << m_scanDate;
 
 	m_filename = sstr.str();
 
@@ -256,6 +302,70 @@ void Scanner::prepareScan()
 		throw Exception("Unsupported Camera Mode");
 	}
 
+	// Watch the video for the scene to settle instead of waiting the fixed delays
+	delete m_settleDetector;
+	m_settleDetector = NULL;
+	if (m_task == Scanner::GENERATE_SCAN && preset.enableSettleDetection
+			&& m_camera->getCameraResolution().cameraType != CT_MMALSTILL)
+	{
+		m_settleDetector = new SettleDetector(m_camera, preset.settleThreshold);
+	}
+
+	// The laser turns off while the table rotates so wait for whichever takes longer
+	m_maxTableSettleTimeSec = MAX(preset.stabilityDelay / 1000000.0, m_laserDelaySec);
+
+	// Continuous rotation needs a video camera to keep up with the table
+	m_continuousRotation = m_task == Scanner::GENERATE_SCAN && preset.continuousRotation;
+	m_continuousRotationSpeed = DEGREES_TO_RADIANS(preset.continuousRotationSpeed);
+	if (m_continuousRotation && m_camera->getCameraResolution().cameraType == CT_MMALSTILL)
+	{
+		InfoLog << "Continuous rotation requires a video camera mode, stopping at each frame instead" << Logger::ENDL;
+		m_continuousRotation = false;
+	}
+
+	// The laser-off images for the whole range must fit in memory, spread them out in the larger modes
+	if (m_continuousRotation)
+	{
+		double imageMb = m_camera->getImageWidth() * m_camera->getImageHeight() * m_camera->getImageComponents() / (1024.0 * 1024.0);
+		m_maxContinuousBackgrounds = (size_t) (CONTINUOUS_BACKGROUND_MEMORY_MB / imageMb);
+
+		real backgroundDegrees = CONTINUOUS_BACKGROUND_DEGREES;
+		if (m_maxContinuousBackgrounds > 1)
+		{
+			backgroundDegrees = MAX(backgroundDegrees, m_range / (m_maxContinuousBackgrounds - 1));
+		}
+
+		if (m_maxContinuousBackgrounds <= 1 || backgroundDegrees > MAX_CONTINUOUS_BACKGROUND_DEGREES)
+		{
+			InfoLog << "The background images for continuous rotation don't fit in memory in this camera mode, stopping at each frame instead" << Logger::ENDL;
+			m_continuousRotation = false;
+		}
+
+		m_continuousBackgroundRadians = DEGREES_TO_RADIANS(backgroundDegrees);
+	}
+
+	// Both lasers can only be captured together if both are used
+	m_singleCaptureDualLaser = preset.dualLaserSingleCapture && preset.laserSide == Laser::ALL_LASERS;
+	m_backgroundInterval = MAX(1, preset.backgroundInterval);
+
+	// The laser images between two laser-off pictures are kept in memory until the second one is taken
+	if (m_backgroundInterval > 1)
+	{
+		double imageMb = m_camera->getImageWidth() * m_camera->getImageHeight() * m_camera->getImageComponents() / (1024.0 * 1024.0);
+		int imagesPerFrame = (m_singleCaptureDualLaser || preset.laserSide != Laser::ALL_LASERS) ? 1 : 2;
+		int maxBackgroundInterval = MAX(1, (int) (DEFERRED_FRAME_MEMORY_MB / (imageMb * imagesPerFrame)) + 1);
+		if (m_backgroundInterval > maxBackgroundInterval)
+		{
+			InfoLog << "Limiting the background interval to " << maxBackgroundInterval << " frames so the laser images fit in memory" << Logger::ENDL;
+			m_backgroundInterval = maxBackgroundInterval;
+		}
+	}
+
+	// Frames between two laser-off pictures interpolate their background from both of them
+	delete m_backgroundModel;
+	m_backgroundModel = new BackgroundModel(2);
+	clearDeferredFrames();
+
 	// Read the laser selection
 	m_laserSelection = preset.laserSide;
 
@@ -396,6 +506,19 @@ void Scanner::runScan()
 	Scanner::TimingStats timingStats;
 	memset(&timingStats, 0, sizeof(Scanner::TimingStats));
 
+	// Writes the photos and scan artifacts so slow storage doesn't hold up the scan
+	AsyncWriter asyncWriter(&m_progress);
+
+	// Encodes the photo sequence while the next frame is acquired
+	JpegWriter photoWriter(asyncWriter);
+
+	// Record the per-frame timing so it can be written next to the scan
+	if (m_task == Scanner::GENERATE_SCAN)
+	{
+		Tracer::get()->start();
+		Tracer::get()->setThreadName("Scanner");
+	}
+
 	try
 	{
 		// Make sure the lasers are off
@@ -404,6 +527,7 @@ void Scanner::runScan()
 
 		// Enable the turn table motor
 		m_turnTable->setMotorEnabled(true);
+		m_turnTable->setStabilityDelayEnabled(m_settleDetector == NULL && !m_continuousRotation);
 
 		// Wait a second in case the object shakes
 		Thread::usleep(2000000);
@@ -441,6 +565,8 @@ void Scanner::runScan()
 		float frameRadians = stepsPerFrame * m_radiansPerFrame;
 
 		numFrames = ceil(rangeRadians / frameRadians);
+		m_numFrames = numFrames;
+		m_tableRotating = false;
 
 		m_numFramesBetweenLaserPlanes = m_radiansBetweenLaserPlanes / frameRadians;
 
@@ -452,54 +578,80 @@ void Scanner::runScan()
 
 		timingStats.startTime = GetTimeInSeconds();
 
-		for (int iFrame = 0; iFrame < numFrames; iFrame++)
-		{
-			timingStats.numFrames++;
+		m_failedFrames.clear();
 
-			// Stop if the user asked us to
-			if (m_stopRequested)
+		if (m_continuousRotation)
+		{
+			runContinuousScan(rangeRadians, frameRadians, leftLocMapper, rightLocMapper, &timingStats);
+		}
+		else
+		{
+			for (int iFrame = 0; iFrame < numFrames; iFrame++)
 			{
-				break;
-			}
+				timingStats.numFrames++;
 
-			if (m_task == Scanner::GENERATE_SCAN)
-			{
-				singleScan(iFrame, rotation, frameRadians, leftLocMapper, rightLocMapper, &timingStats);
-			}
-			else if (m_task == Scanner::GENERATE_PHOTOS)
-			{
-				writePhotos(iFrame, frameRadians);
-			}
+				// Stop if the user asked us to
+				if (m_stopRequested)
+				{
+					break;
+				}
+
+				if (m_task == Scanner::GENERATE_SCAN)
+				{
+					Scanner::TimingStats frameStats = timingStats;
+					singleScan(iFrame, rotation, frameRadians, leftLocMapper, rightLocMapper, &timingStats);
+					recordFrameMetrics(frameStats, timingStats);
+				}
+				else if (m_task == Scanner::GENERATE_PHOTOS)
+				{
+					writePhotos(iFrame, frameRadians, photoWriter);
+				}
 
-			rotation += frameRadians;
+				rotation += frameRadians;
 
-			// Update the progress
-			double progress = (iFrame + 1.0) / numFrames;
-			double timeElapsed = GetTimeInSeconds() - timingStats.startTime;
-			double percentComplete = 100.0 * progress;
-			double fullTimeSec = timeElapsed / progress;
-			double remainingSec = fullTimeSec - timeElapsed;
+				// Update the progress
+				updateProgress((iFrame + 1.0) / numFrames, timingStats);
+			}
+		}
 
-			m_progress.setPercent(progress * 100);
+		// The table may be turning to a frame that won't be scanned if the scan was stopped
+		waitForRotation();
 
-			m_status.enter();
-			m_remainingTime = remainingSec;
-			m_status.leave();
+		// The last frames of the scan only have the background before them
+		flushDeferredFrames(leftLocMapper, rightLocMapper, &timingStats);
 
-			std::stringstream sstr;
-			logTimingStats(sstr, timingStats);
+		// The lasers stay on between frames when they are captured together
+		m_laser->turnOff(Laser::ALL_LASERS);
+		delayAcquisitionForLaser();
 
-			InfoLog << sstr.str() << percentComplete << "% Complete, " << (remainingSec / 60) << " minutes remaining." << Logger::ENDL;
+		// Capture the frames that failed again
+		if (m_task == Scanner::GENERATE_SCAN && !m_stopRequested)
+		{
+			// The table turns before each frame so it is now at the rotation after the last frame
+			rescanFailedFrames(rotation, frameRadians, leftLocMapper, rightLocMapper, &timingStats);
 		}
+
+		// Wait for the last of the photos to be written
+		photoWriter.flush();
 	}
 	catch (...)
 	{	
 		m_turnTable->setMotorEnabled(false);
+		m_turnTable->setStabilityDelayEnabled(true);
+
+		if (m_laser != NULL)
+		{
+			m_laser->turnOff(Laser::ALL_LASERS);
+		}
+		clearDeferredFrames();
+		Tracer::get()->stop();
 
 		m_status.enter();
 		m_running = false;
 		m_status.leave();
 
+		m_progress.setRunning(false);
+
 		if (m_writeRangeCsvEnabled)
 		{
 			m_rangeFout.close();
@@ -511,6 +663,7 @@ void Scanner::runScan()
 	m_rangeFout.close();
 
 	m_turnTable->setMotorEnabled(false);
+	m_turnTable->setStabilityDelayEnabled(true);
 	if (m_task == Scanner::GENERATE_SCAN)
 	{
 		InfoLog << "Merging laser results..." << Logger::ENDL;
@@ -521,14 +674,21 @@ void Scanner::runScan()
 		std::vector<DataPoint> results;
 		LaserResultsMerger merger;
 
-		m_results.enter();
-		merger.merge(results, m_leftLaserResults, m_rightLaserResults, m_maxFramesPerRevolution,
-					 m_numFramesBetweenLaserPlanes, Camera::getInstance()->getImageHeight(), preset.laserMergeAction, m_progress);
-		m_results.leave();
+		{
+			TraceScope trace("merge");
+
+			m_results.enter();
+			merger.merge(results, m_leftLaserResults, m_rightLaserResults, m_maxFramesPerRevolution,
+						 m_numFramesBetweenLaserPlanes, Camera::getInstance()->getImageHeight(), preset.laserMergeAction, m_progress);
+			m_results.leave();
+		}
 
 		// Sort by pseudo-step and row
 		InfoLog << "Sort 2... " << Logger::ENDL;
-		std::sort(results.begin(), results.end(), ComparePseudoSteps);
+		{
+			TraceScope trace("sort");
+			std::sort(results.begin(), results.end(), ComparePseudoSteps);
+		}
 		InfoLog << "End Sort 2... " << Logger::ENDL;
 
 		m_results.enter();
@@ -541,6 +701,16 @@ void Scanner::runScan()
 		m_results.leave();
 
 		timingStats.laserMergeTime += GetTimeInSeconds() - time1;
+		Metrics::get()->observeStage(Metrics::MS_LASER_MERGE, timingStats.laserMergeTime);
+
+		// Measure the scanned points before the object base adds points that aren't part of the object
+		std::map<std::string, real> accuracy;
+		if (measureAccuracy(results, preset.groundPlaneHeight, accuracy))
+		{
+			InfoLog << "Accuracy: mean error " << accuracy["meanError"] << " mm, RMS error " << accuracy["rmsError"]
+			        << " mm, max error " << accuracy["maxError"] << " mm, " << accuracy["percentWithin1mm"]
+			        << "% within 1 mm" << Logger::ENDL;
+		}
 
 		InfoLog << "Constructing mesh..." << Logger::ENDL;
 
@@ -549,6 +719,7 @@ void Scanner::runScan()
 		if (preset.generatePly || preset.generateStl)
 		{
 			Facetizer facetizer;
+			TraceScope trace("facetize");
 
 			time1 = GetTimeInSeconds();
 			m_progress.setLabel("Facetizing Point Cloud");
@@ -561,67 +732,47 @@ void Scanner::runScan()
 				objectBaseCreator.createBase(faces, results, preset.groundPlaneHeight, m_numObjectBaseSubdivisions, m_progress);
 			}
 			timingStats.facetizationTime += GetTimeInSeconds() - time1;
+			Metrics::get()->observeStage(Metrics::MS_FACETIZATION, timingStats.facetizationTime);
 		}
 
-		// Write the PLY file
+		// Write the PLY, XYZ and STL files concurrently
+		MeshExporter exporter(results, faces, asyncWriter);
+
 		if (preset.generatePly)
 		{
-			m_progress.setLabel("Generating PLY file");
-			m_progress.setPercent(0);
-
-			std::string plyFilename = m_filename + ".ply";
-
-			InfoLog << "Writing PLY file... " << plyFilename <<  Logger::ENDL;
-			time1 = GetTimeInSeconds();
+			exporter.add(MeshExporter::MEF_PLY, m_filename + ".ply", preset.plyDataFormat);
+		}
 
-			FileWriter plyOut(plyFilename.c_str());
-			if (!plyOut.is_open())
-			{
-				throw Exception("Error opening file for writing: " + plyFilename);
-			}
+		if (preset.generateXyz)
+		{
+			exporter.add(MeshExporter::MEF_XYZ, m_filename + ".xyz");
+		}
 
-			/** Writes the results to a PLY file */
-			PlyWriter plyWriter;
-			plyWriter.setDataFormat(preset.plyDataFormat);
-			plyWriter.setTotalNumPoints((int)results.size());
-			plyWriter.setTotalNumFacesFromFaceMap(faces);
-			plyWriter.begin(&plyOut);
+		if (preset.generateStl)
+		{
+			exporter.add(MeshExporter::MEF_STL, m_filename + ".stl");
+		}
 
-			real percent = 0;
-			for (size_t iRec = 0; iRec < results.size(); iRec++)
-			{
-				real newPct = 100.0f * iRec / results.size();
-				if (newPct - percent > 0.1)
-				{
-					m_progress.setPercent(newPct);
-					percent = newPct;
-				}
+		exporter.exportAll(m_progress);
 
-				plyWriter.writePoints(&results[iRec].point, 1);
-			}
+		timingStats.plyWritingTime += exporter.getWritingTime(MeshExporter::MEF_PLY);
+		timingStats.xyzWritingTime += exporter.getWritingTime(MeshExporter::MEF_XYZ);
+		timingStats.stlWritingTime += exporter.getWritingTime(MeshExporter::MEF_STL);
 
-			plyWriter.writeFaces(faces);
-			plyWriter.end();
-			plyOut.close();
-			timingStats.plyWritingTime += GetTimeInSeconds() - time1;
+		Metrics * metrics = Metrics::get();
+		if (preset.generatePly)
+		{
+			metrics->observeStage(Metrics::MS_PLY_WRITING, timingStats.plyWritingTime);
 		}
 
-		// Generate the XYZ file
 		if (preset.generateXyz)
 		{
-			time1 = GetTimeInSeconds();
-			XyzWriter xyzWriter;
-			xyzWriter.write(m_filename, results, m_progress);
-			timingStats.xyzWritingTime += GetTimeInSeconds() - time1;
+			metrics->observeStage(Metrics::MS_XYZ_WRITING, timingStats.xyzWritingTime);
 		}
 
-		// Generate the STL file
 		if (preset.generateStl)
 		{
-			time1 = GetTimeInSeconds();
-			StlWriter stlWriter;
-			stlWriter.write(m_filename, results, faces, m_progress);
-			timingStats.stlWritingTime = GetTimeInSeconds() - time1;
+			metrics->observeStage(Metrics::MS_STL_WRITING, timingStats.stlWritingTime);
 		}
 
 		std::stringstream sstr;
@@ -630,9 +781,11 @@ void Scanner::runScan()
 
 		// Generate the log file
 		std::string txtFilename = m_filename + ".log";
-		std::ofstream fout (txtFilename.c_str());
-		if (fout.is_open())
+		AsyncFileWriter logOut(asyncWriter, txtFilename.c_str());
+		if (logOut.is_open())
 		{
+			std::stringstream fout;
+
 			// Log the software version
 			fout << "FreeLSS Version: " << FREELSS_VERSION_MAJOR << "." << FREELSS_VERSION_MINOR << std::endl;
 			fout << "Preset: " << preset.name << std::endl;
@@ -641,17 +794,38 @@ void Scanner::runScan()
 			// Log the timing stats
 			logTimingStats(fout, timingStats);
 
+			for (std::map<std::string, real>::iterator it = accuracy.begin(); it != accuracy.end(); ++it)
+			{
+				fout << "Accuracy " << it->first << ": " << it->second << std::endl;
+			}
+
 			// Get the settings that were used to generate this scan
 			std::vector<Property> properties;
 			PresetManager::get()->encodeProperties(properties);
 			Setup::get()->encodeProperties(properties);
 
+			// Record the timing stats so they can be retrieved along with the scan
+			std::map<std::string, real> timingDetails;
+			getTimingStats(timingStats, timingDetails);
+			for (std::map<std::string, real>::iterator it = timingDetails.begin(); it != timingDetails.end(); ++it)
+			{
+				properties.push_back(Property(TIMING_PROPERTY_PREFIX + it->first, ToString(it->second)));
+			}
+
+			for (std::map<std::string, real>::iterator it = accuracy.begin(); it != accuracy.end(); ++it)
+			{
+				properties.push_back(Property(ACCURACY_PROPERTY_PREFIX + it->first, ToString(it->second)));
+			}
+
 			// Write the settings and preset properties
 			PropertyReaderWriter propWriter;
 			propWriter.writeProperties(fout, properties);
 
 			fout << std::endl;
-			fout.close();
+
+			std::string log = fout.str();
+			logOut.write(log.c_str(), log.size());
+			logOut.close();
 		}
 		else
 		{
@@ -659,16 +833,71 @@ void Scanner::runScan()
 		}
 	}
 
+	// Wait for the files to reach the disk.  Any errors have already been reported to the progress.
+	m_progress.setLabel("Writing files");
+	try
+	{
+		TraceScope trace("flush");
+		asyncWriter.flush();
+	}
+	catch (Exception& ex)
+	{
+		ErrorLog << "Error writing scan output: " << ex << Logger::ENDL;
+	}
+
+	if (m_task == Scanner::GENERATE_SCAN)
+	{
+		writeTrace();
+	}
+
+	// List the scan right away instead of waiting for the catalog to see the files
+	try
+	{
+		ScanCatalog::get()->updateScan(m_scanDate);
+	}
+	catch (Exception& ex)
+	{
+		ErrorLog << "Error adding the scan to the catalog: " << ex << Logger::ENDL;
+	}
 
 	m_progress.setPercent(100);
 
+	if (m_task == Scanner::GENERATE_SCAN && !m_stopRequested)
+	{
+		Metrics::get()->scansCompleted.increment();
+	}
+
 	m_status.enter();
 	m_running = false;
 	m_status.leave();
 
+	m_progress.setRunning(false);
+
 	InfoLog << "Done." << Logger::ENDL;
 }
 
+void Scanner::writeTrace()
+{
+	Tracer * tracer = Tracer::get();
+	tracer->stop();
+
+	std::string traceFilename = m_filename + ".json";
+	std::ofstream fout(traceFilename.c_str());
+	if (!fout.is_open())
+	{
+		ErrorLog << "Error opening file for writing: " << traceFilename << Logger::ENDL;
+		return;
+	}
+
+	tracer->writeChromeTrace(fout);
+	fout.close();
+
+	if (fout.fail())
+	{
+		ErrorLog << "Error writing the scan trace: " << traceFilename << Logger::ENDL;
+	}
+}
+
 void Scanner::generateDebugInfo(Laser::LaserSide laserSide)
 {
 	Setup * setup = Setup::get();
@@ -878,6 +1107,9 @@ void Scanner::generateDebugInfo(Laser::LaserSide laserSide)
 	m_status.enter();
 	m_running = false;
 	m_status.leave();
+
+	m_progress.setRunning(false);
+
 	InfoLog << "Done." << Logger::ENDL;
 }
 
@@ -957,9 +1189,10 @@ void Scanner::mergeDebuggingImages(Image& outImage, Image& leftDebuggingImage, I
 	}
 }
 
-void Scanner::writePhotos(int frame, real frameRotation)
+void Scanner::writePhotos(int frame, real frameRotation, JpegWriter& photoWriter)
 {
 	m_turnTable->rotate(frameRotation);
+	delayAcquisitionForTable();
 
 	bool useLeftLaser = m_saveLaserImages && (m_laserSelection == Laser::LEFT_LASER || m_laserSelection == Laser::ALL_LASERS);
 	bool useRightLaser = m_saveLaserImages && (m_laserSelection == Laser::RIGHT_LASER || m_laserSelection == Laser::ALL_LASERS);
@@ -968,12 +1201,13 @@ void Scanner::writePhotos(int frame, real frameRotation)
 
 	std::string fullPathPrefix = m_photoPathPrefix + "/" + ToString(frame + 1);
 
+	// The images are copied so the camera buffers can be released while they are encoded and written
 	try
 	{
 		image = acquireImage();
 		std::string filename = fullPathPrefix + ".jpg";
 		m_progress.setLabel("Writing " + filename + "...");
-		Image::writeJpeg(* image, filename);
+		photoWriter.write(new Image(* image), filename);
 		releaseImage(image);
 		image = NULL;
 
@@ -985,7 +1219,7 @@ void Scanner::writePhotos(int frame, real frameRotation)
 			image = acquireImage();
 			filename = fullPathPrefix + "_R.jpg";
 			m_progress.setLabel("Writing " + filename + "...");
-			Image::writeJpeg(* image, filename);
+			photoWriter.write(new Image(* image), filename);
 			releaseImage(image);
 			image = NULL;
 
@@ -999,7 +1233,7 @@ void Scanner::writePhotos(int frame, real frameRotation)
 
 			image = acquireImage();
 			filename = fullPathPrefix + "_L.jpg";
-			Image::writeJpeg(* image, filename);
+			photoWriter.write(new Image(* image), filename);
 			releaseImage(image);
 			image = NULL;
 
@@ -1018,9 +1252,19 @@ void Scanner::singleScan(int frame, float rotation, float frameRotation,
 		                 LocationMapper& leftLocMapper, LocationMapper& rightLocMapper, TimingStats * timingStats)
 {
 	double time1 = GetTimeInSeconds();
-	m_turnTable->rotate(frameRotation);
+	{
+		TraceScope trace("rotate", frame);
+		rotateToNextFrame(frameRotation);
+		delayAcquisitionForTable();
+	}
 	timingStats->rotationTime += GetTimeInSeconds() - time1;
 
+	if (m_singleCaptureDualLaser)
+	{
+		singleCaptureScan(frame, rotation, frameRotation, leftLocMapper, rightLocMapper, timingStats);
+		return;
+	}
+
 	Image * image1 = NULL;
 	Image * image2 = NULL;
 
@@ -1030,18 +1274,34 @@ void Scanner::singleScan(int frame, float rotation, float frameRotation,
 	// Ensure that the images get released back to the camera
 	try
 	{
-		// Take a picture with the laser off
-		time1 = GetTimeInSeconds();
-		image1 = acquireImage();
-		timingStats->imageAcquisitionTime += GetTimeInSeconds() - time1;
-
-		// If this is the first image, save it as a thumbnail
-		if (frame == 0)
+		// Take a picture with the laser off, only every few frames if the background is reused
+		bool captureBackground = m_backgroundInterval <= 1 || m_backgroundModel->size() == 0 || frame % m_backgroundInterval == 0;
+		double settleTimeSec = m_maxTableSettleTimeSec;
+		if (captureBackground)
 		{
-			std::string thumbnail = m_filename + ".png";
+			time1 = GetTimeInSeconds();
+			{
+				TraceScope trace("acquire", frame);
+				image1 = acquireSettledImage(settleTimeSec);
+			}
+			timingStats->imageAcquisitionTime += GetTimeInSeconds() - time1;
+			settleTimeSec = m_laserDelaySec;
+
+			// If this is the first image, save it as a thumbnail
+			if (frame == 0)
+			{
+				std::string thumbnail = m_filename + ".png";
+
+				PixelLocationWriter imageWriter;
+				imageWriter.writeImage(* image1, 128, 96, thumbnail.c_str());
+			}
 
-			PixelLocationWriter imageWriter;
-			imageWriter.writeImage(* image1, 128, 96, thumbnail.c_str());
+			// The frames since the last background can be processed now that the next one is known
+			if (m_backgroundInterval > 1)
+			{
+				m_backgroundModel->add(* image1, rotation);
+				flushDeferredFrames(leftLocMapper, rightLocMapper, timingStats);
+			}
 		}
 
 		// Scan with the Right laser
@@ -1049,30 +1309,46 @@ void Scanner::singleScan(int frame, float rotation, float frameRotation,
 		{
 			// Turn on the right laser
 			time1 = GetTimeInSeconds();
-			m_laser->turnOn(Laser::RIGHT_LASER);
-			delayAcquisitionForLaser();
+			{
+				TraceScope trace("laser on", frame, Laser::RIGHT_LASER);
+				m_laser->turnOn(Laser::RIGHT_LASER);
+				delayAcquisitionForLaser();
+			}
 			timingStats->laserTime += GetTimeInSeconds() - time1;
 
 			// Take a picture with the right laser on
 			time1 = GetTimeInSeconds();
-			image2 = acquireImage();
+			{
+				TraceScope trace("acquire", frame, Laser::RIGHT_LASER);
+				image2 = acquireSettledImage(settleTimeSec);
+			}
 			timingStats->imageAcquisitionTime += GetTimeInSeconds() - time1;
+			settleTimeSec = m_laserDelaySec;
 
 			// Turn off the right laser
 			time1 = GetTimeInSeconds();
-			m_laser->turnOff(Laser::RIGHT_LASER);
-
-			// Turn the left laser on now if it is a dual laser scan to save time later
-			if (useLeftLaser)
 			{
-				m_laser->turnOn(Laser::LEFT_LASER);
-			}
+				TraceScope trace("laser off", frame, Laser::RIGHT_LASER);
+				m_laser->turnOff(Laser::RIGHT_LASER);
 
-			delayAcquisitionForLaser();
+				// Turn the left laser on now if it is a dual laser scan to save time later
+				if (useLeftLaser)
+				{
+					m_laser->turnOn(Laser::LEFT_LASER);
+				}
+
+				delayAcquisitionForLaser();
+			}
 			timingStats->laserTime += GetTimeInSeconds() - time1;
 
+			// This was the last picture of the frame if it is a right laser scan
+			if (!useLeftLaser)
+			{
+				startNextRotation(frame, frameRotation);
+			}
+
 			// Process the right laser results
-			processScan(image1, image2, m_rightLaserResults, frame, rotation, rightLocMapper, Laser::RIGHT_LASER, m_firstRowRightLaserCol, timingStats);
+			processFrame(image1, image2, frame, rotation, Laser::RIGHT_LASER, rightLocMapper, timingStats);
 
 			releaseImage(image2);
 		}
@@ -1084,6 +1360,7 @@ void Scanner::singleScan(int frame, float rotation, float frameRotation,
 			time1 = GetTimeInSeconds();
 			if (!m_laser->isOn(Laser::LEFT_LASER))
 			{
+				TraceScope trace("laser on", frame, Laser::LEFT_LASER);
 				m_laser->turnOn(Laser::LEFT_LASER);
 				delayAcquisitionForLaser();
 			}
@@ -1091,17 +1368,25 @@ void Scanner::singleScan(int frame, float rotation, float frameRotation,
 
 			// Take a picture with the left laser on
 			time1 = GetTimeInSeconds();
-			image2 = acquireImage();
+			{
+				TraceScope trace("acquire", frame, Laser::LEFT_LASER);
+				image2 = acquireSettledImage(settleTimeSec);
+			}
 			timingStats->imageAcquisitionTime += GetTimeInSeconds() - time1;
 
 			// Turn off the left laser
 			time1 = GetTimeInSeconds();
-			m_laser->turnOff(Laser::LEFT_LASER);
-			delayAcquisitionForLaser();
+			{
+				TraceScope trace("laser off", frame, Laser::LEFT_LASER);
+				m_laser->turnOff(Laser::LEFT_LASER);
+				delayAcquisitionForLaser();
+			}
 			timingStats->laserTime += GetTimeInSeconds() - time1;
 
+			startNextRotation(frame, frameRotation);
+
 			// Process the left laser results
-			processScan(image1, image2, m_leftLaserResults, frame, rotation, leftLocMapper, Laser::LEFT_LASER, m_firstRowLeftLaserCol, timingStats);
+			processFrame(image1, image2, frame, rotation, Laser::LEFT_LASER, leftLocMapper, timingStats);
 
 			releaseImage(image2);
 		}
@@ -1117,70 +1402,262 @@ void Scanner::singleScan(int frame, float rotation, float frameRotation,
 	}
 }
 
-bool Scanner::processScan(Image * image1, Image * image2, std::vector<DataPoint> & results, int frame, float rotation, LocationMapper& locMapper, Laser::LaserSide laserSide, int & firstRowLaserCol, TimingStats * timingStats)
+void Scanner::singleCaptureScan(int frame, float rotation, float frameRotation, LocationMapper& leftLocMapper,
+		                        LocationMapper& rightLocMapper, TimingStats * timingStats)
 {
-	int numLocationsMapped = 0;
-	int numRowsBadFromColor = 0;
-	int numRowsBadFromNumRanges = 0;
-
-	// Send the pictures off for processing
-	double time1 = GetTimeInSeconds();
-	int numLocations = m_imageProcessor->process(* image1,
-												* image2,
-												NULL,
-												m_laserLocations,
-												m_maxNumLocations,
-												firstRowLaserCol,
-												numRowsBadFromColor,
-												numRowsBadFromNumRanges,
-												NULL);
+	Image * image = NULL;
 
-	timingStats->imageProcessingTime += GetTimeInSeconds() - time1;
+	// Ensure that the image gets released back to the camera
+	try
+	{
+		double time1;
 
-	// If we had major problems with this frame, try it again
-	InfoLog << "numRowsBadFromColor: " << numRowsBadFromColor << Logger::ENDL;
-	InfoLog << "numRowsBadFromNumRanges: " << numRowsBadFromNumRanges << Logger::ENDL;
+		// Refresh the background with the lasers off every few frames
+		bool captureBackground = m_backgroundModel->size() == 0 || frame % m_backgroundInterval == 0;
+		if (captureBackground)
+		{
+			if (m_laser->isOn(Laser::RIGHT_LASER) || m_laser->isOn(Laser::LEFT_LASER))
+			{
+				time1 = GetTimeInSeconds();
+				{
+					TraceScope trace("laser off", frame, Laser::ALL_LASERS);
+					m_laser->turnOff(Laser::ALL_LASERS);
+					delayAcquisitionForLaser();
+				}
+				timingStats->laserTime += GetTimeInSeconds() - time1;
+			}
 
-	if (numRowsBadFromNumRanges > m_maxNumFailedRows)
-	{
-		InfoLog << "!! Too many bad laser locations suspected"
-				  << ", numRowsBadFromColor=" << numRowsBadFromColor
-				  << ", numRowsBadFromNumRanges=" << numRowsBadFromNumRanges
-				  << Logger::ENDL;
-	}
+			time1 = GetTimeInSeconds();
+			{
+				TraceScope trace("acquire", frame);
+				image = acquireSettledImage(m_maxTableSettleTimeSec);
+			}
+			timingStats->imageAcquisitionTime += GetTimeInSeconds() - time1;
 
-	InfoLog << "Detected " << numLocations << " laser pixels." << Logger::ENDL;
+			// If this is the first image, save it as a thumbnail
+			if (frame == 0)
+			{
+				std::string thumbnail = m_filename + ".png";
 
-	// Lookup the 3D locations for the laser points
-	numLocationsMapped = 0;
+				PixelLocationWriter imageWriter;
+				imageWriter.writeImage(* image, 128, 96, thumbnail.c_str());
+			}
 
-	if (numLocations > 0)
-	{
-		time1 = GetTimeInSeconds();
-		locMapper.mapPoints(m_laserLocations, image1, m_columnPoints, numLocations, numLocationsMapped);
+			m_backgroundModel->add(* image, rotation);
+			releaseImage(image);
+			image = NULL;
 
-		// Remove the noisy points
-		NoiseRemover().removeNoise(m_laserLocations, m_columnPoints, numLocationsMapped, numLocationsMapped);
+			// The frames since the last background can be processed now that the next one is known
+			flushDeferredFrames(leftLocMapper, rightLocMapper, timingStats);
 
-		timingStats->pointMappingTime += GetTimeInSeconds() - time1;
+			time1 = GetTimeInSeconds();
+			{
+				TraceScope trace("laser on", frame, Laser::ALL_LASERS);
+				m_laser->turnOn(Laser::ALL_LASERS);
+				delayAcquisitionForLaser();
+			}
+			timingStats->laserTime += GetTimeInSeconds() - time1;
+		}
 
-		if (numLocations != numLocationsMapped)
+		// Take a picture with both lasers on
+		time1 = GetTimeInSeconds();
 		{
-			InfoLog << "Discarded " << numLocations - numLocationsMapped << " points." << Logger::ENDL;
+			TraceScope trace("acquire", frame, Laser::ALL_LASERS);
+			image = acquireSettledImage(captureBackground ? m_laserDelaySec : m_maxTableSettleTimeSec);
 		}
+		timingStats->imageAcquisitionTime += GetTimeInSeconds() - time1;
+
+		startNextRotation(frame, frameRotation);
+
+		// Frames without their own background wait for the next one
+		Image * background = captureBackground ? m_backgroundModel->getBackground(rotation) : NULL;
+		int centerCol = image->getWidth() / 2;
+
+		// The right laser is right of center and the left laser is left of it
+		processFrame(background, image, frame, rotation, Laser::RIGHT_LASER, rightLocMapper, timingStats, centerCol, image->getWidth());
+		processFrame(background, image, frame, rotation, Laser::LEFT_LASER, leftLocMapper, timingStats, 0, centerCol);
+
+		releaseImage(image);
 	}
-	else
+	catch (...)
+	{
+		releaseImage(image);
+		throw;
+	}
+}
+
+void Scanner::processFrame(Image * background, Image * image, int frame, float rotation, Laser::LaserSide laserSide,
+		                   LocationMapper& locMapper, TimingStats * timingStats, int firstCol, int endCol)
+{
+	if (background == NULL)
+	{
+		// Keep a copy since the image goes back to the camera.  Both halves of a dual laser image share one copy.
+		Image * copy = NULL;
+		if (!m_deferredFrames.empty() && m_deferredFrames.back().frame == frame && m_deferredSource == image)
+		{
+			copy = m_deferredFrames.back().image;
+		}
+		else
+		{
+			std::auto_ptr<Image> newCopy(new Image(* image));
+			m_deferredImages.push_back(newCopy.get());
+			copy = newCopy.release();
+		}
+
+		DeferredFrame deferred;
+		deferred.frame = frame;
+		deferred.rotation = rotation;
+		deferred.laserSide = laserSide;
+		deferred.image = copy;
+		deferred.firstCol = firstCol;
+		deferred.endCol = endCol;
+
+		m_deferredFrames.push_back(deferred);
+		m_deferredSource = image;
+		return;
+	}
+
+	bool rightLaser = laserSide == Laser::RIGHT_LASER;
+	if (!processScan(background, image, rightLaser ? m_rightLaserResults : m_leftLaserResults, frame, rotation, locMapper, laserSide,
+			         rightLaser ? m_firstRowRightLaserCol : m_firstRowLeftLaserCol, timingStats, firstCol, endCol))
+	{
+		addFailedFrame(frame, rotation, laserSide);
+	}
+}
+
+void Scanner::flushDeferredFrames(LocationMapper& leftLocMapper, LocationMapper& rightLocMapper, TimingStats * timingStats)
+{
+	if (m_deferredFrames.empty())
+	{
+		return;
+	}
+
+	// Ensure that the deferred images get freed
+	try
+	{
+		Image * first = m_deferredFrames.front().image;
+		Image background(first->getWidth(), first->getHeight(), first->getNumComponents());
+
+		// The frames were deferred in order so the results stay sorted by frame
+		for (size_t iFrame = 0; iFrame < m_deferredFrames.size(); iFrame++)
+		{
+			const DeferredFrame& deferred = m_deferredFrames[iFrame];
+			if (!m_backgroundModel->interpolate(deferred.rotation, background))
+			{
+				throw Exception("There is no background for the deferred frames");
+			}
+
+			LocationMapper& locMapper = deferred.laserSide == Laser::RIGHT_LASER ? rightLocMapper : leftLocMapper;
+			processFrame(&background, deferred.image, deferred.frame, deferred.rotation, deferred.laserSide,
+					     locMapper, timingStats, deferred.firstCol, deferred.endCol);
+		}
+	}
+	catch (...)
+	{
+		clearDeferredFrames();
+		throw;
+	}
+
+	clearDeferredFrames();
+}
+
+void Scanner::clearDeferredFrames()
+{
+	for (size_t iImage = 0; iImage < m_deferredImages.size(); iImage++)
+	{
+		delete m_deferredImages[iImage];
+	}
+
+	m_deferredImages.clear();
+	m_deferredFrames.clear();
+	m_deferredSource = NULL;
+}
+
+bool Scanner::processScan(Image * image1, Image * image2, std::vector<DataPoint> & results, int frame, float rotation, LocationMapper& locMapper, Laser::LaserSide laserSide, int & firstRowLaserCol, TimingStats * timingStats,
+		                  int firstCol, int endCol)
+{
+	int numLocationsMapped = 0;
+	int numRowsBadFromColor = 0;
+	int numRowsBadFromNumRanges = 0;
+
+	// Send the pictures off for processing
+	double time1 = GetTimeInSeconds();
+	int numLocations;
+	{
+		TraceScope trace("process", frame, laserSide);
+		numLocations = m_imageProcessor->process(* image1,
+												 * image2,
+												 NULL,
+												 m_laserLocations,
+												 m_maxNumLocations,
+												 firstRowLaserCol,
+												 numRowsBadFromColor,
+												 numRowsBadFromNumRanges,
+												 NULL,
+												 firstCol,
+												 endCol);
+	}
+
+	timingStats->imageProcessingTime += GetTimeInSeconds() - time1;
+
+	// If we had major problems with this frame, try it again
+	DebugLog << "numRowsBadFromColor: " << numRowsBadFromColor << Logger::ENDL;
+	DebugLog << "numRowsBadFromNumRanges: " << numRowsBadFromNumRanges << Logger::ENDL;
+
+	Metrics * metrics = Metrics::get();
+	metrics->rowsBadFromColor.increment(numRowsBadFromColor);
+	metrics->rowsBadFromNumRanges.increment(numRowsBadFromNumRanges);
+
+	// The frame is still used but it is captured again at the end of the scan if possible
+	bool passed = numLocations > 0;
+
+	if (numRowsBadFromNumRanges > m_maxNumFailedRows)
+	{
+		InfoLog << "!! Too many bad laser locations suspected"
+				  << ", numRowsBadFromColor=" << numRowsBadFromColor
+				  << ", numRowsBadFromNumRanges=" << numRowsBadFromNumRanges
+				  << Logger::ENDL;
+
+		passed = false;
+	}
+
+	DebugLog << "Detected " << numLocations << " laser pixels." << Logger::ENDL;
+
+	// Lookup the 3D locations for the laser points
+	numLocationsMapped = 0;
+
+	if (numLocations > 0)
+	{
+		time1 = GetTimeInSeconds();
+		TraceScope trace("map", frame, laserSide);
+		locMapper.mapPoints(m_laserLocations, image1, m_columnPoints, numLocations, numLocationsMapped);
+
+		// Remove the noisy points
+		NoiseRemover().removeNoise(m_laserLocations, m_columnPoints, numLocationsMapped, numLocationsMapped);
+
+		timingStats->pointMappingTime += GetTimeInSeconds() - time1;
+
+		if (numLocations != numLocationsMapped)
+		{
+			DebugLog << "Discarded " << numLocations - numLocationsMapped << " points." << Logger::ENDL;
+		}
+	}
+	else
 	{
 		// Stop here if we didn't detect the laser at all
 		ErrorLog << "!!! Could not detect laser at all" << Logger::ENDL;
 		timingStats->numEmptyFrames++;
+		metrics->emptyFrames.increment();
 	}
 
+	metrics->pointsPerFrame.observe(numLocationsMapped);
+
 
 	// Map the points if there was something to map
 	if (numLocationsMapped > 0)
 	{
 		time1 = GetTimeInSeconds();
+		TraceScope trace("filter", frame, laserSide);
 
 		if (m_writeRangeCsvEnabled)
 		{
@@ -1215,7 +1692,163 @@ bool Scanner::processScan(Image * image1, Image * image2, std::vector<DataPoint>
 		timingStats->pointProcessingTime += GetTimeInSeconds() - time1;
 	}
 
-	return true;
+	return passed;
+}
+
+void Scanner::addFailedFrame(int frame, float rotation, Laser::LaserSide laserSide)
+{
+	FailedFrame failedFrame;
+	failedFrame.frame = frame;
+	failedFrame.rotation = rotation;
+	failedFrame.laserSide = laserSide;
+
+	m_failedFrames.push_back(failedFrame);
+
+	InfoLog << "Frame " << frame << " failed the quality checks and will be captured again." << Logger::ENDL;
+}
+
+void Scanner::rescanFailedFrames(real tableRotation, real frameRadians, LocationMapper& leftLocMapper,
+		                         LocationMapper& rightLocMapper, TimingStats * timingStats)
+{
+	if (m_failedFrames.empty() || m_maxNumFrameRetries <= 1)
+	{
+		return;
+	}
+
+	size_t maxNumFailedFrames = MAX(1, (size_t) (timingStats->numFrames * MAX_RESCAN_FRAME_FRACTION));
+	if (m_failedFrames.size() > maxNumFailedFrames)
+	{
+		ErrorLog << m_failedFrames.size() << " frames failed the quality checks, which is too many to capture again." << Logger::ENDL;
+		return;
+	}
+
+	InfoLog << "Capturing " << m_failedFrames.size() << " failed frames again..." << Logger::ENDL;
+	m_progress.setLabel("Rescanning failed frames");
+
+	for (size_t iFail = 0; iFail < m_failedFrames.size() && !m_stopRequested; iFail++)
+	{
+		const FailedFrame& failedFrame = m_failedFrames[iFail];
+		bool rightLaser = failedFrame.laserSide == Laser::RIGHT_LASER;
+
+		// The frame was captured after the table turned one frame past its rotation
+		rotateTableTo(tableRotation, failedFrame.rotation + frameRadians);
+
+		bool passed = false;
+		for (int iTry = 1; iTry < m_maxNumFrameRetries && !passed; iTry++)
+		{
+			timingStats->numFrameRetries++;
+			Metrics::get()->frameRetries.increment();
+
+			std::vector<DataPoint> frameResults;
+			passed = recaptureFrame(failedFrame, frameResults,
+					                rightLaser ? rightLocMapper : leftLocMapper,
+					                rightLaser ? m_firstRowRightLaserCol : m_firstRowLeftLaserCol,
+					                timingStats);
+
+			if (passed)
+			{
+				replaceFrameResults(rightLaser ? m_rightLaserResults : m_leftLaserResults, failedFrame.frame, frameResults);
+			}
+		}
+
+		if (!passed)
+		{
+			InfoLog << "Frame " << failedFrame.frame << " failed every retry, keeping its first capture." << Logger::ENDL;
+		}
+
+		m_progress.setPercent(100.0 * (iFail + 1) / m_failedFrames.size());
+	}
+}
+
+bool Scanner::recaptureFrame(const FailedFrame& failedFrame, std::vector<DataPoint>& results, LocationMapper& locMapper,
+		                     int & firstRowLaserCol, TimingStats * timingStats)
+{
+	TraceScope trace("recapture", failedFrame.frame, failedFrame.laserSide);
+
+	Image * image1 = NULL;
+	Image * image2 = NULL;
+	bool passed = false;
+
+	// Ensure that the images get released back to the camera
+	try
+	{
+		// Take a picture with the laser off
+		image1 = acquireSettledImage(m_maxTableSettleTimeSec);
+
+		// Take a picture with the laser on
+		m_laser->turnOn(failedFrame.laserSide);
+		delayAcquisitionForLaser();
+
+		image2 = acquireSettledImage(m_laserDelaySec);
+
+		m_laser->turnOff(failedFrame.laserSide);
+		delayAcquisitionForLaser();
+
+		passed = processScan(image1, image2, results, failedFrame.frame, failedFrame.rotation, locMapper,
+				             failedFrame.laserSide, firstRowLaserCol, timingStats);
+	}
+	catch (...)
+	{
+		releaseImage(image1);
+		releaseImage(image2);
+		throw;
+	}
+
+	releaseImage(image1);
+	releaseImage(image2);
+
+	return passed;
+}
+
+void Scanner::rotateTableTo(real& tableRotation, real rotation)
+{
+	real delta = rotation - tableRotation;
+
+	// The frame can be reached either way on a full revolution so take the shorter one
+	if (m_range > 359)
+	{
+		delta = fmod(delta, (real) (2 * PI));
+		if (delta > PI)
+		{
+			delta -= 2 * PI;
+		}
+		else if (delta < -PI)
+		{
+			delta += 2 * PI;
+		}
+	}
+
+	if (delta < 0)
+	{
+		// Approach the frame going forward like it was originally approached so the gear backlash is the same
+		m_turnTable->rotate(delta - RESCAN_BACKLASH_RADIANS);
+		m_turnTable->rotate(RESCAN_BACKLASH_RADIANS);
+	}
+	else if (delta > 0)
+	{
+		m_turnTable->rotate(delta);
+	}
+
+	delayAcquisitionForTable();
+	tableRotation += delta;
+}
+
+void Scanner::replaceFrameResults(std::vector<DataPoint>& results, int frame, const std::vector<DataPoint>& frameResults)
+{
+	DataPoint key;
+	key.frame = frame;
+
+	m_results.enter();
+
+	// The results are in frame order
+	std::vector<DataPoint>::iterator begin = std::lower_bound(results.begin(), results.end(), key, CompareFrames);
+	std::vector<DataPoint>::iterator end = std::upper_bound(begin, results.end(), key, CompareFrames);
+
+	size_t index = begin - results.begin();
+	results.erase(begin, end);
+	results.insert(results.begin() + index, frameResults.begin(), frameResults.end());
+
+	m_results.leave();
 }
 
 void Scanner::rotatePoints(ColoredPoint * points, float theta, int numPoints)
@@ -1289,6 +1922,51 @@ void Scanner::writeRangePoints(ColoredPoint * points, int numLocationsMapped, La
 	m_rangeFout << std::endl;
 }
 
+void Scanner::getTimingStats(const Scanner::TimingStats& stats, std::map<std::string, real>& details)
+{
+	details["imageAcquisitionTime"] = stats.imageAcquisitionTime;
+	details["imageProcessingTime"] = stats.imageProcessingTime;
+	details["pointMappingTime"] = stats.pointMappingTime;
+	details["rotationTime"] = stats.rotationTime;
+	details["pointProcessingTime"] = stats.pointProcessingTime;
+	details["plyWritingTime"] = stats.plyWritingTime;
+	details["stlWritingTime"] = stats.stlWritingTime;
+	details["xyzWritingTime"] = stats.xyzWritingTime;
+	details["facetizationTime"] = stats.facetizationTime;
+	details["laserTime"] = stats.laserTime;
+	details["laserMergeTime"] = stats.laserMergeTime;
+	details["elapsedTime"] = GetTimeInSeconds() - stats.startTime;
+	details["numFrameRetries"] = stats.numFrameRetries;
+	details["numFrames"] = stats.numFrames;
+	details["numEmptyFrames"] = stats.numEmptyFrames;
+}
+
+void Scanner::recordFrameMetrics(const Scanner::TimingStats& before, const Scanner::TimingStats& after)
+{
+	Metrics * metrics = Metrics::get();
+
+	metrics->framesProcessed.increment();
+	metrics->frameRetries.increment(after.numFrameRetries - before.numFrameRetries);
+
+	metrics->observeStage(Metrics::MS_ROTATION, after.rotationTime - before.rotationTime);
+	metrics->observeStage(Metrics::MS_IMAGE_ACQUISITION, after.imageAcquisitionTime - before.imageAcquisitionTime);
+	metrics->observeStage(Metrics::MS_LASER, after.laserTime - before.laserTime);
+	metrics->observeStage(Metrics::MS_IMAGE_PROCESSING, after.imageProcessingTime - before.imageProcessingTime);
+	metrics->observeStage(Metrics::MS_POINT_MAPPING, after.pointMappingTime - before.pointMappingTime);
+	metrics->observeStage(Metrics::MS_POINT_PROCESSING, after.pointProcessingTime - before.pointProcessingTime);
+}
+
+void Scanner::publishTimingStats(const Scanner::TimingStats& stats)
+{
+	std::map<std::string, real> details;
+	getTimingStats(stats, details);
+
+	for (std::map<std::string, real>::iterator it = details.begin(); it != details.end(); ++it)
+	{
+		m_progress.setDetail(it->first, it->second);
+	}
+}
+
 void Scanner::logTimingStats(std::ostream& out, const Scanner::TimingStats& stats)
 {
 	// Prevent divide by zero
@@ -1329,74 +2007,241 @@ void Scanner::logTimingStats(std::ostream& out, const Scanner::TimingStats& stat
 }
 
 
-std::vector<ScanResult> Scanner::getPastScanResults()
+bool Scanner::getPastScanTimingStats(time_t scanDate, std::map<std::string, real>& stats)
 {
-	std::string scanOutputDir = GetScanOutputDir();
-	DIR * dirp = opendir(scanOutputDir.c_str());
-	if (dirp == NULL)
+	std::stringstream filename;
+	filename << GetScanOutputDir() << "/" << scanDate << ".log";
+
+	if (access(filename.str().c_str(), R_OK) != 0)
 	{
-		throw Exception("Error opening scan directory: " + scanOutputDir);
+		return false;
 	}
 
-	struct dirent *dp = readdir(dirp);
+	PropertyReaderWriter propReader;
+	std::vector<Property> properties = propReader.readProperties(filename.str());
+
+	const std::string prefix = TIMING_PROPERTY_PREFIX;
+	for (size_t iProp = 0; iProp < properties.size(); iProp++)
+	{
+		const Property& prop = properties[iProp];
+		if (StartsWith(prop.name, prefix))
+		{
+			stats[prop.name.substr(prefix.size())] = ToReal(prop.value);
+		}
+	}
 
-	std::map<std::string, ScanResult> scanResultMap;
+	return !stats.empty();
+}
 
-	while (dp != NULL)
+bool Scanner::measureAccuracy(const std::vector<DataPoint>& results, real groundPlaneHeight, std::map<std::string, real>& accuracy)
+{
+	MockCamera * mockCamera = dynamic_cast<MockCamera *>(m_camera);
+	if (!IsMockHardware() || mockCamera == NULL)
 	{
-		std::string name = dp->d_name;
-		size_t dotPos = name.find_last_of(".");
+		return false;
+	}
 
-		if (name != "." && name != ".." && dotPos != std::string::npos)
-		{
-			std::string extension = name.substr(dotPos + 1);
-			std::string base = name.substr(0, dotPos);
+	TraceScope trace("accuracy");
+
+	// The results are relative to the ground plane but the scene is relative to the table
+	std::vector<ColoredPoint> points;
+	points.reserve(results.size());
+	for (size_t iRes = 0; iRes < results.size(); iRes++)
+	{
+		ColoredPoint point = results[iRes].point;
+		point.y += groundPlaneHeight;
+		points.push_back(point);
+	}
+
+	MockScene::ErrorStats stats;
+	mockCamera->getScene().measureError(points, stats);
+
+	accuracy["numPoints"] = stats.numPoints;
+	accuracy["meanError"] = stats.meanError;
+	accuracy["rmsError"] = stats.rmsError;
+	accuracy["maxError"] = stats.maxError;
+	accuracy["percentWithin1mm"] = stats.percentWithin1mm;
+
+	return true;
+}
+
+void Scanner::updateProgress(double progress, const TimingStats& timingStats)
+{
+	// The remaining time can't be estimated until some of the scan is complete
+	if (progress <= 0)
+	{
+		return;
+	}
+
+	double timeElapsed = GetTimeInSeconds() - timingStats.startTime;
+	double percentComplete = 100.0 * progress;
+	double fullTimeSec = timeElapsed / progress;
+	double remainingSec = fullTimeSec - timeElapsed;
+
+	m_status.enter();
+	m_remainingTime = remainingSec;
+	m_status.leave();
 
-			std::string fullPath = scanOutputDir + "/" + name;
-			ScanResultFile file;
+	// Sent to the progress listeners along with the percent
+	m_progress.setDetail("remainingTime", remainingSec);
+	publishTimingStats(timingStats);
 
-			struct stat st;
-			if (stat(fullPath.c_str(), &st) == 0)
+	m_progress.setPercent(progress * 100);
+
+	// Only format the timing stats if they will be logged
+	if (DebugLog.isEnabled())
+	{
+		std::stringstream sstr;
+		logTimingStats(sstr, timingStats);
+		DebugLog << sstr.str();
+	}
+
+	InfoLog << percentComplete << "% Complete, " << (remainingSec / 60) << " minutes remaining." << Logger::ENDL;
+}
+
+void Scanner::runContinuousScan(real rangeRadians, real frameRadians, LocationMapper& leftLocMapper,
+		                        LocationMapper& rightLocMapper, TimingStats * timingStats)
+{
+	// Only one laser can be used since it stays on while the table turns
+	Laser::LaserSide laserSide = m_laserSelection == Laser::LEFT_LASER ? Laser::LEFT_LASER : Laser::RIGHT_LASER;
+	if (m_laserSelection == Laser::ALL_LASERS)
+	{
+		InfoLog << "Continuous rotation scans only use the right laser" << Logger::ENDL;
+	}
+
+	bool rightLaser = laserSide == Laser::RIGHT_LASER;
+	std::vector<DataPoint>& results = rightLaser ? m_rightLaserResults : m_leftLaserResults;
+	LocationMapper& locMapper = rightLaser ? rightLocMapper : leftLocMapper;
+	int & firstRowLaserCol = rightLaser ? m_firstRowRightLaserCol : m_firstRowLeftLaserCol;
+
+	// The frame was exposed over the frame period before the camera delivered it
+	double exposureOffsetSec = 0.5 / MAX(1, m_camera->getCameraResolution().frameRate);
+
+	BackgroundModel backgroundModel(m_maxContinuousBackgrounds);
+	Image * image = NULL;
+
+	// Record the laser-off background on the first turn of the table
+	m_progress.setLabel("Recording the background");
+	{
+		TraceScope trace("background");
+		ContinuousRotator rotator(m_turnTable, m_continuousRotationSpeed, rangeRadians);
+		rotator.execute();
+
+		try
+		{
+			real nextRotation = 0;
+			while (!rotator.isComplete() && !m_stopRequested)
 			{
-				file.fileSize = st.st_size;
+				image = acquireImage();
+
+				real rotation = rotator.getRotationAt(image->getTimestamp() - exposureOffsetSec);
+				if (rotation >= nextRotation)
+				{
+					// Save the first background as the thumbnail
+					if (backgroundModel.size() == 0)
+					{
+						std::string thumbnail = m_filename + ".png";
+
+						PixelLocationWriter imageWriter;
+						imageWriter.writeImage(* image, 128, 96, thumbnail.c_str());
+					}
+
+					backgroundModel.add(* image, rotation);
+					nextRotation = rotation + m_continuousBackgroundRadians;
+
+					updateProgress(0.5 * MIN(rotation / rangeRadians, 1.0), * timingStats);
+				}
+
+				releaseImage(image);
+				image = NULL;
 			}
-			else
+		}
+		catch (...)
+		{
+			releaseImage(image);
+			rotator.stop();
+			rotator.join();
+			throw;
+		}
+
+		rotator.stop();
+		rotator.join();
+	}
+
+	if (m_stopRequested)
+	{
+		return;
+	}
+
+	InfoLog << "Recorded " << backgroundModel.size() << " background images" << Logger::ENDL;
+
+	// Turn back to where the scan started, which is a no-op for a full revolution
+	real tableRotation = rangeRadians;
+	rotateTableTo(tableRotation, 0);
+
+	m_progress.setLabel("Scanning");
+	m_laser->turnOn(laserSide);
+
+	// Wait for the table to stop wobbling and for the camera to see the laser
+	Thread::usleep((unsigned long) (m_maxTableSettleTimeSec * 1000000.0));
+
+	// Scan with the laser on during the second turn
+	ContinuousRotator rotator(m_turnTable, m_continuousRotationSpeed, rangeRadians);
+	rotator.execute();
+
+	try
+	{
+		int frame = 0;
+		real nextRotation = 0;
+		while (!rotator.isComplete() && !m_stopRequested)
+		{
+			double time1 = GetTimeInSeconds();
 			{
-				file.fileSize = 0;
-				ErrorLog << "Error obtaining stats on file: " << fullPath << ", error=" << strerror(errno) << Logger::ENDL;
+				TraceScope trace("acquire", frame, laserSide);
+				image = acquireImage();
 			}
+			timingStats->imageAcquisitionTime += GetTimeInSeconds() - time1;
 
-			file.extension = extension;
-			file.creationTime = atol(base.c_str());
+			real rotation = rotator.getRotationAt(image->getTimestamp() - exposureOffsetSec);
 
-			scanResultMap[base].files.push_back(file);
-		}
+			// Skip the frames that are closer together than the frames per revolution
+			if (rotation >= nextRotation)
+			{
+				Image * background = backgroundModel.getBackground(rotation);
+				if (background == NULL)
+				{
+					throw Exception("No background images were recorded");
+				}
 
-		dp = readdir(dirp);
-	}
+				timingStats->numFrames++;
+				Scanner::TimingStats frameStats = * timingStats;
+				processScan(background, image, results, frame, rotation, locMapper, laserSide, firstRowLaserCol, timingStats);
+				recordFrameMetrics(frameStats, * timingStats);
 
-	closedir(dirp);
+				frame++;
+				nextRotation = rotation + frameRadians;
 
-	//
-	// Turn the map into a vector
-	//
-	std::vector<ScanResult> results;
+				updateProgress(0.5 + 0.5 * MIN(rotation / rangeRadians, 1.0), * timingStats);
+			}
 
-	std::map<std::string, ScanResult>::iterator it = scanResultMap.begin();
-	while (it != scanResultMap.end())
+			releaseImage(image);
+			image = NULL;
+		}
+	}
+	catch (...)
 	{
-		std::sort(it->second.files.begin(), it->second.files.end(), CompareScanResultFiles);
-		results.push_back(it->second);
-		it++;
+		releaseImage(image);
+		m_laser->turnOff(laserSide);
+		rotator.stop();
+		rotator.join();
+		throw;
 	}
 
-	// Sort the results
-	std::sort(results.begin(), results.end(), CompareScanResults);
-
-	return results;
+	m_laser->turnOff(laserSide);
+	rotator.stop();
+	rotator.join();
 }
 
-
 Image * Scanner::acquireImage()
 {
 	Image * image = m_camera->acquireImage();
@@ -1418,7 +2263,63 @@ void Scanner::releaseImage(Image * image)
 
 void Scanner::delayAcquisitionForLaser()
 {
-	m_camera->setAcquisitionDelay(m_laserDelaySec);
+	if (m_settleDetector == NULL)
+	{
+		m_camera->setAcquisitionDelay(m_laserDelaySec);
+	}
+	else
+	{
+		m_settleDetector->sceneChanged(SettleDetector::SC_LASER_CHANGED);
+	}
+}
+
+void Scanner::rotateToNextFrame(float frameRotation)
+{
+	if (m_tableRotating)
+	{
+		waitForRotation();
+	}
+	else
+	{
+		m_turnTable->rotate(frameRotation);
+	}
+}
+
+void Scanner::startNextRotation(int frame, float frameRotation)
+{
+	if (frame + 1 < m_numFrames && !m_stopRequested && !m_tableRotating)
+	{
+		TraceScope trace("start rotate", frame + 1);
+		m_turnTable->startRotation(frameRotation);
+		m_tableRotating = true;
+	}
+}
+
+void Scanner::waitForRotation()
+{
+	if (m_tableRotating)
+	{
+		m_tableRotating = false;
+		m_turnTable->waitForRotation();
+	}
+}
+
+void Scanner::delayAcquisitionForTable()
+{
+	if (m_settleDetector != NULL)
+	{
+		m_settleDetector->sceneChanged(SettleDetector::SC_TABLE_MOVED);
+	}
+}
+
+Image * Scanner::acquireSettledImage(double maxSettleTimeSec)
+{
+	if (m_settleDetector == NULL)
+	{
+		return acquireImage();
+	}
+
+	return m_settleDetector->acquireSettledImage(maxSettleTimeSec);
 }
 
 } // ns sdl
@@ -34,6 +34,9 @@ class TurnTable;
 class Camera;
 class Laser;
 class LocationMapper;
+class JpegWriter;
+class SettleDetector;
+class BackgroundModel;
 
 class Scanner : public Thread
 {
@@ -62,9 +65,10 @@ public:
 	void setTask(Scanner::Task task);
 
 	/**
-	 * Returns the past scan results.
+	 * Reads the timing stats that were recorded in the log of a past scan.
+	 * Returns false if the scan has no log or the log predates timing stats being recorded.
 	 */
-	std::vector<ScanResult> getPastScanResults();
+	bool getPastScanTimingStats(time_t scanDate, std::map<std::string, real>& stats);
 
 	void setRange(real range);
 
@@ -132,15 +136,121 @@ private:
 			        LocationMapper& leftLocMapper,
 			        LocationMapper& rightLocMapper,
 			        TimingStats * timingStats);
+
+	/**
+	 * Captures both lasers in one picture and separates them by image half, the left laser
+	 * is left of center and the right laser is right of it.  The lasers stay on between frames
+	 * and are only turned off to refresh the background every m_backgroundInterval frames.
+	 */
+	void singleCaptureScan(int frame, float rotation, float frameRotation, LocationMapper& leftLocMapper,
+			               LocationMapper& rightLocMapper, TimingStats * timingStats);
+
+	/** Turns the table to the frame unless startNextRotation() already started turning it there */
+	void rotateToNextFrame(float frameRotation);
+
+	/**
+	 * Starts turning the table to the next frame once the frame's pictures are taken so the
+	 * frame is processed while the table turns.  Does nothing after the last frame.
+	 */
+	void startNextRotation(int frame, float frameRotation);
+
+	/** Waits for the table to finish a rotation started by startNextRotation() */
+	void waitForRotation();
 	void logTimingStats(std::ostream& out, const TimingStats& stats);
 
+	/** A frame that failed the quality checks for one of the lasers */
+	struct FailedFrame
+	{
+		int frame;
+		float rotation;
+		Laser::LaserSide laserSide;
+	};
+
+	/** A laser image, or the part of it for one laser, that is waiting for the next laser-off picture to be processed */
+	struct DeferredFrame
+	{
+		int frame;
+		float rotation;
+		Laser::LaserSide laserSide;
+		Image * image;
+		int firstCol;
+		int endCol;
+	};
+
+	/**
+	 * Processes the laser image against the background or, if background is NULL, keeps a copy
+	 * of it until the next laser-off picture is taken so its background can be interpolated.
+	 */
+	void processFrame(Image * background, Image * image, int frame, float rotation, Laser::LaserSide laserSide,
+			          LocationMapper& locMapper, TimingStats * timingStats, int firstCol = 0, int endCol = -1);
+
+	/** Processes the deferred frames against backgrounds interpolated from the background model */
+	void flushDeferredFrames(LocationMapper& leftLocMapper, LocationMapper& rightLocMapper, TimingStats * timingStats);
+
+	/** Frees the deferred frames without processing them */
+	void clearDeferredFrames();
+
+	/** Records that the frame should be captured again at the end of the scan */
+	void addFailedFrame(int frame, float rotation, Laser::LaserSide laserSide);
+
+	/**
+	 * Turns the table back to each frame that failed the quality checks and captures it
+	 * again until it passes or it has been tried m_maxNumFrameRetries times.
+	 * The results of the frame are replaced once a capture passes.
+	 * @param tableRotation - Where the table is relative to where the scan started.
+	 */
+	void rescanFailedFrames(real tableRotation, real frameRadians, LocationMapper& leftLocMapper,
+			                LocationMapper& rightLocMapper, TimingStats * timingStats);
+
+	/** Captures and processes the failed frame, returning true if it passed the quality checks */
+	bool recaptureFrame(const FailedFrame& failedFrame, std::vector<DataPoint>& results, LocationMapper& locMapper,
+			            int & firstRowLaserCol, TimingStats * timingStats);
+
+	/** Turns the table from tableRotation to the given rotation and updates tableRotation */
+	void rotateTableTo(real& tableRotation, real rotation);
+
+	/** Replaces the results of the frame with frameResults */
+	void replaceFrameResults(std::vector<DataPoint>& results, int frame, const std::vector<DataPoint>& frameResults);
+
+	/** Lists the timing stats by name */
+	void getTimingStats(const TimingStats& stats, std::map<std::string, real>& details);
+
+	/**
+	 * Compares the results to the true shape of the simulated object, in mm, so
+	 * faster processing settings can be weighed against how much accuracy they cost.
+	 * Returns false when the camera isn't simulated.
+	 */
+	bool measureAccuracy(const std::vector<DataPoint>& results, real groundPlaneHeight, std::map<std::string, real>& accuracy);
+
+	/** Adds the time each stage took in the last frame to the metrics */
+	void recordFrameMetrics(const TimingStats& before, const TimingStats& after);
+
+	/** Reports the timing stats as details of the progress */
+	void publishTimingStats(const TimingStats& stats);
+
+	/** Updates the progress and remaining time from the fraction of the scan that is complete */
+	void updateProgress(double progress, const TimingStats& timingStats);
+
+	/**
+	 * Scans while the table turns without stopping.  The table turns once with the laser off
+	 * to record the background and again with the laser on.  Each video frame is given the
+	 * rotation of the table at the time it was captured.
+	 */
+	void runContinuousScan(real rangeRadians, real frameRadians, LocationMapper& leftLocMapper,
+			               LocationMapper& rightLocMapper, TimingStats * timingStats);
+
+	/** Writes the stage timing of every frame as Chrome trace JSON next to the scan */
+	void writeTrace();
+
 	/** Free the points data */
 	void clearPoints();
 
 	/**
 	 * Returns true if the scan was processed successfully and false if there was a problem and the frame needs to be again.
+	 * The results are added either way so the frame isn't lost if it can't be captured again.
 	 */
-	bool processScan(Image * image1, Image * image2, std::vector<DataPoint> & results, int frame, float rotation, LocationMapper& locMapper, Laser::LaserSide laserSide, int & firstRowLaserCol, TimingStats * timingStats);
+	bool processScan(Image * image1, Image * image2, std::vector<DataPoint> & results, int frame, float rotation, LocationMapper& locMapper, Laser::LaserSide laserSide, int & firstRowLaserCol, TimingStats * timingStats,
+			         int firstCol = 0, int endCol = -1);
 
 	void writeRangePoints(ColoredPoint * points, int numLocationsMapped,Laser::LaserSide laserSide);
 
@@ -163,10 +273,22 @@ private:
 
 	/**
 	 * Ensures that the "laser delay" amount of time has passed before the next
-	 * picture will be taken.
+	 * picture will be taken.  Settle detection waits for the laser instead when it is enabled.
 	 */
 	void delayAcquisitionForLaser();
 
+	/**
+	 * Lets settle detection know that the table just stopped moving.
+	 * The turn table waits out the stability delay itself when it is disabled.
+	 */
+	void delayAcquisitionForTable();
+
+	/**
+	 * Acquires an image once the scene has settled if settle detection is enabled,
+	 * waiting at most maxSettleTimeSec.  Otherwise it acquires it after the fixed delays.
+	 */
+	Image * acquireSettledImage(double maxSettleTimeSec);
+
 	/**
 	 * Draws a cross hair around pixel
 	 */
@@ -180,7 +302,7 @@ private:
 	/**
 	 *  Write the next set of photos in the sequence.
 	 */
-	void writePhotos(int frame, real frameRadians);
+	void writePhotos(int frame, real frameRadians, JpegWriter& photoWriter);
 
 private:
 	/** Unowned objects */
@@ -204,6 +326,9 @@ private:
 	/** The output filename */
 	std::string m_filename;
 
+	/** The date of the scan, which names its files */
+	time_t m_scanDate;
+
 	/** The progress of the current scan */
 	Progress m_progress;
 
@@ -273,12 +398,53 @@ private:
 	/** Right laser results */
 	std::vector<DataPoint> m_rightLaserResults;
 
+	/** The frames of the current scan that failed the quality checks */
+	std::vector<FailedFrame> m_failedFrames;
+
 	/** Protection for the the 3D result data */
 	CriticalSection m_results;
 
 	/** The laser delay from the preset */
 	double m_laserDelaySec;
 
+	/** Detects when the scene is still after a change or NULL to use the fixed delays */
+	SettleDetector * m_settleDetector;
+
+	/** The longest to wait for the table to settle and the laser to turn off after rotating */
+	double m_maxTableSettleTimeSec;
+
+	/** Indicates if the table turns without stopping during the scan */
+	bool m_continuousRotation;
+
+	/** The speed of the table in radians per second when it turns without stopping */
+	real m_continuousRotationSpeed;
+
+	/** The spacing and the most laser-off images recorded for a continuous rotation scan so they fit in memory */
+	real m_continuousBackgroundRadians;
+	size_t m_maxContinuousBackgrounds;
+
+	/** Indicates if both lasers are captured in the same picture */
+	bool m_singleCaptureDualLaser;
+
+	/** The number of frames in the scan and whether the table is turning to the next one */
+	int m_numFrames;
+	bool m_tableRotating;
+
+	/** The number of frames between laser-off pictures, 1 takes one every frame */
+	int m_backgroundInterval;
+
+	/** The laser-off pictures for frames that don't take their own */
+	BackgroundModel * m_backgroundModel;
+
+	/** Laser images waiting for the next laser-off picture */
+	std::vector<DeferredFrame> m_deferredFrames;
+
+	/** The copies of the deferred images, which are shared by the halves of a dual laser image */
+	std::vector<Image *> m_deferredImages;
+
+	/** The camera image the last deferred image was copied from */
+	Image * m_deferredSource;
+
 	/** Where the photo sequence photos get saved */
 	std::string m_photoPathPrefix;
 
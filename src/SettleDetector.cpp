@@ -0,0 +1,254 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "SettleDetector.h"
+#include "Camera.h"
+#include "Image.h"
+#include "Logger.h"
+
+/** The number of pixels in a row that are averaged for each grid cell */
+#define SETTLE_CELL_WIDTH 8
+
+/** The number of rows between grid rows */
+#define SETTLE_CELL_HEIGHT 16
+
+/** The luma difference of a grid cell that is considered sensor noise instead of motion */
+#define SETTLE_NOISE_LEVEL 10
+
+/** The percent of grid rows that must change for a laser change to have shown up */
+#define SETTLE_LASER_CHANGED_ROWS 10
+
+namespace freelss
+{
+
+SettleDetector::SettleDetector(Camera * camera, real motionThreshold) :
+	m_camera(camera),
+	m_motionThreshold(motionThreshold),
+	m_lastMotion(0),
+	m_previousLuma(),
+	m_luma(),
+	m_referenceLuma(),
+	m_numLumaColumns(0),
+	m_tableMoved(false),
+	m_laserChanged(false),
+	m_changeTime(0)
+{
+	// Do nothing
+}
+
+void SettleDetector::sceneChanged(SceneChange change)
+{
+	if (change == SC_TABLE_MOVED)
+	{
+		m_tableMoved = true;
+	}
+	else
+	{
+		m_laserChanged = true;
+	}
+
+	m_changeTime = GetTimeInSeconds();
+}
+
+Image * SettleDetector::acquireSettledImage(double maxSettleTimeSec)
+{
+	double startTime = GetTimeInSeconds();
+	bool settled = false;
+	Image * image = NULL;
+
+	// The camera delivers a frame about a frame period after its exposure started
+	double frameDurationSec = 1.0 / MAX(1, m_camera->getCameraResolution().frameRate);
+
+	m_previousLuma.clear();
+
+	// Ensure that the image gets released back to the camera
+	try
+	{
+		while (true)
+		{
+			image = m_camera->acquireImage();
+			if (image == NULL)
+			{
+				throw Exception("Camera returned NULL image");
+			}
+
+			computeLuma(* image, m_luma);
+
+			// Frames that were exposed before the change can't show it.  Assume the frame is new if the camera doesn't say.
+			double timestamp = image->getTimestamp();
+			bool exposedAfterChange = timestamp <= 0 || timestamp - frameDurationSec >= m_changeTime;
+
+			if (exposedAfterChange)
+			{
+				if (m_tableMoved)
+				{
+					// The table has stopped so any motion is the object wobbling
+					if (!m_previousLuma.empty())
+					{
+						m_lastMotion = computeMotion(m_previousLuma, m_luma);
+						settled = m_lastMotion <= m_motionThreshold;
+					}
+				}
+				else if (m_laserChanged && !m_referenceLuma.empty())
+				{
+					// Wait for the laser to show up or go away
+					m_lastMotion = computeChangedRows(m_referenceLuma, m_luma);
+					settled = m_lastMotion >= SETTLE_LASER_CHANGED_ROWS;
+				}
+				else
+				{
+					settled = true;
+				}
+			}
+
+			if (settled)
+			{
+				break;
+			}
+
+			if (GetTimeInSeconds() - startTime >= maxSettleTimeSec)
+			{
+				break;
+			}
+
+			m_camera->releaseImage(image);
+			image = NULL;
+
+			m_previousLuma.swap(m_luma);
+		}
+	}
+	catch (...)
+	{
+		if (image != NULL)
+		{
+			m_camera->releaseImage(image);
+		}
+
+		throw;
+	}
+
+	if (DebugLog.isEnabled())
+	{
+		DebugLog << (settled ? "Settled" : "Timed out settling") << " after "
+				 << (GetTimeInSeconds() - startTime) << " sec, motion: " << m_lastMotion << "%" << Logger::ENDL;
+	}
+
+	// The next laser change is compared against this image
+	m_referenceLuma.swap(m_luma);
+	m_numLumaColumns = image->getWidth() / SETTLE_CELL_WIDTH;
+	m_tableMoved = false;
+	m_laserChanged = false;
+
+	return image;
+}
+
+real SettleDetector::getLastMotion() const
+{
+	return m_lastMotion;
+}
+
+void SettleDetector::computeLuma(Image& image, std::vector<unsigned char>& luma)
+{
+	const unsigned width = image.getWidth();
+	const unsigned height = image.getHeight();
+	const unsigned numComponents = image.getNumComponents();
+	const unsigned numCols = width / SETTLE_CELL_WIDTH;
+	const unsigned rowStep = width * numComponents;
+	const unsigned char * pixels = image.getPixels();
+
+	luma.clear();
+	luma.reserve(numCols * (height / SETTLE_CELL_HEIGHT + 1));
+
+	for (unsigned y = SETTLE_CELL_HEIGHT / 2; y < height; y += SETTLE_CELL_HEIGHT)
+	{
+		const unsigned char * px = pixels + y * rowStep;
+		for (unsigned iCol = 0; iCol < numCols; iCol++)
+		{
+			unsigned sum = 0;
+			for (unsigned iPx = 0; iPx < SETTLE_CELL_WIDTH; iPx++)
+			{
+				if (numComponents >= 3)
+				{
+					// BT.601 luma in fixed point
+					sum += (77 * px[0] + 150 * px[1] + 29 * px[2]) >> 8;
+				}
+				else
+				{
+					sum += px[0];
+				}
+
+				px += numComponents;
+			}
+
+			luma.push_back((unsigned char)(sum / SETTLE_CELL_WIDTH));
+		}
+	}
+}
+
+real SettleDetector::computeMotion(const std::vector<unsigned char>& luma1, const std::vector<unsigned char>& luma2)
+{
+	if (luma1.size() != luma2.size() || luma1.empty())
+	{
+		return 100;
+	}
+
+	unsigned numChanged = 0;
+	for (size_t iCell = 0; iCell < luma1.size(); iCell++)
+	{
+		int diff = (int)luma1[iCell] - (int)luma2[iCell];
+		if (ABS(diff) > SETTLE_NOISE_LEVEL)
+		{
+			numChanged++;
+		}
+	}
+
+	return (100.0 * numChanged) / luma1.size();
+}
+
+real SettleDetector::computeChangedRows(const std::vector<unsigned char>& luma1, const std::vector<unsigned char>& luma2)
+{
+	if (luma1.size() != luma2.size() || luma1.empty() || m_numLumaColumns == 0)
+	{
+		return 100;
+	}
+
+	unsigned numRows = luma1.size() / m_numLumaColumns;
+	unsigned numChanged = 0;
+	for (unsigned iRow = 0; iRow < numRows; iRow++)
+	{
+		const unsigned char * row1 = &luma1[iRow * m_numLumaColumns];
+		const unsigned char * row2 = &luma2[iRow * m_numLumaColumns];
+
+		for (unsigned iCol = 0; iCol < m_numLumaColumns; iCol++)
+		{
+			int diff = (int)row1[iCol] - (int)row2[iCol];
+			if (ABS(diff) > SETTLE_NOISE_LEVEL)
+			{
+				numChanged++;
+				break;
+			}
+		}
+	}
+
+	return (100.0 * numChanged) / MAX(numRows, 1u);
+}
+
+}
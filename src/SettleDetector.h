@@ -0,0 +1,94 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+namespace freelss
+{
+
+class Camera;
+class Image;
+
+/**
+ * Watches the camera's video stream to tell when the scene stops changing.
+ * This lets a capture be taken as soon as the turn table and the object have
+ * stopped wobbling and the laser change has shown up instead of always waiting
+ * the worst case delay.  Each frame is reduced to a coarse grid of luma values.
+ * After the table moves the motion is the percent of grid cells that changed from the
+ * previous frame.  A laser line only covers a cell or two of each grid row, so a laser
+ * change is instead detected by the percent of grid rows that changed from the last
+ * image that was returned.
+ */
+class SettleDetector
+{
+public:
+
+	/** The kinds of changes to the scene */
+	enum SceneChange { SC_TABLE_MOVED, SC_LASER_CHANGED };
+
+	/**
+	 * @param camera - The camera to acquire images from.
+	 * @param motionThreshold - The percent of grid cells that can change between frames in a still scene.
+	 */
+	SettleDetector(Camera * camera, real motionThreshold);
+
+	/** Records that the scene was just changed so the next acquisition waits for it */
+	void sceneChanged(SceneChange change);
+
+	/**
+	 * Acquires images until the changes made to the scene since the last acquisition
+	 * show up.  After a table move this is the first still image exposed after the move
+	 * and after a laser change it is the first image exposed after the change that differs
+	 * from the last image.  The last image is returned if the scene hasn't settled after
+	 * maxSettleTimeSec.  The image must be released back to the camera.
+	 */
+	Image * acquireSettledImage(double maxSettleTimeSec);
+
+	/** Returns the last percent of the grid cells or rows that changed between compared frames */
+	real getLastMotion() const;
+
+private:
+
+	/** Averages the luma of a run of pixels for each cell of the grid */
+	void computeLuma(Image& image, std::vector<unsigned char>& luma);
+
+	/** Returns the percent of grid cells that changed by more than the noise level */
+	real computeMotion(const std::vector<unsigned char>& luma1, const std::vector<unsigned char>& luma2);
+
+	/** Returns the percent of grid rows with a cell that changed by more than the noise level */
+	real computeChangedRows(const std::vector<unsigned char>& luma1, const std::vector<unsigned char>& luma2);
+
+	Camera * m_camera;
+	real m_motionThreshold;
+	real m_lastMotion;
+	std::vector<unsigned char> m_previousLuma;
+	std::vector<unsigned char> m_luma;
+
+	/** The luma of the last image that was returned */
+	std::vector<unsigned char> m_referenceLuma;
+	unsigned m_numLumaColumns;
+
+	/** The changes made since the last acquisition and when the last one was made */
+	bool m_tableMoved;
+	bool m_laserChanged;
+	double m_changeTime;
+};
+
+}
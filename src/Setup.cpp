@@ -60,8 +60,14 @@ void Setup::reinit()
 	stepsPerRevolution = 3200;
 	motorResponseDelay = 2;
 	motorStepDelay = 5000;
+	motorAcceleration = 2000;
+	motorSCurve = true;
+	enableGpioWaveforms = false;
 	unitOfLength = UL_INCHES;
 	haveLaserPlaneNormals = false;
+	haveCameraIntrinsics = false;
+	checkerboardColumns = 9;
+	checkerboardRows = 6;
 	enableLighting = false;
 	lightingPin = 3;
 	enableAuthentication = false;
@@ -74,6 +80,12 @@ void Setup::reinit()
 	overriddenFocalLength = "";
 	mmalFlipRedBlue = false;
 	maxObjectSize = 215.9;
+	enableDebugLogging = false;
+	mockObject = "cylinder";
+	mockObjectSize = 80;
+	mockObjectOffset = 20;
+	mockNoise = 2;
+	mockAmbientLight = 30;
 
 	cameraLocation.x = 0;
 	cameraLocation.y = 82.55;
@@ -94,6 +106,18 @@ void Setup::reinit()
 	rightLaserPlaneNormal.x = 0;
 	rightLaserPlaneNormal.y = 0;
 	rightLaserPlaneNormal.z = 0;
+
+	cameraIntrinsics.focalX = 0;
+	cameraIntrinsics.focalY = 0;
+	cameraIntrinsics.principalX = 0;
+	cameraIntrinsics.principalY = 0;
+	cameraIntrinsics.k1 = 0;
+	cameraIntrinsics.k2 = 0;
+	cameraIntrinsics.k3 = 0;
+	cameraIntrinsics.p1 = 0;
+	cameraIntrinsics.p2 = 0;
+	cameraIntrinsics.imageWidth = 0;
+	cameraIntrinsics.imageHeight = 0;
 }
 
 void Setup::encodeProperties(std::vector<Property>& properties)
@@ -120,10 +144,16 @@ void Setup::encodeProperties(std::vector<Property>& properties)
 	properties.push_back(Property("setup.stepsPerRevolution", ToString(stepsPerRevolution)));
 	properties.push_back(Property("setup.motorResponseDelay", ToString(motorResponseDelay)));
 	properties.push_back(Property("setup.motorStepDelay", ToString(motorStepDelay)));
+	properties.push_back(Property("setup.motorAcceleration", ToString(motorAcceleration)));
+	properties.push_back(Property("setup.motorSCurve", ToString(motorSCurve)));
+	properties.push_back(Property("setup.enableGpioWaveforms", ToString(enableGpioWaveforms)));
 	properties.push_back(Property("setup.httpPort", ToString(httpPort)));
 	properties.push_back(Property("setup.serialNumber", serialNumber));
 	properties.push_back(Property("setup.unitOfLength", ToString((int)unitOfLength)));
 	properties.push_back(Property("setup.haveLaserPlaneNormals", ToString(haveLaserPlaneNormals)));
+	properties.push_back(Property("setup.haveCameraIntrinsics", ToString(haveCameraIntrinsics)));
+	properties.push_back(Property("setup.checkerboardColumns", ToString(checkerboardColumns)));
+	properties.push_back(Property("setup.checkerboardRows", ToString(checkerboardRows)));
 	properties.push_back(Property("setup.enableLighting", ToString(enableLighting)));
 	properties.push_back(Property("setup.lightingPin", ToString(lightingPin)));
 	properties.push_back(Property("setup.enableAuthentication", ToString(enableAuthentication)));
@@ -136,6 +166,12 @@ void Setup::encodeProperties(std::vector<Property>& properties)
 	properties.push_back(Property("setup.overriddenFocalLength", overriddenFocalLength));
 	properties.push_back(Property("setup.mmalFlipBlueRed", ToString(mmalFlipRedBlue)));
 	properties.push_back(Property("setup.maxObjectSize", ToString(maxObjectSize)));
+	properties.push_back(Property("setup.enableDebugLogging", ToString(enableDebugLogging)));
+	properties.push_back(Property("setup.mockObject", mockObject));
+	properties.push_back(Property("setup.mockObjectSize", ToString(mockObjectSize)));
+	properties.push_back(Property("setup.mockObjectOffset", ToString(mockObjectOffset)));
+	properties.push_back(Property("setup.mockNoise", ToString(mockNoise)));
+	properties.push_back(Property("setup.mockAmbientLight", ToString(mockAmbientLight)));
 
 	if (haveLaserPlaneNormals)
 	{
@@ -159,6 +195,21 @@ void Setup::encodeProperties(std::vector<Property>& properties)
 		properties.push_back(Property("setup.rightLaserCalibrationBottom.x", ToString(rightLaserCalibrationBottom.x)));
 		properties.push_back(Property("setup.rightLaserCalibrationBottom.y", ToString(rightLaserCalibrationBottom.y)));
 	}
+
+	if (haveCameraIntrinsics)
+	{
+		properties.push_back(Property("setup.cameraIntrinsics.focalX", ToString(cameraIntrinsics.focalX)));
+		properties.push_back(Property("setup.cameraIntrinsics.focalY", ToString(cameraIntrinsics.focalY)));
+		properties.push_back(Property("setup.cameraIntrinsics.principalX", ToString(cameraIntrinsics.principalX)));
+		properties.push_back(Property("setup.cameraIntrinsics.principalY", ToString(cameraIntrinsics.principalY)));
+		properties.push_back(Property("setup.cameraIntrinsics.k1", ToString(cameraIntrinsics.k1)));
+		properties.push_back(Property("setup.cameraIntrinsics.k2", ToString(cameraIntrinsics.k2)));
+		properties.push_back(Property("setup.cameraIntrinsics.k3", ToString(cameraIntrinsics.k3)));
+		properties.push_back(Property("setup.cameraIntrinsics.p1", ToString(cameraIntrinsics.p1)));
+		properties.push_back(Property("setup.cameraIntrinsics.p2", ToString(cameraIntrinsics.p2)));
+		properties.push_back(Property("setup.cameraIntrinsics.imageWidth", ToString(cameraIntrinsics.imageWidth)));
+		properties.push_back(Property("setup.cameraIntrinsics.imageHeight", ToString(cameraIntrinsics.imageHeight)));
+	}
 }
 
 void Setup::decodeProperties(const std::vector<Property>& properties)
@@ -243,6 +294,18 @@ void Setup::decodeProperties(const std::vector<Property>& properties)
 		{
 			motorStepDelay = ToInt(prop.value);
 		}
+		else if (prop.name == "setup.motorAcceleration")
+		{
+			motorAcceleration = ToInt(prop.value);
+		}
+		else if (prop.name == "setup.motorSCurve")
+		{
+			motorSCurve = ToBool(prop.value);
+		}
+		else if (prop.name == "setup.enableGpioWaveforms")
+		{
+			enableGpioWaveforms = ToBool(prop.value);
+		}
 		else if (prop.name == "setup.httpPort")
 		{
 			httpPort = ToInt(prop.value);
@@ -315,6 +378,62 @@ void Setup::decodeProperties(const std::vector<Property>& properties)
 		{
 			rightLaserCalibrationBottom.y = ToReal(prop.value);
 		}
+		else if (prop.name == "setup.haveCameraIntrinsics")
+		{
+			haveCameraIntrinsics = ToBool(prop.value);
+		}
+		else if (prop.name == "setup.checkerboardColumns")
+		{
+			checkerboardColumns = ToInt(prop.value);
+		}
+		else if (prop.name == "setup.checkerboardRows")
+		{
+			checkerboardRows = ToInt(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.focalX")
+		{
+			cameraIntrinsics.focalX = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.focalY")
+		{
+			cameraIntrinsics.focalY = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.principalX")
+		{
+			cameraIntrinsics.principalX = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.principalY")
+		{
+			cameraIntrinsics.principalY = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.k1")
+		{
+			cameraIntrinsics.k1 = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.k2")
+		{
+			cameraIntrinsics.k2 = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.k3")
+		{
+			cameraIntrinsics.k3 = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.p1")
+		{
+			cameraIntrinsics.p1 = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.p2")
+		{
+			cameraIntrinsics.p2 = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.imageWidth")
+		{
+			cameraIntrinsics.imageWidth = ToInt(prop.value);
+		}
+		else if (prop.name == "setup.cameraIntrinsics.imageHeight")
+		{
+			cameraIntrinsics.imageHeight = ToInt(prop.value);
+		}
 		else if (prop.name == "setup.enableLighting")
 		{
 			enableLighting = ToBool(prop.value);
@@ -363,6 +482,30 @@ void Setup::decodeProperties(const std::vector<Property>& properties)
 		{
 			maxObjectSize = ToReal(prop.value);
 		}
+		else if (prop.name == "setup.enableDebugLogging")
+		{
+			enableDebugLogging = ToBool(prop.value);
+		}
+		else if (prop.name == "setup.mockObject")
+		{
+			mockObject = prop.value;
+		}
+		else if (prop.name == "setup.mockObjectSize")
+		{
+			mockObjectSize = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.mockObjectOffset")
+		{
+			mockObjectOffset = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.mockNoise")
+		{
+			mockNoise = ToReal(prop.value);
+		}
+		else if (prop.name == "setup.mockAmbientLight")
+		{
+			mockAmbientLight = ToInt(prop.value);
+		}
 	}
 }
 
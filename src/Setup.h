@@ -59,6 +59,9 @@ public:
 	int stepsPerRevolution;
 	int motorResponseDelay;
 	int motorStepDelay;
+	int motorAcceleration;
+	bool motorSCurve;
+	bool enableGpioWaveforms;
 	int httpPort;
 	std::string serialNumber;
 	UnitOfLength unitOfLength;
@@ -69,6 +72,10 @@ public:
 	PixelLocation leftLaserCalibrationBottom;
 	PixelLocation rightLaserCalibrationTop;
 	PixelLocation rightLaserCalibrationBottom;
+	bool haveCameraIntrinsics;
+	CameraIntrinsics cameraIntrinsics;
+	int checkerboardColumns;
+	int checkerboardRows;
 	bool enableLighting;
 	int lightingPin;
 	bool enableAuthentication;
@@ -81,6 +88,14 @@ public:
 	std::string overriddenFocalLength;
 	bool mmalFlipRedBlue;
 	real maxObjectSize;
+	bool enableDebugLogging;
+
+	/** The simulated scene when running with mock hardware */
+	std::string mockObject;
+	real mockObjectSize;
+	real mockObjectOffset;
+	real mockNoise;
+	int mockAmbientLight;
 private:
 
 	/** Default Constructor */
@@ -23,6 +23,10 @@
 #include "Camera.h"
 #include "Laser.h"
 #include "Progress.h"
+#include "IWriter.h"
+
+#define STL_TRIANGLE_SIZE 50
+#define STL_TRIANGLES_PER_BLOCK 4096
 
 namespace freelss
 {
@@ -38,62 +42,78 @@ StlWriter::StlWriter() :
 }
 
 
-void StlWriter::write(const std::string& baseFilename, const std::vector<DataPoint>& results, const FaceMap& faces, Progress& progress)
+void StlWriter::write(IWriter& writer, const std::vector<DataPoint>& results, const FaceMap& faces, Progress& progress)
 {
 	progress.setLabel("Generating STL file");
 	progress.setPercent(0);
 
-	std::string stlFilename = baseFilename + ".stl";
-	std::ofstream fout (stlFilename.c_str());
-	if (!fout.is_open())
-	{
-		throw Exception("Error opening STL file for writing: " + stlFilename);
-	}
-
 	// Write the STL header
-	writeHeader(fout, faces);
+	writeHeader(writer, faces);
 
 	const std::vector<unsigned>& triangles = faces.triangles;
 
+	// The triangles are packed into blocks that are handed to the writer at once
+	std::vector<char> block(STL_TRIANGLE_SIZE * STL_TRIANGLES_PER_BLOCK);
+	char * start = &block[0];
+	char * out = start;
+
+	real percent = 0;
 	for (size_t idx = 0; idx < triangles.size(); idx += 3)
 	{
+		real newPct = 100.0f * (idx + 3) / triangles.size();
+		if (newPct - percent > 0.1)
+		{
+			progress.setPercent(newPct);
+			percent = newPct;
+		}
+
 		const ColoredPoint& pt1 = results[triangles[idx]].point;
 		const ColoredPoint& pt2 = results[triangles[idx + 1]].point;
 		const ColoredPoint& pt3 = results[triangles[idx + 2]].point;
 
-		writeTriangle(pt1, pt2, pt3, fout);
+		if (out == start + block.size())
+		{
+			writer.write(start, out - start);
+			out = start;
+		}
+
+		writeTriangle(pt1, pt2, pt3, out);
+		out += STL_TRIANGLE_SIZE;
 	}
 
-	fout.close();
+	if (out != start)
+	{
+		writer.write(start, out - start);
+	}
 }
 
-void StlWriter::writeHeader(std::ofstream& fout, const FaceMap& faces)
+void StlWriter::writeHeader(IWriter& writer, const FaceMap& faces)
 {
 	unsigned char header[80];
 	memset(header, 0, sizeof(header));
 	strcpy((char *)header, "2015 Uriah Liggett");
 
 	// Write header string
-	fout.write((const char *)header, sizeof(unsigned char) * 80);
+	writer.write((const char *)header, sizeof(unsigned char) * 80);
 
 	// Write number of triangles
 	uint32 numTriangles = (uint32) (faces.triangles.size() / 3);
-	fout.write((const char *)&numTriangles, sizeof(uint32));
+	writer.write((const char *)&numTriangles, sizeof(uint32));
 }
 
-void StlWriter::writeTriangle(const ColoredPoint& pt1, const ColoredPoint& pt2, const ColoredPoint& pt3, std::ofstream& fout)
+void StlWriter::writeTriangle(const ColoredPoint& pt1, const ColoredPoint& pt2, const ColoredPoint& pt3, char * out)
 {
-	fout.write((const char *)&m_normal, sizeof(real32) * 3);
-	fout.write((const char *)&pt1.x, sizeof(real32));
-	fout.write((const char *)&pt1.y, sizeof(real32));
-	fout.write((const char *)&pt1.z, sizeof(real32));
-	fout.write((const char *)&pt2.x, sizeof(real32));
-	fout.write((const char *)&pt2.y, sizeof(real32));
-	fout.write((const char *)&pt2.z, sizeof(real32));
-	fout.write((const char *)&pt3.x, sizeof(real32));
-	fout.write((const char *)&pt3.y, sizeof(real32));
-	fout.write((const char *)&pt3.z, sizeof(real32));
-	fout.write((const char *)&m_attribute, sizeof(uint16));
+	memcpy(out, &m_normal, sizeof(real32) * 3); out += sizeof(real32) * 3;
+	memcpy(out, &pt1.x, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &pt1.y, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &pt1.z, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &pt2.x, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &pt2.y, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &pt2.z, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &pt3.x, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &pt3.y, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &pt3.z, sizeof(real32)); out += sizeof(real32);
+	memcpy(out, &m_attribute, sizeof(uint16));
 }
 
 }
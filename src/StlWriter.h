@@ -24,17 +24,20 @@ namespace freelss
 {
 
 class Progress;
+struct IWriter;
 
 class StlWriter
 {
 public:
 	StlWriter();
 
-	void write(const std::string& filename, const std::vector<DataPoint>& results, const FaceMap& faces, Progress& progress);
+	void write(IWriter& writer, const std::vector<DataPoint>& results, const FaceMap& faces, Progress& progress);
 
 private:
-	void writeHeader(std::ofstream& fout, const FaceMap& faces);
-	void writeTriangle(const ColoredPoint& pt1, const ColoredPoint& pt2, const ColoredPoint& pt3, std::ofstream& fout);
+	void writeHeader(IWriter& writer, const FaceMap& faces);
+
+	/** Packs the 50 byte triangle record into out */
+	void writeTriangle(const ColoredPoint& pt1, const ColoredPoint& pt2, const ColoredPoint& pt3, char * out);
 
 	real32 m_normal[3];
 	uint16 m_attribute;
@@ -0,0 +1,321 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "Tracer.h"
+#include "JsonWriter.h"
+
+namespace freelss
+{
+
+Tracer * Tracer::m_instance = NULL;
+
+Tracer * Tracer::get()
+{
+	if (m_instance == NULL)
+	{
+		m_instance = new Tracer();
+	}
+
+	return m_instance;
+}
+
+void Tracer::release()
+{
+	delete m_instance;
+	m_instance = NULL;
+}
+
+Tracer::Tracer() :
+	m_cs(),
+	m_buffers(),
+	m_key(),
+	m_nextThreadId(1),
+	m_epoch(now()),
+	m_enabled(false)
+{
+	if (pthread_key_create(&m_key, Tracer::threadExited) != 0)
+	{
+		throw Exception("Error creating the trace thread key");
+	}
+}
+
+Tracer::~Tracer()
+{
+	pthread_key_delete(m_key);
+
+	for (size_t iBuf = 0; iBuf < m_buffers.size(); iBuf++)
+	{
+		delete m_buffers[iBuf];
+	}
+}
+
+void Tracer::start()
+{
+	m_cs.enter();
+
+	// Drop the buffers of the threads that have exited since the last scan
+	size_t numBuffers = 0;
+	for (size_t iBuf = 0; iBuf < m_buffers.size(); iBuf++)
+	{
+		ThreadBuffer * buffer = m_buffers[iBuf];
+		if (buffer->alive)
+		{
+			buffer->events.clear();
+			buffer->count = 0;
+			m_buffers[numBuffers++] = buffer;
+		}
+		else
+		{
+			delete buffer;
+		}
+	}
+
+	m_buffers.resize(numBuffers);
+	m_epoch = now();
+	m_enabled = true;
+
+	m_cs.leave();
+}
+
+void Tracer::stop()
+{
+	m_enabled = false;
+}
+
+bool Tracer::isEnabled() const
+{
+	return m_enabled;
+}
+
+void Tracer::record(const char * stage, int frame, int laser, double start, double end)
+{
+	if (!m_enabled)
+	{
+		return;
+	}
+
+	ThreadBuffer * buffer = getThreadBuffer();
+
+	Event event;
+	event.stage = stage;
+	event.frame = frame;
+	event.laser = laser;
+	event.start = start;
+	event.end = end;
+
+	// Only the owning thread writes to the buffer so no lock is needed
+	if (buffer->events.size() < EVENTS_PER_THREAD)
+	{
+		buffer->events.push_back(event);
+	}
+	else
+	{
+		buffer->events[buffer->count % EVENTS_PER_THREAD] = event;
+	}
+
+	buffer->count++;
+}
+
+void Tracer::setThreadName(const std::string& name)
+{
+	if (!m_enabled)
+	{
+		return;
+	}
+
+	ThreadBuffer * buffer = getThreadBuffer();
+
+	m_cs.enter();
+	buffer->name = name;
+	m_cs.leave();
+}
+
+Tracer::ThreadBuffer * Tracer::getThreadBuffer()
+{
+	ThreadBuffer * buffer = (ThreadBuffer *) pthread_getspecific(m_key);
+	if (buffer != NULL)
+	{
+		return buffer;
+	}
+
+	buffer = new ThreadBuffer();
+	buffer->count = 0;
+	buffer->alive = true;
+
+	m_cs.enter();
+	try
+	{
+		buffer->threadId = m_nextThreadId++;
+		m_buffers.push_back(buffer);
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		delete buffer;
+		throw;
+	}
+	m_cs.leave();
+
+	pthread_setspecific(m_key, buffer);
+
+	return buffer;
+}
+
+void Tracer::threadExited(void * data)
+{
+	// The events are kept until the next scan starts so they can still be written
+	Tracer * tracer = m_instance;
+	if (tracer != NULL)
+	{
+		tracer->m_cs.enter();
+		((ThreadBuffer *) data)->alive = false;
+		tracer->m_cs.leave();
+	}
+}
+
+void Tracer::writeChromeTrace(std::ostream& out)
+{
+	m_cs.enter();
+
+	try
+	{
+		unsigned long numDropped = 0;
+		bool first = true;
+
+		out << "{\"traceEvents\":[";
+
+		for (size_t iBuf = 0; iBuf < m_buffers.size(); iBuf++)
+		{
+			const ThreadBuffer * buffer = m_buffers[iBuf];
+			if (buffer->count == 0)
+			{
+				continue;
+			}
+
+			// Name the thread
+			JsonWriter meta;
+			meta.beginObject();
+			meta.name("name");
+			meta.value("thread_name");
+			meta.name("ph");
+			meta.value("M");
+			meta.name("pid");
+			meta.value(1);
+			meta.name("tid");
+			meta.value(buffer->threadId);
+			meta.name("args");
+			meta.beginObject();
+			meta.name("name");
+			meta.value(buffer->name.empty() ? "Thread " + ToString(buffer->threadId) : buffer->name);
+			meta.endObject();
+			meta.endObject();
+
+			out << (first ? "\n" : ",\n") << meta.str();
+			first = false;
+
+			// Write the events oldest first
+			size_t numEvents = buffer->events.size();
+			size_t firstEvent = buffer->count > numEvents ? buffer->count % EVENTS_PER_THREAD : 0;
+			numDropped += buffer->count - numEvents;
+
+			for (size_t iEvt = 0; iEvt < numEvents; iEvt++)
+			{
+				const Event& event = buffer->events[(firstEvent + iEvt) % numEvents];
+
+				JsonWriter json;
+				json.beginObject();
+				json.name("name");
+				json.value(event.stage);
+				json.name("cat");
+				json.value("scan");
+				json.name("ph");
+				json.value("X");
+				json.name("ts");
+				json.value((long long) ((event.start - m_epoch) * 1000000.0 + 0.5));
+				json.name("dur");
+				json.value((long long) ((event.end - event.start) * 1000000.0 + 0.5));
+				json.name("pid");
+				json.value(1);
+				json.name("tid");
+				json.value(buffer->threadId);
+				json.name("args");
+				json.beginObject();
+				if (event.frame >= 0)
+				{
+					json.name("frame");
+					json.value(event.frame);
+				}
+				if (event.laser >= 0)
+				{
+					json.name("laser");
+					json.value(event.laser);
+				}
+				json.endObject();
+				json.endObject();
+
+				out << ",\n" << json.str();
+			}
+		}
+
+		out << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":" << numDropped << "}}\n";
+	}
+	catch (...)
+	{
+		m_cs.leave();
+		throw;
+	}
+
+	m_cs.leave();
+}
+
+double Tracer::now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+TraceScope::TraceScope(const char * stage, int frame, int laser) :
+	m_stage(stage),
+	m_frame(frame),
+	m_laser(laser),
+	m_start(0)
+{
+	if (Tracer::get()->isEnabled())
+	{
+		m_start = Tracer::now();
+	}
+	else
+	{
+		m_stage = NULL;
+	}
+}
+
+TraceScope::~TraceScope()
+{
+	if (m_stage != NULL)
+	{
+		Tracer::get()->record(m_stage, m_frame, m_laser, m_start, Tracer::now());
+	}
+}
+
+}
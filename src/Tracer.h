@@ -0,0 +1,135 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "CriticalSection.h"
+
+namespace freelss
+{
+
+/**
+ * Records when each stage of a scan started and ended so that stalls and jitter
+ * can be seen frame by frame instead of only as totals.  Each thread records into
+ * its own ring buffer so tracing doesn't need a lock.  The events are written as
+ * Chrome trace_event JSON that can be loaded in chrome://tracing.
+ */
+class Tracer
+{
+public:
+
+	/** A single timed stage */
+	struct Event
+	{
+		/** The name of the stage, must be a string literal */
+		const char * stage;
+
+		/** The frame the stage belongs to or -1 */
+		int frame;
+
+		/** The Laser::LaserSide the stage belongs to or -1 */
+		int laser;
+
+		/** Start and end times from Tracer::now() */
+		double start;
+		double end;
+	};
+
+	static Tracer * get();
+	static void release();
+
+	/** Discards the previous events and starts recording.  Must be called while no stages are being traced. */
+	void start();
+
+	/** Stops recording */
+	void stop();
+
+	/** Indicates if events are being recorded */
+	bool isEnabled() const;
+
+	/** Records an event on the calling thread's buffer */
+	void record(const char * stage, int frame, int laser, double start, double end);
+
+	/** Names the calling thread in the trace, ignored unless events are being recorded */
+	void setThreadName(const std::string& name);
+
+	/** Writes the recorded events as Chrome trace_event JSON.  Must be called once the traced stages are done. */
+	void writeChromeTrace(std::ostream& out);
+
+	/** Returns the current monotonic time in seconds */
+	static double now();
+
+	/** The number of events each thread keeps before it overwrites its oldest ones */
+	static const unsigned EVENTS_PER_THREAD = 65536;
+
+private:
+
+	/** The events of a single thread */
+	struct ThreadBuffer
+	{
+		int threadId;
+		std::string name;
+		std::vector<Event> events;
+
+		/** The number of events recorded, events[count % EVENTS_PER_THREAD] is the next to be overwritten */
+		unsigned long count;
+
+		/** False once the thread has exited */
+		bool alive;
+	};
+
+	Tracer();
+	~Tracer();
+
+	/** Returns the buffer of the calling thread, creating it if needed */
+	ThreadBuffer * getThreadBuffer();
+
+	/** Called by pthreads when a thread with a buffer exits */
+	static void threadExited(void * buffer);
+
+	static Tracer * m_instance;
+
+	/** Protects the list of buffers, not the events themselves */
+	CriticalSection m_cs;
+	std::vector<ThreadBuffer *> m_buffers;
+	pthread_key_t m_key;
+	int m_nextThreadId;
+	double m_epoch;
+	volatile bool m_enabled;
+};
+
+/**
+ * Records the time from its construction to its destruction as an event of the
+ * calling thread.
+ */
+class TraceScope
+{
+public:
+	TraceScope(const char * stage, int frame = -1, int laser = -1);
+	~TraceScope();
+
+private:
+	const char * m_stage;
+	int m_frame;
+	int m_laser;
+	double m_start;
+};
+
+}
@@ -20,7 +20,14 @@
 
 #include "Main.h"
 #include "TurnTable.h"
+#ifndef MOCK
 #include "A4988TurnTable.h"
+#endif
+#include "WaveformTurnTable.h"
+#include "MockTurnTable.h"
+#include "GpioDevice.h"
+#include "Setup.h"
+#include "Logger.h"
 
 namespace freelss
 {
@@ -37,11 +44,43 @@ TurnTable::~TurnTable()
 	// Do nothing
 }
 
+int TurnTable::startRotation(real theta)
+{
+	return rotate(theta);
+}
+
+void TurnTable::waitForRotation()
+{
+	// Do nothing
+}
+
 TurnTable * TurnTable::getInstance()
 {
 	if (TurnTable::m_instance == NULL)
 	{
-		TurnTable::m_instance = new A4988TurnTable();
+		// The waveforms go to the mock GPIO device when the hardware is simulated
+		if (Setup::get()->enableGpioWaveforms)
+		{
+			try
+			{
+				TurnTable::m_instance = new WaveformTurnTable(GpioDevice::get());
+			}
+			catch (Exception& ex)
+			{
+				ErrorLog << "Error creating the waveform turn table, stepping without waveforms instead, error=" << ex << Logger::ENDL;
+			}
+		}
+
+		if (TurnTable::m_instance == NULL && IsMockHardware())
+		{
+			TurnTable::m_instance = new MockTurnTable();
+		}
+#ifndef MOCK
+		else if (TurnTable::m_instance == NULL)
+		{
+			TurnTable::m_instance = new A4988TurnTable();
+		}
+#endif
 	}
 
 	return TurnTable::m_instance;
@@ -39,12 +39,25 @@ public:
 	/** Destructor */
 	virtual ~TurnTable();
 
-	/** Rotates this amount in radians.  Returns the number of steps taken. */
+	/** Rotates this amount in radians, backwards if it is negative.  Returns the number of steps taken. */
 	virtual int rotate(real theta) = 0;
 
+	/**
+	 * Starts rotating this amount in radians and returns the number of steps without waiting for
+	 * the table to stop when the table can turn in the background.  Otherwise it is the same as rotate().
+	 * waitForRotation() must be called before anything else is done with the table.
+	 */
+	virtual int startRotation(real theta);
+
+	/** Waits for the rotation started by startRotation() to finish, including the stability delay */
+	virtual void waitForRotation();
+
 	/** Enable/Disable the stepper motor */
 	virtual void setMotorEnabled(bool enabled) = 0;
 
+	/** Sets whether rotate() waits the stability delay, disabled when the caller detects when the table settles */
+	virtual void setStabilityDelayEnabled(bool enabled) = 0;
+
 protected:
 
 	/** Default Constructor */
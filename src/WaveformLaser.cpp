@@ -0,0 +1,99 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "WaveformLaser.h"
+#include "Setup.h"
+
+namespace freelss
+{
+
+WaveformLaser::WaveformLaser(GpioDevice * gpio) :
+	m_gpio(gpio),
+	m_rightLaserPin(-1),
+	m_leftLaserPin(-1),
+	m_laserOnValue(-1),
+	m_laserOffValue(-1),
+	m_rightLaserOn(false),
+	m_leftLaserOn(false)
+{
+	Setup * setup = Setup::get();
+
+	m_rightLaserPin = setup->rightLaserPin;
+	m_leftLaserPin = setup->leftLaserPin;
+	m_laserOnValue = setup->laserOnValue;
+	m_laserOffValue = m_laserOnValue ? 0 : 1;
+
+	// Setup the pins but disable the lasers
+	m_gpio->setOutput(m_rightLaserPin, m_laserOffValue);
+	m_gpio->setOutput(m_leftLaserPin, m_laserOffValue);
+}
+
+WaveformLaser::~WaveformLaser()
+{
+	turnOff(Laser::ALL_LASERS);
+}
+
+void WaveformLaser::write(Laser::LaserSide laser, int value)
+{
+	if (laser == Laser::RIGHT_LASER || laser == Laser::ALL_LASERS)
+	{
+		m_gpio->write(m_rightLaserPin, value);
+		m_rightLaserOn = value == m_laserOnValue;
+	}
+
+	if (laser == Laser::LEFT_LASER || laser == Laser::ALL_LASERS)
+	{
+		m_gpio->write(m_leftLaserPin, value);
+		m_leftLaserOn = value == m_laserOnValue;
+	}
+}
+
+void WaveformLaser::turnOn(Laser::LaserSide laser)
+{
+	write(laser, m_laserOnValue);
+}
+
+void WaveformLaser::turnOff(Laser::LaserSide laser)
+{
+	write(laser, m_laserOffValue);
+}
+
+bool WaveformLaser::isOn(Laser::LaserSide laser)
+{
+	bool on = false;
+
+	if (laser == Laser::ALL_LASERS)
+	{
+		on = m_rightLaserOn && m_leftLaserOn;
+	}
+	else if (laser == Laser::RIGHT_LASER)
+	{
+		on = m_rightLaserOn;
+	}
+	else if (laser == Laser::LEFT_LASER)
+	{
+		on = m_leftLaserOn;
+	}
+
+	return on;
+}
+
+}
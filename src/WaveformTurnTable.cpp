@@ -0,0 +1,166 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "WaveformTurnTable.h"
+#include "Thread.h"
+#include "Setup.h"
+#include "PresetManager.h"
+#include "MotionPlanner.h"
+
+namespace freelss
+{
+
+WaveformTurnTable::WaveformTurnTable(GpioDevice * gpio) :
+	m_gpio(gpio),
+	m_planner(NULL),
+	m_rotating(false)
+{
+	Setup * setup = Setup::get();
+	m_responseDelay = setup->motorResponseDelay;
+	m_enablePin = setup->motorEnablePin;
+	m_stepPin = setup->motorStepPin;
+	m_directionPin = setup->motorDirPin;
+	m_stepsPerRevolution = setup->stepsPerRevolution;
+	m_stabilityDelay = PresetManager::get()->getActivePreset().stabilityDelay;
+	m_stabilityDelayEnabled = true;
+	m_planner = MotionPlanner::createFromSetup();
+
+	// Disable the stepper and put us in a known state
+	m_gpio->setOutput(m_enablePin, HIGH);
+	m_gpio->setOutput(m_stepPin, LOW);
+	m_gpio->setOutput(m_directionPin, LOW);
+	Thread::usleep(m_responseDelay);
+}
+
+WaveformTurnTable::~WaveformTurnTable()
+{
+	delete m_planner;
+
+	// Disable the stepper
+	m_gpio->waitForWaveform();
+	m_gpio->write(m_enablePin, HIGH);
+	Thread::usleep(m_responseDelay);
+}
+
+void WaveformTurnTable::buildWaveforms(const std::vector<long long>& stepTimes, long long moveTime, bool reverse,
+		                               size_t maxPulses, std::vector<std::vector<GpioDevice::Pulse> >& waveforms) const
+{
+	waveforms.clear();
+	waveforms.push_back(std::vector<GpioDevice::Pulse>());
+
+	// The step pulse is held high for the response delay
+	unsigned pulseWidth = MAX(1, m_responseDelay);
+
+	if (reverse)
+	{
+		waveforms.back().push_back(GpioDevice::Pulse(m_directionPin, HIGH, pulseWidth));
+	}
+
+	for (size_t iStep = 0; iStep < stepTimes.size(); iStep++)
+	{
+		// Start a new waveform if this step doesn't fit, the device plays them back to back
+		if (waveforms.back().size() + 2 > maxPulses)
+		{
+			waveforms.push_back(std::vector<GpioDevice::Pulse>());
+		}
+
+		long long nextStepTime = iStep + 1 < stepTimes.size() ? stepTimes[iStep + 1] : moveTime;
+		long long lowTime = (nextStepTime - stepTimes[iStep]) / 1000 - pulseWidth;
+
+		std::vector<GpioDevice::Pulse>& pulses = waveforms.back();
+		pulses.push_back(GpioDevice::Pulse(m_stepPin, HIGH, pulseWidth));
+		pulses.push_back(GpioDevice::Pulse(m_stepPin, LOW, (unsigned) MAX(1LL, lowTime)));
+	}
+
+	if (reverse)
+	{
+		if (waveforms.back().size() + 1 > maxPulses)
+		{
+			waveforms.push_back(std::vector<GpioDevice::Pulse>());
+		}
+
+		waveforms.back().push_back(GpioDevice::Pulse(m_directionPin, LOW, 0));
+	}
+}
+
+int WaveformTurnTable::rotate(real theta)
+{
+	int numSteps = startRotation(theta);
+	waitForRotation();
+
+	return numSteps;
+}
+
+int WaveformTurnTable::startRotation(real theta)
+{
+	// Round it so an angle that is a whole number of steps doesn't lose one to float error
+	int numSteps = (int) floor((theta / (2 * PI)) * m_stepsPerRevolution + 0.5);
+
+	std::vector<long long> stepTimes;
+	long long moveTime = m_planner->plan(ABS(numSteps), stepTimes);
+
+	std::vector<std::vector<GpioDevice::Pulse> > waveforms;
+	size_t maxPulses = MAX(3, m_gpio->getMaxWaveformPulses());
+	buildWaveforms(stepTimes, moveTime, numSteps < 0, maxPulses, waveforms);
+
+	// The device only queues one waveform behind the one playing so this returns before the last one starts
+	for (size_t iWave = 0; iWave < waveforms.size(); iWave++)
+	{
+		m_gpio->sendWaveform(waveforms[iWave]);
+	}
+
+	m_rotating = true;
+
+	return numSteps;
+}
+
+void WaveformTurnTable::waitForRotation()
+{
+	if (!m_rotating)
+	{
+		return;
+	}
+
+	m_gpio->waitForWaveform();
+	m_rotating = false;
+
+	if (m_stabilityDelayEnabled)
+	{
+		Thread::usleep(m_stabilityDelay);
+	}
+}
+
+void WaveformTurnTable::setMotorEnabled(bool enabled)
+{
+	int value = enabled ? LOW : HIGH;
+
+	m_gpio->waitForWaveform();
+	m_rotating = false;
+	m_gpio->write(m_enablePin, value);
+	Thread::usleep(MAX(m_responseDelay, m_stabilityDelay));
+}
+
+void WaveformTurnTable::setStabilityDelayEnabled(bool enabled)
+{
+	m_stabilityDelayEnabled = enabled;
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "TurnTable.h"
+#include "GpioDevice.h"
+
+namespace freelss
+{
+
+class MotionPlanner;
+
+/**
+ * Drives the A4988 motor driver with GPIO waveforms so the steps are timed by the
+ * hardware instead of by the scanning thread, which sleeps while the table turns.
+ */
+class WaveformTurnTable : public TurnTable
+{
+public:
+	WaveformTurnTable(GpioDevice * gpio);
+	~WaveformTurnTable();
+
+	/** Rotates this amount in radians, negative angles rotate backwards */
+	int rotate(real theta);
+
+	/** Queues the waveforms for the rotation and returns while the hardware plays them */
+	int startRotation(real theta);
+
+	/** Waits for the waveforms to finish playing and the stability delay */
+	void waitForRotation();
+
+	/** Enable/Disable the stepper motor */
+	void setMotorEnabled(bool enabled);
+
+	/** Sets whether rotate() waits the stability delay */
+	void setStabilityDelayEnabled(bool enabled);
+
+private:
+
+	/** Builds the pulses for the steps planned in stepTimes, splitting them into waveforms of at most maxPulses */
+	void buildWaveforms(const std::vector<long long>& stepTimes, long long moveTime, bool reverse,
+			            size_t maxPulses, std::vector<std::vector<GpioDevice::Pulse> >& waveforms) const;
+
+	/** Unowned GPIO device */
+	GpioDevice * m_gpio;
+
+	/** Schedules the steps of each move */
+	MotionPlanner * m_planner;
+
+	/** The time for the stepper driver to detect a voltage transition */
+	int m_responseDelay;
+
+	/** The enable pin */
+	int m_enablePin;
+
+	/** The step pin */
+	int m_stepPin;
+
+	/** The direction pin */
+	int m_directionPin;
+
+	/** The number of steps per revolution */
+	int m_stepsPerRevolution;
+
+	/** The time to sleep after rotating in microseconds */
+	int m_stabilityDelay;
+
+	/** Indicates if rotate() sleeps the stability delay */
+	bool m_stabilityDelayEnabled;
+
+	/** Indicates if a rotation was started that hasn't been waited for */
+	bool m_rotating;
+};
+
+}
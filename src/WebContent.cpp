@@ -24,6 +24,7 @@
 #include "Setup.h"
 #include "Laser.h"
 #include "Camera.h"
+#include "CameraCalibrator.h"
 #include "Progress.h"
 #include "PlyWriter.h"
 #include "Lighting.h"
@@ -36,6 +37,8 @@ namespace freelss
 // A warning is displayed if we have less than this amount of disk space available
 const int WebContent::LOW_DISK_SPACE_MB = 1000;
 
+const int WebContent::SCANS_PER_PAGE = 20;
+
 const std::string WebContent::CSS = "\
 <style type=\"text/css\">\
 .menu2 {\
@@ -200,6 +203,12 @@ const std::string WebContent::LASER_MAGNITUDE_THRESHOLD = "LASER_MAGNITUDE_THRES
 const std::string WebContent::LASER_ON_VALUE = "LASER_ON_VALUE";
 const std::string WebContent::LASER_SELECTION = "LASER_SELECTION";
 const std::string WebContent::STABILITY_DELAY = "STABILITY_DELAY";
+const std::string WebContent::ENABLE_SETTLE_DETECTION = "ENABLE_SETTLE_DETECTION";
+const std::string WebContent::SETTLE_THRESHOLD = "SETTLE_THRESHOLD";
+const std::string WebContent::CONTINUOUS_ROTATION = "CONTINUOUS_ROTATION";
+const std::string WebContent::CONTINUOUS_ROTATION_SPEED = "CONTINUOUS_ROTATION_SPEED";
+const std::string WebContent::DUAL_LASER_SINGLE_CAPTURE = "DUAL_LASER_SINGLE_CAPTURE";
+const std::string WebContent::BACKGROUND_INTERVAL = "BACKGROUND_INTERVAL";
 const std::string WebContent::MAX_LASER_WIDTH = "MAX_LASER_WIDTH";
 const std::string WebContent::MIN_LASER_WIDTH = "MIN_LASER_WIDTH";
 const std::string WebContent::STEPS_PER_REVOLUTION = "STEPS_PER_REVOLUTION";
@@ -209,6 +218,9 @@ const std::string WebContent::DIRECTION_PIN = "DIRECTION_PIN";
 const std::string WebContent::DIRECTION_VALUE = "DIRECTION_VALUE";
 const std::string WebContent::RESPONSE_DELAY = "RESPONSE_DELAY";
 const std::string WebContent::STEP_DELAY = "STEP_DELAY";
+const std::string WebContent::MOTOR_ACCELERATION = "MOTOR_ACCELERATION";
+const std::string WebContent::MOTOR_S_CURVE = "MOTOR_S_CURVE";
+const std::string WebContent::ENABLE_GPIO_WAVEFORMS = "ENABLE_GPIO_WAVEFORMS";
 const std::string WebContent::FRAMES_PER_REVOLUTION = "FRAMES_PER_REVOLUTION";
 const std::string WebContent::GENERATE_XYZ = "GENERATE_XYZ";
 const std::string WebContent::GENERATE_STL = "GENERATE_STL";
@@ -233,6 +245,7 @@ const std::string WebContent::AUTH_PASSWORD1 = "AUTH_PASSWORD1";
 const std::string WebContent::AUTH_PASSWORD2 = "AUTH_PASSWORD2";
 const std::string WebContent::NOISE_REMOVAL_SETTING = "NOISE_REMOVAL_SETTING";
 const std::string WebContent::IMAGE_THRESHOLD_MODE = "IMAGE_THRESHOLD_MODE";
+const std::string WebContent::PEAK_ESTIMATOR = "PEAK_ESTIMATOR";
 const std::string WebContent::CAMERA_EXPOSURE_TIME = "CAMERA_EXPOSURE_TIME";
 const std::string WebContent::ENABLE_USB_NETWORK_CONFIG = "ENABLE_USB_NETWORK_CONFIG";
 const std::string WebContent::MOUNT_SERVERPATH = "MOUNT_SERVERPATH";
@@ -255,7 +268,15 @@ const std::string WebContent::ENABLE_POINT_CLOUD_RENDERER = "ENABLE_POINT_CLOUD_
 const std::string WebContent::OVERRIDE_FOCAL_LENGTH = "OVERRIDE_FOCAL_LENGTH";
 const std::string WebContent::OVERRIDDEN_FOCAL_LENGTH = "OVERRIDDEN_FOCAL_LENGTH";
 const std::string WebContent::FLIP_RED_BLUE = "FLIP_RED_BLUE";
+const std::string WebContent::ENABLE_DEBUG_LOGGING = "ENABLE_DEBUG_LOGGING";
 const std::string WebContent::MAX_OBJECT_SIZE = "MAX_OBJECT_SIZE";
+const std::string WebContent::CHECKERBOARD_COLUMNS = "CHECKERBOARD_COLUMNS";
+const std::string WebContent::CHECKERBOARD_ROWS = "CHECKERBOARD_ROWS";
+const std::string WebContent::MOCK_OBJECT = "MOCK_OBJECT";
+const std::string WebContent::MOCK_OBJECT_SIZE = "MOCK_OBJECT_SIZE";
+const std::string WebContent::MOCK_OBJECT_OFFSET = "MOCK_OBJECT_OFFSET";
+const std::string WebContent::MOCK_NOISE = "MOCK_NOISE";
+const std::string WebContent::MOCK_AMBIENT_LIGHT = "MOCK_AMBIENT_LIGHT";
 
 const std::string WebContent::ID = "id";
 const std::string WebContent::MENU2 = "<div class=\"menu2\"><a href=\"/checkUpdate\"><small><small>Check for Update</small></small></a>&nbsp;&nbsp;&nbsp;&nbsp;<a href=\"/network\"><small><small>Network</small></small></a>&nbsp;&nbsp;&nbsp;&nbsp;<a href=\"/security\"><small><small>Security</small></small></a>&nbsp;&nbsp;&nbsp;&nbsp;<a href=\"/setup\"><small><small>Setup</small></small></a></div>";
@@ -278,12 +299,21 @@ const std::string WebContent::RIGHT_LASER_PIN_DESCR = "The wiringPi pin number f
 const std::string WebContent::LEFT_LASER_PIN_DESCR = "The wiringPi pin number for controlling the left laser";
 const std::string WebContent::LASER_ON_VALUE_DESCR = "Set to 1 if setting the laser pin HIGH turns if on and 0 if LOW turns it on";
 const std::string WebContent::STABILITY_DELAY_DESCR = "The time in microseconds to delay after moving the turntable and before taking a picture";
+const std::string WebContent::ENABLE_SETTLE_DETECTION_DESCR = "Takes each picture as soon as the video shows the scene has stopped moving instead of waiting the stability and laser delays, which become the longest it will wait.  Video camera modes only";
+const std::string WebContent::SETTLE_THRESHOLD_DESCR = "The percent of the image that can change between video frames when the scene is still";
+const std::string WebContent::CONTINUOUS_ROTATION_DESCR = "Turns the table without stopping and captures video frames as it turns.  The table turns once with the laser off to record the background and again with the laser on.  Only one laser is used and it requires a video camera mode";
+const std::string WebContent::CONTINUOUS_ROTATION_SPEED_DESCR = "How fast the table turns during a continuous rotation scan";
+const std::string WebContent::DUAL_LASER_SINGLE_CAPTURE_DESCR = "When scanning with both lasers, captures them together in one picture and tells them apart by which half of the image they are in";
+const std::string WebContent::BACKGROUND_INTERVAL_DESCR = "The number of frames between the pictures taken with the lasers off.  Frames in between use a background blended from the pictures before and after them.  1 takes one every frame";
 const std::string WebContent::MAX_LASER_WIDTH_DESCR = "Maximum laser width in pixels";
 const std::string WebContent::MIN_LASER_WIDTH_DESCR = "Minimum laser width in pixels";
 const std::string WebContent::STEPS_PER_REVOLUTION_DESCR = "The number of motor steps before the turntable spins 360 degrees";
 const std::string WebContent::ENABLE_PIN_DESCR = "The wiringPi pin number for enabling the stepper motor";
 const std::string WebContent::STEP_PIN_DESCR = "The wiringPi pin number for stepping the stepper motor";
 const std::string WebContent::STEP_DELAY_DESCR = "The amount of time between steps in microseconds";
+const std::string WebContent::MOTOR_ACCELERATION_DESCR = "How quickly the motor speeds up to the step delay in steps per second squared, or 0 to always step at full speed";
+const std::string WebContent::MOTOR_S_CURVE_DESCR = "Eases into and out of the acceleration to reduce vibration";
+const std::string WebContent::ENABLE_GPIO_WAVEFORMS_DESCR = "Times the motor steps and laser switching with DMA through pigpio instead of from the scanning thread";
 const std::string WebContent::DIRECTION_PIN_DESCR = "The wiringPi pin number for the stepper motor direction or rotation";
 const std::string WebContent::RESPONSE_DELAY_DESCR = "The time it takes for the stepper controller to recognize a pin value change in microseconds";
 const std::string WebContent::FRAMES_PER_REVOLUTION_DESCR = "The number of frames that should be taken for a scan. Default is 800.";
@@ -305,6 +335,7 @@ const std::string WebContent::AUTH_PASSWORD1_DESCR = "The password to login with
 const std::string WebContent::AUTH_PASSWORD2_DESCR = "Repeat the password";
 const std::string WebContent::NOISE_REMOVAL_SETTING_DESCR = "Controls how aggressively noise should be removed from the point cloud";
 const std::string WebContent::IMAGE_THRESHOLD_MODE_DESCR = "Controls how the laser line is detected in the image.<br>Static is the old method and the threshold must be given below.<br>The new adaptive mode is enabled by selecting low, medium, or high and does not require a threshold.";
+const std::string WebContent::PEAK_ESTIMATOR_DESCR = "Controls how the subpixel center of the laser line is computed.<br>Center of Mass works well for wide lines. Gaussian and Parabolic fit the brightest pixel and its neighbors.<br>Blais-Rioux finds where the derivative of the laser profile crosses zero.";
 const std::string WebContent::CAMERA_EXPOSURE_TIME_DESCR = "Controls how long the shutter stays open for each picture. Default is Auto";
 const std::string WebContent::ENABLE_USB_NETWORK_CONFIG_DESCR = "Enables the ability to configure the network via USB flash drives.";
 const std::string WebContent::MOUNT_PASSWORD_DESCR = "The user's password on the server.";
@@ -322,9 +353,17 @@ const std::string WebContent::ENABLE_POINT_CLOUD_RENDERER_DESCR = "Enables the 2
 const std::string WebContent::OVERRIDE_FOCAL_LENGTH_DESCR = "Overrides the camera's focal length with the value given below.";
 const std::string WebContent::OVERRIDDEN_FOCAL_LENGTH_DESCR = "The value override the camera's focal length with.  This is always in millimters.";
 const std::string WebContent::FLIP_RED_BLUE_DESCR = "Flips the red and blue channels in the image.";
+const std::string WebContent::ENABLE_DEBUG_LOGGING_DESCR = "Logs the details of every frame, which slows down scanning.";
 const std::string WebContent::MAX_OBJECT_SIZE_DESCR = "The maximum size object that can be scanned.";
-
-std::string WebContent::scan(const std::vector<ScanResult>& pastScans)
+const std::string WebContent::CHECKERBOARD_COLUMNS_DESCR = "The number of inner corners across the camera calibration checkerboard, one less than the number of squares.";
+const std::string WebContent::CHECKERBOARD_ROWS_DESCR = "The number of inner corners down the camera calibration checkerboard, one less than the number of squares.";
+const std::string WebContent::MOCK_OBJECT_DESCR = "The object the simulated camera sees: sphere, cylinder, cube or the path of an STL file.";
+const std::string WebContent::MOCK_OBJECT_SIZE_DESCR = "The diameter and height of the simulated sphere, cylinder or cube.";
+const std::string WebContent::MOCK_OBJECT_OFFSET_DESCR = "How far the simulated object is from the center of the turn table.";
+const std::string WebContent::MOCK_NOISE_DESCR = "The standard deviation of the noise added to each simulated pixel.";
+const std::string WebContent::MOCK_AMBIENT_LIGHT_DESCR = "The brightness of the simulated room light.";
+
+std::string WebContent::scan(const std::vector<ScanResult>& pastScans, size_t firstIndex, size_t numScans)
 {
 	const Preset& preset = PresetManager::get()->getActivePreset();
 	Setup * setup = Setup::get();
@@ -360,7 +399,28 @@ std::string WebContent::scan(const std::vector<ScanResult>& pastScans)
 
 	for (size_t iRt = 0; iRt < pastScans.size(); iRt++)
 	{
-		sstr << WebContent::scanResult(iRt + 1, pastScans[iRt], setup->enablePointCloudRenderer);
+		sstr << WebContent::scanResult(firstIndex + iRt + 1, pastScans[iRt], setup->enablePointCloudRenderer);
+	}
+
+	// Links to the newer and older scans
+	size_t lastIndex = firstIndex + pastScans.size();
+	if (!pastScans.empty() && (firstIndex > 0 || lastIndex < numScans))
+	{
+		size_t page = firstIndex / SCANS_PER_PAGE;
+
+		sstr << "<div>";
+		if (page > 0)
+		{
+			sstr << "<a href=\"/?page=" << (page - 1) << "\">&laquo; Newer</a>&nbsp;&nbsp;";
+		}
+
+		sstr << "<small>" << (firstIndex + 1) << " - " << lastIndex << " of " << numScans << "</small>";
+
+		if (lastIndex < numScans)
+		{
+			sstr << "&nbsp;&nbsp;<a href=\"/?page=" << (page + 1) << "\">Older &raquo;</a>";
+		}
+		sstr << "</div>";
 	}
 
 	sstr << "</body></html>";
@@ -427,14 +487,25 @@ std::string WebContent::scanResult(size_t index, const ScanResult& result, bool
 	thumbnail << "/dl/" << result.getScanDate() << ".png";
 	deleteUrl << "/del?id=" << result.getScanDate();
 
+	bool hasThumbnail = false;
+	const std::vector<ScanResultFile>& files = result.files;
+	for (size_t iFil = 0; iFil < files.size(); iFil++)
+	{
+		hasThumbnail |= files[iFil].extension == "png";
+	}
+
 	sstr << "<span>" << index << "\
 	<div class=\"result\">\
-	<div style=\"float: left\">\
-	<img width=\"128\" border=\"0\" src=\"" << thumbnail.str() << "\">\
-	</div>";
+	<div style=\"float: left; width: 128px\">";
+
+	if (hasThumbnail)
+	{
+		sstr << "<img width=\"128\" border=\"0\" src=\"" << thumbnail.str() << "\">";
+	}
+
+	sstr << "</div>";
 
 	bool hasPly = false;
-	const std::vector<ScanResultFile>& files = result.files;
 	for (size_t iFil = 0; iFil < files.size(); iFil++)
 	{
 		const ScanResultFile& file = files[iFil];
@@ -470,6 +541,11 @@ std::string WebContent::scanResult(size_t index, const ScanResult& result, bool
 		}
 	}
 
+	if (result.numPoints > 0 || result.numFaces > 0)
+	{
+		sstr << "<br><small>&nbsp;" << result.numPoints << " points, " << result.numFaces << " faces</small>";
+	}
+
 	sstr << "<br><br>\
 	<div id=\"deleteButton\"><form action=\"" << deleteUrl.str() << "#\" method=\"POST\">\
 	<input type=\"Submit\" value=\"Delete\">\
@@ -514,13 +590,38 @@ std::string WebContent::scanRunning(Progress& progress, real remainingTime, Scan
 
 	std::stringstream sstr;
 	sstr << "<!DOCTYPE html><html><head>"
-		 << "<meta http-equiv=\"refresh\" content=\"5\">"
+		 << "<noscript><meta http-equiv=\"refresh\" content=\"5\"></noscript>"
 		 << CSS
 		 << std::endl
 		 << JAVASCRIPT
 		 << std::endl
+		 << "<script type=\"text/javascript\">\n"
+		 << "var lastRender = new Date().getTime();\n"
+		 << "function pollProgress(version) {\n"
+		 << "  var xhr = new XMLHttpRequest();\n"
+		 << "  xhr.open('GET', '/progress?version=' + version, true);\n"
+		 << "  xhr.onload = function() {\n"
+		 << "    if (xhr.status != 200) { setTimeout(function() { location.reload(); }, 5000); return; }\n"
+		 << "    var p = JSON.parse(xhr.responseText);\n"
+		 << "    if (!p.running) { location.reload(); return; }\n"
+		 << "    var text = p.label + ' is ' + p.percent.toFixed(1) + '% complete';\n"
+		 << "    var minRemaining = p.details.remainingTime / 60.0;\n"
+		 << "    if (minRemaining > 0.01) { text += ' with ' + minRemaining.toFixed(1) + ' minutes remaining'; }\n"
+		 << "    document.getElementById('progressText').textContent = text + '.\\u00a0';\n"
+		 << "    document.getElementById('progressError').textContent = p.error;\n"
+		 << "    var img = document.getElementById('image');\n"
+		 << "    var now = new Date().getTime();\n"
+		 << "    if (img && now - lastRender >= 5000) { lastRender = now; img.src = img.src.replace(/renderImage_[0-9]+/, 'renderImage_' + now); }\n"
+		 << "    pollProgress(p.version);\n"
+		 << "  };\n"
+		 << "  xhr.onerror = function() { setTimeout(function() { pollProgress(version); }, 5000); };\n"
+		 << "  xhr.send();\n"
+		 << "}\n"
+		 << "window.onload = function() { pollProgress(0); };\n"
+		 << "</script>"
+		 << std::endl
 		 << "</head>"
-	     << "<body><p><div style=\"float: left\">"
+	     << "<body><p><div id=\"progressText\" style=\"float: left\">"
 	     << progress.getLabel()
 	     << " is "
 	     << progress.getPercent()
@@ -535,6 +636,8 @@ std::string WebContent::scanRunning(Progress& progress, real remainingTime, Scan
 
 	sstr << ".&nbsp;</div>";
 
+	sstr << "<div id=\"progressError\" style=\"clear: both; color: red\">" << progress.getError() << "</div>";
+
 	if (showPreview)
 	{
 		sstr << "<div style=\"padding-left: 50px\"><form action=\"/preview\" method=\"GET\" enctype=\"application/x-www-form-urlencoded\">"
@@ -744,6 +847,14 @@ std::string WebContent::cal1(const std::string& inMessage)
     <div class=\"cal1GenerateDebugDiv\">\
         <form action=\"/cal1\" method=\"POST\" enctype=\"application/x-www-form-urlencoded\"><input name=\"cmd\" value=\"calibrateLasers\" type=\"hidden\"><input class=\"controlSubmit\" value=\"Calibrate Lasers\" type=\"submit\"></form>\
         <div class=\"calDescr\">Line the front wall of the calibration item over the center of the turntable hole and click this button to calibrate the lasers.</div>\
+    </div>\
+    <div class=\"cal1GenerateDebugDiv\">\
+        <form action=\"/cal1\" method=\"POST\" enctype=\"application/x-www-form-urlencoded\"><input name=\"cmd\" value=\"captureCheckerboard\" type=\"hidden\"><input class=\"controlSubmit\" value=\"Capture Checkerboard\" type=\"submit\"></form>\
+        <div class=\"calDescr\">Hold the checkerboard in view and click this button. Tilt and move the checkerboard between captures.</div>\
+        <form action=\"/cal1\" method=\"POST\" enctype=\"application/x-www-form-urlencoded\"><input name=\"cmd\" value=\"calibrateCamera\" type=\"hidden\"><input class=\"controlSubmit\" value=\"Calibrate Camera\" type=\"submit\"></form>\
+        <div class=\"calDescr\">Calibrates the camera lens from the captured checkerboards. " << CameraCalibrator::get()->getNumViews() << " captured, "
+         << (setup->haveCameraIntrinsics ? "calibrated" : "not calibrated") << ".</div>\
+        <form action=\"/cal1\" method=\"POST\" enctype=\"application/x-www-form-urlencoded\"><input name=\"cmd\" value=\"clearCameraCalibration\" type=\"hidden\"><input class=\"controlSubmit\" value=\"Clear Camera Calibration\" type=\"submit\"></form>\
     </div>";
 
 	if (setup->enableLighting)
@@ -1138,6 +1249,9 @@ std::string WebContent::setup(const std::string& message)
 	sstr << setting(WebContent::ENABLE_PIN, "Motor Enable Pin", setup->motorEnablePin, ENABLE_PIN_DESCR);
 	sstr << setting(WebContent::STEP_PIN, "Motor Step Pin", setup->motorStepPin, STEP_PIN_DESCR);
 	sstr << setting(WebContent::STEP_DELAY, "Motor Step Delay", setup->motorStepDelay, STEP_DELAY_DESCR, "&mu;s");
+	sstr << setting(WebContent::MOTOR_ACCELERATION, "Motor Acceleration", setup->motorAcceleration, MOTOR_ACCELERATION_DESCR, "steps/s&sup2;");
+	sstr << checkbox(WebContent::MOTOR_S_CURVE, "S-Curve Acceleration", setup->motorSCurve, MOTOR_S_CURVE_DESCR);
+	sstr << checkbox(WebContent::ENABLE_GPIO_WAVEFORMS, "Hardware Timed GPIO", setup->enableGpioWaveforms, ENABLE_GPIO_WAVEFORMS_DESCR);
 	sstr << setting(WebContent::DIRECTION_PIN, "Motor Direction Pin", setup->motorDirPin, DIRECTION_PIN_DESCR);
 	sstr << setting(WebContent::RESPONSE_DELAY, "Motor Response Delay", setup->motorResponseDelay, RESPONSE_DELAY_DESCR, "&mu;s");
 	sstr << checkbox(WebContent::ENABLE_LIGHTING, "Enable Lighting", setup->enableLighting, ENABLE_LIGHTING_DESCR);
@@ -1170,8 +1284,20 @@ std::string WebContent::setup(const std::string& message)
 	sstr << checkbox(WebContent::ENABLE_POINT_CLOUD_RENDERER, "Enable Point Cloud Renderer", setup->enablePointCloudRenderer, ENABLE_POINT_CLOUD_RENDERER_DESCR);
 	sstr << checkbox(WebContent::OVERRIDE_FOCAL_LENGTH, "Override Focal Length", setup->overrideFocalLength, OVERRIDE_FOCAL_LENGTH_DESCR);
 	sstr << setting(WebContent::OVERRIDDEN_FOCAL_LENGTH, "Overridden Focal Length", setup->overriddenFocalLength, OVERRIDDEN_FOCAL_LENGTH_DESCR, "mm");
+	sstr << setting(WebContent::CHECKERBOARD_COLUMNS, "Checkerboard Columns", setup->checkerboardColumns, CHECKERBOARD_COLUMNS_DESCR);
+	sstr << setting(WebContent::CHECKERBOARD_ROWS, "Checkerboard Rows", setup->checkerboardRows, CHECKERBOARD_ROWS_DESCR);
 	sstr << checkbox(WebContent::ENABLE_EXPERIMENTAL, "Enable Experimental", setup->enableExperimental, ENABLE_EXPERIMENTAL_DESCR);
 	sstr << checkbox(WebContent::FLIP_RED_BLUE, "Swap Red and Blue", setup->mmalFlipRedBlue, FLIP_RED_BLUE_DESCR);
+	sstr << checkbox(WebContent::ENABLE_DEBUG_LOGGING, "Debug Logging", setup->enableDebugLogging, ENABLE_DEBUG_LOGGING_DESCR);
+
+	if (IsMockHardware())
+	{
+		sstr << setting(WebContent::MOCK_OBJECT, "Simulated Object", setup->mockObject, MOCK_OBJECT_DESCR);
+		sstr << setting(WebContent::MOCK_OBJECT_SIZE, "Simulated Object Size", ConvertUnitOfLength(setup->mockObjectSize, srcUnit, dstUnit), MOCK_OBJECT_SIZE_DESCR, ToString(dstUnit) + ".");
+		sstr << setting(WebContent::MOCK_OBJECT_OFFSET, "Simulated Object Offset", ConvertUnitOfLength(setup->mockObjectOffset, srcUnit, dstUnit), MOCK_OBJECT_OFFSET_DESCR, ToString(dstUnit) + ".");
+		sstr << setting(WebContent::MOCK_NOISE, "Simulated Noise", setup->mockNoise, MOCK_NOISE_DESCR);
+		sstr << setting(WebContent::MOCK_AMBIENT_LIGHT, "Simulated Ambient Light", setup->mockAmbientLight, MOCK_AMBIENT_LIGHT_DESCR, "%");
+	}
 
 
 	sstr << setting(WebContent::VERSION_NAME, "Firmware Version", FREELSS_VERSION_NAME, "The version of FreeLSS the scanner is running", "", true);
@@ -1345,10 +1471,34 @@ std::string WebContent::settings(const std::string& message)
 	sstr << "</select></div>";
 	sstr << "<div class=\"settingsDescr\">" << IMAGE_THRESHOLD_MODE_DESCR << "</div>\n";
 
+	//
+	// Peak Estimator
+	//
+	ImageProcessor::PeakEstimator peakEstimator = preset.peakEstimator;
+	std::string peComSel      = peakEstimator == ImageProcessor::PE_CENTER_OF_MASS ? " SELECTED" : "";
+	std::string peGaussianSel = peakEstimator == ImageProcessor::PE_GAUSSIAN ? " SELECTED" : "";
+	std::string peParabolaSel = peakEstimator == ImageProcessor::PE_PARABOLIC ? " SELECTED" : "";
+	std::string peBlaisSel    = peakEstimator == ImageProcessor::PE_BLAIS_RIOUX ? " SELECTED" : "";
+
+	sstr << "<div><div class=\"settingsText\">Laser Peak Estimator</div>";
+	sstr << "<select name=\"" << WebContent::PEAK_ESTIMATOR << "\">";
+	sstr << "<option value=\"" << (int)ImageProcessor::PE_CENTER_OF_MASS << "\"" << peComSel << ">Center of Mass</option>\r\n";
+	sstr << "<option value=\"" << (int)ImageProcessor::PE_GAUSSIAN << "\"" << peGaussianSel << ">Gaussian</option>\r\n";
+	sstr << "<option value=\"" << (int)ImageProcessor::PE_PARABOLIC << "\"" << peParabolaSel << ">Parabolic</option>\r\n";
+	sstr << "<option value=\"" << (int)ImageProcessor::PE_BLAIS_RIOUX << "\"" << peBlaisSel << ">Blais-Rioux</option>\r\n";
+	sstr << "</select></div>";
+	sstr << "<div class=\"settingsDescr\">" << PEAK_ESTIMATOR_DESCR << "</div>\n";
+
 
 	sstr << setting(WebContent::LASER_MAGNITUDE_THRESHOLD, "Laser Threshold", preset.laserThreshold, LASER_MAGNITUDE_THRESHOLD_DESCR);
 	sstr << setting(WebContent::GROUND_PLANE_HEIGHT, "Ground Plane Height", ConvertUnitOfLength(preset.groundPlaneHeight, srcUnit, dstUnit), GROUND_PLANE_HEIGHT_DESCR,  ToString(dstUnit) + ".", false);
 	sstr << setting(WebContent::STABILITY_DELAY, "Stability Delay", preset.stabilityDelay, STABILITY_DELAY_DESCR, "&mu;s");
+	sstr << checkbox(WebContent::ENABLE_SETTLE_DETECTION, "Settle Detection", preset.enableSettleDetection, ENABLE_SETTLE_DETECTION_DESCR);
+	sstr << setting(WebContent::SETTLE_THRESHOLD, "Settle Threshold", preset.settleThreshold, SETTLE_THRESHOLD_DESCR, "%");
+	sstr << checkbox(WebContent::CONTINUOUS_ROTATION, "Continuous Rotation", preset.continuousRotation, CONTINUOUS_ROTATION_DESCR);
+	sstr << setting(WebContent::CONTINUOUS_ROTATION_SPEED, "Continuous Rotation Speed", preset.continuousRotationSpeed, CONTINUOUS_ROTATION_SPEED_DESCR, "deg/s");
+	sstr << checkbox(WebContent::DUAL_LASER_SINGLE_CAPTURE, "Capture Both Lasers Together", preset.dualLaserSingleCapture, DUAL_LASER_SINGLE_CAPTURE_DESCR);
+	sstr << setting(WebContent::BACKGROUND_INTERVAL, "Background Interval", preset.backgroundInterval, BACKGROUND_INTERVAL_DESCR, "frames");
 	sstr << setting(WebContent::MAX_LASER_WIDTH, "Max Laser Width", preset.maxLaserWidth, MAX_LASER_WIDTH_DESCR, "px.");
 	sstr << setting(WebContent::MIN_LASER_WIDTH, "Min Laser Width", preset.minLaserWidth, MIN_LASER_WIDTH_DESCR, "px.");
 
@@ -39,7 +39,12 @@ public:
 		real rightLaserY; // In scaled image pixelss
 	};
 
-	static std::string scan(const std::vector<ScanResult>& pastScans);
+	/**
+	 * Shows the scan page with a page of the past scans.
+	 * @param firstIndex - The index of the first scan in pastScans among all of the scans.
+	 * @param numScans - The total number of scans.
+	 */
+	static std::string scan(const std::vector<ScanResult>& pastScans, size_t firstIndex, size_t numScans);
 	static std::string scanRunning(Progress& progress, real remainingTime, Scanner::Task task,
 			                       const std::string& url, bool showPointCloudRenderer,
 			                       const std::string& rotation, const std::string& pixelRadius);
@@ -75,6 +80,12 @@ public:
 	static const std::string LASER_ON_VALUE;
 	static const std::string LASER_SELECTION;
 	static const std::string STABILITY_DELAY;
+	static const std::string ENABLE_SETTLE_DETECTION;
+	static const std::string SETTLE_THRESHOLD;
+	static const std::string CONTINUOUS_ROTATION;
+	static const std::string CONTINUOUS_ROTATION_SPEED;
+	static const std::string DUAL_LASER_SINGLE_CAPTURE;
+	static const std::string BACKGROUND_INTERVAL;
 	static const std::string MAX_LASER_WIDTH;
 	static const std::string MIN_LASER_WIDTH;
 	static const std::string STEPS_PER_REVOLUTION;
@@ -84,6 +95,9 @@ public:
 	static const std::string DIRECTION_VALUE;
 	static const std::string RESPONSE_DELAY;
 	static const std::string STEP_DELAY;
+	static const std::string MOTOR_ACCELERATION;
+	static const std::string MOTOR_S_CURVE;
+	static const std::string ENABLE_GPIO_WAVEFORMS;
 	static const std::string FRAMES_PER_REVOLUTION;
 	static const std::string GENERATE_XYZ;
 	static const std::string GENERATE_STL;
@@ -111,6 +125,7 @@ public:
 	static const std::string AUTH_PASSWORD2;
 	static const std::string NOISE_REMOVAL_SETTING;
 	static const std::string IMAGE_THRESHOLD_MODE;
+	static const std::string PEAK_ESTIMATOR;
 	static const std::string CAMERA_EXPOSURE_TIME;
 	static const std::string ENABLE_USB_NETWORK_CONFIG;
 	static const std::string MOUNT_SERVERPATH;
@@ -134,7 +149,18 @@ public:
 	static const std::string OVERRIDE_FOCAL_LENGTH;
 	static const std::string OVERRIDDEN_FOCAL_LENGTH;
 	static const std::string FLIP_RED_BLUE;
+	static const std::string ENABLE_DEBUG_LOGGING;
 	static const std::string MAX_OBJECT_SIZE;
+	static const std::string CHECKERBOARD_COLUMNS;
+	static const std::string CHECKERBOARD_ROWS;
+	static const std::string MOCK_OBJECT;
+	static const std::string MOCK_OBJECT_SIZE;
+	static const std::string MOCK_OBJECT_OFFSET;
+	static const std::string MOCK_NOISE;
+	static const std::string MOCK_AMBIENT_LIGHT;
+
+	/** The number of past scans shown on each page of the scan page */
+	static const int SCANS_PER_PAGE;
 
 private:
 	static std::string setting(const std::string& name, const std::string& label,
@@ -175,12 +201,21 @@ private:
 	static const std::string LEFT_LASER_PIN_DESCR;
 	static const std::string LASER_ON_VALUE_DESCR;
 	static const std::string STABILITY_DELAY_DESCR;
+	static const std::string ENABLE_SETTLE_DETECTION_DESCR;
+	static const std::string SETTLE_THRESHOLD_DESCR;
+	static const std::string CONTINUOUS_ROTATION_DESCR;
+	static const std::string CONTINUOUS_ROTATION_SPEED_DESCR;
+	static const std::string DUAL_LASER_SINGLE_CAPTURE_DESCR;
+	static const std::string BACKGROUND_INTERVAL_DESCR;
 	static const std::string MAX_LASER_WIDTH_DESCR;
 	static const std::string MIN_LASER_WIDTH_DESCR;
 	static const std::string STEPS_PER_REVOLUTION_DESCR;
 	static const std::string ENABLE_PIN_DESCR;
 	static const std::string STEP_PIN_DESCR;
 	static const std::string STEP_DELAY_DESCR;
+	static const std::string MOTOR_ACCELERATION_DESCR;
+	static const std::string MOTOR_S_CURVE_DESCR;
+	static const std::string ENABLE_GPIO_WAVEFORMS_DESCR;
 	static const std::string DIRECTION_PIN_DESCR;
 	static const std::string RESPONSE_DELAY_DESCR;
 	static const std::string FRAMES_PER_REVOLUTION_DESCR;
@@ -202,6 +237,7 @@ private:
 	static const std::string AUTH_PASSWORD2_DESCR;
 	static const std::string NOISE_REMOVAL_SETTING_DESCR;
 	static const std::string IMAGE_THRESHOLD_MODE_DESCR;
+	static const std::string PEAK_ESTIMATOR_DESCR;
 	static const std::string CAMERA_EXPOSURE_TIME_DESCR;
 	static const std::string ENABLE_USB_NETWORK_CONFIG_DESCR;
 	static const std::string MOUNT_PASSWORD_DESCR;
@@ -219,7 +255,15 @@ private:
 	static const std::string OVERRIDE_FOCAL_LENGTH_DESCR;
 	static const std::string OVERRIDDEN_FOCAL_LENGTH_DESCR;
 	static const std::string FLIP_RED_BLUE_DESCR;
+	static const std::string ENABLE_DEBUG_LOGGING_DESCR;
 	static const std::string MAX_OBJECT_SIZE_DESCR;
+	static const std::string CHECKERBOARD_COLUMNS_DESCR;
+	static const std::string CHECKERBOARD_ROWS_DESCR;
+	static const std::string MOCK_OBJECT_DESCR;
+	static const std::string MOCK_OBJECT_SIZE_DESCR;
+	static const std::string MOCK_OBJECT_OFFSET_DESCR;
+	static const std::string MOCK_NOISE_DESCR;
+	static const std::string MOCK_AMBIENT_LIGHT_DESCR;
 };
 
 }
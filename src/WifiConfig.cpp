@@ -113,6 +113,7 @@ std::string WifiConfig::parseInterface(const std::string& line)
 
 int WifiConfig::enumerateDevices(int sk, char *ifname, char *args[], int count)
 {
+#ifndef MOCK
 	std::set<std::string> * interfaces = reinterpret_cast<std::set<std::string>*>(args);
 	if (ifname != NULL && interfaces != NULL)
 	{
@@ -127,6 +128,7 @@ int WifiConfig::enumerateDevices(int sk, char *ifname, char *args[], int count)
 			InfoLog << ifname << " is not a wireless interface" << Logger::ENDL;
 		}
 	}
+#endif
 
 	return 1;
 }
@@ -163,6 +165,10 @@ void WifiConfig::scan()
 	fin.close();
 #endif
 
+#ifdef MOCK
+	// There is no iwlib to scan with in the simulated build
+	InfoLog << "Wireless scanning is not available in the simulated build" << Logger::ENDL;
+#else
 	//
 	// Read from /sys/class/net
 	//
@@ -225,6 +231,7 @@ void WifiConfig::scan()
 	}
 
 	iw_sockets_close(sk);
+#endif
 }
 
 std::vector<std::string> WifiConfig::getInterfaces(const std::string& filename)
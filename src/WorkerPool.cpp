@@ -0,0 +1,171 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#include "Main.h"
+#include "WorkerPool.h"
+#include "Logger.h"
+
+namespace freelss
+{
+
+WorkerTask::~WorkerTask()
+{
+	// Do nothing
+}
+
+WorkerPool::WorkerPool(int numThreads) :
+	m_tasks(),
+	m_workers(),
+	m_numThreads(MAX(1, numThreads)),
+	m_stopping(false)
+{
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_cond, NULL);
+}
+
+WorkerPool::~WorkerPool()
+{
+	pthread_mutex_lock(&m_mutex);
+	m_stopping = true;
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+
+	for (size_t iWorker = 0; iWorker < m_workers.size(); iWorker++)
+	{
+		try
+		{
+			m_workers[iWorker]->join();
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << ex << Logger::ENDL;
+		}
+
+		delete m_workers[iWorker];
+	}
+
+	// Only reached with tasks left if the threads never started
+	for (std::list<WorkerTask *>::iterator it = m_tasks.begin(); it != m_tasks.end(); ++it)
+	{
+		delete * it;
+	}
+
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+}
+
+void WorkerPool::submit(WorkerTask * task)
+{
+	pthread_mutex_lock(&m_mutex);
+
+	try
+	{
+		startWorkers();
+	}
+	catch (...)
+	{
+		pthread_mutex_unlock(&m_mutex);
+		delete task;
+		throw;
+	}
+
+	m_tasks.push_back(task);
+
+	pthread_cond_signal(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void WorkerPool::startWorkers()
+{
+	while ((int)m_workers.size() < m_numThreads)
+	{
+		Worker * worker = new Worker(this);
+
+		try
+		{
+			worker->execute();
+		}
+		catch (...)
+		{
+			delete worker;
+
+			// Keep going with the threads we have
+			if (!m_workers.empty())
+			{
+				break;
+			}
+
+			throw;
+		}
+
+		m_workers.push_back(worker);
+	}
+}
+
+WorkerTask * WorkerPool::next()
+{
+	pthread_mutex_lock(&m_mutex);
+
+	while (m_tasks.empty() && !m_stopping)
+	{
+		pthread_cond_wait(&m_cond, &m_mutex);
+	}
+
+	WorkerTask * task = NULL;
+	if (!m_tasks.empty())
+	{
+		task = m_tasks.front();
+		m_tasks.pop_front();
+	}
+
+	pthread_mutex_unlock(&m_mutex);
+
+	return task;
+}
+
+WorkerPool::Worker::Worker(WorkerPool * pool) :
+	m_pool(pool)
+{
+	// Do nothing
+}
+
+void WorkerPool::Worker::run()
+{
+	WorkerTask * task;
+	while ((task = m_pool->next()) != NULL)
+	{
+		try
+		{
+			task->run();
+		}
+		catch (Exception& ex)
+		{
+			ErrorLog << "Worker task failed: " << ex << Logger::ENDL;
+		}
+		catch (...)
+		{
+			ErrorLog << "Worker task failed with an unknown error" << Logger::ENDL;
+		}
+
+		delete task;
+	}
+}
+
+}
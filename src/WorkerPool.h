@@ -0,0 +1,86 @@
+/*
+ ****************************************************************************
+ *  Copyright (c) 2014 Uriah Liggett <freelaserscanner@gmail.com>           *
+ *	This file is part of FreeLSS.                                           *
+ *                                                                          *
+ *  FreeLSS is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by    *
+ *  the Free Software Foundation, either version 3 of the License, or       *
+ *  (at your option) any later version.                                     *
+ *                                                                          *
+ *  FreeLSS is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *  GNU General Public License for more details.                            *
+ *                                                                          *
+ *   You should have received a copy of the GNU General Public License      *
+ *   along with FreeLSS.  If not, see <http://www.gnu.org/licenses/>.       *
+ ****************************************************************************
+*/
+
+#pragma once
+
+#include "Thread.h"
+
+namespace freelss
+{
+
+/** A unit of work that is run by a WorkerPool */
+class WorkerTask
+{
+public:
+	virtual ~WorkerTask();
+
+	/** Performs the work.  This is called on one of the pool's threads. */
+	virtual void run() = 0;
+};
+
+/**
+ * Runs tasks on a fixed set of threads so that long operations don't tie up the
+ * thread that submitted them.  The threads are started the first time a task is
+ * submitted.  Tasks still in the queue are run before the pool is destroyed.
+ */
+class WorkerPool
+{
+public:
+	WorkerPool(int numThreads = DEFAULT_NUM_THREADS);
+
+	/** Runs the remaining tasks and stops the threads */
+	~WorkerPool();
+
+	/** Queues the task to be run.  The pool takes ownership of the task and deletes it once it has run. */
+	void submit(WorkerTask * task);
+
+	/** The default number of threads in the pool */
+	static const int DEFAULT_NUM_THREADS = 2;
+
+private:
+
+	class Worker : public Thread
+	{
+	public:
+		Worker(WorkerPool * pool);
+		void run();
+
+	private:
+		WorkerPool * m_pool;
+	};
+
+	/** Blocks until a task is available.  Returns NULL when the pool is stopping and the queue is empty. */
+	WorkerTask * next();
+
+	/** Starts the worker threads if they aren't already running */
+	void startWorkers();
+
+	WorkerPool(const WorkerPool& ) { /* NO COPYING */ }
+	WorkerPool& operator = (const WorkerPool& ) { return * this; /* NO ASSIGNMENT */ }
+
+	pthread_mutex_t m_mutex;
+	pthread_cond_t m_cond;
+	std::list<WorkerTask *> m_tasks;
+	std::vector<Worker *> m_workers;
+	int m_numThreads;
+	bool m_stopping;
+};
+
+}
@@ -22,11 +22,15 @@
 #include "XyzWriter.h"
 #include "Camera.h"
 #include "Progress.h"
+#include "IWriter.h"
+#include "FloatFormatter.h"
+
+#define XYZ_BUFFER_SIZE (256 * 1024)
 
 namespace freelss
 {
 
-void XyzWriter::write(const std::string& baseFilename, const std::vector<DataPoint>& results, Progress& progress)
+void XyzWriter::write(IWriter& writer, const std::vector<DataPoint>& results, Progress& progress)
 {
 	// Sanity check
 	if (results.empty())
@@ -37,14 +41,11 @@ void XyzWriter::write(const std::string& baseFilename, const std::vector<DataPoi
 	progress.setLabel("Generating XYZ file");
 	progress.setPercent(0);
 
-	std::string xyzFilename = baseFilename + ".xyz";
-	std::ofstream xyz (xyzFilename.c_str());
-	if (!xyz.is_open())
-	{
-		throw Exception("Error opening STL file for writing: " + xyzFilename);
-	}
-
-	xyz << std::fixed;
+	// Format the lines into a large buffer and hand it to the writer in blocks
+	std::vector<char> buffer(XYZ_BUFFER_SIZE);
+	const size_t maxLineLength = 6 * (FloatFormatter::MAX_FIXED_LENGTH + 1);
+	char * start = &buffer[0];
+	char * out = start;
 
 	real percent = 0;
 	for (size_t iRec = 0; iRec < results.size(); iRec++)
@@ -59,16 +60,27 @@ void XyzWriter::write(const std::string& baseFilename, const std::vector<DataPoi
 		const DataPoint& rec = results[iRec];
 		const ColoredPoint & pt = rec.point;
 
-		xyz << std::setprecision(2) << pt.x << " "
-			<< std::setprecision(2) << pt.y << " "
-			<< std::setprecision(2) << pt.z << " "
-			<< std::setprecision(2) << pt.normal.x << " "
-			<< std::setprecision(2) << pt.normal.y << " "
-			<< std::setprecision(2) << pt.normal.z
-			<< std::endl;
+		if ((size_t)(out - start) + maxLineLength > buffer.size())
+		{
+			writer.write(start, out - start);
+			out = start;
+		}
+
+		out += FloatFormatter::formatFixed(out, pt.x, 2);
+		* out++ = ' ';
+		out += FloatFormatter::formatFixed(out, pt.y, 2);
+		* out++ = ' ';
+		out += FloatFormatter::formatFixed(out, pt.z, 2);
+		* out++ = ' ';
+		out += FloatFormatter::formatFixed(out, pt.normal.x, 2);
+		* out++ = ' ';
+		out += FloatFormatter::formatFixed(out, pt.normal.y, 2);
+		* out++ = ' ';
+		out += FloatFormatter::formatFixed(out, pt.normal.z, 2);
+		* out++ = '\n';
 	}
 
-	xyz.close();
+	writer.write(start, out - start);
 }
 
 
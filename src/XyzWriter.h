@@ -24,6 +24,7 @@ namespace freelss
 {
 
 class Progress;
+struct IWriter;
 
 /**
  * Writes the scan results as an XYZ file.
@@ -32,7 +33,7 @@ class XyzWriter
 {
 public:
 
-	void write(const std::string& filename, const std::vector<DataPoint>& results, Progress& progress);
+	void write(IWriter& writer, const std::vector<DataPoint>& results, Progress& progress);
 };
 
 }